@@ -25,6 +25,7 @@ set( PREPROCESSOR_DEFINES ARRAY_BOUNDS_CHECK
                           TOTALVIEW_OUTPUT
                           TRILINOS
                           VTK
+                          WAVE_SOLVER_DOUBLE_PRECISION_GEOMETRY
                           ${externalComponentsList} )
 
 foreach( DEP in ${PREPROCESSOR_DEFINES} )
@@ -39,6 +39,8 @@ option( ENABLE_VTK "Enables VTK" ON )
 
 option( ENABLE_TOTALVIEW_OUTPUT "Enables Totalview custom view" OFF )
 
+option( ENABLE_WAVE_SOLVER_DOUBLE_PRECISION_GEOMETRY "Evaluates the geometric factors of the wave solver kernels in double precision (OFF to use single precision)" ON )
+
 option( ENABLE_SUPERLU_DIST "Enables SUPERLU_DIST" ON )
 option( ENABLE_TRILINOS "Enables TRILINOS" ON )
 option( ENABLE_HYPRE "Enables HYPRE" ON )
@@ -30,6 +30,18 @@
 namespace geos
 {
 
+namespace
+{
+
+/// Intra-node communicator, lazily created by MpiWrapper::nodeComm()
+MPI_Comm & nodeCommInstance()
+{
+  static MPI_Comm comm = MPI_COMM_NULL;
+  return comm;
+}
+
+}
+
 void MpiWrapper::barrier( MPI_Comm const & MPI_PARAM( comm ) )
 {
 #ifdef GEOSX_USE_MPI
@@ -126,6 +138,10 @@ int MpiWrapper::init( int * argc, char * * * argv )
 void MpiWrapper::finalize()
 {
 #ifdef GEOSX_USE_MPI
+  if( nodeCommInstance() != MPI_COMM_NULL )
+  {
+    commFree( nodeCommInstance() );
+  }
   MPI_CHECK_ERROR( MPI_Finalize() );
 #endif
 }
@@ -431,6 +447,20 @@ int MpiWrapper::nodeCommSize()
   MPI_Comm_size( nodeComm, &nodeCommSize );
   return nodeCommSize;
 }
+
+MPI_Comm MpiWrapper::nodeComm()
+{
+#ifdef GEOSX_USE_MPI
+  MPI_Comm & comm = nodeCommInstance();
+  if( comm == MPI_COMM_NULL )
+  {
+    MPI_CHECK_ERROR( MPI_Comm_split_type( MPI_COMM_GEOSX, MPI_COMM_TYPE_SHARED, commRank(), MPI_INFO_NULL, &comm ) );
+  }
+  return comm;
+#else
+  return MPI_COMM_SELF;
+#endif
+}
 } /* namespace geos */
 
 #if defined(__clang__)
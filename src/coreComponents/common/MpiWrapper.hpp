@@ -291,6 +291,14 @@ public:
    */
   static int nodeCommSize();
 
+  /**
+   * @brief Get the communicator grouping the ranks that can share memory with the current one.
+   * @return The intra-node communicator.
+   * @note The communicator is created on the first call, which is thus collective over MPI_COMM_GEOSX.
+   *       It is freed in finalize().
+   */
+  static MPI_Comm nodeComm();
+
   /**
    * @brief Strongly typed wrapper around MPI_Allgather.
    * @tparam T_SEND The pointer type for \p sendbuf
@@ -355,6 +363,19 @@ public:
   template< typename T >
   static int allReduce( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Iallreduce.
+   * @param[in] sendbuf The pointer to the sending buffer.
+   * @param[out] recvbuf The pointer to the receive buffer, valid only after the request completes.
+   * @param[in] count The number of values to send/receive.
+   * @param[in] op The MPI_Op to perform.
+   * @param[in] comm The MPI_Comm over which the gather operates.
+   * @param[out] request Pointer to the MPI_Request associated with this request.
+   * @return The return value of the underlying call to MPI_Iallreduce().
+   */
+  template< typename T >
+  static int iAllReduce( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm, MPI_Request * request );
+
 
   template< typename T >
   static int scan( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm );
@@ -738,6 +759,26 @@ int MpiWrapper::allReduce( T const * const sendbuf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::iAllReduce( T const * const sendbuf,
+                            T * const recvbuf,
+                            int const count,
+                            MPI_Op const MPI_PARAM( op ),
+                            MPI_Comm const MPI_PARAM( comm ),
+                            MPI_Request * const MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_Datatype const mpiType = internal::getMpiType< T >();
+  return MPI_Iallreduce( sendbuf == recvbuf ? MPI_IN_PLACE : sendbuf, recvbuf, count, mpiType, op, comm, request );
+#else
+  if( sendbuf != recvbuf )
+  {
+    memcpy( recvbuf, sendbuf, count * sizeof( T ) );
+  }
+  return 0;
+#endif
+}
+
 template< typename T >
 int MpiWrapper::scan( T const * const sendbuf,
                       T * const recvbuf,
@@ -0,0 +1,84 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file NodeSharedArray.cpp
+ */
+
+#include "NodeSharedArray.hpp"
+
+namespace geos
+{
+
+NodeSharedBuffer::~NodeSharedBuffer()
+{
+  free();
+}
+
+void NodeSharedBuffer::allocate( std::size_t const numBytes )
+{
+  free();
+
+#ifdef GEOSX_USE_MPI
+  // the whole buffer is owned by the node leader, the other ranks contribute no memory
+  MPI_Comm const comm = MpiWrapper::nodeComm();
+  MPI_Aint const localBytes = isNodeLeader() ? static_cast< MPI_Aint >( numBytes ) : 0;
+  void * localData = nullptr;
+  MPI_CHECK_ERROR( MPI_Win_allocate_shared( localBytes, 1, MPI_INFO_NULL, comm, &localData, &m_window ) );
+
+  MPI_Aint leaderBytes = 0;
+  int dispUnit = 1;
+  MPI_CHECK_ERROR( MPI_Win_shared_query( m_window, 0, &leaderBytes, &dispUnit, &m_data ) );
+  GEOS_ERROR_IF_LT( static_cast< std::size_t >( leaderBytes ), numBytes );
+#else
+  m_storage.resize( numBytes );
+  m_data = m_storage.data();
+#endif
+
+  m_numBytes = numBytes;
+}
+
+void NodeSharedBuffer::free()
+{
+#ifdef GEOSX_USE_MPI
+  if( m_window != MPI_WIN_NULL )
+  {
+    MPI_CHECK_ERROR( MPI_Win_free( &m_window ) );
+  }
+#else
+  m_storage.clear();
+  m_storage.shrink_to_fit();
+#endif
+  m_data = nullptr;
+  m_numBytes = 0;
+}
+
+void NodeSharedBuffer::synchronize() const
+{
+#ifdef GEOSX_USE_MPI
+  if( m_window != MPI_WIN_NULL )
+  {
+    // a fence orders the stores of the leader before the loads of the other ranks of the node
+    MPI_CHECK_ERROR( MPI_Win_fence( 0, m_window ) );
+  }
+#endif
+}
+
+bool NodeSharedBuffer::isNodeLeader()
+{
+  return MpiWrapper::commRank( MpiWrapper::nodeComm() ) == 0;
+}
+
+} // namespace geos
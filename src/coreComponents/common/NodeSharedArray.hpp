@@ -0,0 +1,180 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file NodeSharedArray.hpp
+ */
+
+#ifndef GEOS_COMMON_NODESHAREDARRAY_HPP_
+#define GEOS_COMMON_NODESHAREDARRAY_HPP_
+
+#include "common/MpiWrapper.hpp"
+
+#include <type_traits>
+#include <vector>
+
+namespace geos
+{
+
+/**
+ * @class NodeSharedBuffer
+ * @brief Untyped read-only buffer allocated once per node and shared by all the ranks of the node.
+ *
+ * With MPI, the buffer is allocated in an MPI-3 shared memory window, owned by the
+ * first rank of the node (the node leader); the other ranks of the node only map it.
+ * Without MPI, the buffer is a regular allocation.
+ * All the member functions except data() and numBytes() are collective over MpiWrapper::nodeComm().
+ */
+class NodeSharedBuffer
+{
+public:
+
+  /// Default constructor
+  NodeSharedBuffer() = default;
+
+  /// Deleted copy constructor
+  NodeSharedBuffer( NodeSharedBuffer const & ) = delete;
+
+  /// Deleted copy assignment operator
+  NodeSharedBuffer & operator=( NodeSharedBuffer const & ) = delete;
+
+  /// Destructor, releases the buffer
+  ~NodeSharedBuffer();
+
+  /**
+   * @brief Allocate the buffer, releasing any previous allocation.
+   * @param[in] numBytes the size of the buffer in bytes
+   */
+  void allocate( std::size_t const numBytes );
+
+  /**
+   * @brief Release the buffer.
+   */
+  void free();
+
+  /**
+   * @brief Make the writes of the node leader visible to all the ranks of the node.
+   */
+  void synchronize() const;
+
+  /**
+   * @return true if the current rank owns the buffer and is in charge of filling it
+   */
+  static bool isNodeLeader();
+
+  /**
+   * @return a pointer to the beginning of the buffer
+   */
+  void * data() const
+  { return m_data; }
+
+  /**
+   * @return the size of the buffer in bytes
+   */
+  std::size_t numBytes() const
+  { return m_numBytes; }
+
+private:
+
+  /// Pointer to the beginning of the buffer
+  void * m_data = nullptr;
+
+  /// Size of the buffer in bytes
+  std::size_t m_numBytes = 0;
+
+#ifdef GEOSX_USE_MPI
+  /// Shared memory window holding the buffer
+  MPI_Win m_window = MPI_WIN_NULL;
+#else
+  /// Storage of the buffer when running without MPI
+  std::vector< char > m_storage;
+#endif
+};
+
+/**
+ * @class NodeSharedArray
+ * @brief One-dimensional read-only array stored once per node.
+ * @tparam T the type of the values (must be trivially copyable)
+ *
+ * The array is filled by the node leader only, after which it is seen by all the ranks of the node.
+ * This is intended for large tables that are identical on all the ranks, such that the
+ * memory footprint (and the I/O needed to read them) does not grow with the number of ranks per node.
+ *
+ * @note The data lives in host memory and is not moved to the device.
+ */
+template< typename T >
+class NodeSharedArray
+{
+  static_assert( std::is_trivially_copyable< T >::value, "NodeSharedArray only supports trivially copyable types" );
+
+public:
+
+  /**
+   * @brief Allocate the array and fill it on the node leader (collective over the node).
+   * @tparam FUNC the type of the function filling the array
+   * @param[in] size the number of values
+   * @param[in] fill function called on the node leader only with a pointer to the (uninitialized) values
+   */
+  template< typename FUNC >
+  void allocateAndFill( localIndex const size, FUNC && fill )
+  {
+    m_buffer.allocate( size * sizeof( T ) );
+    m_size = size;
+    if( NodeSharedBuffer::isNodeLeader() )
+    {
+      fill( static_cast< T * >( m_buffer.data() ) );
+    }
+    m_buffer.synchronize();
+  }
+
+  /**
+   * @brief Release the array (collective over the node).
+   */
+  void free()
+  {
+    m_buffer.free();
+    m_size = 0;
+  }
+
+  /**
+   * @return a pointer to the values
+   */
+  T const * data() const
+  { return static_cast< T const * >( m_buffer.data() ); }
+
+  /**
+   * @return the number of values
+   */
+  localIndex size() const
+  { return m_size; }
+
+  /**
+   * @return true if the array has no values
+   */
+  bool empty() const
+  { return m_size == 0; }
+
+private:
+
+  /// The underlying shared buffer
+  NodeSharedBuffer m_buffer;
+
+  /// The number of values
+  localIndex m_size = 0;
+};
+
+} // namespace geos
+
+#endif //GEOS_COMMON_NODESHAREDARRAY_HPP_
@@ -0,0 +1,98 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+// Source includes
+#include "common/NodeSharedArray.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geos;
+
+TEST( NodeSharedArrayTest, fillOnLeaderAndReadEverywhere )
+{
+  localIndex const size = 1000;
+
+  NodeSharedArray< real64 > array;
+  EXPECT_TRUE( array.empty() );
+
+  integer numFillCalls = 0;
+  array.allocateAndFill( size, [&]( real64 * const values )
+  {
+    ++numFillCalls;
+    for( localIndex i = 0; i < size; ++i )
+    {
+      values[i] = 0.5 * i;
+    }
+  } );
+
+  // only one rank per node fills the array
+  EXPECT_EQ( numFillCalls, NodeSharedBuffer::isNodeLeader() ? 1 : 0 );
+  EXPECT_EQ( MpiWrapper::sum( numFillCalls, MpiWrapper::nodeComm() ), 1 );
+
+  // but all the ranks see the values
+  ASSERT_EQ( array.size(), size );
+  for( localIndex i = 0; i < size; ++i )
+  {
+    EXPECT_EQ( array.data()[i], 0.5 * i );
+  }
+
+  array.free();
+  EXPECT_TRUE( array.empty() );
+  EXPECT_EQ( array.data(), nullptr );
+}
+
+TEST( NodeSharedArrayTest, sharedBetweenRanksOfNode )
+{
+  // the parallel run is launched on a single node, so all the ranks share the same window
+  EXPECT_EQ( MpiWrapper::nodeCommSize(), MpiWrapper::commSize() );
+  EXPECT_EQ( MpiWrapper::sum( NodeSharedBuffer::isNodeLeader() ? 1 : 0, MpiWrapper::nodeComm() ), 1 );
+
+  // each rank only fills the values it owns, and reads the values of all the others through the shared window
+  int const rank = MpiWrapper::commRank( MpiWrapper::nodeComm() );
+  int const numRanks = MpiWrapper::nodeCommSize();
+  NodeSharedBuffer buffer;
+  buffer.allocate( numRanks * sizeof( integer ) );
+  integer * const values = static_cast< integer * >( buffer.data() );
+  values[rank] = 10 * rank + 1;
+  buffer.synchronize();
+  for( int r = 0; r < numRanks; ++r )
+  {
+    EXPECT_EQ( values[r], 10 * r + 1 );
+  }
+  buffer.free();
+}
+
+TEST( NodeSharedArrayTest, reallocate )
+{
+  NodeSharedArray< integer > array;
+  array.allocateAndFill( 10, []( integer * const values ) { std::fill( values, values + 10, 1 ); } );
+  array.allocateAndFill( 20, []( integer * const values ) { std::fill( values, values + 20, 2 ); } );
+
+  ASSERT_EQ( array.size(), 20 );
+  for( localIndex i = 0; i < array.size(); ++i )
+  {
+    EXPECT_EQ( array.data()[i], 2 );
+  }
+}
+
+int main( int ac, char * av[] )
+{
+  ::testing::InitGoogleTest( &ac, av );
+  MpiWrapper::init( &ac, &av );
+  int const result = RUN_ALL_TESTS();
+  MpiWrapper::finalize();
+  return result;
+}
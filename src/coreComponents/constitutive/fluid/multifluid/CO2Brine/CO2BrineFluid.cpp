@@ -94,6 +94,13 @@ CO2BrineFluid( string const & name, Group * const parent ):
     setRestartFlags( RestartFlags::NO_WRITE ).
     setDescription( "Name of the file defining the parameters of the flash model" );
 
+  registerWrapper( viewKeyStruct::pvtTableCacheDirectoryString(), &m_pvtTableCacheDirectory ).
+    setApplyDefaultValue( "" ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Directory in which the tabulated PVT properties are stored after being computed, and from which they are read "
+                    "back in subsequent runs using the same parameters. If empty, the tables are recomputed in every run" );
+
   // if this is a thermal model, we need to make sure that the arrays will be properly displayed and saved to restart
   if( isThermal() )
   {
@@ -311,8 +318,10 @@ void CO2BrineFluid< PHASE1, PHASE2, FLASH >::createPVTModels()
                  InputError );
 
   // then, we are ready to instantiate the phase models
-  m_phase1 = std::make_unique< PHASE1 >( getName() + "_phaseModel1", phase1InputParams, m_componentNames, m_componentMolarWeight );
-  m_phase2 = std::make_unique< PHASE2 >( getName() + "_phaseModel2", phase2InputParams, m_componentNames, m_componentMolarWeight );
+  m_phase1 = std::make_unique< PHASE1 >( getName() + "_phaseModel1", phase1InputParams, m_componentNames, m_componentMolarWeight,
+                                         m_pvtTableCacheDirectory );
+  m_phase2 = std::make_unique< PHASE2 >( getName() + "_phaseModel2", phase2InputParams, m_componentNames, m_componentMolarWeight,
+                                         m_pvtTableCacheDirectory );
 
   // 2) Create the flash model
   {
@@ -336,7 +345,8 @@ void CO2BrineFluid< PHASE1, PHASE2, FLASH >::createPVTModels()
                                                  strs,
                                                  m_phaseNames,
                                                  m_componentNames,
-                                                 m_componentMolarWeight );
+                                                 m_componentMolarWeight,
+                                                 m_pvtTableCacheDirectory );
           }
         }
         else
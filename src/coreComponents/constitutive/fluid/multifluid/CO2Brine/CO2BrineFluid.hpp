@@ -171,6 +171,7 @@ private:
   {
     static constexpr char const * flashModelParaFileString() { return "flashModelParaFile"; }
     static constexpr char const * phasePVTParaFilesString() { return "phasePVTParaFiles"; }
+    static constexpr char const * pvtTableCacheDirectoryString() { return "pvtTableCacheDirectory"; }
   };
 
 protected:
@@ -189,6 +190,9 @@ private:
   /// Name of the file defining the flash model
   Path m_flashModelParaFile;
 
+  /// Directory where the tabulated PVT properties are cached (no caching if empty)
+  string m_pvtTableCacheDirectory;
+
   /// Index of the liquid phase
   integer m_p1Index;
 
@@ -53,23 +53,28 @@ struct PhaseModel
    * @param[in] inputParams input parameters read from files
    * @param[in] componentNames names of the components
    * @param[in] componentMolarWeight molar weights of the components
+   * @param[in] tableCacheDirectory directory in which the property tables are cached, empty to disable the cache
    */
   PhaseModel( string const & phaseModelName,
               array1d< array1d< string > > const & inputParams,
               string_array const & componentNames,
-              array1d< real64 > const & componentMolarWeight )
+              array1d< real64 > const & componentMolarWeight,
+              string const & tableCacheDirectory )
     : density( phaseModelName + "_" + Density::catalogName(),
                inputParams[InputParamOrder::DENSITY],
                componentNames,
-               componentMolarWeight ),
+               componentMolarWeight,
+               tableCacheDirectory ),
     viscosity( phaseModelName + "_" + Viscosity::catalogName(),
                inputParams[InputParamOrder::VISCOSITY],
                componentNames,
-               componentMolarWeight ),
+               componentMolarWeight,
+               tableCacheDirectory ),
     enthalpy( phaseModelName + "_" + Enthalpy::catalogName(),
               inputParams[InputParamOrder::ENTHALPY],
               componentNames,
-              componentMolarWeight )
+              componentMolarWeight,
+              tableCacheDirectory )
   {}
 
   /// The phase density model
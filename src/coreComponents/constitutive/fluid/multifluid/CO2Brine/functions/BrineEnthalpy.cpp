@@ -87,6 +87,7 @@ void calculateBrineEnthalpy( PTTableCoordinates const & tableCoords,
 
 TableFunction const * makeCO2EnthalpyTable( string_array const & inputParams,
                                             string const & functionName,
+                                            string const & tableCacheDirectory,
                                             FunctionManager & functionManager )
 {
   string const tableName = functionName + "_CO2_enthalpy_table";
@@ -119,7 +120,7 @@ TableFunction const * makeCO2EnthalpyTable( string_array const & inputParams,
     array1d< real64 > enthalpies( tableCoords.nPressures() * tableCoords.nTemperatures() );
 
 
-    SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, densities );
+    SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, tableCacheDirectory, densities );
 
     CO2Enthalpy::calculateCO2Enthalpy( tableCoords, densities, enthalpies );
 
@@ -183,7 +184,8 @@ TableFunction const * makeBrineEnthalpyTable( string_array const & inputParams,
 BrineEnthalpy::BrineEnthalpy( string const & name,
                               string_array const & inputParams,
                               string_array const & componentNames,
-                              array1d< real64 > const & componentMolarWeight ):
+                              array1d< real64 > const & componentMolarWeight,
+                              string const & tableCacheDirectory ):
   PVTFunctionBase( name,
                    componentNames,
                    componentMolarWeight )
@@ -194,7 +196,7 @@ BrineEnthalpy::BrineEnthalpy( string const & name,
   string const expectedWaterComponentNames[] = { "Water", "water" };
   m_waterIndex = PVTFunctionHelpers::findName( componentNames, expectedWaterComponentNames, "componentNames" );
 
-  m_CO2EnthalpyTable = makeCO2EnthalpyTable( inputParams, m_functionName, FunctionManager::getInstance() );
+  m_CO2EnthalpyTable = makeCO2EnthalpyTable( inputParams, m_functionName, tableCacheDirectory, FunctionManager::getInstance() );
   m_brineEnthalpyTable = makeBrineEnthalpyTable( inputParams, m_functionName, FunctionManager::getInstance() );
 }
 
@@ -219,7 +221,7 @@ BrineEnthalpy::createKernelWrapper() const
                         m_waterIndex );
 }
 
-REGISTER_CATALOG_ENTRY( PVTFunctionBase, BrineEnthalpy, string const &, string_array const &, string_array const &, array1d< real64 > const & )
+REGISTER_CATALOG_ENTRY( PVTFunctionBase, BrineEnthalpy, string const &, string_array const &, string_array const &, array1d< real64 > const &, string const & )
 
 } // namespace PVTProps
 
@@ -98,7 +98,8 @@ public:
   BrineEnthalpy( string const & name,
                  string_array const & inputParams,
                  string_array const & componentNames,
-                 array1d< real64 > const & componentMolarWeight );
+                 array1d< real64 > const & componentMolarWeight,
+                 string const & tableCacheDirectory );
 
   static string catalogName() { return "BrineEnthalpy"; }
 
@@ -201,6 +201,7 @@ real64 helmholtzCO2Enthalpy( real64 const & T,
 
 TableFunction const * makeCO2EnthalpyTable( string_array const & inputParams,
                                             string const & functionName,
+                                            string const & tableCacheDirectory,
                                             FunctionManager & functionManager )
 {
   string const tableName = functionName + "_CO2_enthalpy_table";
@@ -233,7 +234,7 @@ TableFunction const * makeCO2EnthalpyTable( string_array const & inputParams,
     array1d< real64 > enthalpies( tableCoords.nPressures() * tableCoords.nTemperatures() );
 
 
-    SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, densities );
+    SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, tableCacheDirectory, densities );
 
     CO2Enthalpy::calculateCO2Enthalpy( tableCoords, densities, enthalpies );
 
@@ -251,7 +252,8 @@ TableFunction const * makeCO2EnthalpyTable( string_array const & inputParams,
 CO2Enthalpy::CO2Enthalpy( string const & name,
                           string_array const & inputParams,
                           string_array const & componentNames,
-                          array1d< real64 > const & componentMolarWeight ):
+                          array1d< real64 > const & componentMolarWeight,
+                          string const & tableCacheDirectory ):
   PVTFunctionBase( name,
                    componentNames,
                    componentMolarWeight )
@@ -259,7 +261,7 @@ CO2Enthalpy::CO2Enthalpy( string const & name,
   string const expectedCO2ComponentNames[] = { "CO2", "co2" };
   m_CO2Index = PVTFunctionHelpers::findName( componentNames, expectedCO2ComponentNames, "componentNames" );
 
-  m_CO2EnthalpyTable = makeCO2EnthalpyTable( inputParams, m_functionName, FunctionManager::getInstance() );
+  m_CO2EnthalpyTable = makeCO2EnthalpyTable( inputParams, m_functionName, tableCacheDirectory, FunctionManager::getInstance() );
 }
 
 
@@ -301,7 +303,7 @@ CO2Enthalpy::createKernelWrapper() const
                         m_CO2Index );
 }
 
-REGISTER_CATALOG_ENTRY( PVTFunctionBase, CO2Enthalpy, string const &, string_array const &, string_array const &, array1d< real64 > const & )
+REGISTER_CATALOG_ENTRY( PVTFunctionBase, CO2Enthalpy, string const &, string_array const &, string_array const &, array1d< real64 > const &, string const & )
 
 } // namespace PVTProps
 
@@ -166,6 +166,7 @@ void calculateCO2Solubility( string const & functionName,
                              real64 const & tolerance,
                              PTTableCoordinates const & tableCoords,
                              real64 const & salinity,
+                             string const & tableCacheDirectory,
                              array1d< real64 > const & values )
 {
   // Interaction parameters, see Table 2 of Duan and Sun (2003)
@@ -175,48 +176,49 @@ void calculateCO2Solubility( string const & functionName,
   constexpr real64 lambda[] = { -0.411370585, 6.07632013e-4, 97.5347708, 0, 0, 0, 0, -0.0237622469, 0.0170656236, 0, 1.41335834e-5 };
   constexpr real64 zeta[] = { 3.36389723e-4, -1.98298980e-5, 0, 0, 0, 0, 0, 2.12220830e-3, -5.24873303e-3, 0, 0 };
 
-  localIndex const nPressures = tableCoords.nPressures();
-  localIndex const nTemperatures = tableCoords.nTemperatures();
-
-  for( localIndex i = 0; i < nPressures; ++i )
+  // the table points are distributed over the ranks, and the table may be read from the cache
+  PVTFunctionHelpers::computePropertyTable( "CO2Solubility",
+                                            { tolerance, salinity },
+                                            tableCoords,
+                                            tableCacheDirectory,
+                                            values.toView(),
+                                            [&]( localIndex const i, localIndex const j )
   {
     real64 const P = tableCoords.getPressure( i ) / P_Pa_f;
+    real64 const T = tableCoords.getTemperature( j );
+
+    // compute reduced volume by solving the CO2 equation of state
+    real64 const V_r = CO2SolubilityFunction( functionName, tolerance, T, P, &co2EOS );
+
+    // compute equation (6) of Duan and Sun (2003)
+    real64 const logK = Par( units::convertCToK( T ), P, mu )
+                        - logF( T, P, V_r )
+                        + 2*Par( units::convertCToK( T ), P, lambda ) * salinity
+                        + Par( units::convertCToK( T ), P, zeta ) * salinity * salinity;
+    real64 const expLogK = exp( logK );
+
+    // mole fraction of CO2 in vapor phase, equation (4) of Duan and Sun (2003)
+    real64 const Pw = PWater( T );
+    real64 const y_CO2 = (P - Pw)/P;
+    real64 value = y_CO2 * P / expLogK;
 
-    for( localIndex j = 0; j < nTemperatures; ++j )
+    GEOS_WARNING_IF( expLogK <= 1e-10,
+                     GEOS_FMT( "CO2Solubility: exp(logK) = {} is too small (logK = {}, P = {}, T = {}, V_r = {}), resulting solubility value is {}",
+                               expLogK, logK, P, T, V_r, value ));
+
+    if( value < 0 )
     {
-      real64 const T = tableCoords.getTemperature( j );
-
-      // compute reduced volume by solving the CO2 equation of state
-      real64 const V_r = CO2SolubilityFunction( functionName, tolerance, T, P, &co2EOS );
-
-      // compute equation (6) of Duan and Sun (2003)
-      real64 const logK = Par( units::convertCToK( T ), P, mu )
-                          - logF( T, P, V_r )
-                          + 2*Par( units::convertCToK( T ), P, lambda ) * salinity
-                          + Par( units::convertCToK( T ), P, zeta ) * salinity * salinity;
-      real64 const expLogK = exp( logK );
-
-      // mole fraction of CO2 in vapor phase, equation (4) of Duan and Sun (2003)
-      real64 const Pw = PWater( T );
-      real64 const y_CO2 = (P - Pw)/P;
-      values[j*nPressures+i] = y_CO2 * P / expLogK;
-
-      GEOS_WARNING_IF( expLogK <= 1e-10,
-                       GEOS_FMT( "CO2Solubility: exp(logK) = {} is too small (logK = {}, P = {}, T = {}, V_r = {}), resulting solubility value is {}",
-                                 expLogK, logK, P, T, V_r, values[j*nPressures+i] ));
-
-      if( values[j*nPressures+i] < 0 )
-      {
-        GEOS_LOG_RANK_0( GEOS_FMT( "CO2Solubility: negative solubility value = {}, y_CO2 = {}, P = {}, PWater(T) = {}; corrected to 0",
-                                   values[j * nPressures + i], y_CO2, P, Pw ) );
-        values[j*nPressures+i] = 0.0;
-      }
+      GEOS_LOG_RANK( GEOS_FMT( "CO2Solubility: negative solubility value = {}, y_CO2 = {}, P = {}, PWater(T) = {}; corrected to 0",
+                               value, y_CO2, P, Pw ) );
+      value = 0.0;
     }
-  }
+    return value;
+  } );
 }
 
 TableFunction const * makeSolubilityTable( string_array const & inputParams,
                                            string const & functionName,
+                                           string const & tableCacheDirectory,
                                            FunctionManager & functionManager )
 {
   // initialize the (p,T) coordinates
@@ -243,9 +245,6 @@ TableFunction const * makeSolubilityTable( string_array const & inputParams,
     GEOS_THROW( GEOS_FMT( "{}: invalid model parameter value: {}", functionName, e.what() ), InputError );
   }
 
-  array1d< real64 > values( tableCoords.nPressures() * tableCoords.nTemperatures() );
-  calculateCO2Solubility( functionName, tolerance, tableCoords, salinity, values );
-
   string const tableName = functionName + "_table";
   if( functionManager.hasGroup< TableFunction >( tableName ) )
   {
@@ -253,6 +252,9 @@ TableFunction const * makeSolubilityTable( string_array const & inputParams,
   }
   else
   {
+    array1d< real64 > values( tableCoords.nPressures() * tableCoords.nTemperatures() );
+    calculateCO2Solubility( functionName, tolerance, tableCoords, salinity, tableCacheDirectory, values );
+
     TableFunction * const solubilityTable = dynamicCast< TableFunction * >( functionManager.createChild( "TableFunction", tableName ) );
     solubilityTable->setTableCoordinates( tableCoords.getCoords(),
                                           { units::Pressure, units::TemperatureInC } );
@@ -268,7 +270,8 @@ CO2Solubility::CO2Solubility( string const & name,
                               string_array const & inputParams,
                               string_array const & phaseNames,
                               string_array const & componentNames,
-                              array1d< real64 > const & componentMolarWeight ):
+                              array1d< real64 > const & componentMolarWeight,
+                              string const & tableCacheDirectory ):
   FlashModelBase( name,
                   componentNames,
                   componentMolarWeight )
@@ -292,7 +295,7 @@ CO2Solubility::CO2Solubility( string const & name,
   string const expectedWaterPhaseNames[] = { "Water", "water", "Liquid", "liquid" };
   m_phaseLiquidIndex = PVTFunctionHelpers::findName( phaseNames, expectedWaterPhaseNames, "phaseNames" );
 
-  m_CO2SolubilityTable = makeSolubilityTable( inputParams, m_modelName, FunctionManager::getInstance() );
+  m_CO2SolubilityTable = makeSolubilityTable( inputParams, m_modelName, tableCacheDirectory, FunctionManager::getInstance() );
 }
 
 void CO2Solubility::checkTablesParameters( real64 const pressure,
@@ -312,7 +315,7 @@ CO2Solubility::KernelWrapper CO2Solubility::createKernelWrapper() const
                         m_phaseLiquidIndex );
 }
 
-REGISTER_CATALOG_ENTRY( FlashModelBase, CO2Solubility, string const &, string_array const &, string_array const &, string_array const &, array1d< real64 > const & )
+REGISTER_CATALOG_ENTRY( FlashModelBase, CO2Solubility, string const &, string_array const &, string_array const &, string_array const &, array1d< real64 > const &, string const & )
 
 } // end namespace PVTProps
 
@@ -107,7 +107,8 @@ public:
                  string_array const & inputParams,
                  string_array const & phaseNames,
                  string_array const & componentNames,
-                 array1d< real64 > const & componentMolarWeight );
+                 array1d< real64 > const & componentMolarWeight,
+                 string const & tableCacheDirectory );
 
   static string catalogName() { return "CO2Solubility"; }
 
@@ -36,7 +36,8 @@ namespace PVTProps
 EzrokhiBrineDensity::EzrokhiBrineDensity( string const & name,
                                           string_array const & inputPara,
                                           string_array const & componentNames,
-                                          array1d< real64 > const & componentMolarWeight ):
+                                          array1d< real64 > const & componentMolarWeight,
+                                          string const & GEOS_UNUSED_PARAM( tableCacheDirectory ) ):
   PVTFunctionBase( name,
                    componentNames,
                    componentMolarWeight )
@@ -96,7 +97,7 @@ EzrokhiBrineDensity::createKernelWrapper() const
                         m_coef2 );
 }
 
-REGISTER_CATALOG_ENTRY( PVTFunctionBase, EzrokhiBrineDensity, string const &, string_array const &, string_array const &, array1d< real64 > const & )
+REGISTER_CATALOG_ENTRY( PVTFunctionBase, EzrokhiBrineDensity, string const &, string_array const &, string_array const &, array1d< real64 > const &, string const & )
 
 } // end namespace PVTProps
 
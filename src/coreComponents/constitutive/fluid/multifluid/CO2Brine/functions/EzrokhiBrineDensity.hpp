@@ -115,7 +115,8 @@ public:
   EzrokhiBrineDensity( string const & name,
                        string_array const & inputPara,
                        string_array const & componentNames,
-                       array1d< real64 > const & componentMolarWeight );
+                       array1d< real64 > const & componentMolarWeight,
+                       string const & tableCacheDirectory );
 
   virtual ~EzrokhiBrineDensity() override = default;
 
@@ -36,7 +36,8 @@ namespace PVTProps
 EzrokhiBrineViscosity::EzrokhiBrineViscosity( string const & name,
                                               string_array const & inputPara,
                                               string_array const & componentNames,
-                                              array1d< real64 > const & componentMolarWeight ):
+                                              array1d< real64 > const & componentMolarWeight,
+                                              string const & GEOS_UNUSED_PARAM( tableCacheDirectory ) ):
   PVTFunctionBase( name,
                    componentNames,
                    componentMolarWeight )
@@ -90,7 +91,7 @@ EzrokhiBrineViscosity::createKernelWrapper() const
                         m_coef2 );
 }
 
-REGISTER_CATALOG_ENTRY( PVTFunctionBase, EzrokhiBrineViscosity, string const &, string_array const &, string_array const &, array1d< real64 > const & )
+REGISTER_CATALOG_ENTRY( PVTFunctionBase, EzrokhiBrineViscosity, string const &, string_array const &, string_array const &, array1d< real64 > const &, string const & )
 
 } // end namespace PVTProps
 
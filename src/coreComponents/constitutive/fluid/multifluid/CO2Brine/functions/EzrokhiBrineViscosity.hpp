@@ -104,7 +104,8 @@ public:
   EzrokhiBrineViscosity( string const & name,
                          string_array const & inputPara,
                          string_array const & componentNames,
-                         array1d< real64 > const & componentMolarWeight );
+                         array1d< real64 > const & componentMolarWeight,
+                         string const & tableCacheDirectory );
 
   virtual ~EzrokhiBrineViscosity() override = default;
 
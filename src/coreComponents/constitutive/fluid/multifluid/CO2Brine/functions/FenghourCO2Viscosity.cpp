@@ -91,6 +91,7 @@ void calculateCO2Viscosity( PTTableCoordinates const & tableCoords,
 
 TableFunction const * makeViscosityTable( string_array const & inputParams,
                                           string const & functionName,
+                                          string const & tableCacheDirectory,
                                           FunctionManager & functionManager )
 {
   PTTableCoordinates tableCoords;
@@ -109,13 +110,6 @@ TableFunction const * makeViscosityTable( string_array const & inputParams,
     GEOS_THROW( GEOS_FMT( "{}: invalid model parameter value: {}", functionName, e.what() ), InputError );
   }
 
-  localIndex const nP = tableCoords.nPressures();
-  localIndex const nT = tableCoords.nTemperatures();
-  array1d< real64 > density( nP * nT );
-  array1d< real64 > viscosity( nP * nT );
-  SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, density );
-  calculateCO2Viscosity( tableCoords, density, viscosity );
-
   string const tableName = functionName + "_table";
   if( functionManager.hasGroup< TableFunction >( tableName ) )
   {
@@ -123,6 +117,13 @@ TableFunction const * makeViscosityTable( string_array const & inputParams,
   }
   else
   {
+    localIndex const nP = tableCoords.nPressures();
+    localIndex const nT = tableCoords.nTemperatures();
+    array1d< real64 > density( nP * nT );
+    array1d< real64 > viscosity( nP * nT );
+    SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, tableCacheDirectory, density );
+    calculateCO2Viscosity( tableCoords, density, viscosity );
+
     TableFunction * const viscosityTable = dynamicCast< TableFunction * >( functionManager.createChild( "TableFunction", tableName ) );
     viscosityTable->setTableCoordinates( tableCoords.getCoords(),
                                          { units::Pressure, units::TemperatureInC } );
@@ -137,12 +138,13 @@ TableFunction const * makeViscosityTable( string_array const & inputParams,
 FenghourCO2Viscosity::FenghourCO2Viscosity( string const & name,
                                             string_array const & inputParams,
                                             string_array const & componentNames,
-                                            array1d< real64 > const & componentMolarWeight )
+                                            array1d< real64 > const & componentMolarWeight,
+                                            string const & tableCacheDirectory )
   : PVTFunctionBase( name,
                      componentNames,
                      componentMolarWeight )
 {
-  m_CO2ViscosityTable = makeViscosityTable( inputParams, m_functionName, FunctionManager::getInstance() );
+  m_CO2ViscosityTable = makeViscosityTable( inputParams, m_functionName, tableCacheDirectory, FunctionManager::getInstance() );
 }
 
 void FenghourCO2Viscosity::checkTablesParameters( real64 const pressure,
@@ -159,7 +161,7 @@ FenghourCO2Viscosity::createKernelWrapper() const
                         *m_CO2ViscosityTable );
 }
 
-REGISTER_CATALOG_ENTRY( PVTFunctionBase, FenghourCO2Viscosity, string const &, string_array const &, string_array const &, array1d< real64 > const & )
+REGISTER_CATALOG_ENTRY( PVTFunctionBase, FenghourCO2Viscosity, string const &, string_array const &, string_array const &, array1d< real64 > const &, string const & )
 
 } // end namespace PVTProps
 
@@ -82,7 +82,8 @@ public:
                                                              string_array const &,
                                                              string_array const &,
                                                              string_array const &,
-                                                             array1d< real64 > const & >;
+                                                             array1d< real64 > const &,
+                                                             string const & >;
   static typename CatalogInterface::CatalogType & getCatalog()
   {
     static CatalogInterface::CatalogType catalog;
@@ -80,12 +80,13 @@ public:
   NoOpPVTFunction( string const & name,
                    string_array const & inputPara,
                    string_array const & componentNames,
-                   array1d< real64 > const & componentMolarWeight )
+                   array1d< real64 > const & componentMolarWeight,
+                   string const & tableCacheDirectory )
     : PVTFunctionBase( name,
                        componentNames,
                        componentMolarWeight )
   {
-    GEOS_UNUSED_VAR( inputPara );
+    GEOS_UNUSED_VAR( inputPara, tableCacheDirectory );
   }
 
   virtual ~NoOpPVTFunction() override = default;
@@ -17,9 +17,13 @@
  */
 
 #include "codingUtilities/StringUtilities.hpp"
+#include "common/Path.hpp"
 #include "constitutive/fluid/multifluid/CO2Brine/functions/PVTFunctionHelpers.hpp"
 #include "LvArray/src/sortedArrayManipulation.hpp"
 
+#include <cstdio>
+#include <unistd.h>
+
 namespace geos
 {
 
@@ -152,6 +156,125 @@ BlackOilTables::buildAllTables( localIndex const ipOil,
   }
 }
 
+namespace PVTFunctionHelpers
+{
+
+namespace
+{
+
+/// Identifier written at the beginning of the cache files (to be changed when the format changes)
+constexpr char tableCacheMagic[8] = { 'G', 'E', 'O', 'S', 'P', 'V', 'T', '1' };
+
+/**
+ * @brief Update a 64-bit FNV-1a hash with a sequence of bytes.
+ * @param[in] data the bytes to hash
+ * @param[in] size the number of bytes
+ * @param[in] hash the current value of the hash
+ * @return the updated hash
+ */
+std::uint64_t hashBytes( void const * const data,
+                         std::size_t const size,
+                         std::uint64_t hash )
+{
+  unsigned char const * const bytes = static_cast< unsigned char const * >( data );
+  for( std::size_t i = 0; i < size; ++i )
+  {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+std::uint64_t hashTableInputs( string const & propertyName,
+                               std::vector< real64 > const & parameters,
+                               PTTableCoordinates const & tableCoords )
+{
+  std::uint64_t hash = 14695981039346656037ULL;
+  hash = hashBytes( tableCacheMagic, sizeof( tableCacheMagic ), hash );
+  hash = hashBytes( propertyName.data(), propertyName.size(), hash );
+  hash = hashBytes( parameters.data(), parameters.size() * sizeof( real64 ), hash );
+  for( array1d< real64 > const & coords : tableCoords.getCoords() )
+  {
+    localIndex const numCoords = coords.size();
+    hash = hashBytes( &numCoords, sizeof( numCoords ), hash );
+    hash = hashBytes( coords.data(), coords.size() * sizeof( real64 ), hash );
+  }
+  return hash;
+}
+
+} // namespace
+
+string getTableCacheFile( string const & cacheDirectory,
+                          string const & propertyName,
+                          std::vector< real64 > const & parameters,
+                          PTTableCoordinates const & tableCoords )
+{
+  if( cacheDirectory.empty() )
+  {
+    return {};
+  }
+  std::uint64_t const hash = hashTableInputs( propertyName, parameters, tableCoords );
+  return joinPath( cacheDirectory, GEOS_FMT( "{}_{:016x}.pvt", propertyName, hash ) );
+}
+
+bool readCachedTable( string const & cacheFile,
+                      arrayView1d< real64 > const & values )
+{
+  int found = 0;
+  if( MpiWrapper::commRank() == 0 )
+  {
+    std::ifstream is( cacheFile, std::ios::binary );
+    char magic[sizeof( tableCacheMagic )]{};
+    localIndex numValues = -1;
+    if( is.read( magic, sizeof( magic ) ) &&
+        std::equal( magic, magic + sizeof( magic ), tableCacheMagic ) &&
+        is.read( reinterpret_cast< char * >( &numValues ), sizeof( numValues ) ) &&
+        numValues == values.size() &&
+        is.read( reinterpret_cast< char * >( values.data() ), numValues * sizeof( real64 ) ) )
+    {
+      found = 1;
+    }
+  }
+
+  MpiWrapper::broadcast( found );
+  if( found )
+  {
+    MpiWrapper::bcast( values.data(), LvArray::integerConversion< int >( values.size() ), 0, MPI_COMM_GEOSX );
+    GEOS_LOG_RANK_0( GEOS_FMT( "PVT table read from cache file {}", cacheFile ) );
+  }
+  return found;
+}
+
+void writeCachedTable( string const & cacheFile,
+                       arrayView1d< real64 const > const & values )
+{
+  if( MpiWrapper::commRank() != 0 )
+  {
+    return;
+  }
+
+  // write to a temporary file first, then rename it, so that concurrent jobs never read a partial table
+  makeDirsForPath( splitPath( cacheFile ).first );
+  string const tmpFile = GEOS_FMT( "{}.{}.tmp", cacheFile, getpid() );
+  {
+    std::ofstream os( tmpFile, std::ios::binary );
+    localIndex const numValues = values.size();
+    os.write( tableCacheMagic, sizeof( tableCacheMagic ) );
+    os.write( reinterpret_cast< char const * >( &numValues ), sizeof( numValues ) );
+    os.write( reinterpret_cast< char const * >( values.data() ), numValues * sizeof( real64 ) );
+    if( !os )
+    {
+      std::remove( tmpFile.c_str() );
+      GEOS_WARNING( GEOS_FMT( "Could not write the PVT table cache file {}", tmpFile ) );
+      return;
+    }
+  }
+  GEOS_WARNING_IF( std::rename( tmpFile.c_str(), cacheFile.c_str() ) != 0,
+                   GEOS_FMT( "Could not write the PVT table cache file {}", cacheFile ) );
+}
+
+} // namespace PVTFunctionHelpers
+
 } // namespace PVTProps
 
 } // namespace constitutive
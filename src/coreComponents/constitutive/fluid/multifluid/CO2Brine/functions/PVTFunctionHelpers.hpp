@@ -17,6 +17,7 @@
  */
 
 #include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
 #include "common/Units.hpp"
 
 #ifndef GEOS_CONSTITUTIVE_FLUID_MULTIFLUID_CO2BRINE_FUNCTIONS_PVTFUNCTIONHELPERS_HPP_
@@ -227,6 +228,108 @@ initializePropertyTable( string_array const & inputParameters,
   }
 }
 
+/**
+ * @brief Get the name of the file caching a property table.
+ * @param[in] cacheDirectory the directory in which the tables are cached, or an empty string if the cache is disabled
+ * @param[in] propertyName the name of the property (e.g., the name of the PVT model)
+ * @param[in] parameters the parameters, other than the table coordinates, on which the property values depend
+ * @param[in] tableCoords the (p,T) coordinates of the table
+ * @return the path of the cache file, named after a hash of the inputs, or an empty string if the cache is disabled
+ */
+string getTableCacheFile( string const & cacheDirectory,
+                          string const & propertyName,
+                          std::vector< real64 > const & parameters,
+                          PTTableCoordinates const & tableCoords );
+
+/**
+ * @brief Read a property table from a cache file on rank 0 and broadcast it (collective).
+ * @param[in] cacheFile the path of the cache file
+ * @param[out] values the property values
+ * @return true if a valid table of the right size has been found, false otherwise
+ */
+bool readCachedTable( string const & cacheFile,
+                      arrayView1d< real64 > const & values );
+
+/**
+ * @brief Write a property table to a cache file from rank 0.
+ * @param[in] cacheFile the path of the cache file
+ * @param[in] values the property values
+ */
+void writeCachedTable( string const & cacheFile,
+                       arrayView1d< real64 const > const & values );
+
+/**
+ * @brief Evaluate a property at all the (p,T) points of a table (collective).
+ * @tparam FUNC the type of the function evaluating the property
+ * @param[in] propertyName the name of the property (e.g., the name of the PVT model)
+ * @param[in] parameters the parameters, other than the table coordinates, on which the property values depend
+ * @param[in] tableCoords the (p,T) coordinates of the table
+ * @param[in] cacheDirectory the directory in which the tables are cached, or an empty string to disable the cache
+ * @param[out] values the property values, ordered with the pressure index running fastest
+ * @param[in] func function returning the value of the property for a pair of pressure and temperature indices
+ *
+ * The table points are split in contiguous chunks evaluated on the different MPI ranks, and
+ * the chunks are gathered on all ranks. If a cache directory is given, a table previously
+ * computed with the same inputs is read from disk instead, and newly computed tables are saved.
+ * This function must be called by all the ranks, in the same order.
+ */
+template< typename FUNC >
+void computePropertyTable( string const & propertyName,
+                           std::vector< real64 > const & parameters,
+                           PTTableCoordinates const & tableCoords,
+                           string const & cacheDirectory,
+                           arrayView1d< real64 > const & values,
+                           FUNC && func )
+{
+  localIndex const nPressures = tableCoords.nPressures();
+  localIndex const numValues = nPressures * tableCoords.nTemperatures();
+  GEOS_ERROR_IF_NE( values.size(), numValues );
+
+  string const cacheFile = getTableCacheFile( cacheDirectory, propertyName, parameters, tableCoords );
+  if( !cacheFile.empty() && readCachedTable( cacheFile, values ) )
+  {
+    return;
+  }
+
+  // split the table points in contiguous chunks of equal size, one per rank
+  localIndex const numRanks = MpiWrapper::commSize();
+  localIndex const chunkSize = ( numValues + numRanks - 1 ) / numRanks;
+  localIndex const chunkBegin = std::min( numValues, MpiWrapper::commRank() * chunkSize );
+  localIndex const chunkEnd = std::min( numValues, chunkBegin + chunkSize );
+
+  array1d< real64 > chunkValues( chunkSize );
+  string errorMessage;
+  try
+  {
+    for( localIndex k = chunkBegin; k < chunkEnd; ++k )
+    {
+      chunkValues[k - chunkBegin] = func( k % nPressures, k / nPressures );
+    }
+  }
+  catch( std::exception const & e )
+  {
+    errorMessage = e.what();
+  }
+
+  // all the ranks must stop if the evaluation failed on one of them, otherwise the gather below would hang
+  int const failed = MpiWrapper::max( errorMessage.empty() ? 0 : 1 );
+  GEOS_THROW_IF( failed > 0,
+                 ( errorMessage.empty() ? GEOS_FMT( "{}: the table generation failed on another rank", propertyName ) : errorMessage ),
+                 InputError );
+
+  array1d< real64 > allValues;
+  MpiWrapper::allGather( chunkValues.toViewConst(), allValues );
+  for( localIndex k = 0; k < numValues; ++k )
+  {
+    values[k] = allValues[k];
+  }
+
+  if( !cacheFile.empty() )
+  {
+    writeCachedTable( cacheFile, values.toViewConst() );
+  }
+}
+
 } // namespace PVTFunctionHelpers
 
 } // namespace PVTProps
@@ -168,7 +168,8 @@ TableFunction const * makeDensityTable( string_array const & inputParams,
 PhillipsBrineDensity::PhillipsBrineDensity( string const & name,
                                             string_array const & inputParams,
                                             string_array const & componentNames,
-                                            array1d< real64 > const & componentMolarWeight ):
+                                            array1d< real64 > const & componentMolarWeight,
+                                            string const & GEOS_UNUSED_PARAM( tableCacheDirectory ) ):
   PVTFunctionBase( name,
                    componentNames,
                    componentMolarWeight )
@@ -198,7 +199,7 @@ void PhillipsBrineDensity::checkTablesParameters( real64 const pressure,
   m_brineDensityTable->checkCoord( temperature, 1 );
 }
 
-REGISTER_CATALOG_ENTRY( PVTFunctionBase, PhillipsBrineDensity, string const &, string_array const &, string_array const &, array1d< real64 > const & )
+REGISTER_CATALOG_ENTRY( PVTFunctionBase, PhillipsBrineDensity, string const &, string_array const &, string_array const &, array1d< real64 > const &, string const & )
 
 } // namespace PVTProps
 
@@ -35,7 +35,8 @@ namespace PVTProps
 PhillipsBrineViscosity::PhillipsBrineViscosity( string const & name,
                                                 string_array const & inputPara,
                                                 string_array const & componentNames,
-                                                array1d< real64 > const & componentMolarWeight ):
+                                                array1d< real64 > const & componentMolarWeight,
+                                                string const & GEOS_UNUSED_PARAM( tableCacheDirectory ) ):
   PVTFunctionBase( name,
                    componentNames,
                    componentMolarWeight )
@@ -88,7 +89,7 @@ PhillipsBrineViscosity::createKernelWrapper() const
                         m_coef1 );
 }
 
-REGISTER_CATALOG_ENTRY( PVTFunctionBase, PhillipsBrineViscosity, string const &, string_array const &, string_array const &, array1d< real64 > const & )
+REGISTER_CATALOG_ENTRY( PVTFunctionBase, PhillipsBrineViscosity, string const &, string_array const &, string_array const &, array1d< real64 > const &, string const & )
 
 } // end namespace PVTProps
 
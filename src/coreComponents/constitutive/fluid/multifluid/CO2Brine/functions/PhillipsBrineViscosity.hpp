@@ -90,7 +90,8 @@ public:
   PhillipsBrineViscosity( string const & name,
                           string_array const & inputPara,
                           string_array const & componentNames,
-                          array1d< real64 > const & componentMolarWeight );
+                          array1d< real64 > const & componentMolarWeight,
+                          string const & tableCacheDirectory );
 
   virtual ~PhillipsBrineViscosity() override = default;
 
@@ -209,6 +209,7 @@ real64 spanWagnerCO2DensityFunction( string const & name,
 
 TableFunction const * makeDensityTable( string_array const & inputParams,
                                         string const & functionName,
+                                        string const & tableCacheDirectory,
                                         FunctionManager & functionManager )
 {
   PTTableCoordinates tableCoords;
@@ -227,9 +228,6 @@ TableFunction const * makeDensityTable( string_array const & inputParams,
     GEOS_THROW( GEOS_FMT( "{}: invalid model parameter value: {}", functionName, e.what() ), InputError );
   }
 
-  array1d< real64 > densities( tableCoords.nPressures() * tableCoords.nTemperatures() );
-  SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, densities );
-
   string const & tableName = functionName + "_table";
   if( functionManager.hasGroup< TableFunction >( tableName ) )
   {
@@ -237,6 +235,9 @@ TableFunction const * makeDensityTable( string_array const & inputParams,
   }
   else
   {
+    array1d< real64 > densities( tableCoords.nPressures() * tableCoords.nTemperatures() );
+    SpanWagnerCO2Density::calculateCO2Density( functionName, tolerance, tableCoords, tableCacheDirectory, densities );
+
     TableFunction * const densityTable = dynamicCast< TableFunction * >( functionManager.createChild( "TableFunction", tableName ) );
     densityTable->setTableCoordinates( tableCoords.getCoords(), tableCoords.coordsUnits );
     densityTable->setTableValues( densities, units::Density );
@@ -250,29 +251,31 @@ TableFunction const * makeDensityTable( string_array const & inputParams,
 void SpanWagnerCO2Density::calculateCO2Density( string const & functionName,
                                                 real64 const & tolerance,
                                                 PTTableCoordinates const & tableCoords,
+                                                string const & tableCacheDirectory,
                                                 array1d< real64 > const & densities )
 {
 
   constexpr real64 TK_f = constants::zeroDegreesCelsiusInKelvin;
 
-  localIndex const nPressures = tableCoords.nPressures();
-  localIndex const nTemperatures = tableCoords.nTemperatures();
-
-  for( localIndex i = 0; i < nPressures; ++i )
+  // the table points are distributed over the ranks, and the table may be read from the cache
+  PVTFunctionHelpers::computePropertyTable( catalogName(),
+                                            { tolerance },
+                                            tableCoords,
+                                            tableCacheDirectory,
+                                            densities.toView(),
+                                            [&]( localIndex const i, localIndex const j )
   {
     real64 const PPa = tableCoords.getPressure( i );
-    for( localIndex j = 0; j < nTemperatures; ++j )
-    {
-      real64 const TK = tableCoords.getTemperature( j ) + TK_f;
-      densities[j*nPressures+i] = spanWagnerCO2DensityFunction( functionName, tolerance, TK, PPa, &co2HelmholtzEnergy );
-    }
-  }
+    real64 const TK = tableCoords.getTemperature( j ) + TK_f;
+    return spanWagnerCO2DensityFunction( functionName, tolerance, TK, PPa, &co2HelmholtzEnergy );
+  } );
 }
 
 SpanWagnerCO2Density::SpanWagnerCO2Density( string const & name,
                                             string_array const & inputParams,
                                             string_array const & componentNames,
-                                            array1d< real64 > const & componentMolarWeight ):
+                                            array1d< real64 > const & componentMolarWeight,
+                                            string const & tableCacheDirectory ):
   PVTFunctionBase( name,
                    componentNames,
                    componentMolarWeight )
@@ -280,7 +283,7 @@ SpanWagnerCO2Density::SpanWagnerCO2Density( string const & name,
   string const expectedCO2ComponentNames[] = { "CO2", "co2" };
   m_CO2Index = PVTFunctionHelpers::findName( componentNames, expectedCO2ComponentNames, "componentNames" );
 
-  m_CO2DensityTable = makeDensityTable( inputParams, m_functionName, FunctionManager::getInstance() );
+  m_CO2DensityTable = makeDensityTable( inputParams, m_functionName, tableCacheDirectory, FunctionManager::getInstance() );
 }
 
 void SpanWagnerCO2Density::checkTablesParameters( real64 const pressure,
@@ -298,7 +301,7 @@ SpanWagnerCO2Density::createKernelWrapper() const
                         m_CO2Index );
 }
 
-REGISTER_CATALOG_ENTRY( PVTFunctionBase, SpanWagnerCO2Density, string const &, string_array const &, string_array const &, array1d< real64 > const & )
+REGISTER_CATALOG_ENTRY( PVTFunctionBase, SpanWagnerCO2Density, string const &, string_array const &, string_array const &, array1d< real64 > const &, string const & )
 
 } // namespace PVTProps
 
@@ -87,7 +87,8 @@ public:
   SpanWagnerCO2Density( string const &,
                         string_array const & inputParams,
                         string_array const & componentNames,
-                        array1d< real64 > const & componentMolarWeight );
+                        array1d< real64 > const & componentMolarWeight,
+                        string const & tableCacheDirectory );
 
   static string catalogName() { return "SpanWagnerCO2Density"; }
 
@@ -116,6 +117,7 @@ public:
   void calculateCO2Density( string const & functionName,
                             real64 const & tolerance,
                             PVTProps::PTTableCoordinates const & tableCoords,
+                            string const & tableCacheDirectory,
                             array1d< real64 > const & densities );
 
 private:
@@ -35,7 +35,8 @@ namespace PVTProps
 WaterDensity::WaterDensity( string const & name,
                             string_array const & inputParams,
                             string_array const & componentNames,
-                            array1d< real64 > const & componentMolarWeight ):
+                            array1d< real64 > const & componentMolarWeight,
+                            string const & GEOS_UNUSED_PARAM( tableCacheDirectory ) ):
   PVTFunctionBase( name,
                    componentNames,
                    componentMolarWeight )
@@ -58,7 +59,7 @@ WaterDensity::createKernelWrapper() const
                         *m_waterDensityTable );
 }
 
-REGISTER_CATALOG_ENTRY( PVTFunctionBase, WaterDensity, string const &, string_array const &, string_array const &, array1d< real64 > const & )
+REGISTER_CATALOG_ENTRY( PVTFunctionBase, WaterDensity, string const &, string_array const &, string_array const &, array1d< real64 > const &, string const & )
 
 } // namespace PVTProps
 
@@ -82,7 +82,8 @@ public:
   WaterDensity( string const & name,
                 string_array const & inputParams,
                 string_array const & componentNames,
-                array1d< real64 > const & componentMolarWeight );
+                array1d< real64 > const & componentMolarWeight,
+                string const & tableCacheDirectory );
 
   static string catalogName() { return "WaterDensity"; }
 
@@ -107,13 +107,17 @@ void MultiFluidBase::resizeFields( localIndex const size, localIndex const numPt
   m_phaseViscosity.value.resize( size, numPts, numPhase );
   m_phaseViscosity.derivs.resize( size, numPts, numPhase, numDof );
 
+  // the derivatives of the energy properties are only computed and used with thermal models,
+  // so there is no need to store them otherwise
+  integer const numEnergyDof = isThermal() ? numDof : 0;
+
   m_phaseEnthalpy.value.resize( size, numPts, numPhase );
   m_phaseEnthalpy_n.resize( size, numPts, numPhase );
-  m_phaseEnthalpy.derivs.resize( size, numPts, numPhase, numDof );
+  m_phaseEnthalpy.derivs.resize( size, numPts, numPhase, numEnergyDof );
 
   m_phaseInternalEnergy.value.resize( size, numPts, numPhase );
   m_phaseInternalEnergy_n.resize( size, numPts, numPhase );
-  m_phaseInternalEnergy.derivs.resize( size, numPts, numPhase, numDof );
+  m_phaseInternalEnergy.derivs.resize( size, numPts, numPhase, numEnergyDof );
 
   m_phaseCompFraction.value.resize( size, numPts, numPhase, numComp );
   m_phaseCompFraction_n.resize( size, numPts, numPhase, numComp );
@@ -164,6 +164,7 @@ public:
   arrayView3d< real64 const, multifluid::USD_PHASE > phaseEnthalpy_n() const
   { return m_phaseEnthalpy_n; }
 
+  // note: only allocated for thermal models (see isThermal), empty in the derivative dimension otherwise
   arrayView4d< real64 const, multifluid::USD_PHASE_DC > dPhaseEnthalpy() const
   { return m_phaseEnthalpy.derivs; }
 
@@ -173,6 +174,7 @@ public:
   arrayView3d< real64 const, multifluid::USD_PHASE > phaseInternalEnergy_n() const
   { return m_phaseInternalEnergy_n; }
 
+  // note: only allocated for thermal models (see isThermal), empty in the derivative dimension otherwise
   arrayView4d< real64 const, multifluid::USD_PHASE_DC > dPhaseInternalEnergy() const
   { return m_phaseInternalEnergy.derivs; }
 
@@ -887,8 +889,12 @@ MultiFluidBase::KernelWrapper::
     applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, phaseFrac.derivs[ip], work, Deriv::dC );
     applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseDens[ip], work, Deriv::dC );
     applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseVisc[ip], work, Deriv::dC );
-    applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseEnthalpy[ip], work, Deriv::dC );
-    applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseInternalEnergy[ip], work, Deriv::dC );
+    // the derivatives of the energy properties are not stored for isothermal models
+    if( dPhaseEnthalpy.size( 1 ) > 0 )
+    {
+      applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseEnthalpy[ip], work, Deriv::dC );
+      applyChainRuleInPlace( numComp, dCompMoleFrac_dCompMassFrac, dPhaseInternalEnergy[ip], work, Deriv::dC );
+    }
 
     for( integer ic = 0; ic < numComp; ++ic )
     {
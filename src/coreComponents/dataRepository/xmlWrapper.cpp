@@ -247,6 +247,96 @@ xmlResult xmlDocument::loadFile( string const & path, bool loadNodeFileInfo )
   return result;
 }
 
+xmlResult xmlDocument::loadFileAndBroadcast( string const & path, bool loadNodeFileInfo )
+{
+  int const rank = MpiWrapper::commRank();
+
+  // Only the first rank reads the input file and its includes, and resolves them in a single tree
+  xmlResult result;
+  string errorMsg;
+  string resolvedBuffer;
+  if( rank == 0 )
+  {
+    result = loadFile( path, loadNodeFileInfo );
+    if( result )
+    {
+      try
+      {
+        addIncludedXMLRecursive( getFirstChild() );
+      }
+      catch( InputError const & e )
+      {
+        errorMsg = e.what();
+      }
+      std::ostringstream oss;
+      pugiDocument.save( oss, "", pugi::format_raw );
+      resolvedBuffer = oss.str();
+    }
+  }
+
+  // Make sure that all ranks fail consistently
+  int status = result.status;
+  long long offset = result.offset;
+  MpiWrapper::broadcast( status );
+  MpiWrapper::broadcast( offset );
+  MpiWrapper::broadcast( errorMsg );
+  GEOS_THROW_IF( !errorMsg.empty(), errorMsg, InputError );
+  if( status != pugi::status_ok )
+  {
+    result.status = static_cast< pugi::xml_parse_status >( status );
+    result.offset = offset;
+    return result;
+  }
+
+  MpiWrapper::broadcast( resolvedBuffer );
+  MpiWrapper::broadcast( m_rootFilePath );
+
+  // The original buffers are needed on every rank to retrieve the node positions in error messages
+  if( loadNodeFileInfo )
+  {
+    if( rank != 0 )
+    {
+      m_originalBuffers.clear();
+    }
+    int numBuffers = LvArray::integerConversion< int >( m_originalBuffers.size() );
+    MpiWrapper::broadcast( numBuffers );
+    auto bufferIt = m_originalBuffers.begin();
+    for( int i = 0; i < numBuffers; ++i )
+    {
+      string filePath = rank == 0 ? bufferIt->first : string();
+      string buffer = rank == 0 ? bufferIt->second : string();
+      MpiWrapper::broadcast( filePath );
+      MpiWrapper::broadcast( buffer );
+      if( rank == 0 )
+      {
+        ++bufferIt;
+      }
+      else
+      {
+        m_originalBuffers[filePath] = std::move( buffer );
+      }
+    }
+  }
+
+  // All ranks build their tree from the same resolved buffer, the file info being kept in the node attributes
+  result = pugiDocument.load_buffer( resolvedBuffer.data(), resolvedBuffer.size(),
+                                     pugi::parse_default, pugi::encoding_auto );
+  return result;
+}
+
+void xmlDocument::addIncludedXMLRecursive( xmlNode targetNode )
+{
+  addIncludedXML( targetNode );
+
+  for( xmlNode subNode : targetNode.children() )
+  {
+    if( subNode.type() == xmlNodeType::node_element )
+    {
+      addIncludedXMLRecursive( subNode );
+    }
+  }
+}
+
 xmlNode xmlDocument::appendChild( string const & name )
 { return pugiDocument.append_child( name.c_str() ); }
 
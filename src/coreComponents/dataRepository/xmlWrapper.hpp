@@ -215,6 +215,19 @@ public:
    */
   xmlResult loadFile( string const & path, bool loadNodeFileInfo = false );
 
+  /**
+   * @brief Load document from file on the first rank only, and broadcast it to all other ranks.
+   * Free any previously loaded xml tree.
+   * The first rank parses the file and all of its includes, and broadcasts the resolved
+   * document (and the original buffers if requested), so that the input deck files are
+   * accessed once instead of by every rank. Must be called collectively on MPI_COMM_GEOSX.
+   * @param path the path of an xml file to load.
+   * @param loadNodeFileInfo Load the node source file info, allowing getNodePosition() to work.
+   * @return an xmlResult object representing the parsing resulting status (identical on all ranks).
+   * @throws an InputError on all ranks if an included file could not be loaded.
+   */
+  xmlResult loadFileAndBroadcast( string const & path, bool loadNodeFileInfo = false );
+
   /**
    * @brief Add a root element to the document
    * @param name the tag name of the node to add
@@ -255,6 +268,13 @@ public:
   bool hasNodeFileInfo() const;
 
 private:
+
+  /**
+   * @brief Recursively add the included files of a node and of all its children.
+   * @param targetNode the node from which to start looking for includes
+   */
+  void addIncludedXMLRecursive( xmlNode targetNode );
+
   /// original xml_document object that this class aims to wrap
   pugi::xml_document pugiDocument;
 
@@ -855,6 +855,96 @@ void BlasLapackLA::matrixEigenvalues( MatRowMajor< real64 const > const & A,
   matrixEigenvalues( AT.toSliceConst(), lambda );
 }
 
+void BlasLapackLA::matrixEigenvectors( MatColMajor< real64 const > const & A,
+                                       Vec< std::complex< real64 > > const & lambda,
+                                       MatColMajor< real64 > const & V )
+{
+  GEOS_ASSERT_MSG( A.size( 0 ) == A.size( 1 ),
+                   "The matrix A must be square" );
+
+  GEOS_ASSERT_MSG( A.size( 0 ) == lambda.size(),
+                   "The matrix A and lambda have incompatible sizes" );
+
+  GEOS_ASSERT_MSG( A.size( 0 ) == V.size( 0 ) && A.size( 1 ) == V.size( 1 ),
+                   "The matrix A and V have incompatible sizes" );
+
+  // make a copy of A, since dgeev destroys contents
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > ACOPY( A.size( 0 ), A.size( 1 ) );
+  BlasLapackLA::matrixCopy( A, ACOPY );
+
+  // use a contiguous buffer for the eigenvectors, since V may be a slice of a larger array
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > VR( A.size( 0 ), A.size( 1 ) );
+
+  // define the arguments of dgeev
+  int const N    = LvArray::integerConversion< int >( A.size( 0 ) );
+  int const LDA  = N;
+  int const LDVL = 1;
+  int const LDVR = N;
+  int LWORK = 0;
+  int INFO  = 0;
+  double WKOPT = 0.0;
+  double VL = 0.0;
+
+  array1d< real64 > WR( N );
+  array1d< real64 > WI( N );
+
+  // 1) query and allocate the optimal workspace
+  LWORK = -1;
+  GEOS_dgeev( "N", "V",
+              &N, ACOPY.data(), &LDA,
+              WR.data(), WI.data(),
+              &VL, &LDVL,
+              VR.data(), &LDVR,
+              &WKOPT, &LWORK, &INFO );
+
+  LWORK = static_cast< int >( WKOPT );
+  array1d< real64 > WORK( LWORK );
+
+  // 2) compute eigenvalues and right eigenvectors
+  GEOS_dgeev( "N", "V",
+              &N, ACOPY.data(), &LDA,
+              WR.data(), WI.data(),
+              &VL, &LDVL,
+              VR.data(), &LDVR,
+              WORK.data(), &LWORK, &INFO );
+
+  for( int i = 0; i < N; ++i )
+  {
+    lambda[i] = std::complex< real64 >( WR[i], WI[i] );
+  }
+  BlasLapackLA::matrixCopy( VR.toSliceConst(), V );
+
+  GEOS_ERROR_IF( INFO != 0, "The algorithm computing eigenvectors failed to converge." );
+}
+
+void BlasLapackLA::matrixEigenvectors( MatRowMajor< real64 const > const & A,
+                                       Vec< std::complex< real64 > > const & lambda,
+                                       MatRowMajor< real64 > const & V )
+{
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > AT( A.size( 0 ), A.size( 1 ) );
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > VT( V.size( 0 ), V.size( 1 ) );
+
+  // convert A to a column major format
+  for( int i = 0; i < A.size( 0 ); ++i )
+  {
+    for( int j = 0; j < A.size( 1 ); ++j )
+    {
+      AT( i, j ) = A( i, j );
+    }
+  }
+
+  matrixEigenvectors( AT.toSliceConst(), lambda, VT.toSlice() );
+
+  // convert V back to a row major format
+  for( int i = 0; i < V.size( 0 ); ++i )
+  {
+    for( int j = 0; j < V.size( 1 ); ++j )
+    {
+      V( i, j ) = VT( i, j );
+    }
+  }
+}
+
 void BlasLapackLA::solveLinearSystem( MatColMajor< real64 const > const & A,
                                       arraySlice1d< real64 const > const & rhs,
                                       arraySlice1d< real64 > const & solution )
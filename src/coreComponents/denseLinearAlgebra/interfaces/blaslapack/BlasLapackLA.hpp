@@ -596,6 +596,32 @@ struct BlasLapackLA
   static void matrixEigenvalues( MatColMajor< real64 const > const & A,
                                  Vec< std::complex< real64 > > const & lambda );
 
+  /**
+   * @brief Computes the eigenvalues and right eigenvectors of A
+   *
+   * If size(A) = (N,N), this function expects:
+   * size(lambda) = N and size(V) = (N,N)
+   * On exit, lambda contains the eigenvalues of A and V the right eigenvectors,
+   * stored in the real LAPACK format: if lambda(j) is real, V(:,j) is the
+   * corresponding eigenvector; if lambda(j) and lambda(j+1) form a complex
+   * conjugate pair, V(:,j) and V(:,j+1) hold the real and imaginary parts
+   * of the eigenvector associated with lambda(j).
+   *
+   * @param [in]    A GEOSX array2d.
+   * @param [out]   lambda GEOSX array1d.
+   * @param [out]   V GEOSX array2d.
+   */
+  static void matrixEigenvectors( MatRowMajor< real64 const > const & A,
+                                  Vec< std::complex< real64 > > const & lambda,
+                                  MatRowMajor< real64 > const & V );
+
+  /**
+   * @copydoc matrixEigenvectors
+   */
+  static void matrixEigenvectors( MatColMajor< real64 const > const & A,
+                                  Vec< std::complex< real64 > > const & lambda,
+                                  MatColMajor< real64 > const & V );
+
 };
 
 }
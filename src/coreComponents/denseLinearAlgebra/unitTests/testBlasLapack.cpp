@@ -1139,6 +1139,56 @@ void matrix_svd_test()
   }
 }
 
+template< typename LAI >
+void matrix_eigenvectors_test()
+{
+  array1d< INDEX_TYPE > N_indices;
+  N_indices.emplace_back( 1 );
+  N_indices.emplace_back( 2 );
+  N_indices.emplace_back( 3 );
+  N_indices.emplace_back( 5 );
+  N_indices.emplace_back( 8 );
+
+  array2d< real64 > A;
+  array2d< real64 > V;
+  array1d< std::complex< real64 > > lambda;
+
+  for( INDEX_TYPE N : N_indices )
+  {
+    A.resize( N, N );
+    V.resize( N, N );
+    lambda.resize( N );
+
+    // Populate matrix A with random coefficients
+    LAI::matrixRand( A,
+                     LAI::RandomNumberDistribution::UNIFORM_m1p1 );
+
+    // Compute the eigenpairs of A
+    LAI::matrixEigenvectors( A, lambda, V );
+
+    // Check that A * v = lambda * v for every eigenpair, taking care of complex conjugate pairs
+    INDEX_TYPE j = 0;
+    while( j < N )
+    {
+      bool const isComplex = std::abs( lambda[j].imag() ) > 0.0;
+      for( INDEX_TYPE i = 0; i < N; ++i )
+      {
+        std::complex< real64 > Av = 0.0;
+        for( INDEX_TYPE l = 0; l < N; ++l )
+        {
+          std::complex< real64 > const v_l = isComplex ? std::complex< real64 >( V( l, j ), V( l, j+1 ) ) : V( l, j );
+          Av += A( i, l ) * v_l;
+        }
+        std::complex< real64 > const v_i = isComplex ? std::complex< real64 >( V( i, j ), V( i, j+1 ) ) : V( i, j );
+        std::complex< real64 > const lambdaV = lambda[j] * v_i;
+        EXPECT_NEAR( Av.real(), lambdaV.real(), N * machinePrecision );
+        EXPECT_NEAR( Av.imag(), lambdaV.imag(), N * machinePrecision );
+      }
+      j += isComplex ? 2 : 1;
+    }
+  }
+}
+
 TEST( Array1D, vectorNorm1 )
 {
   vector_norm1_test< BlasLapackLA >();
@@ -1264,6 +1314,11 @@ TEST( DenseLAInterface, matrixSVD )
   matrix_svd_test< BlasLapackLA >();
 }
 
+TEST( DenseLAInterface, matrixEigenvectors )
+{
+  matrix_eigenvectors_test< BlasLapackLA >();
+}
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
@@ -29,6 +29,7 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
   m_format( ),
   m_filename( ),
   m_recordCount( 0 ),
+  m_compressionLevel( 0 ),
   m_io( )
 {
   registerWrapper( viewKeys::timeHistoryOutputTargetString(), &m_collectorPaths ).
@@ -51,6 +52,20 @@ TimeHistoryOutput::TimeHistoryOutput( string const & name,
     setRestartFlags( RestartFlags::WRITE_AND_READ ).
     setDescription( "The current history record to be written, on restart from an earlier time allows use to remove invalid future history." );
 
+  registerWrapper( viewKeys::timeHistoryCompressionLevelString(), &m_compressionLevel ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Level of the deflate compression (1 to 9) applied to the collected datasets, 0 to disable compression." );
+
+}
+
+void TimeHistoryOutput::postProcessInput()
+{
+  GEOS_THROW_IF( m_compressionLevel < 0 || m_compressionLevel > 9,
+                 GEOS_FMT( "{} `{}`: `{}` must be between 0 and 9, got {}",
+                           catalogName(), getDataContext(),
+                           viewKeys::timeHistoryCompressionLevelString(), m_compressionLevel ),
+                 InputError );
 }
 
 void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, HistoryCollection & collector )
@@ -73,7 +88,7 @@ void TimeHistoryOutput::initCollectorParallel( DomainPartition const & domain, H
         metadata.setName( prefix + metadata.getName() );
       }
 
-      m_io.emplace_back( std::make_unique< HDFHistoryIO >( outputFile, metadata, m_recordCount ) );
+      m_io.emplace_back( std::make_unique< HDFHistoryIO >( outputFile, metadata, m_recordCount, 1, 2, MPI_COMM_GEOSX, m_compressionLevel ) );
       hc.registerBufferProvider( collectorIdx, [this, idx = m_io.size() - 1]( localIndex count )
       {
         m_io[idx]->updateCollectingCount( count );
@@ -51,6 +51,8 @@ public:
    */
   static string catalogName() { return "TimeHistory"; }
 
+  virtual void postProcessInput() override;
+
   /**
    * @brief Perform initalization after all subgroups have been initialized.
    *   Check for existing files and data spaces/sets on restart, else create the
@@ -97,6 +99,7 @@ public:
     static constexpr char const * timeHistoryOutputFilenameString() { return "filename"; }
     static constexpr char const * timeHistoryOutputFormatString() { return "format"; }
     static constexpr char const * timeHistoryRestartString() { return "restart"; }
+    static constexpr char const * timeHistoryCompressionLevelString() { return "compressionLevel"; }
 
     dataRepository::ViewKey timeHistoryOutputTarget = { "sources" };
     dataRepository::ViewKey timeHistoryOutputFilename = { "filename" };
@@ -130,6 +133,8 @@ private:
   string m_filename;
   /// The discrete number of time history states expected to be written to the file
   integer m_recordCount;
+  /// The deflate compression level of the datasets (0 if not compressed)
+  integer m_compressionLevel;
   /// The buffered time history output objects for each collector to collect data into and to use to configure/write to file.
   std::vector< std::unique_ptr< BufferedHistoryIO > > m_io;
 };
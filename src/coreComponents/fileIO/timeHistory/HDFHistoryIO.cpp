@@ -89,7 +89,8 @@ HDFHistoryIO::HDFHistoryIO( string const & filename,
                             localIndex writeHead,
                             localIndex initAlloc,
                             localIndex overallocMultiple,
-                            MPI_Comm comm ):
+                            MPI_Comm comm,
+                            integer compressionLevel ):
   m_bufferedCount( 0 ),
   m_bufferHead( nullptr ),
   m_dataBuffer( 0 ),
@@ -110,7 +111,8 @@ HDFHistoryIO::HDFHistoryIO( string const & filename,
   m_name( name ),
   m_comm( comm ),
   m_subcomm( MPI_COMM_NULL ),
-  m_sizeChanged( true )
+  m_sizeChanged( true ),
+  m_compressionLevel( compressionLevel )
 {
   for( hsize_t dd = 0; dd < m_rank; ++dd )
   {
@@ -213,6 +215,14 @@ void HDFHistoryIO::init( bool existsOkay )
     dimChunks[1] = m_chunkSize;
     historyFileDims[1] = LvArray::integerConversion< hsize_t >( m_globalIdxCount );
 
+    // cap the chunk extents, from the innermost dimension, so that a chunk holds at most maxChunkBytes
+    hsize_t chunkCapacity = LvArray::math::max( LvArray::integerConversion< hsize_t >( maxChunkBytes / m_typeSize ), hsize_t( 1 ) );
+    for( hsize_t dd = m_rank; dd > 0; --dd )
+    {
+      dimChunks[dd] = LvArray::math::min( dimChunks[dd], chunkCapacity );
+      chunkCapacity = LvArray::math::max( chunkCapacity / LvArray::math::max( dimChunks[dd], hsize_t( 1 ) ), hsize_t( 1 ) );
+    }
+
     HDFFile target( m_filename, false, true, subcomm );
     bool inTarget = target.hasDataset( m_name );
     if( !inTarget )
@@ -222,12 +232,24 @@ void HDFHistoryIO::init( bool existsOkay )
       // chunking is required to create an extensible dataset
       dcplId = H5Pcreate( H5P_DATASET_CREATE );
       H5Pset_chunk( dcplId, m_rank + 1, &dimChunks[0] );
+      // a chunk holds a single row and at most m_chunkSize indices, i.e. the smallest nonzero count of indices of a rank:
+      //  the chunks are not aligned with the rank partitioning, but each of them is written by at most two ranks
+      if( m_compressionLevel > 0 )
+      {
+        bool const deflateAvailable = H5Zfilter_avail( H5Z_FILTER_DEFLATE ) > 0;
+        GEOS_WARNING_IF( !deflateAvailable, "Deflate filter is not available in HDF5, dataset (" + m_name + ") will not be compressed" );
+        if( deflateAvailable )
+        {
+          H5Pset_deflate( dcplId, LvArray::integerConversion< unsigned >( m_compressionLevel ) );
+        }
+      }
       maxFileDims[0] = H5S_UNLIMITED;
       maxFileDims[1] = H5S_UNLIMITED;
       hid_t space = H5Screate_simple( m_rank+1, &historyFileDims[0], &maxFileDims[0] );
       hid_t dataset = H5Dcreate( target, m_name.c_str(), m_hdfType, space, H5P_DEFAULT, dcplId, H5P_DEFAULT );
       H5Dclose( dataset );
       H5Sclose( space );
+      H5Pclose( dcplId );
     }
     else if( existsOkay )
     {
@@ -248,67 +270,37 @@ void HDFHistoryIO::write()
   resizeFileIfNeeded( m_bufferedCount );
   if( m_bufferedCount > 0 )
   {
-    buffer_unit_type * dataBuffer = nullptr;
+    buffer_unit_type const * dataBuffer = nullptr;
     if( m_dataBuffer.size() > 0 )
     {
       dataBuffer = &m_dataBuffer[0];
     }
-    for( localIndex row = 0; row < m_bufferedCount; ++row )
+    if( m_sizeChanged )
     {
-      // if the size changed at all, update the partitioning and dataset extent before each row is to be written
-      //  to ensure the correct mpi ranks participate and that there is enough room to write the largest row during execution
-      if( m_sizeChanged )
+      for( localIndex row = 0; row < m_bufferedCount; ++row )
       {
+        // if the size changed at all, update the partitioning and dataset extent before each row is to be written
+        //  to ensure the correct mpi ranks participate and that there is enough room to write the largest row during execution
         // since the highwater might change (the max # of indices / 2nd dimension) when updating the partitioning
         setupPartition( m_localIdxCounts_buffered[ row ] );
         // keep the write limit the same (will only change in resizeFileIfNeeded call above)
         updateDatasetExtent( m_writeLimit );
-      }
-
-      if( m_subcomm != MPI_COMM_NULL )
-      {
-        HDFFile target( m_filename, false, true, m_subcomm );
-
-        hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
-        hid_t filespace = H5Dget_space( dataset );
 
-        std::vector< hsize_t > fileOffset( m_rank+1 );
-        fileOffset[0] = LvArray::integerConversion< hsize_t >( m_writeHead );
-        // the m_globalIdxOffset will be updated for each row during the partition setup if the size has changed during buffered collection
-        fileOffset[1] = LvArray::integerConversion< hsize_t >( m_globalIdxOffset );
-
-        std::vector< hsize_t > bufferedCounts( m_rank+1 );
-        bufferedCounts[0] = LvArray::integerConversion< hsize_t >( 1 );
-        bufferedCounts[1] = LvArray::integerConversion< hsize_t >( m_localIdxCounts_buffered[ row ] );
-        for( hsize_t dd = 2; dd < m_rank+1; ++dd )
-        {
-          bufferedCounts[dd] = m_dims[dd-1];
-        }
-        hid_t memspace = H5Screate_simple( m_rank+1, &bufferedCounts[0], nullptr );
-
-        hid_t fileHyperslab = filespace;
-        H5Sselect_hyperslab( fileHyperslab, H5S_SELECT_SET, &fileOffset[0], nullptr, &bufferedCounts[0], nullptr );
-
-        H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, H5P_DEFAULT, dataBuffer );
-
-        // forward the data buffer pointer to the start of the next row
+        // the accessing mpi ranks and extents can change from one row to the next, so each row is written separately
+        writeRows( 1, m_localIdxCounts_buffered[ row ], dataBuffer );
         if( dataBuffer )
         {
-          hsize_t rowsize = m_localIdxCounts_buffered[ row ] * m_typeSize;
-          for( hsize_t ii = 1; ii < m_rank; ++ii )
-          {
-            rowsize *= m_dims[ii];
-          }
-          dataBuffer += rowsize;
+          dataBuffer += getRowBytes( m_localIdxCounts_buffered[ row ] );
         }
-
-        // unfortunately have to close/open the file for each row since the accessing mpi ranks and extents can change over time
-        H5Sclose( memspace );
-        H5Sclose( filespace );
-        H5Dclose( dataset );
+        m_writeHead++;
       }
-
-      m_writeHead++;
+    }
+    else
+    {
+      // the partitioning did not change since the last write: all the buffered rows have the same
+      //  extent and are contiguous in the buffer, so they are written at once as a single hyperslab
+      writeRows( m_bufferedCount, LvArray::integerConversion< globalIndex >( m_dims[0] ), dataBuffer );
+      m_writeHead += m_bufferedCount;
     }
   }
   m_sizeChanged = false;
@@ -316,6 +308,52 @@ void HDFHistoryIO::write()
   emptyBuffer( );
 }
 
+void HDFHistoryIO::writeRows( localIndex numRows,
+                              globalIndex localIdxCount,
+                              buffer_unit_type const * dataBuffer )
+{
+  if( m_subcomm == MPI_COMM_NULL )
+  {
+    return;
+  }
+
+  HDFFile target( m_filename, false, true, m_subcomm );
+
+  hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
+  hid_t filespace = H5Dget_space( dataset );
+
+  std::vector< hsize_t > fileOffset( m_rank+1 );
+  fileOffset[0] = LvArray::integerConversion< hsize_t >( m_writeHead );
+  // the m_globalIdxOffset is updated during the partition setup if the size has changed during buffered collection
+  fileOffset[1] = LvArray::integerConversion< hsize_t >( m_globalIdxOffset );
+
+  std::vector< hsize_t > bufferedCounts( m_rank+1 );
+  bufferedCounts[0] = LvArray::integerConversion< hsize_t >( numRows );
+  bufferedCounts[1] = LvArray::integerConversion< hsize_t >( localIdxCount );
+  for( hsize_t dd = 2; dd < m_rank+1; ++dd )
+  {
+    bufferedCounts[dd] = m_dims[dd-1];
+  }
+  hid_t memspace = H5Screate_simple( m_rank+1, &bufferedCounts[0], nullptr );
+
+  hid_t fileHyperslab = filespace;
+  H5Sselect_hyperslab( fileHyperslab, H5S_SELECT_SET, &fileOffset[0], nullptr, &bufferedCounts[0], nullptr );
+
+  // every rank of the sub-communicator writes its part, so a collective transfer can be used
+  //  (this is also required by hdf5 to write to a compressed dataset in parallel)
+  hid_t dxplId = H5Pcreate( H5P_DATASET_XFER );
+#ifdef GEOSX_USE_MPI
+  H5Pset_dxpl_mpio( dxplId, H5FD_MPIO_COLLECTIVE );
+#endif
+
+  H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, dxplId, dataBuffer );
+
+  H5Pclose( dxplId );
+  H5Sclose( memspace );
+  H5Sclose( filespace );
+  H5Dclose( dataset );
+}
+
 void HDFHistoryIO::compressInFile()
 {
   // set the write limit in the file to the current write head
@@ -358,6 +396,16 @@ size_t HDFHistoryIO::getRowBytes()
   return m_typeCount * m_typeSize;
 }
 
+size_t HDFHistoryIO::getRowBytes( globalIndex localIdxCount ) const
+{
+  size_t rowBytes = LvArray::integerConversion< size_t >( localIdxCount ) * m_typeSize;
+  for( hsize_t dd = 1; dd < m_rank; ++dd )
+  {
+    rowBytes *= m_dims[dd];
+  }
+  return rowBytes;
+}
+
 void HDFHistoryIO::emptyBuffer()
 {
   m_bufferedCount = 0;
@@ -32,6 +32,9 @@ namespace geos
 class HDFHistoryIO : public BufferedHistoryIO
 {
 public:
+  /// The largest size in bytes of a chunk of the dataset in the file (hdf5 does not allow chunks of 4 GB or more)
+  static constexpr size_t maxChunkBytes = 4 * 1024 * 1024;
+
   /**
    * @brief Constructor
    * @param[in] filename The filename to perform history output to.
@@ -43,6 +46,7 @@ public:
    * @param[in] initAlloc How many states to preallocate the internal buffer to hold.
    * @param[in] overallocMultiple Integer to scale the internal buffer when we fill the existing space.
    * @param[in] comm A communicator where every rank will participate in writting to the output file.
+   * @param[in] compressionLevel The deflate compression level (1-9) of the dataset, 0 to disable compression.
    */
   HDFHistoryIO( string const & filename,
                 localIndex rank,
@@ -52,7 +56,8 @@ public:
                 localIndex writeHead = 0,
                 localIndex initAlloc = 1,
                 localIndex overallocMultiple = 2,
-                MPI_Comm comm = MPI_COMM_GEOSX );
+                MPI_Comm comm = MPI_COMM_GEOSX,
+                integer compressionLevel = 0 );
 
   /**
    * @brief Constructor
@@ -62,13 +67,15 @@ public:
    * @param[in] initAlloc How many states to preallocate the internal buffer to hold.
    * @param[in] overallocMultiple Integer to scale the internal buffer when we fill the existing space.
    * @param[in] comm A communicator where every rank will participate in writing to the output file.
+   * @param[in] compressionLevel The deflate compression level (1-9) of the dataset, 0 to disable compression.
    */
   HDFHistoryIO( string const & filename,
                 const HistoryMetadata & spec,
                 localIndex writeHead = 0,
                 localIndex initAlloc = 1,
                 localIndex overallocMultiple = 2,
-                MPI_Comm comm = MPI_COMM_GEOSX ):
+                MPI_Comm comm = MPI_COMM_GEOSX,
+                integer compressionLevel = 0 ):
     HDFHistoryIO( filename,
                   spec.getRank(),
                   spec.getDims(),
@@ -77,7 +84,8 @@ public:
                   writeHead,
                   initAlloc,
                   overallocMultiple,
-                  comm )
+                  comm,
+                  compressionLevel )
   { }
 
   /// Destructor
@@ -108,6 +116,24 @@ private:
    */
   size_t getRowBytes();
 
+  /**
+   * @brief Get the size in bytes of a buffered row for a given local index count.
+   * @param[in] localIdxCount The number of pieces of data associated with the local rank in the row
+   * @return The size in bytes.
+   */
+  size_t getRowBytes( globalIndex localIdxCount ) const;
+
+  /**
+   * @brief Write consecutive buffered rows to the dataset, starting at the write head.
+   * @param[in] numRows The number of rows to write
+   * @param[in] localIdxCount The number of pieces of data associated with the local rank in each row
+   * @param[in] dataBuffer The buffer holding the rows contiguously
+   * @note This is collective over the partition sub-communicator
+   */
+  void writeRows( localIndex numRows,
+                  globalIndex localIdxCount,
+                  buffer_unit_type const * dataBuffer );
+
   /// @brief Empty the history collection buffer
   void emptyBuffer();
 
@@ -184,6 +210,8 @@ private:
   MPI_Comm m_subcomm;
   /// Whether the size of the collected data has changed between writes to file
   int m_sizeChanged;
+  /// The deflate compression level of the dataset (0 if not compressed)
+  integer m_compressionLevel;
 };
 
 }
@@ -221,16 +221,18 @@ public:
   /**
    * @brief Calculates the isoparametric "Jacobian" transformation
    *   matrix/mapping from the parent space to the physical space on a 2D domain (face).
+   * @tparam REAL_TYPE The floating point type of the coordinates and of the computed terms
    * @param qa The 1d quadrature point index in xi0 direction (0,1)
    * @param qb The 1d quadrature point index in xi1 direction (0,1)
    * @param X Array containing the coordinates of the support points.
    * @param J Array to store the Jacobian transformation.
    */
+  template< typename REAL_TYPE >
   GEOS_HOST_DEVICE
   static void jacobianTransformation2d( int const qa,
                                         int const qb,
-                                        real64 const (&X)[numNodesPerFace][3],
-                                        real64 ( &J )[3][2] );
+                                        REAL_TYPE const (&X)[numNodesPerFace][3],
+                                        REAL_TYPE ( &J )[3][2] );
 
 
   /**
@@ -319,18 +321,20 @@ public:
   /**
    * @brief Calculates the isoparametric "Jacobian" transformation
    *   matrix/mapping from the parent space to the physical space.
+   * @tparam REAL_TYPE The floating point type of the coordinates and of the computed terms
    * @param qa The 1d quadrature point index in xi0 direction (0,1)
    * @param qb The 1d quadrature point index in xi1 direction (0,1)
    * @param qc The 1d quadrature point index in xi2 direction (0,1)
    * @param X Array containing the coordinates of the support points.
    * @param J Array to store the Jacobian transformation.
    */
+  template< typename REAL_TYPE >
   GEOS_HOST_DEVICE
   static void jacobianTransformation( int const qa,
                                       int const qb,
                                       int const qc,
-                                      real64 const (&X)[numNodes][3],
-                                      real64 ( &J )[3][3] );
+                                      REAL_TYPE const (&X)[numNodes][3],
+                                      REAL_TYPE ( &J )[3][3] );
 
   /**
    * @brief Calculates the isoparametric "Jacobian" transformation
@@ -373,31 +377,36 @@ public:
   /**
    * @brief computes the non-zero contributions of the d.o.f. indexd by q to the
    *   mass matrix M, i.e., the superposition matrix of the shape functions.
+   * @tparam REAL_TYPE The floating point type of the coordinates and of the computed terms
    * @param q The quadrature point index
    * @param X Array containing the coordinates of the support points.
    * @return The diagonal mass term associated to q
    */
+  template< typename REAL_TYPE >
   GEOS_HOST_DEVICE
-  static real64
+  static REAL_TYPE
   computeMassTerm( int q,
-                   real64 const (&X)[numNodes][3] );
+                   REAL_TYPE const (&X)[numNodes][3] );
 
   /**
    * @brief computes the non-zero contributions of the d.o.f. indexd by q to the
    *   damping matrix M, i.e., the superposition matrix of the shape functions
    *   integrated over a face.
+   * @tparam REAL_TYPE The floating point type of the coordinates and of the computed terms
    * @param q The quadrature point index
    * @param X Array containing the coordinates of the support points.
    * @return The diagonal damping term associated to q
    */
+  template< typename REAL_TYPE >
   GEOS_HOST_DEVICE
-  static real64
+  static REAL_TYPE
   computeDampingTerm( int q,
-                      real64 const (&X)[numNodesPerFace][3] );
+                      REAL_TYPE const (&X)[numNodesPerFace][3] );
 
   /**
    * @brief computes the matrix B, defined as J^{-T}J^{-1}/det(J), where J is the Jacobian matrix,
    *   at the given Gauss-Lobatto point.
+   * @tparam REAL_TYPE The floating point type of the coordinates and of the computed terms
    * @param qa The 1d quadrature point index in xi0 direction (0,1)
    * @param qb The 1d quadrature point index in xi1 direction (0,1)
    * @param qc The 1d quadrature point index in xi2 direction (0,1)
@@ -405,33 +414,36 @@ public:
    * @param J Array to store the Jacobian
    * @param B Array to store the matrix B, in Voigt notation
    */
+  template< typename REAL_TYPE >
   GEOS_HOST_DEVICE
   static void
     computeBMatrix( int const qa,
                     int const qb,
                     int const qc,
-                    real64 const (&X)[numNodes][3],
-                    real64 ( &J )[3][3],
-                    real64 ( &B )[6] );
+                    REAL_TYPE const (&X)[numNodes][3],
+                    REAL_TYPE ( &J )[3][3],
+                    REAL_TYPE ( &B )[6] );
 
   /**
    * @brief computes the non-zero contributions of the d.o.f. indexed by q to the
    *   stiffness matrix R, i.e., the superposition matrix of first derivatives
    *   of the shape functions.
+   * @tparam REAL_TYPE The floating point type of the coordinates and of the computed terms
    * @param q The quadrature point index
    * @param X Array containing the coordinates of the support points.
    * @param func Callback function accepting three parameters: i, j and R_ij
    */
-  template< typename FUNC >
+  template< typename REAL_TYPE, typename FUNC >
   GEOS_HOST_DEVICE
   static void
   computeStiffnessTerm( int q,
-                        real64 const (&X)[numNodes][3],
+                        REAL_TYPE const (&X)[numNodes][3],
                         FUNC && func );
 
   /**
    * @brief computes the matrix B in the case of quasi-stiffness (e.g. for pseudo-acoustic case), defined as J^{-T}A_xy J^{-1}/det(J), where
    * J is the Jacobian matrix, and A_xy is a zero matrix except on A_xy(1,1) = 1 and A_xy(2,2) = 1.
+   * @tparam REAL_TYPE The floating point type of the coordinates and of the computed terms
    * @param qa The 1d quadrature point index in xi0 direction (0,1)
    * @param qb The 1d quadrature point index in xi1 direction (0,1)
    * @param qc The 1d quadrature point index in xi2 direction (0,1)
@@ -439,33 +451,36 @@ public:
    * @param J Array to store the Jacobian
    * @param B Array to store the matrix B, in Voigt notation
    */
+  template< typename REAL_TYPE >
   GEOS_HOST_DEVICE
   static void
     computeBxyMatrix( int const qa,
                       int const qb,
                       int const qc,
-                      real64 const (&X)[numNodes][3],
-                      real64 ( &J )[3][3],
-                      real64 ( &B )[6] );
+                      REAL_TYPE const (&X)[numNodes][3],
+                      REAL_TYPE ( &J )[3][3],
+                      REAL_TYPE ( &B )[6] );
 
   /**
    * @brief computes the non-zero contributions of the d.o.f. indexed by q to the
    *   partial-stiffness matrix R, i.e., the superposition matrix of first derivatives in x and y
    *   of the shape functions. Warning, the matrix B is obtained by computeBxyMatrix instead of usual one.
+   * @tparam REAL_TYPE The floating point type of the coordinates and of the computed terms
    * @param q The quadrature point index
    * @param X Array containing the coordinates of the support points.
    * @param func Callback function accepting three parameters: i, j and R_ij
    */
-  template< typename FUNC >
+  template< typename REAL_TYPE, typename FUNC >
   GEOS_HOST_DEVICE
   static void
   computeStiffnessxyTerm( int q,
-                          real64 const (&X)[numNodes][3],
+                          REAL_TYPE const (&X)[numNodes][3],
                           FUNC && func );
 
   /**
    * @brief computes the matrix B in the case of quasi-stiffness (e.g. for pseudo-acoustic case), defined as J^{-T}A_z J^{-1}/det(J), where
    * J is the Jacobian matrix, and A_z is a zero matrix except on A_z(3,3) = 1.
+   * @tparam REAL_TYPE The floating point type of the coordinates and of the computed terms
    * @param qa The 1d quadrature point index in xi0 direction (0,1)
    * @param qb The 1d quadrature point index in xi1 direction (0,1)
    * @param qc The 1d quadrature point index in xi2 direction (0,1)
@@ -473,104 +488,111 @@ public:
    * @param J Array to store the Jacobian
    * @param B Array to store the matrix B, in Voigt notation
    */
+  template< typename REAL_TYPE >
   GEOS_HOST_DEVICE
   static void
     computeBzMatrix( int const qa,
                      int const qb,
                      int const qc,
-                     real64 const (&X)[numNodes][3],
-                     real64 ( &J )[3][3],
-                     real64 ( &B )[6] );
+                     REAL_TYPE const (&X)[numNodes][3],
+                     REAL_TYPE ( &J )[3][3],
+                     REAL_TYPE ( &B )[6] );
 
   /**
    * @brief computes the non-zero contributions of the d.o.f. indexed by q to the
    *   partial-stiffness matrix R, i.e., the superposition matrix of first derivatives in z only
    *   of the shape functions. Warning, the matrix B is obtained by computeBzMatrix instead of usual one.
+   * @tparam REAL_TYPE The floating point type of the coordinates and of the computed terms
    * @param q The quadrature point index
    * @param X Array containing the coordinates of the support points.
    * @param func Callback function accepting three parameters: i, j and R_ij
    */
-  template< typename FUNC >
+  template< typename REAL_TYPE, typename FUNC >
   GEOS_HOST_DEVICE
   static void
   computeStiffnesszTerm( int q,
-                         real64 const (&X)[numNodes][3],
+                         REAL_TYPE const (&X)[numNodes][3],
                          FUNC && func );
 
 /**
  * @brief Computes the "Grad(Phi)*B*Grad(Phi)" coefficient of the stiffness term. The matrix B must be provided and Phi denotes a basis
  * function.
+ * @tparam REAL_TYPE The floating point type of the coordinates and of the computed terms
  * @param qa The 1d quadrature point index in xi0 direction (0,1)
  * @param qb The 1d quadrature point index in xi1 direction (0,1)
  * @param qc The 1d quadrature point index in xi2 direction (0,1)
  * @param B Array of the B matrix, in Voigt notation
  * @param func Callback function accepting three parameters: i, j and R_ij
  */
-  template< typename FUNC >
+  template< typename REAL_TYPE, typename FUNC >
   GEOS_HOST_DEVICE
   static void
   computeGradPhiBGradPhi( int qa,
                           int qb,
                           int qc,
-                          real64 const (&B)[6],
+                          REAL_TYPE const (&B)[6],
                           FUNC && func );
 
   /**
    * @brief computes the non-zero contributions of the d.o.f. indexd by q to the
    *   x-part of the first order stiffness matrix R, i.e., the matrix composed of the
    *   the product of first derivatives of one shape function i and the shape function j itself.
+   * @tparam REAL_TYPE The floating point type of the coordinates and of the computed terms
    * @param q The quadrature point index
    * @param X Array containing the coordinates of the support points.
    * @param func Callback function accepting three parameters: i, j and R_ij
    */
-  template< typename FUNC >
+  template< typename REAL_TYPE, typename FUNC >
   GEOS_HOST_DEVICE
   static void
   computeFirstOrderStiffnessTermX( int q,
-                                   real64 const (&X)[numNodes][3],
+                                   REAL_TYPE const (&X)[numNodes][3],
                                    FUNC && func );
   /**
    * @brief computes the non-zero contributions of the d.o.f. indexd by q to the
    *   y-part of the first order stiffness matrix R, i.e., the matrix composed of the
    *   the product of first derivatives of one shape function i and the shape function j itself.
+   * @tparam REAL_TYPE The floating point type of the coordinates and of the computed terms
    * @param q The quadrature point index
    * @param X Array containing the coordinates of the support points.
    * @param func Callback function accepting three parameters: i, j and R_ij
    */
-  template< typename FUNC >
+  template< typename REAL_TYPE, typename FUNC >
   GEOS_HOST_DEVICE
   static void
   computeFirstOrderStiffnessTermY( int q,
-                                   real64 const (&X)[numNodes][3],
+                                   REAL_TYPE const (&X)[numNodes][3],
                                    FUNC && func );
   /**
    * @brief computes the non-zero contributions of the d.o.f. indexd by q to the
    *   z-part of the first order stiffness matrix R, i.e., the matrix composed of the
    *   the product of first derivatives of one shape function i and the shape function j itself.
+   * @tparam REAL_TYPE The floating point type of the coordinates and of the computed terms
    * @param q The quadrature point index
    * @param X Array containing the coordinates of the support points.
    * @param func Callback function accepting three parameters: i, j and R_ij
    */
-  template< typename FUNC >
+  template< typename REAL_TYPE, typename FUNC >
   GEOS_HOST_DEVICE
   static void
   computeFirstOrderStiffnessTermZ( int q,
-                                   real64 const (&X)[numNodes][3],
+                                   REAL_TYPE const (&X)[numNodes][3],
                                    FUNC && func );
   /**
    * @brief computes the non-zero contributions of the d.o.f. indexd by q to the
    *   stiffness matrix R for the elastic case, i.e., the superposition matrix of first derivatives
    *   of the shape functions. This callback returns the two indices indices i and j of matrix R and the value
    *   R[i][j] associated to those two indices.
+   * @tparam REAL_TYPE The floating point type of the coordinates and of the computed terms
    * @param q The quadrature point index
    * @param X Array containing the coordinates of the support points.
    * @param stiffnessVal Callback function accepting three parameters: i, j and R_ij
    */
-  template< typename FUNC >
+  template< typename REAL_TYPE, typename FUNC >
   GEOS_HOST_DEVICE
   static void
   computeFirstOrderStiffnessTerm( int q,
-                                  real64 const (&X)[numNodes][3],
+                                  REAL_TYPE const (&X)[numNodes][3],
                                   FUNC && stiffnessVal );
 
 
@@ -805,6 +827,7 @@ calcGradN( localIndex const q,
 #endif
 
 template< typename GL_BASIS >
+template< typename REAL_TYPE >
 GEOS_HOST_DEVICE
 inline
 void
@@ -812,20 +835,28 @@ Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
 jacobianTransformation( int const qa,
                         int const qb,
                         int const qc,
-                        real64 const (&X)[numNodes][3],
-                        real64 ( & J )[3][3] )
+                        REAL_TYPE const (&X)[numNodes][3],
+                        REAL_TYPE ( & J )[3][3] )
 {
+  // in reduced precision, the coordinates are taken relative to the first support point: this leaves the Jacobian
+  // unchanged, since the shape function derivatives sum to zero, but avoids cancellations for large coordinates
+  bool constexpr isReducedPrecision = sizeof( REAL_TYPE ) < sizeof( real64 );
+  REAL_TYPE const X0[3] = { isReducedPrecision ? X[0][0] : 0,
+                            isReducedPrecision ? X[0][1] : 0,
+                            isReducedPrecision ? X[0][2] : 0 };
+
   supportLoop( qa, qb, qc, [] GEOS_HOST_DEVICE ( real64 const (&dNdXi)[3],
                                                  int const nodeIndex,
-                                                 real64 const (&X)[numNodes][3],
-                                                 real64 (& J)[3][3] )
+                                                 REAL_TYPE const (&X)[numNodes][3],
+                                                 REAL_TYPE const (&X0)[3],
+                                                 REAL_TYPE (& J)[3][3] )
   {
-    real64 const * const GEOS_RESTRICT Xnode = X[nodeIndex];
+    REAL_TYPE const * const GEOS_RESTRICT Xnode = X[nodeIndex];
     for( int i = 0; i < 3; ++i )
     {
       for( int j = 0; j < 3; ++j )
       {
-        J[i][j] = J[i][j] + dNdXi[ j ] * Xnode[i];
+        J[i][j] = J[i][j] + dNdXi[ j ] * ( Xnode[i] - X0[i] );
       }
     }
 
@@ -839,7 +870,7 @@ jacobianTransformation( int const qa,
 //    J[2][1] = J[2][1] + dNdXi[1] * Xnode[2];
 //    J[2][2] = J[2][2] + dNdXi[2] * Xnode[2];
 
-  }, X, J );
+  }, X, X0, J );
 }
 template< typename GL_BASIS >
 GEOS_HOST_DEVICE
@@ -911,40 +942,49 @@ computeLocalCoords( real64 const (&Xmesh)[8][3],
 }
 
 template< typename GL_BASIS >
+template< typename REAL_TYPE >
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
 void
 Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
 jacobianTransformation2d( int const qa,
                           int const qb,
-                          real64 const (&X)[numNodesPerFace][3],
-                          real64 ( & J )[3][2] )
+                          REAL_TYPE const (&X)[numNodesPerFace][3],
+                          REAL_TYPE ( & J )[3][2] )
 {
+  // see jacobianTransformation
+  bool constexpr isReducedPrecision = sizeof( REAL_TYPE ) < sizeof( real64 );
+  REAL_TYPE const X0[3] = { isReducedPrecision ? X[0][0] : 0,
+                            isReducedPrecision ? X[0][1] : 0,
+                            isReducedPrecision ? X[0][2] : 0 };
+
   supportLoop2d( qa, qb, [] GEOS_HOST_DEVICE ( real64 const (&dNdXi)[2],
                                                int const nodeIndex,
-                                               real64 const (&X)[numNodesPerFace][3],
-                                               real64 ( & J)[3][2] )
+                                               REAL_TYPE const (&X)[numNodesPerFace][3],
+                                               REAL_TYPE const (&X0)[3],
+                                               REAL_TYPE ( & J)[3][2] )
   {
-    real64 const * const GEOS_RESTRICT Xnode = X[nodeIndex];
+    REAL_TYPE const * const GEOS_RESTRICT Xnode = X[nodeIndex];
     for( int i = 0; i < 3; ++i )
     {
       for( int j = 0; j < 2; ++j )
       {
-        J[i][j] = J[i][j] + dNdXi[ j ] * Xnode[i];
+        J[i][j] = J[i][j] + dNdXi[ j ] * ( Xnode[i] - X0[i] );
       }
     }
-  }, X, J );
+  }, X, X0, J );
 }
 
 template< typename GL_BASIS >
+template< typename REAL_TYPE >
 GEOS_HOST_DEVICE
 inline
-real64
+REAL_TYPE
 Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
 computeMassTerm( int q,
-                 real64 const (&X)[numNodes][3] )
+                 REAL_TYPE const (&X)[numNodes][3] )
 {
-  real64 J[3][3] = {{0}};
+  REAL_TYPE J[3][3] = {{0}};
   int qa, qb, qc;
   GL_BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
   jacobianTransformation( qa, qb, qc, X, J );
@@ -952,15 +992,16 @@ computeMassTerm( int q,
 }
 
 template< typename GL_BASIS >
+template< typename REAL_TYPE >
 GEOS_HOST_DEVICE
 inline
-real64
+REAL_TYPE
 Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
 computeDampingTerm( int q,
-                    real64 const (&X)[numNodesPerFace][3] )
+                    REAL_TYPE const (&X)[numNodesPerFace][3] )
 {
-  real64 B[3];
-  real64 J[3][2] = {{0}};
+  REAL_TYPE B[3];
+  REAL_TYPE J[3][2] = {{0}};
   int qa, qb;
   GL_BASIS::TensorProduct2D::multiIndex( q, qa, qb );
   jacobianTransformation2d( qa, qb, X, J );
@@ -972,6 +1013,7 @@ computeDampingTerm( int q,
 }
 
 template< typename GL_BASIS >
+template< typename REAL_TYPE >
 GEOS_HOST_DEVICE
 inline
 void
@@ -979,12 +1021,12 @@ Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
 computeBMatrix( int const qa,
                 int const qb,
                 int const qc,
-                real64 const (&X)[numNodes][3],
-                real64 (& J)[3][3],
-                real64 (& B)[6] )
+                REAL_TYPE const (&X)[numNodes][3],
+                REAL_TYPE (& J)[3][3],
+                REAL_TYPE (& B)[6] )
 {
   jacobianTransformation( qa, qb, qc, X, J );
-  real64 const detJ = LvArray::tensorOps::determinant< 3 >( J );
+  REAL_TYPE const detJ = LvArray::tensorOps::determinant< 3 >( J );
 
   // compute J^T.J/det(J), using Voigt notation for B
   B[0] = (J[0][0]*J[0][0]+J[1][0]*J[1][0]+J[2][0]*J[2][0])/detJ;
@@ -999,6 +1041,7 @@ computeBMatrix( int const qa,
 }
 
 template< typename GL_BASIS >
+template< typename REAL_TYPE >
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
 void
@@ -1006,14 +1049,14 @@ Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
 computeBzMatrix( int const qa,
                  int const qb,
                  int const qc,
-                 real64 const (&X)[numNodes][3],
-                 real64 (& J)[3][3],
-                 real64 (& B)[6] )
+                 REAL_TYPE const (&X)[numNodes][3],
+                 REAL_TYPE (& J)[3][3],
+                 REAL_TYPE (& B)[6] )
 {
   jacobianTransformation( qa, qb, qc, X, J );
-  real64 const detJ = LvArray::tensorOps::determinant< 3 >( J );
+  REAL_TYPE const detJ = LvArray::tensorOps::determinant< 3 >( J );
 
-  real64 Jinv[3][3] = {{0}};
+  REAL_TYPE Jinv[3][3] = {{0}};
   LvArray::tensorOps::invert< 3 >( Jinv, J );
 
   // compute det(J)*J^{-1}Az*J^{-T}, using Voigt notation for B
@@ -1026,6 +1069,7 @@ computeBzMatrix( int const qa,
 }
 
 template< typename GL_BASIS >
+template< typename REAL_TYPE >
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
 void
@@ -1033,14 +1077,14 @@ Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
 computeBxyMatrix( int const qa,
                   int const qb,
                   int const qc,
-                  real64 const (&X)[numNodes][3],
-                  real64 (& J)[3][3],
-                  real64 (& B)[6] )
+                  REAL_TYPE const (&X)[numNodes][3],
+                  REAL_TYPE (& J)[3][3],
+                  REAL_TYPE (& B)[6] )
 {
   jacobianTransformation( qa, qb, qc, X, J );
-  real64 const detJ = LvArray::tensorOps::determinant< 3 >( J );
+  REAL_TYPE const detJ = LvArray::tensorOps::determinant< 3 >( J );
 
-  real64 Jinv[3][3] = {{0}};
+  REAL_TYPE Jinv[3][3] = {{0}};
   LvArray::tensorOps::invert< 3 >( Jinv, J );
 
   // compute det(J)*J^{-1}Axy*J^{-T}, using Voigt notation for B
@@ -1053,7 +1097,7 @@ computeBxyMatrix( int const qa,
 }
 
 template< typename GL_BASIS >
-template< typename FUNC >
+template< typename REAL_TYPE, typename FUNC >
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
 void
@@ -1061,7 +1105,7 @@ Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
 computeGradPhiBGradPhi( int qa,
                         int qb,
                         int qc,
-                        real64 const (&B)[6],
+                        REAL_TYPE const (&B)[6],
                         FUNC && func )
 {
   // diagonal terms
@@ -1105,9 +1149,9 @@ computeGradPhiBGradPhi( int qa,
     {
       int ii = GL_BASIS::TensorProduct3D::linearIndex( qa, i, qc );
       int jj = GL_BASIS::TensorProduct3D::linearIndex( qa, qb, j );
-      real64 val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*B[3]*
-                   GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qb ) )*
-                   GL_BASIS::gradient( j, GL_BASIS::parentSupportCoord( qc ) );
+      REAL_TYPE val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*B[3]*
+                      GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qb ) )*
+                      GL_BASIS::gradient( j, GL_BASIS::parentSupportCoord( qc ) );
       func( ii, jj, val );
       func( jj, ii, val );
     }
@@ -1118,9 +1162,9 @@ computeGradPhiBGradPhi( int qa,
     {
       int ii = GL_BASIS::TensorProduct3D::linearIndex( i, qb, qc );
       int jj = GL_BASIS::TensorProduct3D::linearIndex( qa, qb, j );
-      real64 val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*B[4]*
-                   GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qa ) )*
-                   GL_BASIS::gradient( j, GL_BASIS::parentSupportCoord( qc ) );
+      REAL_TYPE val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*B[4]*
+                      GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qa ) )*
+                      GL_BASIS::gradient( j, GL_BASIS::parentSupportCoord( qc ) );
       func( ii, jj, val );
       func( jj, ii, val );
     }
@@ -1131,9 +1175,9 @@ computeGradPhiBGradPhi( int qa,
     {
       int ii = GL_BASIS::TensorProduct3D::linearIndex( i, qb, qc );
       int jj = GL_BASIS::TensorProduct3D::linearIndex( qa, j, qc );
-      real64 val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*B[5]*
-                   GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qa ) )*
-                   GL_BASIS::gradient( j, GL_BASIS::parentSupportCoord( qb ) );
+      REAL_TYPE val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*B[5]*
+                      GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qa ) )*
+                      GL_BASIS::gradient( j, GL_BASIS::parentSupportCoord( qb ) );
       func( ii, jj, val );
       func( jj, ii, val );
     }
@@ -1141,17 +1185,17 @@ computeGradPhiBGradPhi( int qa,
 }
 
 template< typename GL_BASIS >
-template< typename FUNC >
+template< typename REAL_TYPE, typename FUNC >
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
 void
 Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
 computeStiffnessxyTerm( int q,
-                        real64 const (&X)[numNodes][3],
+                        REAL_TYPE const (&X)[numNodes][3],
                         FUNC && func )
 {
-  real64 B[6] = {0};
-  real64 J[3][3] = {{0}};
+  REAL_TYPE B[6] = {0};
+  REAL_TYPE J[3][3] = {{0}};
   int qa, qb, qc;
   GL_BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
   computeBxyMatrix( qa, qb, qc, X, J, B ); // The only change!
@@ -1159,17 +1203,17 @@ computeStiffnessxyTerm( int q,
 }
 
 template< typename GL_BASIS >
-template< typename FUNC >
+template< typename REAL_TYPE, typename FUNC >
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
 void
 Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
 computeStiffnesszTerm( int q,
-                       real64 const (&X)[numNodes][3],
+                       REAL_TYPE const (&X)[numNodes][3],
                        FUNC && func )
 {
-  real64 B[6] = {0};
-  real64 J[3][3] = {{0}};
+  REAL_TYPE B[6] = {0};
+  REAL_TYPE J[3][3] = {{0}};
   int qa, qb, qc;
   GL_BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
   computeBzMatrix( qa, qb, qc, X, J, B ); // The only change!
@@ -1177,17 +1221,17 @@ computeStiffnesszTerm( int q,
 }
 
 template< typename GL_BASIS >
-template< typename FUNC >
+template< typename REAL_TYPE, typename FUNC >
 GEOS_HOST_DEVICE
 inline
 void
 Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
 computeStiffnessTerm( int q,
-                      real64 const (&X)[numNodes][3],
+                      REAL_TYPE const (&X)[numNodes][3],
                       FUNC && func )
 {
-  real64 B[6] = {0};
-  real64 J[3][3] = {{0}};
+  REAL_TYPE B[6] = {0};
+  REAL_TYPE J[3][3] = {{0}};
   int qa, qb, qc;
   GL_BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
   computeBMatrix( qa, qb, qc, X, J, B );
@@ -1232,9 +1276,9 @@ computeStiffnessTerm( int q,
     {
       int ii = GL_BASIS::TensorProduct3D::linearIndex( qa, i, qc );
       int jj = GL_BASIS::TensorProduct3D::linearIndex( qa, qb, j );
-      real64 val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*B[3]*
-                   GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qb ) )*
-                   GL_BASIS::gradient( j, GL_BASIS::parentSupportCoord( qc ) );
+      REAL_TYPE val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*B[3]*
+                      GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qb ) )*
+                      GL_BASIS::gradient( j, GL_BASIS::parentSupportCoord( qc ) );
       func( ii, jj, val );
       func( jj, ii, val );
     }
@@ -1245,9 +1289,9 @@ computeStiffnessTerm( int q,
     {
       int ii = GL_BASIS::TensorProduct3D::linearIndex( i, qb, qc );
       int jj = GL_BASIS::TensorProduct3D::linearIndex( qa, qb, j );
-      real64 val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*B[4]*
-                   GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qa ) )*
-                   GL_BASIS::gradient( j, GL_BASIS::parentSupportCoord( qc ) );
+      REAL_TYPE val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*B[4]*
+                      GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qa ) )*
+                      GL_BASIS::gradient( j, GL_BASIS::parentSupportCoord( qc ) );
       func( ii, jj, val );
       func( jj, ii, val );
     }
@@ -1258,9 +1302,9 @@ computeStiffnessTerm( int q,
     {
       int ii = GL_BASIS::TensorProduct3D::linearIndex( i, qb, qc );
       int jj = GL_BASIS::TensorProduct3D::linearIndex( qa, j, qc );
-      real64 val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*B[5]*
-                   GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qa ) )*
-                   GL_BASIS::gradient( j, GL_BASIS::parentSupportCoord( qb ) );
+      REAL_TYPE val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*B[5]*
+                      GL_BASIS::gradient( i, GL_BASIS::parentSupportCoord( qa ) )*
+                      GL_BASIS::gradient( j, GL_BASIS::parentSupportCoord( qb ) );
       func( ii, jj, val );
       func( jj, ii, val );
     }
@@ -1268,20 +1312,20 @@ computeStiffnessTerm( int q,
 }
 
 template< typename GL_BASIS >
-template< typename FUNC >
+template< typename REAL_TYPE, typename FUNC >
 GEOS_HOST_DEVICE
 inline
 void
 Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
 computeFirstOrderStiffnessTerm( int q,
-                                real64 const (&X)[numNodes][3],
+                                REAL_TYPE const (&X)[numNodes][3],
                                 FUNC && func )
 {
-  real64 J[3][3] = {{0}};
+  REAL_TYPE J[3][3] = {{0}};
   int qa, qb, qc;
   GL_BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
   jacobianTransformation( qa, qb, qc, X, J );
-  real64 const detJ = LvArray::tensorOps::invert< 3 >( J );
+  REAL_TYPE const detJ = LvArray::tensorOps::invert< 3 >( J );
   // diagonal terms
   for( int i=0; i<num1dNodes; i++ )
   {
@@ -1421,24 +1465,24 @@ computeFirstOrderStiffnessTerm( int q,
 }
 
 template< typename GL_BASIS >
-template< typename FUNC >
+template< typename REAL_TYPE, typename FUNC >
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
 void
 Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
 computeFirstOrderStiffnessTermX( int q,
-                                 real64 const (&X)[numNodes][3],
+                                 REAL_TYPE const (&X)[numNodes][3],
                                  FUNC && func )
 {
-  real64 J[3][3] = {{0}};
+  REAL_TYPE J[3][3] = {{0}};
   int qa, qb, qc;
   GL_BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
   jacobianTransformation( qa, qb, qc, X, J );
-  real64 const detJ = LvArray::tensorOps::invert< 3 >( J );
+  REAL_TYPE const detJ = LvArray::tensorOps::invert< 3 >( J );
 
   for( int i1 = 0; i1 < num1dNodes; ++i1 )
   {
-    real64 val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*GL_BASIS::gradient( i1, GL_BASIS::parentSupportCoord( qa ) );
+    REAL_TYPE val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*GL_BASIS::gradient( i1, GL_BASIS::parentSupportCoord( qa ) );
     func( GL_BASIS::TensorProduct3D::linearIndex( i1, qb, qc ),
           GL_BASIS::TensorProduct3D::linearIndex( qa, qb, qc ),
           detJ*J[0][0]*val, detJ*J[0][1]*val, detJ*J[0][2]*val );
@@ -1448,24 +1492,24 @@ computeFirstOrderStiffnessTermX( int q,
 }
 
 template< typename GL_BASIS >
-template< typename FUNC >
+template< typename REAL_TYPE, typename FUNC >
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
 void
 Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
 computeFirstOrderStiffnessTermY( int q,
-                                 real64 const (&X)[numNodes][3],
+                                 REAL_TYPE const (&X)[numNodes][3],
                                  FUNC && func )
 {
-  real64 J[3][3] = {{0}};
+  REAL_TYPE J[3][3] = {{0}};
   int qa, qb, qc;
   GL_BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
   jacobianTransformation( qa, qb, qc, X, J );
-  real64 const detJ = LvArray::tensorOps::invert< 3 >( J );
+  REAL_TYPE const detJ = LvArray::tensorOps::invert< 3 >( J );
 
   for( int i2 = 0; i2 < num1dNodes; ++i2 )
   {
-    real64 val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*GL_BASIS::gradient( i2, GL_BASIS::parentSupportCoord( qb ) );
+    REAL_TYPE val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*GL_BASIS::gradient( i2, GL_BASIS::parentSupportCoord( qb ) );
     func( GL_BASIS::TensorProduct3D::linearIndex( qa, i2, qc ),
           GL_BASIS::TensorProduct3D::linearIndex( qa, qb, qc ),
           detJ*J[1][0]*val, detJ*J[1][1]*val, detJ*J[1][2]*val );
@@ -1475,24 +1519,24 @@ computeFirstOrderStiffnessTermY( int q,
 }
 
 template< typename GL_BASIS >
-template< typename FUNC >
+template< typename REAL_TYPE, typename FUNC >
 GEOS_HOST_DEVICE
 GEOS_FORCE_INLINE
 void
 Qk_Hexahedron_Lagrange_GaussLobatto< GL_BASIS >::
 computeFirstOrderStiffnessTermZ( int q,
-                                 real64 const (&X)[numNodes][3],
+                                 REAL_TYPE const (&X)[numNodes][3],
                                  FUNC && func )
 {
-  real64 J[3][3] = {{0}};
+  REAL_TYPE J[3][3] = {{0}};
   int qa, qb, qc;
   GL_BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
   jacobianTransformation( qa, qb, qc, X, J );
-  real64 const detJ = LvArray::tensorOps::invert< 3 >( J );
+  REAL_TYPE const detJ = LvArray::tensorOps::invert< 3 >( J );
 
   for( int i3 = 0; i3 < num1dNodes; ++i3 )
   {
-    real64 val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*GL_BASIS::gradient( i3, GL_BASIS::parentSupportCoord( qc ) );
+    REAL_TYPE val = GL_BASIS::weight( qa )*GL_BASIS::weight( qb )*GL_BASIS::weight( qc )*GL_BASIS::gradient( i3, GL_BASIS::parentSupportCoord( qc ) );
     func( GL_BASIS::TensorProduct3D::linearIndex( qa, qb, i3 ),
           GL_BASIS::TensorProduct3D::linearIndex( qa, qb, qc ),
           detJ*J[2][0]*val, detJ*J[2][1]*val, detJ*J[2][2]*val );
@@ -208,6 +208,83 @@ void testKernelDriver()
     }
   } );
 }
+
+template< typename REAL_TYPE >
+void computeSEMTerms( REAL_TYPE const (&xLocal)[64][3],
+                      real64 (& mass)[64],
+                      real64 (& stiffness)[64][64],
+                      real64 (& firstOrderStiffness)[64][64] )
+{
+  for( int q = 0; q < 64; ++q )
+  {
+    mass[q] = Q3_Hexahedron_Lagrange_GaussLobatto::computeMassTerm( q, xLocal );
+    Q3_Hexahedron_Lagrange_GaussLobatto::computeStiffnessTerm( q, xLocal, [&] ( int const i, int const j, REAL_TYPE const val )
+    {
+      stiffness[i][j] += val;
+    } );
+    Q3_Hexahedron_Lagrange_GaussLobatto::computeFirstOrderStiffnessTerm( q, xLocal, [&] ( int i, int j, REAL_TYPE val, REAL_TYPE J[3][3], int p, int r )
+    {
+      firstOrderStiffness[i][j] += val * ( J[p][0] * J[r][1] + J[p][1] * J[r][0] );
+    } );
+  }
+}
+
+TEST( FiniteElementShapeFunctions, testSinglePrecisionSEMTerms )
+{
+  // distorted Q3 element: trilinear map of a sheared box with a warped corner
+  real64 const corners[8][3] = { { 0.0, 0.0, 0.0 }, { 100.0, 5.0, 0.0 }, { 10.0, 80.0, 0.0 }, { 110.0, 90.0, 5.0 },
+    { 0.0, 5.0, 120.0 }, { 95.0, 10.0, 125.0 }, { 10.0, 85.0, 115.0 }, { 120.0, 100.0, 140.0 } };
+  real64 const xi[4] = { -1.0, -1.0/sqrt( 5.0 ), 1.0/sqrt( 5.0 ), 1.0 };
+  real64 xLocal64[64][3];
+  for( int a = 0; a < 64; ++a )
+  {
+    Q3_Hexahedron_Lagrange_GaussLobatto::trilinearInterp( ( xi[a%4] + 1.0 ) / 2.0,
+                                                          ( xi[(a/4)%4] + 1.0 ) / 2.0,
+                                                          ( xi[a/16] + 1.0 ) / 2.0,
+                                                          corners,
+                                                          xLocal64[a] );
+  }
+
+  // shift the element far from the origin, as in a field-scale mesh
+  real32 xLocal32[64][3];
+  for( int a = 0; a < 64; ++a )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      xLocal64[a][i] += 1.0e4;
+      xLocal32[a][i] = xLocal64[a][i];
+      xLocal64[a][i] = xLocal32[a][i];
+    }
+  }
+
+  real64 mass64[64], mass32[64];
+  real64 stiffness64[64][64] = {{0}}, stiffness32[64][64] = {{0}};
+  real64 firstOrder64[64][64] = {{0}}, firstOrder32[64][64] = {{0}};
+  computeSEMTerms( xLocal64, mass64, stiffness64, firstOrder64 );
+  computeSEMTerms( xLocal32, mass32, stiffness32, firstOrder32 );
+
+  real64 maxStiffness = 0.0, maxFirstOrder = 0.0;
+  for( int i = 0; i < 64; ++i )
+  {
+    for( int j = 0; j < 64; ++j )
+    {
+      maxStiffness = LvArray::math::max( maxStiffness, LvArray::math::abs( stiffness64[i][j] ) );
+      maxFirstOrder = LvArray::math::max( maxFirstOrder, LvArray::math::abs( firstOrder64[i][j] ) );
+    }
+  }
+
+  // the single precision terms only differ by the round-off of the geometric factors
+  for( int i = 0; i < 64; ++i )
+  {
+    EXPECT_NEAR( mass64[i], mass32[i], 1.0e-4 * LvArray::math::abs( mass64[i] ) );
+    for( int j = 0; j < 64; ++j )
+    {
+      EXPECT_NEAR( stiffness64[i][j], stiffness32[i][j], 1.0e-4 * maxStiffness );
+      EXPECT_NEAR( firstOrder64[i][j], firstOrder32[i][j], 1.0e-4 * maxFirstOrder );
+    }
+  }
+}
+
 #ifdef GEOS_USE_DEVICE
 TEST( FiniteElementShapeFunctions, testKernelCuda )
 {
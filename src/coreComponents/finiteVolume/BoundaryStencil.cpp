@@ -66,6 +66,39 @@ void BoundaryStencil::addVectors( real64 const & transMultiplier,
   LvArray::tensorOps::copy< 3 >( m_cellToFaceVec[size], cellToFaceVec );
 }
 
+void BoundaryStencil::resize( localIndex const size )
+{
+  m_elementRegionIndices.resize( size, maxStencilSize );
+  m_elementSubRegionIndices.resize( size, maxStencilSize );
+  m_elementIndices.resize( size, maxStencilSize );
+  m_weights.resize( size, maxStencilSize );
+
+  m_faceNormal.resize( size );
+  m_cellToFaceVec.resize( size );
+  m_weightMultiplier.resize( size );
+}
+
+void BoundaryStencil::setConnection( localIndex const index,
+                                     localIndex const (&elementRegionIndices)[2],
+                                     localIndex const (&elementSubRegionIndices)[2],
+                                     localIndex const (&elementIndices)[2],
+                                     real64 const (&weights)[2],
+                                     real64 const transMultiplier,
+                                     real64 const (&faceNormal)[3],
+                                     real64 const (&cellToFaceVec)[3] )
+{
+  for( localIndex a = 0; a < 2; ++a )
+  {
+    m_elementRegionIndices( index, a ) = elementRegionIndices[a];
+    m_elementSubRegionIndices( index, a ) = elementSubRegionIndices[a];
+    m_elementIndices( index, a ) = elementIndices[a];
+    m_weights( index, a ) = weights[a];
+  }
+  m_weightMultiplier[index] = transMultiplier;
+  LvArray::tensorOps::copy< 3 >( m_faceNormal[index], faceNormal );
+  LvArray::tensorOps::copy< 3 >( m_cellToFaceVec[index], cellToFaceVec );
+}
+
 BoundaryStencil::KernelWrapper BoundaryStencil::createKernelWrapper() const
 {
   return { m_elementRegionIndices,
@@ -87,6 +87,42 @@ void CellElementStencilTPFA::addVectors( real64 const & transMultiplier,
   }
 }
 
+void CellElementStencilTPFA::resize( localIndex const size )
+{
+  m_elementRegionIndices.resize( size, maxStencilSize );
+  m_elementSubRegionIndices.resize( size, maxStencilSize );
+  m_elementIndices.resize( size, maxStencilSize );
+  m_weights.resize( size, maxStencilSize );
+
+  m_faceNormal.resize( size );
+  m_cellToFaceVec.resize( size );
+  m_transMultiplier.resize( size );
+  m_geometricStabilizationCoef.resize( size );
+}
+
+void CellElementStencilTPFA::setConnection( localIndex const index,
+                                            localIndex const (&elementRegionIndices)[2],
+                                            localIndex const (&elementSubRegionIndices)[2],
+                                            localIndex const (&elementIndices)[2],
+                                            real64 const (&weights)[2],
+                                            real64 const transMultiplier,
+                                            real64 const geometricStabilizationCoef,
+                                            real64 const (&faceNormal)[3],
+                                            real64 const (&cellToFaceVec)[2][3] )
+{
+  for( localIndex a = 0; a < 2; ++a )
+  {
+    m_elementRegionIndices( index, a ) = elementRegionIndices[a];
+    m_elementSubRegionIndices( index, a ) = elementSubRegionIndices[a];
+    m_elementIndices( index, a ) = elementIndices[a];
+    m_weights( index, a ) = weights[a];
+    LvArray::tensorOps::copy< 3 >( m_cellToFaceVec[index][a], cellToFaceVec[a] );
+  }
+  LvArray::tensorOps::copy< 3 >( m_faceNormal[index], faceNormal );
+  m_transMultiplier[index] = transMultiplier;
+  m_geometricStabilizationCoef[index] = geometricStabilizationCoef;
+}
+
 CellElementStencilTPFA::KernelWrapper
 CellElementStencilTPFA::createKernelWrapper() const
 {
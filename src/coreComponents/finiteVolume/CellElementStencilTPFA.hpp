@@ -169,6 +169,38 @@ public:
                    real64 const (&faceNormal)[3],
                    real64 const (&cellToFaceVec)[2][3] );
 
+  /**
+   * @brief Resize the stencil to a given number of entries.
+   * @param[in] size the new number of stencil entries
+   *
+   * The new entries must then be filled with setConnection(), which does not
+   * reallocate and can therefore be called concurrently for distinct entries.
+   */
+  void resize( localIndex const size );
+
+  /**
+   * @brief Set all the data of a stencil entry allocated with resize().
+   * @param[in] index the index of the stencil entry
+   * @param[in] elementRegionIndices the element region indices of the two cells
+   * @param[in] elementSubRegionIndices the element subregion indices of the two cells
+   * @param[in] elementIndices the element indices of the two cells
+   * @param[in] weights the weights of the two cells
+   * @param[in] transMultiplier the transmissibility multiplier
+   * @param[in] geometricStabilizationCoef the stabilization weight
+   * @param[in] faceNormal the normal to the face
+   * @param[in] cellToFaceVec distance vector between the cell centers and the face
+   * @note The connector index of the entry must be recorded separately with setConnectorIndex().
+   */
+  void setConnection( localIndex const index,
+                      localIndex const (&elementRegionIndices)[2],
+                      localIndex const (&elementSubRegionIndices)[2],
+                      localIndex const (&elementIndices)[2],
+                      real64 const (&weights)[2],
+                      real64 const transMultiplier,
+                      real64 const geometricStabilizationCoef,
+                      real64 const (&faceNormal)[3],
+                      real64 const (&cellToFaceVec)[2][3] );
+
   /**
    * @brief Return the stencil size.
    * @return the stencil size
@@ -197,6 +197,17 @@ public:
    */
   virtual bool zero( localIndex const connectorIndex );
 
+  /**
+   * @brief Associate a connector element to an existing stencil entry.
+   * @param[in] connectorIndex The index of the connector element that the stencil acts across
+   * @param[in] index The index of the stencil entry
+   *
+   * This is meant to be used along with the bulk insertion of stencil entries,
+   * since add() already records the connector of the new entry.
+   */
+  void setConnectorIndex( localIndex const connectorIndex, localIndex const index )
+  { m_connectorIndices[connectorIndex] = index; }
+
   /**
    * @brief Give the number of stencil entries.
    * @return The number of stencil entries
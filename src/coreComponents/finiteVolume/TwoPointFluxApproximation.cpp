@@ -132,46 +132,81 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
     regionFilter.insert( ei );
   } );
 
-  stencil.reserve( faceManager.size() );
+  SortedArrayView< localIndex const > const regionFilterView = regionFilter.toViewConst();
+  ElementRegionManager::ElementViewConst< arrayView2d< real64 const > > const elemCenterView = elemCenter.toNestedViewConst();
+  ElementRegionManager::ElementViewConst< arrayView1d< globalIndex const > > const elemGlobalIndexView = elemGlobalIndex.toNestedViewConst();
+  ElementRegionManager::ElementViewConst< arrayView1d< integer const > > const elemGhostRankView = elemGhostRank.toNestedViewConst();
 
   real64 const lengthTolerance = m_lengthScale * m_areaRelTol;
   real64 const areaTolerance = lengthTolerance * lengthTolerance;
 
-  forAll< serialPolicy >( faceManager.size(), [=, &stencil]( localIndex const kf )
+  auto const isConnectionCandidate = [=]( localIndex const kf )
   {
     // Filter out boundary faces
     if( elemList[kf][0] < 0 || elemList[kf][1] < 0 || isZero( transMultiplier[kf] ) )
     {
-      return;
+      return false;
     }
 
     // Filter out faces where neither cell is locally owned
-    if( elemGhostRank[elemRegionList[kf][0]][elemSubRegionList[kf][0]][elemList[kf][0]] >= 0 &&
-        elemGhostRank[elemRegionList[kf][1]][elemSubRegionList[kf][1]][elemList[kf][1]] >= 0 )
+    if( elemGhostRankView[elemRegionList[kf][0]][elemSubRegionList[kf][0]][elemList[kf][0]] >= 0 &&
+        elemGhostRankView[elemRegionList[kf][1]][elemSubRegionList[kf][1]][elemList[kf][1]] >= 0 )
     {
-      return;
+      return false;
     }
 
     // Filter out faces where either of two cells is outside of target regions
-    if( !( regionFilter.contains( elemRegionList[kf][0] ) && regionFilter.contains( elemRegionList[kf][1] ) ) )
+    return regionFilterView.contains( elemRegionList[kf][0] ) && regionFilterView.contains( elemRegionList[kf][1] );
+  };
+
+  // The stencil is built in two passes over the faces, so that the connections can be written concurrently.
+  // First pass: compute the geometry of the candidate faces and flag the faces that give a connection,
+  // then get the position of each connection by a prefix sum.
+  array1d< localIndex > connectionOffsets( faceManager.size() + 1 );
+  arrayView1d< localIndex > const connectionOffsetsView = connectionOffsets.toView();
+  array1d< real64 > faceAreas( faceManager.size() );
+  array2d< real64 > faceCenters( faceManager.size(), 3 );
+  array2d< real64 > faceNormals( faceManager.size(), 3 );
+  arrayView1d< real64 > const faceAreaView = faceAreas.toView();
+  arrayView2d< real64 > const faceCenterView = faceCenters.toView();
+  arrayView2d< real64 > const faceNormalView = faceNormals.toView();
+
+  forAll< parallelHostPolicy >( faceManager.size(), [=]( localIndex const kf )
+  {
+    if( !isConnectionCandidate( kf ) )
     {
       return;
     }
 
-    real64 faceCenter[ 3 ], faceNormal[ 3 ], cellToFaceVec[2][ 3 ];
-    real64 const faceArea = computationalGeometry::centroid_3DPolygon( faceToNodes[kf], X, faceCenter, faceNormal, areaTolerance );
+    faceAreaView[kf] = computationalGeometry::centroid_3DPolygon( faceToNodes[kf], X, faceCenterView[kf], faceNormalView[kf], areaTolerance );
+    if( faceAreaView[kf] >= areaTolerance )
+    {
+      connectionOffsetsView[kf + 1] = 1;
+    }
+  } );
+
+  RAJA::inclusive_scan_inplace< parallelHostPolicy >( RAJA::make_span( connectionOffsets.data(), connectionOffsets.size() ) );
 
-    if( faceArea < areaTolerance )
+  localIndex const firstConnection = stencil.size();
+  stencil.resize( firstConnection + connectionOffsets.back() );
+
+  // Second pass: compute the connections and write them at their final position
+  forAll< parallelHostPolicy >( faceManager.size(), [=, &stencil]( localIndex const kf )
+  {
+    if( connectionOffsetsView[kf + 1] == connectionOffsetsView[kf] )
     {
       return;
     }
 
-    stackArray1d< localIndex, 2 > regionIndex( 2 );
-    stackArray1d< localIndex, 2 > subRegionIndex( 2 );
-    stackArray1d< localIndex, 2 > elementIndex( 2 );
-    stackArray1d< real64, 2 > stencilWeights( 2 );
-    stackArray1d< real64, 2 > stencilStabilizationWeights( 2 );
-    stackArray1d< globalIndex, 2 > stencilCellsGlobalIndex( 2 );
+    real64 faceNormal[ 3 ], cellToFaceVec[2][ 3 ];
+    LvArray::tensorOps::copy< 3 >( faceNormal, faceNormalView[kf] );
+
+    localIndex regionIndex[2];
+    localIndex subRegionIndex[2];
+    localIndex elementIndex[2];
+    real64 stencilWeights[2];
+    real64 stencilStabilizationWeights[2];
+    globalIndex stencilCellsGlobalIndex[2];
 
     for( localIndex ke = 0; ke < 2; ++ke )
     {
@@ -182,15 +217,15 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
       regionIndex[ke] = er;
       subRegionIndex[ke] = esr;
       elementIndex[ke] = ei;
-      stencilCellsGlobalIndex[ke] = elemGlobalIndex[er][esr][ei];
+      stencilCellsGlobalIndex[ke] = elemGlobalIndexView[er][esr][ei];
 
-      LvArray::tensorOps::copy< 3 >( cellToFaceVec[ke], faceCenter );
-      LvArray::tensorOps::subtract< 3 >( cellToFaceVec[ke], elemCenter[er][esr][ei] );
+      LvArray::tensorOps::copy< 3 >( cellToFaceVec[ke], faceCenterView[kf] );
+      LvArray::tensorOps::subtract< 3 >( cellToFaceVec[ke], elemCenterView[er][esr][ei] );
 
       real64 const c2fDistance = LvArray::tensorOps::normalize< 3 >( cellToFaceVec[ke] );
 
-      stencilWeights[ke] = faceArea / c2fDistance;
-      stencilStabilizationWeights[ke] = faceArea * c2fDistance;
+      stencilWeights[ke] = faceAreaView[kf] / c2fDistance;
+      stencilStabilizationWeights[ke] = faceAreaView[kf] * c2fDistance;
     }
 
     real64 const sumStabilizationWeight =
@@ -203,21 +238,30 @@ void TwoPointFluxApproximation::computeCellStencil( MeshLevel & mesh ) const
       std::swap( subRegionIndex[0], subRegionIndex[1] );
       std::swap( elementIndex[0], elementIndex[1] );
       std::swap( stencilWeights[0], stencilWeights[1] );
-      std::swap( stencilStabilizationWeights[0], stencilStabilizationWeights[1] );
       std::swap( cellToFaceVec[0][0], cellToFaceVec[1][0] );
       std::swap( cellToFaceVec[0][1], cellToFaceVec[1][1] );
       std::swap( cellToFaceVec[0][2], cellToFaceVec[1][2] );
     }
 
-    stencil.add( 2,
-                 regionIndex.data(),
-                 subRegionIndex.data(),
-                 elementIndex.data(),
-                 stencilWeights.data(),
-                 kf );
-
-    stencil.addVectors( transMultiplier[kf], sumStabilizationWeight, faceNormal, cellToFaceVec );
+    stencil.setConnection( firstConnection + connectionOffsetsView[kf],
+                           regionIndex,
+                           subRegionIndex,
+                           elementIndex,
+                           stencilWeights,
+                           transMultiplier[kf],
+                           sumStabilizationWeight,
+                           faceNormal,
+                           cellToFaceVec );
   } );
+
+  // The connector map is not thread-safe, fill it afterwards
+  for( localIndex kf = 0; kf < faceManager.size(); ++kf )
+  {
+    if( connectionOffsets[kf + 1] > connectionOffsets[kf] )
+    {
+      stencil.setConnectorIndex( kf, firstConnection + connectionOffsets[kf] );
+    }
+  }
 }
 
 void TwoPointFluxApproximation::registerFractureStencil( Group & stencilGroup ) const
@@ -1006,20 +1050,58 @@ void TwoPointFluxApproximation::computeBoundaryStencil( MeshLevel & mesh,
     regionFilter.insert( elemManager.getRegions().getIndex( regionName ) );
   }
 
-  constexpr localIndex numPts = BoundaryStencil::maxNumPointsInFlux;
+  SortedArrayView< localIndex const > const regionFilterView = regionFilter.toViewConst();
+  ElementRegionManager::ElementViewConst< arrayView2d< real64 const > > const elemCenterView = elemCenter.toNestedViewConst();
+  ElementRegionManager::ElementViewConst< arrayView1d< integer const > > const elemGhostRankView = elemGhostRank.toNestedViewConst();
 
-  stackArray1d< localIndex, numPts > stencilRegionIndices( numPts );
-  stackArray1d< localIndex, numPts > stencilSubRegionIndices( numPts );
-  stackArray1d< localIndex, numPts > stencilElemOrFaceIndices( numPts );
-  stackArray1d< real64, numPts > stencilWeights( numPts );
+  constexpr localIndex numPts = BoundaryStencil::maxNumPointsInFlux;
 
   real64 const lengthTolerance = m_lengthScale * m_areaRelTol;
   real64 const areaTolerance = lengthTolerance * lengthTolerance;
 
-  // loop over faces and calculate faceArea, faceNormal and faceCenter
-  stencil.reserve( faceSet.size() );
-  for( localIndex kf : faceSet )
+  auto const isConnection = [=]( localIndex const kf, localIndex const ke )
+  {
+    localIndex const er  = elemRegionList[kf][ke];
+    localIndex const esr = elemSubRegionList[kf][ke];
+    localIndex const ei  = elemList[kf][ke];
+
+    // Filter out elements not locally present, not in target regions,
+    // or ghosted - to be handled by the owning rank
+    return er >= 0 && regionFilterView.contains( er ) && elemGhostRankView[er][esr][ei] < 0;
+  };
+
+  // The stencil is built in two passes over the faces, so that the connections can be written concurrently.
+  // First pass: count the connections of each face, then get the position of the connections by a prefix sum.
+  array1d< localIndex > connectionOffsets( faceSet.size() + 1 );
+  arrayView1d< localIndex > const connectionOffsetsView = connectionOffsets.toView();
+
+  forAll< parallelHostPolicy >( faceSet.size(), [=]( localIndex const i )
+  {
+    for( localIndex ke = 0; ke < numPts; ++ke )
+    {
+      if( isConnection( faceSet[i], ke ) )
+      {
+        ++connectionOffsetsView[i + 1];
+      }
+    }
+  } );
+
+  RAJA::inclusive_scan_inplace< parallelHostPolicy >( RAJA::make_span( connectionOffsets.data(), connectionOffsets.size() ) );
+
+  localIndex const firstConnection = stencil.size();
+  stencil.resize( firstConnection + connectionOffsets.back() );
+
+  // Second pass: compute faceArea, faceNormal and faceCenter, and write the connections at their final position
+  forAll< parallelHostPolicy >( faceSet.size(), [=, &stencil]( localIndex const i )
   {
+    localIndex connection = firstConnection + connectionOffsetsView[i];
+    if( connection == firstConnection + connectionOffsetsView[i + 1] )
+    {
+      return;
+    }
+
+    localIndex const kf = faceSet[i];
+
     real64 faceCenter[ 3 ];
     real64 faceNormal[ 3 ];
     real64 const faceArea = computationalGeometry::centroid_3DPolygon( faceToNodes[kf],
@@ -1030,31 +1112,18 @@ void TwoPointFluxApproximation::computeBoundaryStencil( MeshLevel & mesh,
 
     for( localIndex ke = 0; ke < numPts; ++ke )
     {
-      localIndex const er  = elemRegionList[kf][ke];
-      localIndex const esr = elemSubRegionList[kf][ke];
-      localIndex const ei  = elemList[kf][ke];
-
-      // Filter out elements not locally present
-      if( er < 0 )
+      if( !isConnection( kf, ke ) )
       {
         continue;
       }
 
-      // Filter out elements not in target regions
-      if( !regionFilter.contains( er ) )
-      {
-        continue;
-      }
-
-      // Filter out ghosted elements - to be handled by the owning rank
-      if( elemGhostRank[er][esr][ei] >= 0 )
-      {
-        continue;
-      }
+      localIndex const er  = elemRegionList[kf][ke];
+      localIndex const esr = elemSubRegionList[kf][ke];
+      localIndex const ei  = elemList[kf][ke];
 
       real64 cellToFaceVec[ 3 ];
       LvArray::tensorOps::copy< 3 >( cellToFaceVec, faceCenter );
-      LvArray::tensorOps::subtract< 3 >( cellToFaceVec, elemCenter[ er ][ esr ][ ei ] );
+      LvArray::tensorOps::subtract< 3 >( cellToFaceVec, elemCenterView[ er ][ esr ][ ei ] );
 
       if( LvArray::tensorOps::AiBi< 3 >( cellToFaceVec, faceNormal ) < 0.0 )
       {
@@ -1064,6 +1133,11 @@ void TwoPointFluxApproximation::computeBoundaryStencil( MeshLevel & mesh,
       real64 const c2fDistance = LvArray::tensorOps::normalize< 3 >( cellToFaceVec );
       real64 const faceWeight = faceArea / c2fDistance;
 
+      localIndex stencilRegionIndices[numPts];
+      localIndex stencilSubRegionIndices[numPts];
+      localIndex stencilElemOrFaceIndices[numPts];
+      real64 stencilWeights[numPts];
+
       stencilRegionIndices[BoundaryStencil::Order::ELEM] = er;
       stencilSubRegionIndices[BoundaryStencil::Order::ELEM] = esr;
       stencilElemOrFaceIndices[BoundaryStencil::Order::ELEM] = ei;
@@ -1074,14 +1148,23 @@ void TwoPointFluxApproximation::computeBoundaryStencil( MeshLevel & mesh,
       stencilElemOrFaceIndices[BoundaryStencil::Order::FACE] = kf;
       stencilWeights[BoundaryStencil::Order::FACE] = -faceWeight;
 
-      stencil.add( stencilRegionIndices.size(),
-                   stencilRegionIndices.data(),
-                   stencilSubRegionIndices.data(),
-                   stencilElemOrFaceIndices.data(),
-                   stencilWeights.data(),
-                   kf );
+      stencil.setConnection( connection++,
+                             stencilRegionIndices,
+                             stencilSubRegionIndices,
+                             stencilElemOrFaceIndices,
+                             stencilWeights,
+                             transMultiplier[kf],
+                             faceNormal,
+                             cellToFaceVec );
+    }
+  } );
 
-      stencil.addVectors( transMultiplier[kf], faceNormal, cellToFaceVec );
+  // The connector map is not thread-safe, fill it afterwards (the last connection of a face is recorded, as in add())
+  for( localIndex i = 0; i < faceSet.size(); ++i )
+  {
+    if( connectionOffsets[i + 1] > connectionOffsets[i] )
+    {
+      stencil.setConnectorIndex( faceSet[i], firstConnection + connectionOffsets[i + 1] - 1 );
     }
   }
 }
@@ -19,19 +19,175 @@
 #include "MultivariableTableFunction.hpp"
 
 #include "common/DataTypes.hpp"
+#include "common/TimingMacros.hpp"
 #include <algorithm>
+#include <cstdio>
+#include <iterator>
 
 namespace geos
 {
 
 using namespace dataRepository;
 
+namespace
+{
+
+/// Identifier written at the beginning of the point cache files (to be changed when the format changes)
+constexpr char pointCacheMagic[8] = { 'G', 'E', 'O', 'S', 'O', 'B', 'L', '1' };
+
+/**
+ * @brief Write the header of a point cache file, describing the table discretization
+ * @param[in] os the output stream
+ * @param[in] numOps the number of operators
+ * @param[in] axisPoints the number of points of each axis
+ * @param[in] axisMinimums the minimum coordinate of each axis
+ * @param[in] axisMaximums the maximum coordinate of each axis
+ */
+void writePointCacheHeader( std::ostream & os,
+                            integer const numOps,
+                            arrayView1d< integer const > const & axisPoints,
+                            arrayView1d< real64 const > const & axisMinimums,
+                            arrayView1d< real64 const > const & axisMaximums )
+{
+  integer const numDims = LvArray::integerConversion< integer >( axisPoints.size() );
+  os.write( pointCacheMagic, sizeof( pointCacheMagic ) );
+  os.write( reinterpret_cast< char const * >( &numDims ), sizeof( numDims ) );
+  os.write( reinterpret_cast< char const * >( &numOps ), sizeof( numOps ) );
+  for( integer i = 0; i < numDims; ++i )
+  {
+    os.write( reinterpret_cast< char const * >( &axisPoints[i] ), sizeof( integer ) );
+    os.write( reinterpret_cast< char const * >( &axisMinimums[i] ), sizeof( real64 ) );
+    os.write( reinterpret_cast< char const * >( &axisMaximums[i] ), sizeof( real64 ) );
+  }
+}
+
+/**
+ * @brief Read the header of a point cache file and check that it matches the table discretization
+ * @param[in] is the input stream
+ * @param[in] numOps the number of operators
+ * @param[in] axisPoints the number of points of each axis
+ * @param[in] axisMinimums the minimum coordinate of each axis
+ * @param[in] axisMaximums the maximum coordinate of each axis
+ * @return true if the cache file has been generated for the same table discretization
+ */
+bool readPointCacheHeader( std::istream & is,
+                           integer const numOps,
+                           arrayView1d< integer const > const & axisPoints,
+                           arrayView1d< real64 const > const & axisMinimums,
+                           arrayView1d< real64 const > const & axisMaximums )
+{
+  char magic[sizeof( pointCacheMagic )]{};
+  integer numDims = 0;
+  integer numOpsRead = 0;
+  if( !is.read( magic, sizeof( magic ) ) ||
+      !std::equal( magic, magic + sizeof( magic ), pointCacheMagic ) ||
+      !is.read( reinterpret_cast< char * >( &numDims ), sizeof( numDims ) ) ||
+      !is.read( reinterpret_cast< char * >( &numOpsRead ), sizeof( numOpsRead ) ) ||
+      numDims != axisPoints.size() ||
+      numOpsRead != numOps )
+  {
+    return false;
+  }
+  for( integer i = 0; i < numDims; ++i )
+  {
+    integer points = 0;
+    real64 minimum = 0.0;
+    real64 maximum = 0.0;
+    if( !is.read( reinterpret_cast< char * >( &points ), sizeof( points ) ) ||
+        !is.read( reinterpret_cast< char * >( &minimum ), sizeof( minimum ) ) ||
+        !is.read( reinterpret_cast< char * >( &maximum ), sizeof( maximum ) ) ||
+        points != axisPoints[i] || minimum != axisMinimums[i] || maximum != axisMaximums[i] )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
 MultivariableTableFunction::MultivariableTableFunction( const string & name,
                                                         Group * const parent ):
   FunctionBase( name, parent )
 {}
 
-void MultivariableTableFunction::initializeFunctionFromFile( string const & filename )
+void MultivariableTableFunction::initializeFunctionFromFile( string const & filename,
+                                                             bool const useNodeSharedStorage )
+{
+#if defined( GEOS_USE_DEVICE )
+  // the kernels read the table on the device, where the node-shared host memory is not accessible
+  GEOS_WARNING_IF( useNodeSharedStorage,
+                   catalogName() << " " << getDataContext() << ": node-shared storage is not supported on device, the table is stored per rank" );
+  m_useNodeSharedStorage = false;
+#else
+  m_useNodeSharedStorage = useNodeSharedStorage;
+#endif
+
+  if( !m_useNodeSharedStorage )
+  {
+    readTableFile( filename );
+    initializeFunction();
+    return;
+  }
+
+  // only the node leader reads the file, the other ranks of the node only receive the table coordinates
+  MPI_Comm const nodeComm = MpiWrapper::nodeComm();
+  string errorMessage;
+  if( NodeSharedBuffer::isNodeLeader() )
+  {
+    try
+    {
+      readTableFile( filename );
+    }
+    catch( std::exception const & e )
+    {
+      errorMessage = e.what();
+    }
+  }
+  integer const failed = MpiWrapper::max( errorMessage.empty() ? 0 : 1, nodeComm );
+  GEOS_THROW_IF( failed > 0,
+                 ( errorMessage.empty() ? catalogName() + " " + getDataContext().toString() + ": could not read input file " + filename : errorMessage ),
+                 InputError );
+
+  integer numDims = m_numDims;
+  integer numOps = m_numOps;
+  MpiWrapper::broadcast( numDims, 0, nodeComm );
+  MpiWrapper::broadcast( numOps, 0, nodeComm );
+
+  real64_array axisMinimums( numDims ), axisMaximums( numDims );
+  integer_array axisPoints( numDims );
+  if( NodeSharedBuffer::isNodeLeader() )
+  {
+    axisMinimums = m_axisMinimums;
+    axisMaximums = m_axisMaximums;
+    axisPoints = m_axisPoints;
+  }
+  MpiWrapper::bcast( axisMinimums.data(), numDims, 0, nodeComm );
+  MpiWrapper::bcast( axisMaximums.data(), numDims, 0, nodeComm );
+  MpiWrapper::bcast( axisPoints.data(), numDims, 0, nodeComm );
+
+  setTableCoordinates( numDims, numOps, axisMinimums, axisMaximums, axisPoints );
+  initializeFunction();
+}
+
+void MultivariableTableFunction::initializeAdaptiveFunctionFromFile( string const & filename,
+                                                                     PointGenerator generator,
+                                                                     string const & pointCacheFile )
+{
+  readTableFile( filename, false );
+  setPointGenerator( std::move( generator ), pointCacheFile );
+  initializeFunction();
+}
+
+void MultivariableTableFunction::setPointGenerator( PointGenerator generator,
+                                                    string const & pointCacheFile )
+{
+  m_pointGenerator = std::move( generator );
+  m_pointCacheFile = pointCacheFile;
+}
+
+void MultivariableTableFunction::readTableFile( string const & filename,
+                                                bool const readValues )
 {
   std::ifstream file( filename.c_str() );
   GEOS_THROW_IF( !file, catalogName() << " " << getDataContext() << ": could not read input file " << filename, InputError );
@@ -77,6 +233,14 @@ void MultivariableTableFunction::initializeFunctionFromFile( string const & file
     numPointsTotal *= axisPoints[i];
   }
 
+  setTableCoordinates( numDims, numOps, axisMinimums, axisMaximums, axisPoints );
+
+  // adaptive tables only need the table coordinates, the values are generated on demand
+  if( !readValues )
+  {
+    return;
+  }
+
   // lets limit the point storage size with 1 Gb (taking into account that hypercube storage is 2^numDim larger)
   real64 pointStorageMemoryLimitGB = 1;
 
@@ -103,9 +267,6 @@ void MultivariableTableFunction::initializeFunctionFromFile( string const & file
   GEOS_THROW_IF( file, catalogName() << " " << getDataContext() << ": table file is longer than expected", InputError );
 
   file.close();
-
-  setTableCoordinates( numDims, numOps, axisMinimums, axisMaximums, axisPoints );
-  initializeFunction();
 }
 
 
@@ -202,9 +363,26 @@ void MultivariableTableFunction::initializeFunction()
   }
 
 
-  // check is point data size is correct
-  GEOS_THROW_IF_NE_MSG( globalIndex( numTablePoints ) * m_numOps, m_pointData.size(), catalogName() << " " << getDataContext() <<
-                        ": table values array is expected to have length of " + std::to_string( globalIndex( numTablePoints ) * m_numOps ), InputError );
+  // adaptive table: no value is available yet, only the generated points cached in previous runs are loaded
+  if( isAdaptive() )
+  {
+    GEOS_THROW_IF_GT_MSG( numTablePoints, real64( std::numeric_limits< globalIndex >::max() ),
+                          catalogName() << " " << getDataContext() << ": the number of table points exceeds the index range",
+                          InputError );
+    m_pointData = real64_array();
+    m_hypercubeData.resize( 0 );
+    m_hypercubeIndices.resize( 0 );
+    m_generatedPoints.clear();
+    m_generatedPointData.clear();
+    readPointCache();
+    return;
+  }
+
+  // check is point data size is correct (with node-shared storage, only the node leader holds the point data)
+  bool const hasPointData = !m_useNodeSharedStorage || NodeSharedBuffer::isNodeLeader();
+  GEOS_THROW_IF( hasPointData && globalIndex( numTablePoints ) * m_numOps != m_pointData.size(),
+                 catalogName() << " " << getDataContext() <<
+                 ": table values array is expected to have length of " + std::to_string( globalIndex( numTablePoints ) * m_numOps ), InputError );
 
   // lets limit the hypercube storage size with 16 Gb
   real64 hypercubeStorageMemoryLimitGB = 16;
@@ -216,10 +394,37 @@ void MultivariableTableFunction::initializeFunction()
                         InputError );
 
   // initialize hypercube data storage
-  m_hypercubeData.resize( numTableHypercubes * m_numVerts * m_numOps );
+  localIndex const hypercubeDataSize = numTableHypercubes * m_numVerts * m_numOps;
+  if( m_useNodeSharedStorage )
+  {
+    m_hypercubeData.resize( 0 );
+    m_sharedHypercubeData.allocateAndFill( hypercubeDataSize, [&]( real64 * const hypercubeData )
+    {
+      fillHypercubeData( hypercubeData );
+    } );
+
+    // the point data has been copied into the shared storage and is no longer needed
+    m_pointData = real64_array();
+  }
+  else
+  {
+    m_sharedHypercubeData.free();
+    m_hypercubeData.resize( hypercubeDataSize );
+    fillHypercubeData( m_hypercubeData.data() );
+  }
+}
+
+void MultivariableTableFunction::fillHypercubeData( real64 * const hypercubeData ) const
+{
+  globalIndex numTableHypercubes = 1;
+  for( int dim = 0; dim < m_numDims; dim++ )
+  {
+    numTableHypercubes *= m_axisPoints[dim] - 1;
+  }
+
   globalIndex_array points( m_numVerts );
 
-  // fill each hypercube directly on the device with corresponding data from m_pointData
+  // fill each hypercube with corresponding data from m_pointData
   for( auto i = 0; i < numTableHypercubes; i++ )
   {
     getHypercubePoints( i, points );
@@ -228,10 +433,239 @@ void MultivariableTableFunction::initializeFunction()
     {
       std::copy( m_pointData.begin() + points[j] * m_numOps,
                  m_pointData.begin() + (points[j] + 1) * m_numOps,
-                 m_hypercubeData.begin() + m_numOps * (i * m_numVerts + j));
+                 hypercubeData + m_numOps * (i * m_numVerts + j));
+    }
+  }
+}
+
+void MultivariableTableFunction::getPointCoordinates( globalIndex const pointIndex,
+                                                      real64 * const coordinates ) const
+{
+  globalIndex remainder = pointIndex;
+  for( integer i = 0; i < m_numDims; ++i )
+  {
+    globalIndex const axisIndex = remainder / m_axisPointMults[i];
+    remainder = remainder % m_axisPointMults[i];
+    coordinates[i] = m_axisMinimums[i] + axisIndex * m_axisSteps[i];
+  }
+}
+
+void MultivariableTableFunction::generateHypercubes( arrayView1d< globalIndex const > const & hypercubeIndices )
+{
+  GEOS_MARK_FUNCTION;
+
+  GEOS_ERROR_IF( !isAdaptive(), catalogName() << " " << getDataContext() << ": hypercubes can only be generated in adaptive tables" );
+
+  m_hypercubeIndices.move( hostMemorySpace, false );
+  m_hypercubeData.move( hostMemorySpace, false );
+
+  // 1. find the hypercubes missing on this rank, and the points needed to build them
+  std::vector< globalIndex > newHypercubes;
+  std::vector< globalIndex > missingPoints;
+  globalIndex_array points( m_numVerts );
+  for( globalIndex const hypercubeIndex : hypercubeIndices )
+  {
+    if( std::binary_search( m_hypercubeIndices.begin(), m_hypercubeIndices.end(), hypercubeIndex ) )
+    {
+      continue;
+    }
+    newHypercubes.push_back( hypercubeIndex );
+    getHypercubePoints( hypercubeIndex, points );
+    for( integer j = 0; j < m_numVerts; ++j )
+    {
+      if( m_generatedPoints.count( points[j] ) == 0 )
+      {
+        missingPoints.push_back( points[j] );
+      }
+    }
+  }
+  std::sort( missingPoints.begin(), missingPoints.end() );
+  missingPoints.erase( std::unique( missingPoints.begin(), missingPoints.end() ), missingPoints.end() );
+
+  // 2. gather the points missing on all the ranks in a single batch, so that each of them is only evaluated once
+  localIndex const maxNumMissingPoints = MpiWrapper::max( LvArray::integerConversion< localIndex >( missingPoints.size() ) );
+  if( maxNumMissingPoints > 0 )
+  {
+    array1d< globalIndex > localPoints( maxNumMissingPoints );
+    localPoints.setValues< serialPolicy >( -1 );
+    std::copy( missingPoints.begin(), missingPoints.end(), localPoints.begin() );
+
+    array1d< globalIndex > allPoints;
+    MpiWrapper::allGather( localPoints.toViewConst(), allPoints );
+
+    std::vector< globalIndex > pointsToGenerate;
+    std::copy_if( allPoints.begin(), allPoints.end(), std::back_inserter( pointsToGenerate ),
+                  []( globalIndex const pointIndex ) { return pointIndex >= 0; } );
+    std::sort( pointsToGenerate.begin(), pointsToGenerate.end() );
+    pointsToGenerate.erase( std::unique( pointsToGenerate.begin(), pointsToGenerate.end() ), pointsToGenerate.end() );
+
+    generatePoints( pointsToGenerate );
+  }
+
+  if( newHypercubes.empty() )
+  {
+    return;
+  }
+
+  // 3. build the new hypercubes and merge them with the existing ones, keeping the hypercubes sorted by index
+  localIndex const hypercubeSize = m_numVerts * m_numOps;
+  array1d< globalIndex > mergedIndices( m_hypercubeIndices.size() + LvArray::integerConversion< localIndex >( newHypercubes.size() ) );
+  std::merge( m_hypercubeIndices.begin(), m_hypercubeIndices.end(),
+              newHypercubes.begin(), newHypercubes.end(),
+              mergedIndices.begin() );
+
+  array1d< real64 > mergedData( mergedIndices.size() * hypercubeSize );
+  localIndex iOld = 0;
+  for( localIndex k = 0; k < mergedIndices.size(); ++k )
+  {
+    real64 * const hypercubeData = mergedData.data() + k * hypercubeSize;
+    if( iOld < m_hypercubeIndices.size() && m_hypercubeIndices[iOld] == mergedIndices[k] )
+    {
+      std::copy( m_hypercubeData.begin() + iOld * hypercubeSize,
+                 m_hypercubeData.begin() + ( iOld + 1 ) * hypercubeSize,
+                 hypercubeData );
+      ++iOld;
+      continue;
+    }
+
+    getHypercubePoints( mergedIndices[k], points );
+    for( integer j = 0; j < m_numVerts; ++j )
+    {
+      localIndex const offset = m_generatedPoints.at( points[j] );
+      std::copy( m_generatedPointData.begin() + offset,
+                 m_generatedPointData.begin() + offset + m_numOps,
+                 hypercubeData + j * m_numOps );
     }
   }
 
+  m_hypercubeIndices = std::move( mergedIndices );
+  m_hypercubeData = std::move( mergedData );
+}
+
+void MultivariableTableFunction::generatePoints( std::vector< globalIndex > const & pointIndices )
+{
+  // each rank evaluates a contiguous chunk of the points
+  localIndex const numPoints = LvArray::integerConversion< localIndex >( pointIndices.size() );
+  localIndex const numRanks = MpiWrapper::commSize();
+  localIndex const chunkSize = ( numPoints + numRanks - 1 ) / numRanks;
+  localIndex const chunkBegin = std::min( numPoints, MpiWrapper::commRank() * chunkSize );
+  localIndex const chunkEnd = std::min( numPoints, chunkBegin + chunkSize );
+
+  array1d< real64 > chunkValues( chunkSize * m_numOps );
+  array1d< real64 > coordinates( m_numDims );
+  string errorMessage;
+  try
+  {
+    for( localIndex k = chunkBegin; k < chunkEnd; ++k )
+    {
+      getPointCoordinates( pointIndices[k], coordinates.data() );
+      m_pointGenerator( coordinates.data(), chunkValues.data() + ( k - chunkBegin ) * m_numOps );
+    }
+  }
+  catch( std::exception const & e )
+  {
+    errorMessage = e.what();
+  }
+
+  // all the ranks must stop if the evaluation failed on one of them, otherwise the gather below would hang
+  integer const failed = MpiWrapper::max( errorMessage.empty() ? 0 : 1 );
+  GEOS_THROW_IF( failed > 0,
+                 ( errorMessage.empty() ? catalogName() + " " + getDataContext().toString() + ": the generation of table points failed on another rank" : errorMessage ),
+                 InputError );
+
+  // the chunks have the same size on all the ranks, hence the values of point k start at k * numOps
+  array1d< real64 > allValues;
+  MpiWrapper::allGather( chunkValues.toViewConst(), allValues );
+  for( localIndex k = 0; k < numPoints; ++k )
+  {
+    m_generatedPoints.emplace( pointIndices[k], LvArray::integerConversion< localIndex >( m_generatedPointData.size() ) );
+    m_generatedPointData.insert( m_generatedPointData.end(),
+                                 allValues.begin() + k * m_numOps,
+                                 allValues.begin() + ( k + 1 ) * m_numOps );
+  }
+
+  writePointCache( pointIndices );
+}
+
+void MultivariableTableFunction::readPointCache()
+{
+  if( m_pointCacheFile.empty() )
+  {
+    return;
+  }
+
+  std::vector< globalIndex > pointIndices;
+  std::vector< real64 > pointValues;
+  if( MpiWrapper::commRank() == 0 )
+  {
+    std::ifstream is( m_pointCacheFile, std::ios::binary );
+    if( is )
+    {
+      if( readPointCacheHeader( is, m_numOps, m_axisPoints.toViewConst(), m_axisMinimums.toViewConst(), m_axisMaximums.toViewConst() ) )
+      {
+        globalIndex pointIndex;
+        std::vector< real64 > values( m_numOps );
+        while( is.read( reinterpret_cast< char * >( &pointIndex ), sizeof( pointIndex ) ) &&
+               is.read( reinterpret_cast< char * >( values.data() ), m_numOps * sizeof( real64 ) ) )
+        {
+          pointIndices.push_back( pointIndex );
+          pointValues.insert( pointValues.end(), values.begin(), values.end() );
+        }
+      }
+      else
+      {
+        // the file has been generated for another table, it is overwritten by the points generated in this run
+        is.close();
+        GEOS_WARNING( catalogName() << " " << getDataContext() << ": the point cache file " << m_pointCacheFile <<
+                      " does not match the table discretization and is discarded" );
+        std::remove( m_pointCacheFile.c_str() );
+      }
+    }
+  }
+
+  localIndex numPoints = LvArray::integerConversion< localIndex >( pointIndices.size() );
+  MpiWrapper::broadcast( numPoints );
+  if( numPoints == 0 )
+  {
+    return;
+  }
+  pointIndices.resize( numPoints );
+  pointValues.resize( numPoints * m_numOps );
+  MpiWrapper::bcast( pointIndices.data(), LvArray::integerConversion< int >( numPoints ), 0, MPI_COMM_GEOSX );
+  MpiWrapper::bcast( pointValues.data(), LvArray::integerConversion< int >( numPoints * m_numOps ), 0, MPI_COMM_GEOSX );
+
+  for( localIndex k = 0; k < numPoints; ++k )
+  {
+    if( m_generatedPoints.emplace( pointIndices[k], LvArray::integerConversion< localIndex >( m_generatedPointData.size() ) ).second )
+    {
+      m_generatedPointData.insert( m_generatedPointData.end(),
+                                   pointValues.begin() + k * m_numOps,
+                                   pointValues.begin() + ( k + 1 ) * m_numOps );
+    }
+  }
+  GEOS_LOG_RANK_0( catalogName() << " " << getName() << ": " << m_generatedPoints.size() << " points read from " << m_pointCacheFile );
+}
+
+void MultivariableTableFunction::writePointCache( std::vector< globalIndex > const & pointIndices ) const
+{
+  if( m_pointCacheFile.empty() || MpiWrapper::commRank() != 0 )
+  {
+    return;
+  }
+
+  bool const isNewFile = !std::ifstream( m_pointCacheFile ).good();
+  std::ofstream os( m_pointCacheFile, std::ios::binary | std::ios::app );
+  if( isNewFile )
+  {
+    writePointCacheHeader( os, m_numOps, m_axisPoints.toViewConst(), m_axisMinimums.toViewConst(), m_axisMaximums.toViewConst() );
+  }
+  for( globalIndex const pointIndex : pointIndices )
+  {
+    localIndex const offset = m_generatedPoints.at( pointIndex );
+    os.write( reinterpret_cast< char const * >( &pointIndex ), sizeof( pointIndex ) );
+    os.write( reinterpret_cast< char const * >( m_generatedPointData.data() + offset ), m_numOps * sizeof( real64 ) );
+  }
+  GEOS_WARNING_IF( !os, catalogName() << " " << getDataContext() << ": could not write the point cache file " << m_pointCacheFile );
 }
 
 REGISTER_CATALOG_ENTRY( FunctionBase, MultivariableTableFunction, string const &, Group * const )
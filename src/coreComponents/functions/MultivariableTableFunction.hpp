@@ -22,8 +22,12 @@
 #include "FunctionBase.hpp"
 
 #include "codingUtilities/EnumStrings.hpp"
+#include "common/NodeSharedArray.hpp"
 #include "LvArray/src/tensorOps.hpp"
 
+#include <functional>
+#include <unordered_map>
+
 namespace geos
 {
 
@@ -38,6 +42,9 @@ class MultivariableTableFunction : public FunctionBase
 {
 public:
 
+  /// Type of the functions computing the values of all the operators at a given table point (adaptive tables)
+  using PointGenerator = std::function< void ( real64 const * const coordinates, real64 * const values ) >;
+
   /**
    * @brief The constructor
    * @param[in] name the name of this object manager
@@ -83,8 +90,53 @@ public:
   /**
    * @brief Initialize the table function using data from file
    * @param[in] filename The name of the file to read.
+   * @param[in] useNodeSharedStorage if true, the file is read by a single rank per node and the table
+   *                                 values are stored once per node in shared memory (collective, host builds only)
+   */
+  void initializeFunctionFromFile( string const & filename,
+                                   bool const useNodeSharedStorage = false );
+
+  /**
+   * @brief Switch the table to the adaptive mode, in which the operator values are only computed
+   *        at the vertices of the hypercubes requested with generateHypercubes()
+   * @param[in] generator the function computing the operator values at a table point
+   * @param[in] pointCacheFile file from which the previously generated points are read and to which
+   *                           the new ones are appended (no caching if empty)
+   * @note Must be called before initializeFunction()
+   */
+  void setPointGenerator( PointGenerator generator,
+                          string const & pointCacheFile = "" );
+
+  /**
+   * @brief Initialize an adaptive table function, reading only the table axes from file
+   * @param[in] filename The name of the file to read.
+   * @param[in] generator the function computing the operator values at a table point
+   * @param[in] pointCacheFile file caching the generated points (no caching if empty)
+   */
+  void initializeAdaptiveFunctionFromFile( string const & filename,
+                                           PointGenerator generator,
+                                           string const & pointCacheFile );
+
+  /**
+   * @brief Make sure that the given hypercubes are available in an adaptive table (collective)
+   * @param[in] hypercubeIndices the sorted and unique indices of the hypercubes needed by this rank
+   *
+   * The points missing on any rank are gathered, evaluated in parallel by all the ranks,
+   * and exchanged, so that all the ranks share the same set of generated points.
    */
-  void initializeFunctionFromFile( string const & filename );
+  void generateHypercubes( arrayView1d< globalIndex const > const & hypercubeIndices );
+
+  /**
+   * @brief Check whether the table values are generated on demand
+   * @return true if the table is adaptive
+   */
+  bool isAdaptive() const { return static_cast< bool >( m_pointGenerator ); }
+
+  /**
+   * @brief Get the number of table points at which the operators have been evaluated (adaptive tables)
+   * @return the number of generated points
+   */
+  localIndex numGeneratedPoints() const { return LvArray::integerConversion< localIndex >( m_generatedPoints.size() ); }
 
 
   /**
@@ -164,6 +216,18 @@ public:
    */
   arrayView1d< real64 const > getHypercubeData() const { return m_hypercubeData.toViewConst(); }
 
+  /**
+   * @brief Get the sorted indices of the hypercubes stored in the table (adaptive tables)
+   * @return a reference to an array of hypercube indices, empty if the table is not adaptive
+   */
+  arrayView1d< globalIndex const > getHypercubeIndices() const { return m_hypercubeIndices.toViewConst(); }
+
+  /**
+   * @brief Get the table values stored per-hypercube in node-shared memory
+   * @return a pointer to the table values, or nullptr if the table is not stored in node-shared memory
+   */
+  real64 const * getSharedHypercubeData() const { return m_sharedHypercubeData.data(); }
+
   /**
    * @brief Get the number of table dimensions
    * @return the number of table dimensions
@@ -186,6 +250,44 @@ private:
    */
   void getHypercubePoints( globalIndex const hypercubeIndex, globalIndex_array & hypercubePoints ) const;
 
+  /**
+   * @brief Read the table coordinates and values from a file
+   * @param[in] filename The name of the file to read.
+   * @param[in] readValues if false, only the table coordinates are read
+   */
+  void readTableFile( string const & filename,
+                      bool const readValues = true );
+
+  /**
+   * @brief Copy the point data into the per-hypercube storage
+   * @param[out] hypercubeData pointer to the per-hypercube storage
+   */
+  void fillHypercubeData( real64 * const hypercubeData ) const;
+
+  /**
+   * @brief Compute the coordinates of a table point
+   * @param[in] pointIndex index of the point
+   * @param[out] coordinates the point coordinates
+   */
+  void getPointCoordinates( globalIndex const pointIndex, real64 * const coordinates ) const;
+
+  /**
+   * @brief Evaluate the operators at a set of points, in parallel over the ranks, and store them (collective)
+   * @param[in] pointIndices the sorted indices of the points, identical on all the ranks
+   */
+  void generatePoints( std::vector< globalIndex > const & pointIndices );
+
+  /**
+   * @brief Read the previously generated points from the cache file (collective)
+   */
+  void readPointCache();
+
+  /**
+   * @brief Append generated points to the cache file (on rank 0)
+   * @param[in] pointIndices the indices of the points to append
+   */
+  void writePointCache( std::vector< globalIndex > const & pointIndices ) const;
+
   /// Number of table dimensions (inputs)
   integer m_numDims;
 
@@ -225,6 +327,29 @@ private:
 
   ///  Main table data stored per hypercube: all values required for interpolation withing give hypercube are stored contiguously
   real64_array m_hypercubeData;
+
+  ///  Same as m_hypercubeData, stored once per node in shared memory (used instead of m_hypercubeData if enabled)
+  NodeSharedArray< real64 > m_sharedHypercubeData;
+
+  /// Flag indicating whether the table values are stored in node-shared memory
+  bool m_useNodeSharedStorage = false;
+
+  // adaptive tables: operator values generated on demand
+
+  /// Function computing the operator values at a table point (empty if the table is not adaptive)
+  PointGenerator m_pointGenerator;
+
+  /// File caching the generated points between runs
+  string m_pointCacheFile;
+
+  /// Map from the index of a generated point to the position of its values in m_generatedPointData
+  std::unordered_map< globalIndex, localIndex > m_generatedPoints;
+
+  /// Operator values at the generated points
+  std::vector< real64 > m_generatedPointData;
+
+  ///  Sorted indices of the hypercubes stored in m_hypercubeData
+  array1d< globalIndex > m_hypercubeIndices;
 };
 
 
@@ -64,6 +64,10 @@ public:
    * @param[in] axisStepInvs inversions of axis interval lengths (axes are discretized uniformly)
    * @param[in] axisHypercubeMults  hypercube index mult factors for each axis
    * @param[in] hypercubeData table data stored per hypercube
+   * @param[in] hypercubeIndices sorted indices of the hypercubes stored in @p hypercubeData
+   *                             if only a subset of them is available (adaptive tables), empty otherwise
+   * @param[in] sharedHypercubeData table data stored per hypercube in node-shared host memory,
+   *                                used instead of @p hypercubeData if not null
    */
   MultivariableTableFunctionStaticKernel( arrayView1d< real64 const > const & axisMinimums,
                                           arrayView1d< real64 const > const & axisMaximums,
@@ -71,14 +75,18 @@ public:
                                           arrayView1d< real64 const > const & axisSteps,
                                           arrayView1d< real64 const > const & axisStepInvs,
                                           arrayView1d< globalIndex const > const & axisHypercubeMults,
-                                          arrayView1d< real64 const > const & hypercubeData ):
+                                          arrayView1d< real64 const > const & hypercubeData,
+                                          arrayView1d< globalIndex const > const & hypercubeIndices,
+                                          real64 const * const sharedHypercubeData = nullptr ):
     m_axisMinimums ( axisMinimums ),
     m_axisMaximums ( axisMaximums ),
     m_axisPoints ( axisPoints ),
     m_axisSteps ( axisSteps ),
     m_axisStepInvs ( axisStepInvs ),
     m_axisHypercubeMults ( axisHypercubeMults ),
-    m_hypercubeData ( hypercubeData )
+    m_hypercubeData ( hypercubeData ),
+    m_hypercubeIndices ( hypercubeIndices ),
+    m_sharedHypercubeData ( sharedHypercubeData )
   {};
 
 /**
@@ -149,6 +157,27 @@ public:
 
   }
 
+  /**
+   * @brief Get the index of the hypercube containing a given point
+   *
+   * @param[in] coordinates point coordinates
+   * @return the hypercube index (points outside of the table are assigned the closest hypercube)
+   */
+  template< typename IN_ARRAY >
+  GEOS_HOST_DEVICE
+  globalIndex
+  getHypercubeIndex( IN_ARRAY const & coordinates ) const
+  {
+    globalIndex hypercubeIndex = 0;
+    for( int i = 0; i < numDims; ++i )
+    {
+      integer axisIndex = integer( ( coordinates[i] - m_axisMinimums[i] ) * m_axisStepInvs[i] );
+      axisIndex = axisIndex < 0 ? 0 : ( axisIndex > m_axisPoints[i] - 2 ? m_axisPoints[i] - 2 : axisIndex );
+      hypercubeIndex += axisIndex * m_axisHypercubeMults[i];
+    }
+    return hypercubeIndex;
+  }
+
 protected:
 
   /**
@@ -162,6 +191,31 @@ protected:
   real64 const *
   getHypercubeData( globalIndex const hypercubeIndex ) const
   {
+    if( m_sharedHypercubeData != nullptr )
+    {
+      return m_sharedHypercubeData + hypercubeIndex * numVerts * numOps;
+    }
+    if( !m_hypercubeIndices.empty() )
+    {
+      // adaptive table: the hypercubes are stored contiguously in the order of their indices
+      localIndex first = 0;
+      localIndex last = m_hypercubeIndices.size();
+      while( first < last )
+      {
+        localIndex const mid = first + ( last - first ) / 2;
+        if( m_hypercubeIndices[mid] < hypercubeIndex )
+        {
+          first = mid + 1;
+        }
+        else
+        {
+          last = mid;
+        }
+      }
+      GEOS_ERROR_IF( first == m_hypercubeIndices.size() || m_hypercubeIndices[first] != hypercubeIndex,
+                     "Hypercube " << hypercubeIndex << " has not been generated in the adaptive table" );
+      return &m_hypercubeData[first * numVerts * numOps];
+    }
     return &m_hypercubeData[hypercubeIndex * numVerts * numOps];
   }
 
@@ -372,6 +426,12 @@ protected:
   ///  Main table data stored per hypercube: all values required for interpolation withing give hypercube are stored contiguously
   arrayView1d< real64 const > m_hypercubeData;
 
+  ///  Sorted indices of the hypercubes stored in m_hypercubeData (adaptive tables only, empty otherwise)
+  arrayView1d< globalIndex const > m_hypercubeIndices;
+
+  ///  Same as m_hypercubeData, when the table is stored in node-shared memory (null otherwise)
+  real64 const * m_sharedHypercubeData;
+
   // inputs: where to interpolate
 
   /// Coordinates in numDims-dimensional space where interpolation is requested
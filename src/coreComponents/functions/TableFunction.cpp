@@ -19,6 +19,7 @@
 #include "TableFunction.hpp"
 #include "codingUtilities/Parsing.hpp"
 #include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
 
 #include <algorithm>
 
@@ -60,15 +61,30 @@ TableFunction::TableFunction( const string & name,
 
 void TableFunction::readFile( string const & filename, array1d< real64 > & target )
 {
-  auto const skipped = []( char const c ){ return std::isspace( c ) || c == ','; };
-  try
+  // The file is only read on the first rank and broadcast, to avoid every rank accessing it at once
+  string errorMsg;
+  if( MpiWrapper::commRank() == 0 )
   {
-    parseFile( filename, target, skipped );
-  }
-  catch( std::runtime_error const & e )
-  {
-    GEOS_THROW( GEOS_FMT( "{} {}: {}", catalogName(), getDataContext(), e.what() ), InputError );
+    auto const skipped = []( char const c ){ return std::isspace( c ) || c == ','; };
+    try
+    {
+      parseFile( filename, target, skipped );
+    }
+    catch( std::runtime_error const & e )
+    {
+      errorMsg = e.what();
+    }
   }
+
+  MpiWrapper::broadcast( errorMsg );
+  GEOS_THROW_IF( !errorMsg.empty(),
+                 GEOS_FMT( "{} {}: {}", catalogName(), getDataContext(), errorMsg ),
+                 InputError );
+
+  localIndex size = target.size();
+  MpiWrapper::broadcast( size );
+  target.resize( size );
+  MpiWrapper::bcast( target.data(), LvArray::integerConversion< int >( size ), 0, MPI_COMM_GEOSX );
 }
 
 void TableFunction::setInterpolationMethod( InterpolationType const method )
@@ -323,7 +323,7 @@ private:
 private:
 
   /**
-   * @brief Parse a table file.
+   * @brief Parse a table file on the first rank and broadcast its values to all ranks.
    * @param[in] target The place to store values.
    * @param[in] filename The name of the file to read.
    * @param[in] delimiter The delimiter used for file entries.
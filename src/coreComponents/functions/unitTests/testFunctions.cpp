@@ -26,7 +26,9 @@
   #include "functions/SymbolicFunction.hpp"
 #endif
 
+#include <filesystem>
 #include <random>
+#include <unistd.h>
 
 using namespace geos;
 
@@ -648,7 +650,8 @@ void testMutivariableFunction( MultivariableTableFunction & function,
                                                                       function.getAxisSteps(),
                                                                       function.getAxisStepInvs(),
                                                                       function.getAxisHypercubeMults(),
-                                                                      function.getHypercubeData()
+                                                                      function.getHypercubeData(),
+                                                                      function.getHypercubeIndices()
                                                                       );
   // Test values evaluation first
   forAll< geos::parallelDevicePolicy< > >( numElems, [=] GEOS_HOST_DEVICE
@@ -824,6 +827,175 @@ TEST( FunctionTests, 2DMultivariableTable )
   testMutivariableFunction< nDims, nOps >( table_g, testCoordinates, testExpectedValues, testExpectedDerivatives, 1e-2, 2e-2 );
 }
 
+TEST( FunctionTests, 2DMultivariableTableAdaptive )
+{
+  FunctionManager * functionManager = &FunctionManager::getInstance();
+
+  localIndex constexpr nDims = 2;
+  localIndex constexpr nOps = 3;
+  localIndex const nTest = 3;
+
+  // Setup table axes only, the values are generated on demand
+  array1d< real64 > axisMins( nDims );
+  array1d< real64 > axisMaxs( nDims );
+  integer_array axisPoints( nDims );
+  axisMins[0] = 1;
+  axisMins[1] = 0;
+  axisMaxs[0] = 2;
+  axisMaxs[1] = 1;
+  axisPoints[0] = 1000;
+  axisPoints[1] = 1100;
+
+  MultivariableTableFunction & table_a = dynamicCast< MultivariableTableFunction & >( *functionManager->createChild( "MultivariableTableFunction", "table_a" ) );
+  table_a.setTableCoordinates( nDims, nOps, axisMins, axisMaxs, axisPoints );
+  table_a.setPointGenerator( []( real64 const * const coordinates, real64 * const values )
+  {
+    values[0] = operator1( coordinates[0], coordinates[1] );
+    values[1] = operator2( coordinates[0], coordinates[1] );
+    values[2] = operator3( coordinates[0], coordinates[1] );
+  } );
+  table_a.initializeFunction();
+  EXPECT_TRUE( table_a.isAdaptive() );
+  EXPECT_EQ( table_a.numGeneratedPoints(), 0 );
+
+  // Setup testing coordinates, expected values
+  array1d< real64 > testCoordinates( nTest * nDims );
+  testCoordinates[0] = 1.2334;
+  testCoordinates[1] = 0.1232;
+  testCoordinates[2] = 1.7342;
+  testCoordinates[3] = 0.2454;
+  testCoordinates[4] = 2.0;
+  testCoordinates[5] = 0.7745;
+
+  array1d< real64 > testExpectedValues( nTest * nOps );
+  array1d< real64 > testExpectedDerivatives( nTest * nOps * nDims );
+  for( auto i = 0; i < nTest; i++ )
+  {
+    testExpectedValues[i * nOps] = operator1( testCoordinates[i * nDims], testCoordinates[i * nDims + 1] );
+    testExpectedValues[i * nOps + 1] = operator2( testCoordinates[i * nDims], testCoordinates[i * nDims + 1] );
+    testExpectedValues[i * nOps + 2] = operator3( testCoordinates[i * nDims], testCoordinates[i * nDims + 1] );
+    testExpectedDerivatives[i * nOps * nDims] = dOperator1_dx( testCoordinates[i * nDims], testCoordinates[i * nDims + 1] );
+    testExpectedDerivatives[i * nOps * nDims + 1] = dOperator1_dy( testCoordinates[i * nDims], testCoordinates[i * nDims + 1] );
+    testExpectedDerivatives[i * nOps * nDims + 2] = dOperator2_dx( testCoordinates[i * nDims], testCoordinates[i * nDims + 1] );
+    testExpectedDerivatives[i * nOps * nDims + 3] = dOperator2_dy( testCoordinates[i * nDims], testCoordinates[i * nDims + 1] );
+    testExpectedDerivatives[i * nOps * nDims + 4] = dOperator3_dx( testCoordinates[i * nDims], testCoordinates[i * nDims + 1] );
+    testExpectedDerivatives[i * nOps * nDims + 5] = dOperator3_dy( testCoordinates[i * nDims], testCoordinates[i * nDims + 1] );
+  }
+
+  // Generate the hypercubes containing the test points (twice, the second call must not generate anything)
+  MultivariableTableFunctionStaticKernel< nDims, nOps > kernel( table_a.getAxisMinimums(),
+                                                                table_a.getAxisMaximums(),
+                                                                table_a.getAxisPoints(),
+                                                                table_a.getAxisSteps(),
+                                                                table_a.getAxisStepInvs(),
+                                                                table_a.getAxisHypercubeMults(),
+                                                                table_a.getHypercubeData(),
+                                                                table_a.getHypercubeIndices() );
+  array1d< globalIndex > hypercubeIndices( nTest );
+  for( auto i = 0; i < nTest; i++ )
+  {
+    hypercubeIndices[i] = kernel.getHypercubeIndex( &testCoordinates[i * nDims] );
+  }
+  std::sort( hypercubeIndices.begin(), hypercubeIndices.end() );
+
+  table_a.generateHypercubes( hypercubeIndices.toViewConst() );
+  EXPECT_EQ( table_a.getHypercubeIndices().size(), nTest );
+  EXPECT_EQ( table_a.numGeneratedPoints(), nTest * ( 1 << nDims ) );
+
+  table_a.generateHypercubes( hypercubeIndices.toViewConst() );
+  EXPECT_EQ( table_a.numGeneratedPoints(), nTest * ( 1 << nDims ) );
+
+  testMutivariableFunction< nDims, nOps >( table_a, testCoordinates, testExpectedValues, testExpectedDerivatives, 1e-2, 2e-2 );
+}
+
+TEST( FunctionTests, 2DMultivariableTableAdaptivePointCache )
+{
+  FunctionManager * functionManager = &FunctionManager::getInstance();
+
+  integer constexpr nDims = 2;
+  integer constexpr nOps = 3;
+
+  array1d< real64 > axisMins( nDims );
+  array1d< real64 > axisMaxs( nDims );
+  integer_array axisPoints( nDims );
+  axisMins[0] = 1;
+  axisMins[1] = 0;
+  axisMaxs[0] = 2;
+  axisMaxs[1] = 1;
+  axisPoints[0] = 100;
+  axisPoints[1] = 110;
+
+  std::filesystem::path const cacheFile = std::filesystem::temp_directory_path() / GEOS_FMT( "oblPointCache_{}.bin", getpid() );
+  std::filesystem::remove( cacheFile );
+
+  // the generator counts its evaluations, to check which points are read from the cache
+  localIndex numEvaluations = 0;
+  auto const createTable = [&]( string const & name, integer_array const & points ) -> MultivariableTableFunction &
+  {
+    MultivariableTableFunction & table = dynamicCast< MultivariableTableFunction & >( *functionManager->createChild( "MultivariableTableFunction", name ) );
+    table.setTableCoordinates( nDims, nOps, axisMins, axisMaxs, points );
+    table.setPointGenerator( [&numEvaluations]( real64 const * const coordinates, real64 * const values )
+    {
+      ++numEvaluations;
+      values[0] = operator1( coordinates[0], coordinates[1] );
+      values[1] = operator2( coordinates[0], coordinates[1] );
+      values[2] = operator3( coordinates[0], coordinates[1] );
+    }, cacheFile.string() );
+    table.initializeFunction();
+    return table;
+  };
+
+  // two hypercubes sharing two vertices, and a separate one
+  array1d< globalIndex > hypercubeIndices( 3 );
+  hypercubeIndices[0] = 0;
+  hypercubeIndices[1] = 1;
+  hypercubeIndices[2] = 5000;
+  localIndex const numPoints = 3 * ( 1 << nDims ) - 2;
+
+  // the first table evaluates all the points and writes them to the cache file
+  MultivariableTableFunction & table_g = createTable( "table_cache_generated", axisPoints );
+  EXPECT_EQ( table_g.numGeneratedPoints(), 0 );
+  table_g.generateHypercubes( hypercubeIndices.toViewConst() );
+  EXPECT_EQ( numEvaluations, numPoints );
+  EXPECT_TRUE( std::filesystem::exists( cacheFile ) );
+
+  // the second table reads them back, and only evaluates the points of a new hypercube
+  numEvaluations = 0;
+  MultivariableTableFunction & table_c = createTable( "table_cache_read", axisPoints );
+  EXPECT_EQ( table_c.numGeneratedPoints(), numPoints );
+  table_c.generateHypercubes( hypercubeIndices.toViewConst() );
+  EXPECT_EQ( numEvaluations, 0 );
+
+  arrayView1d< real64 const > const generatedData = table_g.getHypercubeData();
+  arrayView1d< real64 const > const cachedData = table_c.getHypercubeData();
+  ASSERT_EQ( cachedData.size(), generatedData.size() );
+  for( localIndex i = 0; i < generatedData.size(); ++i )
+  {
+    EXPECT_EQ( cachedData[i], generatedData[i] );
+  }
+
+  array1d< globalIndex > newHypercubeIndices( 1 );
+  newHypercubeIndices[0] = 6000;
+  table_c.generateHypercubes( newHypercubeIndices.toViewConst() );
+  EXPECT_EQ( numEvaluations, 1 << nDims );
+  EXPECT_EQ( table_c.numGeneratedPoints(), numPoints + ( 1 << nDims ) );
+
+  // the new points have been appended to the cache file
+  numEvaluations = 0;
+  MultivariableTableFunction & table_a = createTable( "table_cache_appended", axisPoints );
+  EXPECT_EQ( table_a.numGeneratedPoints(), numPoints + ( 1 << nDims ) );
+
+  // a table with another discretization discards the cache file
+  integer_array finerAxisPoints( axisPoints );
+  finerAxisPoints[1] = 120;
+  MultivariableTableFunction & table_f = createTable( "table_cache_finer", finerAxisPoints );
+  EXPECT_EQ( table_f.numGeneratedPoints(), 0 );
+  table_f.generateHypercubes( hypercubeIndices.toViewConst() );
+  EXPECT_EQ( numEvaluations, numPoints );
+
+  std::filesystem::remove( cacheFile );
+}
+
 TEST( FunctionTests, MultivariableTableFromFile )
 {
   FunctionManager * functionManager = &FunctionManager::getInstance();
@@ -903,6 +1075,7 @@ TEST( TableFunctionEnums, InterpolationType )
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
+  MpiWrapper::init( &argc, &argv );
 
   // geos::GeosxState state( geos::basicSetup( argc, argv ) );
   conduit::Node conduitNode;
@@ -914,6 +1087,7 @@ int main( int argc, char * * argv )
   int const result = RUN_ALL_TESTS();
 
   // geos::basicCleanup();
+  MpiWrapper::finalize();
 
   return result;
 }
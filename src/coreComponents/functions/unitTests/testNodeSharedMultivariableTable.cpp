@@ -0,0 +1,176 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "gtest/gtest.h"
+#include "common/NodeSharedArray.hpp"
+#include "functions/FunctionManager.hpp"
+#include "functions/MultivariableTableFunction.hpp"
+#include "functions/MultivariableTableFunctionKernels.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+
+using namespace geos;
+
+namespace
+{
+
+constexpr integer numDims = 2;
+constexpr integer numOps = 2;
+constexpr integer numAxisPoints = 11;
+
+/// Values of the operators of the OBL table at point (x, y)
+void operators( real64 const x, real64 const y, real64 (& values)[numOps] )
+{
+  values[0] = 1.0 + x + 2.0 * y;
+  values[1] = x * y;
+}
+
+/**
+ * @brief Write the OBL table on the unit square to a file named after the process of rank 0.
+ * @return the path of the file, written by rank 0 and readable by all the ranks
+ */
+std::filesystem::path writeTableFile()
+{
+  int pid = MpiWrapper::commRank() == 0 ? static_cast< int >( getpid() ) : 0;
+  MpiWrapper::broadcast( pid, 0 );
+  std::filesystem::path const path = std::filesystem::temp_directory_path() / GEOS_FMT( "nodeSharedOBLTable_{}.txt", pid );
+
+  if( MpiWrapper::commRank() == 0 )
+  {
+    std::ofstream os( path );
+    EXPECT_TRUE( os.is_open() );
+    os << numDims << " " << numOps << "\n";
+    for( integer dim = 0; dim < numDims; ++dim )
+    {
+      os << numAxisPoints << " 0 1\n";
+    }
+    os.precision( 17 );
+    // the last axis varies fastest
+    for( integer i = 0; i < numAxisPoints; ++i )
+    {
+      for( integer j = 0; j < numAxisPoints; ++j )
+      {
+        real64 values[numOps];
+        operators( i / real64( numAxisPoints - 1 ), j / real64( numAxisPoints - 1 ), values );
+        os << values[0] << " " << values[1] << "\n";
+      }
+    }
+  }
+  MpiWrapper::barrier();
+  return path;
+}
+
+MultivariableTableFunctionStaticKernel< numDims, numOps > createKernel( MultivariableTableFunction const & table )
+{
+  return MultivariableTableFunctionStaticKernel< numDims, numOps >( table.getAxisMinimums(),
+                                                                   table.getAxisMaximums(),
+                                                                   table.getAxisPoints(),
+                                                                   table.getAxisSteps(),
+                                                                   table.getAxisStepInvs(),
+                                                                   table.getAxisHypercubeMults(),
+                                                                   table.getHypercubeData(),
+                                                                   table.getHypercubeIndices(),
+                                                                   table.getSharedHypercubeData() );
+}
+
+}
+
+TEST( NodeSharedMultivariableTable, sameValuesAsPerRankTable )
+{
+  FunctionManager & functionManager = FunctionManager::getInstance();
+  std::filesystem::path const path = writeTableFile();
+
+  MultivariableTableFunction & perRankTable =
+    dynamicCast< MultivariableTableFunction & >( *functionManager.createChild( "MultivariableTableFunction", "perRankTable" ) );
+  perRankTable.initializeFunctionFromFile( path.string() );
+
+  MultivariableTableFunction & sharedTable =
+    dynamicCast< MultivariableTableFunction & >( *functionManager.createChild( "MultivariableTableFunction", "sharedTable" ) );
+  sharedTable.initializeFunctionFromFile( path.string(), true );
+
+  MpiWrapper::barrier();
+  if( MpiWrapper::commRank() == 0 )
+  {
+    std::filesystem::remove( path );
+  }
+
+  // the axes are known on all the ranks, even if only the node leader read the file
+  ASSERT_EQ( sharedTable.numDims(), numDims );
+  ASSERT_EQ( sharedTable.numOps(), numOps );
+  for( integer dim = 0; dim < numDims; ++dim )
+  {
+    EXPECT_EQ( sharedTable.getAxisPoints()[dim], numAxisPoints );
+    EXPECT_EQ( sharedTable.getAxisMinimums()[dim], perRankTable.getAxisMinimums()[dim] );
+    EXPECT_EQ( sharedTable.getAxisMaximums()[dim], perRankTable.getAxisMaximums()[dim] );
+  }
+
+#if defined( GEOS_USE_DEVICE )
+  // the flag is ignored on device, the table is stored per rank
+  EXPECT_EQ( sharedTable.getSharedHypercubeData(), nullptr );
+  EXPECT_EQ( sharedTable.getHypercubeData().size(), perRankTable.getHypercubeData().size() );
+#else
+  // the hypercube data is only stored in the node-shared window, filled once per node
+  ASSERT_NE( sharedTable.getSharedHypercubeData(), nullptr );
+  EXPECT_EQ( sharedTable.getHypercubeData().size(), 0 );
+  arrayView1d< real64 const > const perRankData = perRankTable.getHypercubeData();
+  real64 const * const sharedData = sharedTable.getSharedHypercubeData();
+  for( localIndex i = 0; i < perRankData.size(); ++i )
+  {
+    EXPECT_EQ( sharedData[i], perRankData[i] );
+  }
+#endif
+
+  // both tables interpolate the same values and derivatives
+  MultivariableTableFunctionStaticKernel< numDims, numOps > const perRankKernel = createKernel( perRankTable );
+  MultivariableTableFunctionStaticKernel< numDims, numOps > const sharedKernel = createKernel( sharedTable );
+  real64 const coordinates[4][numDims] = { { 0.0, 0.0 }, { 0.123, 0.877 }, { 0.5, 0.25 }, { 1.0, 1.0 } };
+  for( auto const & input : coordinates )
+  {
+    real64 perRankValues[numOps], sharedValues[numOps];
+    real64 perRankDerivatives[numOps][numDims], sharedDerivatives[numOps][numDims];
+    perRankKernel.compute( input, perRankValues, perRankDerivatives );
+    sharedKernel.compute( input, sharedValues, sharedDerivatives );
+
+    real64 expectedValues[numOps];
+    operators( input[0], input[1], expectedValues );
+    for( integer op = 0; op < numOps; ++op )
+    {
+      EXPECT_EQ( sharedValues[op], perRankValues[op] );
+      // the first operator is linear, so it is interpolated exactly
+      EXPECT_NEAR( sharedValues[op], expectedValues[op], op == 0 ? 1e-12 : 1e-2 );
+      for( integer dim = 0; dim < numDims; ++dim )
+      {
+        EXPECT_EQ( sharedDerivatives[op][dim], perRankDerivatives[op][dim] );
+      }
+    }
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  MpiWrapper::init( &argc, &argv );
+
+  conduit::Node conduitNode;
+  dataRepository::Group rootNode( "root", conduitNode );
+  FunctionManager functionManager( "FunctionManager", &rootNode );
+
+  int const result = RUN_ALL_TESTS();
+
+  MpiWrapper::finalize();
+
+  return result;
+}
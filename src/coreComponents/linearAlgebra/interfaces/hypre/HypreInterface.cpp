@@ -23,6 +23,7 @@
 #include "linearAlgebra/interfaces/hypre/HyprePreconditioner.hpp"
 #include "linearAlgebra/interfaces/hypre/HypreSolver.hpp"
 #include "linearAlgebra/interfaces/hypre/HypreUtils.hpp"
+#include "linearAlgebra/solvers/PreconditionerJacobi.hpp"
 
 #if defined(GEOSX_USE_SUPERLU_DIST)
 #include "linearAlgebra/interfaces/direct/SuperLUDist.hpp"
@@ -92,6 +93,11 @@ HypreInterface::createSolver( LinearSolverParameters params )
 std::unique_ptr< PreconditionerBase< HypreInterface > >
 geos::HypreInterface::createPreconditioner( LinearSolverParameters params )
 {
+  if( params.mixedPrecision && params.preconditionerType == LinearSolverParameters::PreconditionerType::jacobi )
+  {
+    // Native implementation storing the inverse diagonal in single precision
+    return std::make_unique< PreconditionerJacobi< HypreInterface > >( true );
+  }
   return std::make_unique< HyprePreconditioner >( std::move( params ) );
 }
 
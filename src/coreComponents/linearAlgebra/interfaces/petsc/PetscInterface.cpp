@@ -22,6 +22,7 @@
 #include "linearAlgebra/interfaces/direct/SuperLUDist.hpp"
 #include "linearAlgebra/interfaces/petsc/PetscPreconditioner.hpp"
 #include "linearAlgebra/interfaces/petsc/PetscSolver.hpp"
+#include "linearAlgebra/solvers/PreconditionerJacobi.hpp"
 
 #include <petscsys.h>
 
@@ -64,6 +65,11 @@ PetscInterface::createSolver( LinearSolverParameters params )
 std::unique_ptr< PreconditionerBase< PetscInterface > >
 PetscInterface::createPreconditioner( LinearSolverParameters params )
 {
+  if( params.mixedPrecision && params.preconditionerType == LinearSolverParameters::PreconditionerType::jacobi )
+  {
+    // Native implementation storing the inverse diagonal in single precision
+    return std::make_unique< PreconditionerJacobi< PetscInterface > >( true );
+  }
   return std::make_unique< PetscPreconditioner >( params );
 }
 
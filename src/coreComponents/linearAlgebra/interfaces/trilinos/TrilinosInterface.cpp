@@ -22,6 +22,7 @@
 #include "linearAlgebra/interfaces/direct/SuperLUDist.hpp"
 #include "linearAlgebra/interfaces/trilinos/TrilinosPreconditioner.hpp"
 #include "linearAlgebra/interfaces/trilinos/TrilinosSolver.hpp"
+#include "linearAlgebra/solvers/PreconditionerJacobi.hpp"
 
 namespace geos
 {
@@ -55,6 +56,11 @@ TrilinosInterface::createSolver( LinearSolverParameters params )
 std::unique_ptr< PreconditionerBase< TrilinosInterface > >
 TrilinosInterface::createPreconditioner( LinearSolverParameters params )
 {
+  if( params.mixedPrecision && params.preconditionerType == LinearSolverParameters::PreconditionerType::jacobi )
+  {
+    // Native implementation storing the inverse diagonal in single precision
+    return std::make_unique< PreconditionerJacobi< TrilinosInterface > >( true );
+  }
   return std::make_unique< TrilinosPreconditioner >( params );
 }
 
@@ -0,0 +1,467 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file GcrodrSolver.cpp
+ */
+
+#include "GcrodrSolver.hpp"
+
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+#include "denseLinearAlgebra/interfaces/blaslapack/BlasLapackLA.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace geos
+{
+
+template< typename VECTOR >
+GcrodrSolver< VECTOR >::GcrodrSolver( LinearSolverParameters params,
+                                      LinearOperator< Vector > const & A,
+                                      LinearOperator< Vector > const & M,
+                                      RecycleSpace * const recycleSpace )
+  : KrylovSolver< VECTOR >( std::move( params ), A, M ),
+  m_kspace( m_params.krylov.maxRestart + 1 ),
+  m_zspace( m_params.krylov.maxRestart ),
+  m_kspaceInitialized( false ),
+  m_ownRecycleSpace(),
+  m_recycleSpace( recycleSpace != nullptr ? recycleSpace : &m_ownRecycleSpace )
+{
+  GEOS_ERROR_IF_LE_MSG( m_params.krylov.maxRestart, 0, "GCRO-DR: max number of iterations until restart must be positive." );
+  GEOS_ERROR_IF_LT_MSG( m_params.krylov.recycleSize, 0, "GCRO-DR: size of the recycled subspace must be non-negative." );
+  GEOS_ERROR_IF_GE_MSG( m_params.krylov.recycleSize, m_params.krylov.maxRestart,
+                        "GCRO-DR: size of the recycled subspace must be less than max number of iterations until restart." );
+}
+
+template< typename VECTOR >
+void GcrodrSolver< VECTOR >::solve( Vector const & b,
+                                    Vector & x ) const
+{
+  // We create Krylov subspace vectors once using the size and partitioning of b.
+  // On repeated calls to solve() input vectors must have the same size and partitioning.
+  if( !m_kspaceInitialized )
+  {
+    for( VectorTemp & kv : m_kspace )
+    {
+      kv = createTempVector( b );
+    }
+    for( VectorTemp & zv : m_zspace )
+    {
+      zv = createTempVector( b );
+    }
+    m_kspaceInitialized = true;
+  }
+
+  Stopwatch watch;
+
+  integer const maxRestart = m_params.krylov.maxRestart;
+  integer const recycleSize = m_params.krylov.recycleSize;
+
+  // Define vectors
+  VectorTemp r = createTempVector( b );
+  VectorTemp w = createTempVector( b );
+
+  // Compute initial rk
+  m_operator.residual( x, b, r );
+
+  // Compute the target absolute tolerance
+  real64 const rnorm0 = r.norm2();
+  real64 const absTol = rnorm0 * m_params.krylov.relTolerance;
+
+  // The operator and/or the preconditioner may have changed since the recycled subspace
+  // was built, so we recompute its images UP = M*U and C = A*M*U, with C orthonormal.
+  // Vectors that became linearly dependent are dropped from the recycled subspace.
+  array1d< VectorTemp > & U = m_recycleSpace->vectors;
+  array1d< VectorTemp > C;
+  array1d< VectorTemp > UP;
+  {
+    array1d< VectorTemp > Ukept;
+    for( localIndex l = 0; l < LvArray::math::min( U.size(), LvArray::integerConversion< localIndex >( recycleSize ) ); ++l )
+    {
+      VectorTemp up = createTempVector( b );
+      VectorTemp c = createTempVector( b );
+      m_precond.apply( U[l], up );
+      m_operator.apply( up, c );
+
+      real64 const cnormInit = c.norm2();
+      for( localIndex i = 0; i < C.size(); ++i )
+      {
+        real64 const alpha = c.dot( C[i] );
+        c.axpy( -alpha, C[i] );
+        up.axpy( -alpha, UP[i] );
+        U[l].axpy( -alpha, Ukept[i] );
+      }
+
+      real64 const cnorm = c.norm2();
+      if( cnorm > LvArray::NumericLimits< real64 >::epsilon * cnormInit )
+      {
+        c.scale( 1.0 / cnorm );
+        up.scale( 1.0 / cnorm );
+        U[l].scale( 1.0 / cnorm );
+        C.emplace_back( std::move( c ) );
+        UP.emplace_back( std::move( up ) );
+        Ukept.emplace_back( std::move( U[l] ) );
+      }
+    }
+    U = std::move( Ukept );
+  }
+
+  // Create upper Hessenberg matrix (kept unrotated for the recycled subspace update), its rotated
+  // counterpart used to solve the least-squares problem, and the projection onto the recycled subspace
+  array2d< real64 > H( maxRestart + 1, maxRestart );
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > HR( maxRestart + 1, maxRestart );
+  array2d< real64 > B( LvArray::math::max( recycleSize, 1 ), maxRestart );
+
+  // Create plane rotation storage
+  array1d< real64 > c( maxRestart + 1 );
+  array1d< real64 > s( maxRestart + 1 );
+  array1d< real64 > g( maxRestart + 1 );
+
+  // Initialize iteration state
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.clear();
+
+  integer & k = m_result.numIterations;
+  k = 0;
+  while( k <= m_params.krylov.maxIterations && m_result.status == LinearSolverResult::Status::NotConverged )
+  {
+    // Project the residual onto the orthogonal complement of range(C) and update the solution accordingly
+    localIndex const numRecycled = C.size();
+    for( localIndex i = 0; i < numRecycled; ++i )
+    {
+      real64 const alpha = r.dot( C[i] );
+      x.axpy( alpha, UP[i] );
+      r.axpy( -alpha, C[i] );
+    }
+
+    // Re-initialize Krylov subspace; its size is reduced by the size of the recycled subspace
+    integer const cycleSize = maxRestart - LvArray::integerConversion< integer >( numRecycled );
+    H.zero();
+    B.zero();
+    g.zero();
+    g[0] = r.norm2();
+    m_kspace[0].copy( r );
+    if( g[0] > 0 )
+    {
+      m_kspace[0].scale( 1.0 / g[0] );
+    }
+
+    integer j = 0;
+    for(; j < cycleSize && k <= m_params.krylov.maxIterations; ++j, ++k )
+    {
+      // Record iteration progress
+      real64 const rnorm = std::fabs( g[j] );
+      m_residualNorms.emplace_back( rnorm );
+      logProgress();
+
+      // Convergence check
+      if( rnorm <= absTol )
+      {
+        m_result.status = LinearSolverResult::Status::Success;
+        break;
+      }
+
+      // Compute the new vector, keeping the preconditioned one for the solution update
+      m_precond.apply( m_kspace[j], m_zspace[j] );
+      m_operator.apply( m_zspace[j], w );
+
+      // Orthogonalization against the recycled subspace
+      for( localIndex i = 0; i < numRecycled; ++i )
+      {
+        B( i, j ) = w.dot( C[i] );
+        w.axpby( -B( i, j ), C[i], 1.0 );
+      }
+
+      // Orthogonalization against the Krylov subspace
+      for( integer i = 0; i <= j; ++i )
+      {
+        H( i, j ) = w.dot( m_kspace[i] );
+        w.axpby( -H( i, j ), m_kspace[i], 1.0 );
+      }
+
+      H( j+1, j ) = w.norm2();
+      GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( H( j+1, j ) )
+      m_kspace[j+1].axpby( 1.0 / H( j+1, j ), w, 0.0 );
+
+      // Apply all previous rotations to a copy of the new column
+      for( integer i = 0; i <= j+1; ++i )
+      {
+        HR( i, j ) = H( i, j );
+      }
+      for( integer i = 0; i < j; ++i )
+      {
+        krylov::applyGivensRotation( c[i], s[i], HR( i, j ), HR( i+1, j ) );
+      }
+
+      // Compute and apply the new rotation to eliminate subdiagonal element
+      krylov::computeGivensRotation( HR( j, j ), HR( j+1, j ), c[j], s[j] );
+      krylov::applyGivensRotation( c[j], s[j], HR( j, j ), HR( j+1, j ) );
+      krylov::applyGivensRotation( c[j], s[j], g[j], g[j+1] );
+    }
+
+    // Regardless of how we quit out of inner loop, j is the actual size of H
+    krylov::backsolve( j, HR, g );
+
+    // Update the solution vector, x += Z*y - UP*(B*y), and recompute residual
+    for( integer i = 0; i < j; ++i )
+    {
+      x.axpy( g[i], m_zspace[i] );
+    }
+    for( localIndex l = 0; l < numRecycled; ++l )
+    {
+      real64 By = 0.0;
+      for( integer i = 0; i < j; ++i )
+      {
+        By += B( l, i ) * g[i];
+      }
+      x.axpy( -By, UP[l] );
+    }
+    m_operator.residual( x, b, r );
+
+    // Deflate the eigenvalues found during this cycle
+    if( recycleSize > 0 && j > 0 && m_result.status != LinearSolverResult::Status::Breakdown )
+    {
+      updateRecycleSpace( j, B.toSliceConst(), H.toSliceConst(), C, UP );
+    }
+  }
+
+  m_result.residualReduction = rnorm0 > 0.0 ? m_residualNorms.back() / rnorm0 : 0.0;
+  m_result.solveTime = watch.elapsedTime();
+  logResult();
+}
+
+template< typename VECTOR >
+void GcrodrSolver< VECTOR >::updateRecycleSpace( integer const numKrylov,
+                                                 arraySlice2d< real64 const > const & B,
+                                                 arraySlice2d< real64 const > const & H,
+                                                 array1d< VectorTemp > & C,
+                                                 array1d< VectorTemp > & UP ) const
+{
+  array1d< VectorTemp > & U = m_recycleSpace->vectors;
+  integer const numRecycled = LvArray::integerConversion< integer >( C.size() );
+  integer const n = numRecycled + numKrylov;
+
+  // Assemble G = [ I B ; 0 H ], such that A*M*[U V] = [C V+] * G
+  array2d< real64 > G( n + 1, n );
+  for( integer i = 0; i < numRecycled; ++i )
+  {
+    G( i, i ) = 1.0;
+    for( integer j = 0; j < numKrylov; ++j )
+    {
+      G( i, numRecycled + j ) = B( i, j );
+    }
+  }
+  for( integer i = 0; i <= numKrylov; ++i )
+  {
+    for( integer j = 0; j < numKrylov; ++j )
+    {
+      G( numRecycled + i, numRecycled + j ) = H( i, j );
+    }
+  }
+
+  // Assemble Phi = [C V+]^T * [U V]; note that C^T*V = 0 by construction
+  array2d< real64 > Phi( n + 1, n );
+  for( integer j = 0; j < numRecycled; ++j )
+  {
+    for( integer i = 0; i < numRecycled; ++i )
+    {
+      Phi( i, j ) = C[i].dot( U[j] );
+    }
+    for( integer i = 0; i <= numKrylov; ++i )
+    {
+      Phi( numRecycled + i, j ) = m_kspace[i].dot( U[j] );
+    }
+  }
+  for( integer i = 0; i < numKrylov; ++i )
+  {
+    Phi( numRecycled + i, numRecycled + i ) = 1.0;
+  }
+
+  // Harmonic Ritz vectors solve G^T*G*p = theta*G^T*Phi*p. Since G has full column rank, we solve
+  // instead the standard eigenproblem (G^T*G)^{-1}*G^T*Phi*p = mu*p, with mu = 1/theta.
+  array2d< real64 > GtG( n, n );
+  array2d< real64 > GtGinv( n, n );
+  array2d< real64 > GtPhi( n, n );
+  array2d< real64 > X( n, n );
+  BlasLapackLA::matrixTMatrixMultiply( G, G, GtG );
+  BlasLapackLA::matrixTMatrixMultiply( G, Phi, GtPhi );
+  BlasLapackLA::matrixInverse( GtG, GtGinv );
+  BlasLapackLA::matrixMatrixMultiply( GtGinv, GtPhi, X );
+
+  array1d< std::complex< real64 > > mu( n );
+  array2d< real64 > P( n, n );
+  BlasLapackLA::matrixEigenvectors( X, mu, P );
+
+  // Select the vectors associated with the harmonic Ritz values of smallest magnitude (i.e. largest |mu|).
+  // Both real and imaginary parts of a complex eigenvector are kept, so that the subspace remains real.
+  array1d< integer > order( n );
+  std::iota( order.begin(), order.end(), 0 );
+  std::sort( order.begin(), order.end(), [&]( integer const a, integer const b )
+  {
+    return std::abs( mu[a] ) > std::abs( mu[b] );
+  } );
+
+  array1d< integer > isSelected( n );
+  array1d< integer > selected;
+  for( integer const idx : order )
+  {
+    if( isSelected[idx] )
+    {
+      continue;
+    }
+    if( isZero( mu[idx].imag() ) )
+    {
+      if( selected.size() + 1 <= recycleSize )
+      {
+        selected.emplace_back( idx );
+      }
+      isSelected[idx] = 1;
+    }
+    else
+    {
+      integer const first = mu[idx].imag() > 0.0 ? idx : idx - 1;
+      if( selected.size() + 2 <= recycleSize )
+      {
+        selected.emplace_back( first );
+        selected.emplace_back( first + 1 );
+      }
+      isSelected[first] = 1;
+      isSelected[first + 1] = 1;
+    }
+  }
+
+  integer const numSelected = LvArray::integerConversion< integer >( selected.size() );
+  if( numSelected == 0 )
+  {
+    return;
+  }
+
+  // Compute the QR factorization G*P = Q*R by modified Gram-Schmidt, and store P*R^{-1} in place of P.
+  // Columns that are numerically dependent on the previous ones are dropped.
+  array2d< real64 > Psel( n, numSelected );
+  for( integer i = 0; i < n; ++i )
+  {
+    for( integer j = 0; j < numSelected; ++j )
+    {
+      Psel( i, j ) = P( i, selected[j] );
+    }
+  }
+  array2d< real64 > Q( n + 1, numSelected );
+  BlasLapackLA::matrixMatrixMultiply( G, Psel, Q );
+
+  integer numNew = 0;
+  for( integer j = 0; j < numSelected; ++j )
+  {
+    real64 normInit = 0.0;
+    for( integer i = 0; i <= n; ++i )
+    {
+      normInit += Q( i, j ) * Q( i, j );
+    }
+    for( integer l = 0; l < numNew; ++l )
+    {
+      real64 alpha = 0.0;
+      for( integer i = 0; i <= n; ++i )
+      {
+        alpha += Q( i, l ) * Q( i, j );
+      }
+      for( integer i = 0; i <= n; ++i )
+      {
+        Q( i, j ) -= alpha * Q( i, l );
+      }
+      for( integer i = 0; i < n; ++i )
+      {
+        Psel( i, j ) -= alpha * Psel( i, l );
+      }
+    }
+    real64 norm = 0.0;
+    for( integer i = 0; i <= n; ++i )
+    {
+      norm += Q( i, j ) * Q( i, j );
+    }
+    if( norm <= LvArray::NumericLimits< real64 >::epsilon * normInit )
+    {
+      continue;
+    }
+    norm = std::sqrt( norm );
+    for( integer i = 0; i <= n; ++i )
+    {
+      Q( i, numNew ) = Q( i, j ) / norm;
+    }
+    for( integer i = 0; i < n; ++i )
+    {
+      Psel( i, numNew ) = Psel( i, j ) / norm;
+    }
+    ++numNew;
+  }
+
+  // Form the new subspace: C = [C V+]*Q, UP = [UP Z]*P*R^{-1}, U = [U V]*P*R^{-1}
+  array1d< VectorTemp > Cnew( numNew );
+  array1d< VectorTemp > UPnew( numNew );
+  array1d< VectorTemp > Unew( numNew );
+  for( integer l = 0; l < numNew; ++l )
+  {
+    Cnew[l] = createTempVector( m_kspace[0] );
+    UPnew[l] = createTempVector( m_kspace[0] );
+    Unew[l] = createTempVector( m_kspace[0] );
+    Cnew[l].zero();
+    UPnew[l].zero();
+    Unew[l].zero();
+
+    for( integer i = 0; i < numRecycled; ++i )
+    {
+      Cnew[l].axpy( Q( i, l ), C[i] );
+      UPnew[l].axpy( Psel( i, l ), UP[i] );
+      Unew[l].axpy( Psel( i, l ), U[i] );
+    }
+    for( integer i = 0; i < numKrylov; ++i )
+    {
+      Cnew[l].axpy( Q( numRecycled + i, l ), m_kspace[i] );
+      UPnew[l].axpy( Psel( numRecycled + i, l ), m_zspace[i] );
+      Unew[l].axpy( Psel( numRecycled + i, l ), m_kspace[i] );
+    }
+    Cnew[l].axpy( Q( n, l ), m_kspace[numKrylov] );
+  }
+
+  C = std::move( Cnew );
+  UP = std::move( UPnew );
+  U = std::move( Unew );
+
+  if( m_params.logLevel >= 2 )
+  {
+    GEOS_LOG_RANK_0( GEOS_FMT( "[{}] recycled subspace size: {}", methodName(), numNew ) );
+  }
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class GcrodrSolver< TrilinosInterface::ParallelVector >;
+template class GcrodrSolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class GcrodrSolver< HypreInterface::ParallelVector >;
+template class GcrodrSolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class GcrodrSolver< PetscInterface::ParallelVector >;
+template class GcrodrSolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} // namespace geos
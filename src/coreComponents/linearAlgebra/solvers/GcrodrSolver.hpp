@@ -0,0 +1,175 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file GcrodrSolver.hpp
+ */
+
+#ifndef GEOS_LINEARALGEBRA_SOLVERS_GCRODRSOLVER_HPP_
+#define GEOS_LINEARALGEBRA_SOLVERS_GCRODRSOLVER_HPP_
+
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+
+namespace geos
+{
+
+/**
+ * @brief Storage for the recycled subspace of GcrodrSolver, persistent across solves.
+ * @tparam VECTOR type of the stored vectors
+ *
+ * Only the (unpreconditioned) basis vectors are stored; their images through
+ * the preconditioner and the operator are recomputed at the beginning of each
+ * solve, since both may have changed since the subspace was built.
+ */
+template< typename VECTOR >
+struct GcrodrRecycleSpace
+{
+  /// Basis of the recycled subspace
+  array1d< VECTOR > vectors;
+
+  /**
+   * @brief Discard the recycled subspace (e.g. when the system size changes).
+   */
+  void clear()
+  {
+    vectors.clear();
+  }
+};
+
+/**
+ * @brief This class implements the Generalized Conjugate Residual method with
+ *        inner Orthogonalization and Deflated Restarting (GCRO-DR),
+ *        right-preconditioned, for monolithic and block linear operators.
+ * @tparam VECTOR type of vectors this solver operates on.
+ *
+ * The solver maintains a small subspace spanned by harmonic Ritz vectors
+ * of the preconditioned operator, which is used to deflate the corresponding
+ * eigenvalues. The subspace is updated at every restart and is kept between
+ * calls to solve(), so that a sequence of slowly varying systems (e.g. the
+ * Jacobians of consecutive Newton iterations) can reuse it. The subspace may
+ * be owned by the solver or provided by the user (see RecycleSpace), the latter
+ * being useful when the solver object itself is recreated for every solve.
+ *
+ * @note  The notation is consistent with "Recycling Krylov Subspaces for
+ *        Sequences of Linear Systems" from M.L. Parks, E. de Sturler,
+ *        G. Mackey, D.D. Johnson and S. Maiti (SIAM J. Sci. Comput., 2006).
+ */
+template< typename VECTOR >
+class GcrodrSolver : public KrylovSolver< VECTOR >
+{
+public:
+
+  /// Alias for the base type
+  using Base = KrylovSolver< VECTOR >;
+
+  /// Alias for the vector type
+  using Vector = typename Base::Vector;
+
+  /// Alias for vector type that can be used for temporaries
+  using VectorTemp = typename Base::VectorTemp;
+
+  /// Alias for the storage of the recycled subspace
+  using RecycleSpace = GcrodrRecycleSpace< VectorTemp >;
+
+  /**
+   * @name Constructor/Destructor Methods
+   */
+  ///@{
+
+  /**
+   * @brief Solver object constructor.
+   * @param[in] params  parameters for the solver
+   * @param[in] matrix  reference to the system matrix
+   * @param[in] precond reference to the preconditioning operator
+   * @param[in] recycleSpace external storage for the recycled subspace;
+   *                         if @p nullptr, the solver uses its own storage
+   */
+  GcrodrSolver( LinearSolverParameters params,
+                LinearOperator< Vector > const & matrix,
+                LinearOperator< Vector > const & precond,
+                RecycleSpace * const recycleSpace = nullptr );
+
+  ///@}
+
+  /**
+   * @name KrylovSolver interface
+   */
+  ///@{
+
+  /**
+   * @brief Solve preconditioned system
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  virtual void solve( Vector const & b, Vector & x ) const override final;
+
+  virtual string methodName() const override final
+  {
+    return "GCRO-DR";
+  };
+
+  ///@}
+
+  /**
+   * @brief @return the current number of vectors in the recycled subspace
+   */
+  localIndex recycleSpaceSize() const
+  {
+    return m_recycleSpace->vectors.size();
+  }
+
+protected:
+
+  using Base::m_params;
+  using Base::m_operator;
+  using Base::m_precond;
+  using Base::m_residualNorms;
+  using Base::m_result;
+  using Base::createTempVector;
+  using Base::logProgress;
+  using Base::logResult;
+
+  /**
+   * @brief Build the new recycled subspace out of the current one and the last Arnoldi cycle.
+   * @param[in] numKrylov number of Arnoldi vectors generated in the cycle
+   * @param[in] B projection of the operator onto the current recycled subspace
+   * @param[in] H (unrotated) upper Hessenberg matrix of the cycle
+   * @param[inout] C orthonormal image of the recycled subspace through the preconditioned operator
+   * @param[inout] UP image of the recycled subspace through the preconditioner
+   */
+  void updateRecycleSpace( integer const numKrylov,
+                           arraySlice2d< real64 const > const & B,
+                           arraySlice2d< real64 const > const & H,
+                           array1d< VectorTemp > & C,
+                           array1d< VectorTemp > & UP ) const;
+
+  /// Storage for Krylov subspace vectors
+  array1d< VectorTemp > m_kspace;
+
+  /// Storage for preconditioned Krylov subspace vectors
+  array1d< VectorTemp > m_zspace;
+
+  /// Flag indicating whether kspace vectors have been created
+  bool mutable m_kspaceInitialized;
+
+  /// Recycled subspace owned by the solver (used if no external one is provided)
+  RecycleSpace mutable m_ownRecycleSpace;
+
+  /// Pointer to the recycled subspace used by the solver
+  RecycleSpace * m_recycleSpace;
+};
+
+} // namespace geos
+
+#endif //GEOS_LINEARALGEBRA_SOLVERS_GCRODRSOLVER_HPP_
@@ -19,7 +19,11 @@
 #include "KrylovSolver.hpp"
 #include "linearAlgebra/solvers/BicgstabSolver.hpp"
 #include "linearAlgebra/solvers/CgSolver.hpp"
+#include "linearAlgebra/solvers/GcrodrSolver.hpp"
 #include "linearAlgebra/solvers/GmresSolver.hpp"
+#include "linearAlgebra/solvers/PipeCgSolver.hpp"
+#include "linearAlgebra/solvers/PipeGmresSolver.hpp"
+#include "linearAlgebra/solvers/SStepGmresSolver.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 
 namespace geos
@@ -67,6 +71,30 @@ KrylovSolver< VECTOR >::create( LinearSolverParameters const & parameters,
                                                         matrix,
                                                         precond );
     }
+    case LinearSolverParameters::SolverType::gcrodr:
+    {
+      return std::make_unique< GcrodrSolver< Vector > >( parameters,
+                                                         matrix,
+                                                         precond );
+    }
+    case LinearSolverParameters::SolverType::pipecg:
+    {
+      return std::make_unique< PipeCgSolver< Vector > >( parameters,
+                                                         matrix,
+                                                         precond );
+    }
+    case LinearSolverParameters::SolverType::pipegmres:
+    {
+      return std::make_unique< PipeGmresSolver< Vector > >( parameters,
+                                                            matrix,
+                                                            precond );
+    }
+    case LinearSolverParameters::SolverType::sstepgmres:
+    {
+      return std::make_unique< SStepGmresSolver< Vector > >( parameters,
+                                                             matrix,
+                                                             precond );
+    }
     default:
     {
       GEOS_ERROR( "Unsupported linear solver type: " << parameters.solverType );
@@ -19,6 +19,10 @@
 #define GEOS_LINEARALGEBRA_SOLVERS_KRYLOVUTILS_HPP_
 
 #include "codingUtilities/Utilities.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "common/MpiWrapper.hpp"
+#include "denseLinearAlgebra/common/layouts.hpp"
+#include "linearAlgebra/utilities/BlockVectorView.hpp"
 
 /**
  * @brief Exit solver iteration and report a breakdown if value too close to zero.
@@ -35,4 +39,201 @@
     break;                                  \
   }                                         \
 
+namespace geos
+{
+
+namespace krylov
+{
+
+/**
+ * @brief Compute a Givens rotation that eliminates the second component of a 2-vector.
+ * @param[in] x first component
+ * @param[in] y second component (to be eliminated)
+ * @param[out] c cosine of the rotation
+ * @param[out] s sine of the rotation
+ */
+inline void computeGivensRotation( real64 const x, real64 const y, real64 & c, real64 & s )
+{
+  if( isZero( y ) )
+  {
+    c = 1.0;
+    s = 0.0;
+  }
+  else if( std::fabs( y ) > std::fabs( x ) )
+  {
+    real64 const nu = x / y;
+    s = 1.0 / std::sqrt( 1.0 + nu * nu );
+    c = nu * s;
+  }
+  else
+  {
+    real64 const nu = y / x;
+    c = 1.0 / std::sqrt( 1.0 + nu * nu );
+    s = nu * c;
+  }
+}
+
+/**
+ * @brief Apply a Givens rotation to a 2-vector.
+ * @param[in] c cosine of the rotation
+ * @param[in] s sine of the rotation
+ * @param[inout] dx first component
+ * @param[inout] dy second component
+ */
+inline void applyGivensRotation( real64 const c, real64 const s, real64 & dx, real64 & dy )
+{
+  real64 const temp = c * dx + s * dy;
+  dy = -s * dx + c * dy;
+  dx = temp;
+}
+
+/**
+ * @brief Solve an upper triangular system in place.
+ * @param[in] k size of the system
+ * @param[in] H the upper triangular matrix (only the leading k x k block is used)
+ * @param[inout] g the right-hand side on input, the solution on output
+ */
+inline void backsolve( integer const k,
+                       arraySlice2d< real64 const, MatrixLayout::COL_MAJOR > const & H,
+                       arraySlice1d< real64 > const & g )
+{
+  for( integer j = k - 1; j >= 0; --j )
+  {
+    g[j] /= H( j, j );
+    for( integer i = j - 1; i >= 0; --i )
+    {
+      g[i] -= H( i, j ) * g[j];
+    }
+  }
+}
+
+/**
+ * @brief Helper providing rank-local reductions on vectors, to be combined into a single global reduction.
+ * @tparam VECTOR type of vector
+ */
+template< typename VECTOR >
+struct LocalReductions
+{
+  /**
+   * @brief @return the rank-local part of the dot product of two vectors
+   * @param x the first vector
+   * @param y the second vector
+   */
+  static real64 dot( VECTOR const & x, VECTOR const & y )
+  {
+    arrayView1d< real64 const > const xValues = x.values();
+    arrayView1d< real64 const > const yValues = y.values();
+    RAJA::ReduceSum< ReducePolicy< parallelDevicePolicy<> >, real64 > sum( 0.0 );
+    forAll< parallelDevicePolicy<> >( xValues.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+    {
+      sum += xValues[i] * yValues[i];
+    } );
+    return sum.get();
+  }
+
+  /**
+   * @brief @return the communicator of a vector
+   * @param x the vector
+   */
+  static MPI_Comm comm( VECTOR const & x )
+  {
+    return x.comm();
+  }
+};
+
+/**
+ * @brief Specialization for block vectors.
+ * @tparam VECTOR type of vector blocks
+ */
+template< typename VECTOR >
+struct LocalReductions< BlockVectorView< VECTOR > >
+{
+  /// @copydoc LocalReductions::dot
+  static real64 dot( BlockVectorView< VECTOR > const & x, BlockVectorView< VECTOR > const & y )
+  {
+    real64 sum = 0.0;
+    for( localIndex i = 0; i < x.blockSize(); ++i )
+    {
+      sum += LocalReductions< VECTOR >::dot( x.block( i ), y.block( i ) );
+    }
+    return sum;
+  }
+
+  /// @copydoc LocalReductions::comm
+  static MPI_Comm comm( BlockVectorView< VECTOR > const & x )
+  {
+    return x.block( 0 ).comm();
+  }
+};
+
+/**
+ * @brief Batch of dot products summed over ranks with a single non-blocking reduction.
+ *
+ * Local contributions are accumulated with add(), the global sum is started with start()
+ * and the results are available after wait(), which allows to overlap the reduction
+ * with other work (e.g. preconditioner and operator application).
+ */
+class AsyncDotProducts
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param capacity maximum number of dot products in a batch
+   */
+  explicit AsyncDotProducts( localIndex const capacity )
+    : m_values( capacity ),
+    m_size( 0 ),
+    m_request( MPI_REQUEST_NULL )
+  {}
+
+  /**
+   * @brief Add the local contribution of a dot product to the batch.
+   * @tparam VECTOR type of vectors
+   * @param x the first vector
+   * @param y the second vector
+   */
+  template< typename VECTOR >
+  void add( VECTOR const & x, VECTOR const & y )
+  {
+    GEOS_ASSERT_GT( m_values.size(), m_size );
+    m_values[m_size++] = LocalReductions< VECTOR >::dot( x, y );
+  }
+
+  /**
+   * @brief Start the global reduction of the batch.
+   * @param comm the communicator
+   */
+  void start( MPI_Comm const comm )
+  {
+    MpiWrapper::iAllReduce( m_values.data(), m_values.data(), LvArray::integerConversion< int >( m_size ), MPI_SUM, comm, &m_request );
+  }
+
+  /**
+   * @brief Wait for the global reduction to complete and reset the batch.
+   * @return view of the reduced values, in the order they were added
+   */
+  arrayView1d< real64 const > wait()
+  {
+    MpiWrapper::wait( &m_request, MPI_STATUS_IGNORE );
+    m_size = 0;
+    return m_values.toViewConst();
+  }
+
+private:
+
+  /// Local contributions, then global values after reduction
+  array1d< real64 > m_values;
+
+  /// Number of dot products in the current batch
+  localIndex m_size;
+
+  /// Handle of the pending reduction
+  MPI_Request m_request;
+};
+
+} // namespace krylov
+
+} // namespace geos
+
 #endif //GEOS_LINEARALGEBRA_SOLVERS_KRYLOVUTILS_HPP_
@@ -0,0 +1,162 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file PipeCgSolver.cpp
+ */
+
+#include "PipeCgSolver.hpp"
+
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+
+namespace geos
+{
+
+template< typename VECTOR >
+PipeCgSolver< VECTOR >::PipeCgSolver( LinearSolverParameters params,
+                                      LinearOperator< Vector > const & A,
+                                      LinearOperator< Vector > const & M )
+  : KrylovSolver< VECTOR >( std::move( params ), A, M )
+{
+  GEOS_ERROR_IF( !m_params.isSymmetric, "Cannot use pipelined CG solver with a non-symmetric system" );
+}
+
+template< typename VECTOR >
+void PipeCgSolver< VECTOR >::solve( Vector const & b, Vector & x ) const
+{
+  Stopwatch watch;
+
+  // Define residual vector and its preconditioned counterparts: u = M*r, w = A*u
+  VectorTemp r = createTempVector( b );
+  VectorTemp u = createTempVector( b );
+  VectorTemp w = createTempVector( b );
+
+  // Define auxiliary vectors: m = M*w, n = A*m
+  VectorTemp m = createTempVector( b );
+  VectorTemp n = createTempVector( b );
+
+  // Define recurrence vectors: p (search direction), s = A*p, q = M*s, z = A*q
+  VectorTemp p = createTempVector( b );
+  VectorTemp s = createTempVector( b );
+  VectorTemp q = createTempVector( b );
+  VectorTemp z = createTempVector( b );
+  p.zero();
+  s.zero();
+  q.zero();
+  z.zero();
+
+  // Compute initial rk = b - Ax, u = M*r and w = A*u
+  m_operator.residual( x, b, r );
+  m_precond.apply( r, u );
+  m_operator.apply( u, w );
+
+  // Compute the target absolute tolerance
+  real64 const rnorm0 = r.norm2();
+  real64 const absTol = rnorm0 * m_params.krylov.relTolerance;
+
+  krylov::AsyncDotProducts dots( 3 );
+  MPI_Comm const comm = krylov::LocalReductions< Vector >::comm( b );
+
+  real64 gamma_old = 0.0;
+  real64 alpha_old = 0.0;
+
+  // Initialize iteration state
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.clear();
+
+  integer & k = m_result.numIterations;
+  for( k = 0; k <= m_params.krylov.maxIterations; ++k )
+  {
+    // Start the reduction of all dot products of the iteration
+    dots.add< Vector >( r, r );
+    dots.add< Vector >( r, u );
+    dots.add< Vector >( w, u );
+    dots.start( comm );
+
+    // Overlap the reduction with m = M*w, n = A*m
+    m_precond.apply( w, m );
+    m_operator.apply( m, n );
+
+    arrayView1d< real64 const > const values = dots.wait();
+    real64 const rnorm = std::sqrt( LvArray::math::max( values[0], 0.0 ) );
+    real64 const gamma = values[1];
+    real64 const delta = values[2];
+
+    m_residualNorms.emplace_back( rnorm );
+    logProgress();
+
+    // Convergence check on ||rk||/||b||
+    if( rnorm <= absTol )
+    {
+      m_result.status = LinearSolverResult::Status::Success;
+      break;
+    }
+
+    // Compute alpha and beta
+    real64 beta = 0.0;
+    real64 denom = delta;
+    if( k > 0 )
+    {
+      GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( gamma_old )
+      GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( alpha_old )
+      beta = gamma / gamma_old;
+      denom = delta - beta * gamma / alpha_old;
+    }
+    GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( denom )
+    real64 const alpha = gamma / denom;
+
+    // Update recurrences
+    z.axpby( 1.0, n, beta );
+    q.axpby( 1.0, m, beta );
+    s.axpby( 1.0, w, beta );
+    p.axpby( 1.0, u, beta );
+
+    // Update solution and residuals
+    x.axpby( alpha, p, 1.0 );
+    r.axpby( -alpha, s, 1.0 );
+    u.axpby( -alpha, q, 1.0 );
+    w.axpby( -alpha, z, 1.0 );
+
+    // Keep the old values
+    gamma_old = gamma;
+    alpha_old = alpha;
+  }
+
+  m_result.residualReduction = rnorm0 > 0.0 ? m_residualNorms.back() / rnorm0 : 0.0;
+  m_result.solveTime = watch.elapsedTime();
+  logResult();
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class PipeCgSolver< TrilinosInterface::ParallelVector >;
+template class PipeCgSolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class PipeCgSolver< HypreInterface::ParallelVector >;
+template class PipeCgSolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class PipeCgSolver< PetscInterface::ParallelVector >;
+template class PipeCgSolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} // namespace geos
@@ -0,0 +1,107 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file PipeCgSolver.hpp
+ */
+
+#ifndef GEOS_LINEARALGEBRA_SOLVERS_PIPECGSOLVER_HPP_
+#define GEOS_LINEARALGEBRA_SOLVERS_PIPECGSOLVER_HPP_
+
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+
+namespace geos
+{
+
+/**
+ * @brief This class implements the pipelined Conjugate Gradient method
+ *        for monolithic and block linear operators.
+ * @tparam VECTOR type of vectors this solver operates on.
+ *
+ * All dot products of an iteration are combined into a single non-blocking
+ * global reduction, which is overlapped with the application of the
+ * preconditioner and the operator. This trades a few extra vector updates
+ * for the removal of the global synchronization points of standard CG.
+ *
+ * @note  The notation is consistent with "Hiding global synchronization
+ *        latency in the preconditioned Conjugate Gradient algorithm"
+ *        from P. Ghysels and W. Vanroose (Parallel Computing, 2014).
+ */
+template< typename VECTOR >
+class PipeCgSolver : public KrylovSolver< VECTOR >
+{
+public:
+
+  /// Alias for base type
+  using Base = KrylovSolver< VECTOR >;
+
+  /// Alias for template parameter
+  using Vector = typename Base::Vector;
+
+  /**
+   * @name Constructor/Destructor Methods
+   */
+  ///@{
+
+  /**
+   * @brief Constructor.
+   * @param [in] params parameters for the solver
+   * @param [in] A reference to the system matrix.
+   * @param [in] M reference to the preconditioning operator.
+   */
+  PipeCgSolver( LinearSolverParameters params,
+                LinearOperator< Vector > const & A,
+                LinearOperator< Vector > const & M );
+
+  ///@}
+
+  /**
+   * @name KrylovSolver interface
+   */
+  ///@{
+
+  /**
+   * @brief Solve preconditioned system
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  virtual void solve( Vector const & b, Vector & x ) const override final;
+
+  virtual string methodName() const override final
+  {
+    return "PipeCG";
+  };
+
+  ///@}
+
+protected:
+
+  /// Alias for vector type that can be used for temporaries
+  using VectorTemp = typename KrylovSolver< VECTOR >::VectorTemp;
+
+  using Base::m_params;
+  using Base::m_operator;
+  using Base::m_precond;
+  using Base::m_result;
+  using Base::m_residualNorms;
+  using Base::createTempVector;
+  using Base::logProgress;
+  using Base::logResult;
+
+};
+
+} // namespace geos
+
+#endif //GEOS_LINEARALGEBRA_SOLVERS_PIPECGSOLVER_HPP_
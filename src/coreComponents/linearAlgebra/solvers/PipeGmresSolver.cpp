@@ -0,0 +1,222 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file PipeGmresSolver.cpp
+ */
+
+#include "PipeGmresSolver.hpp"
+
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+
+namespace geos
+{
+
+template< typename VECTOR >
+PipeGmresSolver< VECTOR >::PipeGmresSolver( LinearSolverParameters params,
+                                            LinearOperator< Vector > const & A,
+                                            LinearOperator< Vector > const & M )
+  : KrylovSolver< VECTOR >( std::move( params ), A, M ),
+  m_kspace( m_params.krylov.maxRestart + 1 ),
+  m_zspace( m_params.krylov.maxRestart + 1 ),
+  m_wspace( m_params.krylov.maxRestart + 1 ),
+  m_kspaceInitialized( false )
+{
+  GEOS_ERROR_IF_LE_MSG( m_params.krylov.maxRestart, 0, "PipeGMRES: max number of iterations until restart must be positive." );
+}
+
+template< typename VECTOR >
+void PipeGmresSolver< VECTOR >::solve( Vector const & b,
+                                       Vector & x ) const
+{
+  // We create Krylov subspace vectors once using the size and partitioning of b.
+  // On repeated calls to solve() input vectors must have the same size and partitioning.
+  if( !m_kspaceInitialized )
+  {
+    for( localIndex i = 0; i < m_kspace.size(); ++i )
+    {
+      m_kspace[i] = createTempVector( b );
+      m_zspace[i] = createTempVector( b );
+      m_wspace[i] = createTempVector( b );
+    }
+    m_kspaceInitialized = true;
+  }
+
+  Stopwatch watch;
+
+  integer const maxRestart = m_params.krylov.maxRestart;
+
+  // Define vectors
+  VectorTemp r = createTempVector( b );
+  VectorTemp zt = createTempVector( b );
+  VectorTemp wt = createTempVector( b );
+
+  // Compute initial rk
+  m_operator.residual( x, b, r );
+
+  // Compute the target absolute tolerance
+  real64 const rnorm0 = r.norm2();
+  real64 const absTol = rnorm0 * m_params.krylov.relTolerance;
+
+  // Create upper Hessenberg matrix
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > H( maxRestart + 1, maxRestart );
+
+  // Create plane rotation storage
+  array1d< real64 > c( maxRestart + 1 );
+  array1d< real64 > s( maxRestart + 1 );
+  array1d< real64 > g( maxRestart + 1 );
+
+  krylov::AsyncDotProducts dots( maxRestart + 1 );
+  MPI_Comm const comm = krylov::LocalReductions< Vector >::comm( b );
+
+  // Initialize iteration state
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.clear();
+
+  integer & k = m_result.numIterations;
+  k = 0;
+  while( k <= m_params.krylov.maxIterations && m_result.status == LinearSolverResult::Status::NotConverged )
+  {
+    // Re-initialize Krylov subspace along with its images
+    g.zero();
+    g[0] = k > 0 ? r.norm2() : rnorm0;
+    m_kspace[0].copy( r );
+    if( g[0] > 0 )
+    {
+      m_kspace[0].scale( 1.0 / g[0] );
+    }
+    m_precond.apply( m_kspace[0], m_zspace[0] );
+    m_operator.apply( m_zspace[0], m_wspace[0] );
+
+    integer j = 0;
+    for(; j < maxRestart && k <= m_params.krylov.maxIterations; ++j, ++k )
+    {
+      // Record iteration progress
+      real64 const rnorm = std::fabs( g[j] );
+      m_residualNorms.emplace_back( rnorm );
+      logProgress();
+
+      // Convergence check
+      if( rnorm <= absTol )
+      {
+        m_result.status = LinearSolverResult::Status::Success;
+        break;
+      }
+
+      // Start the reduction of all dot products needed for orthogonalization of w = A*M*v_j
+      VectorTemp const & w = m_wspace[j];
+      for( integer i = 0; i <= j; ++i )
+      {
+        dots.add< Vector >( w, m_kspace[i] );
+      }
+      dots.add< Vector >( w, w );
+      dots.start( comm );
+
+      // Overlap the reduction with the images of w, unless this is the last vector of the cycle
+      bool const computeNext = j + 1 < maxRestart;
+      if( computeNext )
+      {
+        m_precond.apply( w, zt );
+        m_operator.apply( zt, wt );
+      }
+
+      // Classical Gram-Schmidt coefficients, the norm being obtained from Pythagoras' theorem
+      arrayView1d< real64 const > const values = dots.wait();
+      real64 normSq = values[j+1];
+      for( integer i = 0; i <= j; ++i )
+      {
+        H( i, j ) = values[i];
+        normSq -= values[i] * values[i];
+      }
+
+      m_kspace[j+1].copy( w );
+      for( integer i = 0; i <= j; ++i )
+      {
+        m_kspace[j+1].axpy( -H( i, j ), m_kspace[i] );
+      }
+
+      // Fall back to an explicit norm computation in case of severe cancellation
+      if( normSq <= LvArray::NumericLimits< real64 >::epsilon * values[j+1] )
+      {
+        normSq = m_kspace[j+1].dot( m_kspace[j+1] );
+      }
+      H( j+1, j ) = std::sqrt( LvArray::math::max( normSq, 0.0 ) );
+      GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( H( j+1, j ) )
+      real64 const scale = 1.0 / H( j+1, j );
+      m_kspace[j+1].scale( scale );
+
+      // Recover M*v_{j+1} and A*M*v_{j+1} by linearity
+      if( computeNext )
+      {
+        m_zspace[j+1].copy( zt );
+        m_wspace[j+1].copy( wt );
+        for( integer i = 0; i <= j; ++i )
+        {
+          m_zspace[j+1].axpy( -H( i, j ), m_zspace[i] );
+          m_wspace[j+1].axpy( -H( i, j ), m_wspace[i] );
+        }
+        m_zspace[j+1].scale( scale );
+        m_wspace[j+1].scale( scale );
+      }
+
+      // Apply all previous rotations to the new column
+      for( integer i = 0; i < j; ++i )
+      {
+        krylov::applyGivensRotation( c[i], s[i], H( i, j ), H( i+1, j ) );
+      }
+
+      // Compute and apply the new rotation to eliminate subdiagonal element
+      krylov::computeGivensRotation( H( j, j ), H( j+1, j ), c[j], s[j] );
+      krylov::applyGivensRotation( c[j], s[j], H( j, j ), H( j+1, j ) );
+      krylov::applyGivensRotation( c[j], s[j], g[j], g[j+1] );
+    }
+
+    // Regardless of how we quit out of inner loop, j is the actual size of H
+    krylov::backsolve( j, H, g );
+
+    // Update the solution vector and recompute residual
+    for( integer i = 0; i < j; ++i )
+    {
+      x.axpy( g[i], m_zspace[i] );
+    }
+    m_operator.residual( x, b, r );
+  }
+
+  m_result.residualReduction = rnorm0 > 0.0 ? m_residualNorms.back() / rnorm0 : 0.0;
+  m_result.solveTime = watch.elapsedTime();
+  logResult();
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class PipeGmresSolver< TrilinosInterface::ParallelVector >;
+template class PipeGmresSolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class PipeGmresSolver< HypreInterface::ParallelVector >;
+template class PipeGmresSolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class PipeGmresSolver< PetscInterface::ParallelVector >;
+template class PipeGmresSolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} // namespace geos
@@ -0,0 +1,121 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file PipeGmresSolver.hpp
+ */
+
+#ifndef GEOS_LINEARALGEBRA_SOLVERS_PIPEGMRESSOLVER_HPP_
+#define GEOS_LINEARALGEBRA_SOLVERS_PIPEGMRESSOLVER_HPP_
+
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+
+namespace geos
+{
+
+/**
+ * @brief This class implements the pipelined Generalized Minimized RESidual method
+ *        (right-preconditioned) for monolithic and block linear operators.
+ * @tparam VECTOR type of vectors this solver operates on.
+ *
+ * Orthogonalization uses classical Gram-Schmidt, and all dot products of an
+ * iteration (including the norm of the new vector) are combined into a single
+ * non-blocking global reduction. The reduction is overlapped with the application
+ * of the preconditioner and the operator to the unorthogonalized vector, the images
+ * of the new basis vector being then recovered by linearity from those of the
+ * previous ones. This requires storing the basis, its image through the
+ * preconditioner and its image through the preconditioned operator.
+ *
+ * @note  The approach follows "Hiding global communication latency in the GMRES
+ *        algorithm on massively parallel machines" from P. Ghysels, T.J. Ashby,
+ *        K. Meerbergen and W. Vanroose (SIAM J. Sci. Comput., 2013), with a lag of one.
+ */
+template< typename VECTOR >
+class PipeGmresSolver : public KrylovSolver< VECTOR >
+{
+public:
+
+  /// Alias for the base type
+  using Base = KrylovSolver< VECTOR >;
+
+  /// Alias for the vector type
+  using Vector = typename Base::Vector;
+
+  /**
+   * @name Constructor/Destructor Methods
+   */
+  ///@{
+
+  /**
+   * @brief Solver object constructor.
+   * @param[in] params  parameters for the solver
+   * @param[in] matrix  reference to the system matrix
+   * @param[in] precond reference to the preconditioning operator
+   */
+  PipeGmresSolver( LinearSolverParameters params,
+                   LinearOperator< Vector > const & matrix,
+                   LinearOperator< Vector > const & precond );
+
+  ///@}
+
+  /**
+   * @name KrylovSolver interface
+   */
+  ///@{
+
+  /**
+   * @brief Solve preconditioned system
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  virtual void solve( Vector const & b, Vector & x ) const override final;
+
+  virtual string methodName() const override final
+  {
+    return "PipeGMRES";
+  };
+
+  ///@}
+
+protected:
+
+  /// Alias for vector type that can be used for temporaries
+  using VectorTemp = typename KrylovSolver< VECTOR >::VectorTemp;
+
+  using Base::m_params;
+  using Base::m_operator;
+  using Base::m_precond;
+  using Base::m_residualNorms;
+  using Base::m_result;
+  using Base::createTempVector;
+  using Base::logProgress;
+  using Base::logResult;
+
+  /// Storage for Krylov subspace vectors
+  array1d< VectorTemp > m_kspace;
+
+  /// Storage for preconditioned Krylov subspace vectors
+  array1d< VectorTemp > m_zspace;
+
+  /// Storage for images of Krylov subspace vectors through the preconditioned operator
+  array1d< VectorTemp > m_wspace;
+
+  /// Flag indicating whether kspace vectors have been created
+  bool mutable m_kspaceInitialized;
+};
+
+} // namespace geos
+
+#endif //GEOS_LINEARALGEBRA_SOLVERS_PIPEGMRESSOLVER_HPP_
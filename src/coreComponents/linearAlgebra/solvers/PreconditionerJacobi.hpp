@@ -17,6 +17,7 @@
 
 #include "linearAlgebra/common/LinearOperator.hpp"
 #include "linearAlgebra/common/PreconditionerBase.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
 
 namespace geos
 {
@@ -39,6 +40,14 @@ public:
   /// Alias for matrix type
   using Matrix = typename Base::Matrix;
 
+  /**
+   * @brief Constructor.
+   * @param mixedPrecision whether to store and apply the inverse diagonal in single precision
+   */
+  explicit PreconditionerJacobi( bool const mixedPrecision = false )
+    : m_mixedPrecision( mixedPrecision )
+  {}
+
   /**
    * @brief Compute the preconditioner from a matrix.
    * @param mat the matrix to precondition.
@@ -46,9 +55,24 @@ public:
   virtual void setup( Matrix const & mat ) override
   {
     GEOS_LAI_ASSERT( mat.ready() );
+    PreconditionerBase< LAI >::setup( mat );
+
     m_diagInv.createWithLocalSize( mat.numLocalRows(), mat.comm() );
     mat.extractDiagonal( m_diagInv );
     m_diagInv.reciprocal();
+
+    if( m_mixedPrecision )
+    {
+      // Keep a single precision copy only, the double precision one is released
+      arrayView1d< real64 const > const diagInv = m_diagInv.values();
+      m_diagInvSingle.resize( diagInv.size() );
+      arrayView1d< real32 > const diagInvSingle = m_diagInvSingle.toView();
+      forAll< parallelDevicePolicy<> >( diagInv.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+      {
+        diagInvSingle[i] = static_cast< real32 >( diagInv[i] );
+      } );
+      m_diagInv.reset();
+    }
   }
 
   /**
@@ -64,27 +88,9 @@ public:
    */
   virtual void clear() override
   {
+    PreconditionerBase< LAI >::clear();
     m_diagInv.reset();
-  }
-
-  /**
-   * @brief Get the number of global rows.
-   * @return Number of global rows in the operator.
-   */
-  virtual globalIndex numGlobalRows() const override final
-  {
-    GEOS_LAI_ASSERT( m_diagInv.ready() );
-    return m_diagInv.globalSize();
-  }
-
-  /**
-   * @brief Get the number of global columns.
-   * @return Number of global columns in the operator.
-   */
-  virtual globalIndex numGlobalCols() const override final
-  {
-    GEOS_LAI_ASSERT( m_diagInv.ready() );
-    return m_diagInv.globalSize();
+    m_diagInvSingle.clear();
   }
 
   /**
@@ -96,17 +102,38 @@ public:
   virtual void apply( Vector const & src,
                       Vector & dst ) const override
   {
-    GEOS_LAI_ASSERT( m_diagInv.ready() );
+    GEOS_LAI_ASSERT( this->ready() );
     GEOS_LAI_ASSERT_EQ( this->numGlobalRows(), dst.globalSize() );
     GEOS_LAI_ASSERT_EQ( this->numGlobalCols(), src.globalSize() );
 
-    m_diagInv.pointwiseProduct( src, dst );
+    if( m_mixedPrecision )
+    {
+      // Vectors remain in double precision, conversion happens on the fly
+      arrayView1d< real32 const > const diagInv = m_diagInvSingle.toViewConst();
+      arrayView1d< real64 const > const srcValues = src.values();
+      arrayView1d< real64 > const dstValues = dst.open();
+      forAll< parallelDevicePolicy<> >( dstValues.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+      {
+        dstValues[i] = diagInv[i] * srcValues[i];
+      } );
+      dst.close();
+    }
+    else
+    {
+      m_diagInv.pointwiseProduct( src, dst );
+    }
   }
 
 private:
 
-  /// The diagonal of the matrix
+  /// The inverse diagonal of the matrix
   Vector m_diagInv;
+
+  /// The inverse diagonal of the matrix in single precision (mixed precision mode)
+  array1d< real32 > m_diagInvSingle;
+
+  /// Whether to store and apply the preconditioner in single precision
+  bool m_mixedPrecision = false;
 };
 
 }
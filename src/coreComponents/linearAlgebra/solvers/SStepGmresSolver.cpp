@@ -0,0 +1,334 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file SStepGmresSolver.cpp
+ */
+
+#include "SStepGmresSolver.hpp"
+
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+
+namespace geos
+{
+
+template< typename VECTOR >
+SStepGmresSolver< VECTOR >::SStepGmresSolver( LinearSolverParameters params,
+                                              LinearOperator< Vector > const & A,
+                                              LinearOperator< Vector > const & M )
+  : KrylovSolver< VECTOR >( std::move( params ), A, M ),
+  m_kspace( m_params.krylov.maxRestart + 1 ),
+  m_kspaceInitialized( false )
+{
+  GEOS_ERROR_IF_LE_MSG( m_params.krylov.maxRestart, 0, "s-step GMRES: max number of iterations until restart must be positive." );
+  GEOS_ERROR_IF_LE_MSG( m_params.krylov.sStepSize, 0, "s-step GMRES: number of steps per block must be positive." );
+}
+
+template< typename VECTOR >
+void SStepGmresSolver< VECTOR >::solve( Vector const & b,
+                                        Vector & x ) const
+{
+  // We create Krylov subspace vectors once using the size and partitioning of b.
+  // On repeated calls to solve() input vectors must have the same size and partitioning.
+  if( !m_kspaceInitialized )
+  {
+    for( VectorTemp & kv : m_kspace )
+    {
+      kv = createTempVector( b );
+    }
+    m_kspaceInitialized = true;
+  }
+
+  Stopwatch watch;
+
+  integer const maxRestart = m_params.krylov.maxRestart;
+  integer const sMax = LvArray::math::min( m_params.krylov.sStepSize, maxRestart );
+
+  // Define vectors
+  VectorTemp r = createTempVector( b );
+  VectorTemp w = createTempVector( b );
+  VectorTemp z = createTempVector( b );
+
+  // Compute initial rk
+  m_operator.residual( x, b, r );
+
+  // Compute the target absolute tolerance
+  real64 const rnorm0 = r.norm2();
+  real64 const absTol = rnorm0 * m_params.krylov.relTolerance;
+
+  // Create upper Hessenberg matrix, both as computed and with rotations applied
+  array2d< real64 > H( maxRestart + 1, maxRestart );
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > HR( maxRestart + 1, maxRestart );
+
+  // Create plane rotation storage
+  array1d< real64 > c( maxRestart + 1 );
+  array1d< real64 > s( maxRestart + 1 );
+  array1d< real64 > g( maxRestart + 1 );
+
+  // Create storage for the block orthogonalization and the change of basis
+  array2d< real64 > C( maxRestart + 1, sMax );
+  array2d< real64 > G( sMax, sMax );
+  array2d< real64 > R( sMax, sMax );
+  array2d< real64 > T0( maxRestart + 1, sMax );
+  array2d< real64 > T1( maxRestart + 1, sMax );
+  array2d< real64 > HB( maxRestart + 1, sMax );
+
+  krylov::AsyncDotProducts dots( ( maxRestart + 1 ) * sMax + sMax * ( sMax + 1 ) / 2 );
+  MPI_Comm const comm = krylov::LocalReductions< Vector >::comm( b );
+
+  // Initialize iteration state
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.clear();
+
+  integer & k = m_result.numIterations;
+  k = 0;
+  while( k <= m_params.krylov.maxIterations && m_result.status == LinearSolverResult::Status::NotConverged )
+  {
+    // Re-initialize Krylov subspace
+    g.zero();
+    H.zero();
+    g[0] = k > 0 ? r.norm2() : rnorm0;
+    m_kspace[0].copy( r );
+    if( g[0] > 0 )
+    {
+      m_kspace[0].scale( 1.0 / g[0] );
+    }
+
+    integer j = 0;
+    integer blockEnd = 0;
+    for(; j < maxRestart && k <= m_params.krylov.maxIterations; ++j, ++k )
+    {
+      // Record iteration progress
+      real64 const rnorm = std::fabs( g[j] );
+      m_residualNorms.emplace_back( rnorm );
+      logProgress();
+
+      // Convergence check
+      if( rnorm <= absTol )
+      {
+        m_result.status = LinearSolverResult::Status::Success;
+        break;
+      }
+
+      if( j == blockEnd )
+      {
+        integer const numSteps = LvArray::math::min( sMax, maxRestart - j );
+
+        // Generate the monomial basis K_a = (A*M)^{a+1} v_j, stored in place of v_{j+1+a}, without any reduction
+        for( integer a = 0; a < numSteps; ++a )
+        {
+          m_precond.apply( m_kspace[j+a], z );
+          m_operator.apply( z, m_kspace[j+1+a] );
+        }
+
+        // Compute all dot products of the block with a single reduction: C = V^T K and G = K^T K
+        for( integer a = 0; a < numSteps; ++a )
+        {
+          for( integer l = 0; l <= j; ++l )
+          {
+            dots.add< Vector >( m_kspace[l], m_kspace[j+1+a] );
+          }
+          for( integer bb = 0; bb <= a; ++bb )
+          {
+            dots.add< Vector >( m_kspace[j+1+bb], m_kspace[j+1+a] );
+          }
+        }
+        dots.start( comm );
+        arrayView1d< real64 const > const values = dots.wait();
+        localIndex pos = 0;
+        for( integer a = 0; a < numSteps; ++a )
+        {
+          for( integer l = 0; l <= j; ++l )
+          {
+            C( l, a ) = values[pos++];
+          }
+          for( integer bb = 0; bb <= a; ++bb )
+          {
+            G( bb, a ) = values[pos++];
+            G( a, bb ) = G( bb, a );
+          }
+        }
+
+        // Cholesky factorization of the Gram matrix of the projected block, G - C^T C = R^T R.
+        // Vectors that are numerically dependent on the previous ones are discarded.
+        integer numAccepted = 0;
+        R.zero();
+        for( integer a = 0; a < numSteps; ++a )
+        {
+          real64 d = G( a, a );
+          for( integer l = 0; l <= j; ++l )
+          {
+            d -= C( l, a ) * C( l, a );
+          }
+          for( integer t = 0; t < a; ++t )
+          {
+            d -= R( t, a ) * R( t, a );
+          }
+          if( d <= LvArray::NumericLimits< real64 >::epsilon * G( a, a ) )
+          {
+            break;
+          }
+          R( a, a ) = std::sqrt( d );
+          for( integer bb = a + 1; bb < numSteps; ++bb )
+          {
+            real64 v = G( a, bb );
+            for( integer l = 0; l <= j; ++l )
+            {
+              v -= C( l, a ) * C( l, bb );
+            }
+            for( integer t = 0; t < a; ++t )
+            {
+              v -= R( t, a ) * R( t, bb );
+            }
+            R( a, bb ) = v / R( a, a );
+          }
+          ++numAccepted;
+        }
+        if( numAccepted == 0 )
+        {
+          if( m_params.logLevel >= 1 )
+          {
+            GEOS_LOG_RANK_0( "Breakdown in " << methodName() << ": monomial basis is numerically rank deficient" );
+          }
+          m_result.status = LinearSolverResult::Status::Breakdown;
+          break;
+        }
+
+        // Orthonormalize the block: Q = (K - V*C) * R^{-1}
+        for( integer a = 0; a < numAccepted; ++a )
+        {
+          for( integer l = 0; l <= j; ++l )
+          {
+            m_kspace[j+1+a].axpy( -C( l, a ), m_kspace[l] );
+          }
+          for( integer t = 0; t < a; ++t )
+          {
+            m_kspace[j+1+a].axpy( -R( t, a ), m_kspace[j+1+t] );
+          }
+          m_kspace[j+1+a].scale( 1.0 / R( a, a ) );
+        }
+
+        // Coordinates of the monomial vectors in the orthonormal basis: T0 for (v_j, K_0, ..., K_{s-2}), T1 for (K_0, ..., K_{s-1})
+        T0.zero();
+        T1.zero();
+        T0( j, 0 ) = 1.0;
+        for( integer a = 0; a < numAccepted; ++a )
+        {
+          for( integer l = 0; l <= j; ++l )
+          {
+            T1( l, a ) = C( l, a );
+          }
+          for( integer t = 0; t <= a; ++t )
+          {
+            T1( j+1+t, a ) = R( t, a );
+          }
+          if( a + 1 < numAccepted )
+          {
+            for( integer i = 0; i <= j + 1 + a; ++i )
+            {
+              T0( i, a+1 ) = T1( i, a );
+            }
+          }
+        }
+
+        // Since A*M*[V_{0:j-1} B_new]*T0 = B*T1 and A*M*V_{0:j-1} = B*H_{0:j-1}, the new columns are
+        // H_new = (T1 - H_{0:j-1}*T0_{0:j-1}) * T^{-1}, with T the (upper triangular) trailing block of T0
+        for( integer a = 0; a < numAccepted; ++a )
+        {
+          for( integer i = 0; i <= j + 1 + a; ++i )
+          {
+            real64 v = T1( i, a );
+            for( integer l = 0; l < j; ++l )
+            {
+              v -= H( i, l ) * T0( l, a );
+            }
+            for( integer t = 0; t < a; ++t )
+            {
+              v -= HB( i, t ) * T0( j+t, a );
+            }
+            HB( i, a ) = v / T0( j+a, a );
+          }
+          for( integer i = j + 2 + a; i <= maxRestart; ++i )
+          {
+            HB( i, a ) = 0.0;
+          }
+        }
+        for( integer a = 0; a < numAccepted; ++a )
+        {
+          for( integer i = 0; i <= j + 1 + a; ++i )
+          {
+            H( i, j+a ) = HB( i, a );
+          }
+        }
+
+        blockEnd = j + numAccepted;
+      }
+
+      // Apply all previous rotations to a copy of the new column
+      for( integer i = 0; i <= j+1; ++i )
+      {
+        HR( i, j ) = H( i, j );
+      }
+      for( integer i = 0; i < j; ++i )
+      {
+        krylov::applyGivensRotation( c[i], s[i], HR( i, j ), HR( i+1, j ) );
+      }
+
+      // Compute and apply the new rotation to eliminate subdiagonal element
+      krylov::computeGivensRotation( HR( j, j ), HR( j+1, j ), c[j], s[j] );
+      krylov::applyGivensRotation( c[j], s[j], HR( j, j ), HR( j+1, j ) );
+      krylov::applyGivensRotation( c[j], s[j], g[j], g[j+1] );
+    }
+
+    // Regardless of how we quit out of inner loop, j is the actual size of H
+    krylov::backsolve( j, HR, g );
+    w.zero();
+    for( integer i = 0; i < j; ++i )
+    {
+      w.axpy( g[i], m_kspace[i] );
+    }
+    m_precond.apply( w, z );
+
+    // Update the solution vector and recompute residual
+    x.axpy( 1.0, z );
+    m_operator.residual( x, b, r );
+  }
+
+  m_result.residualReduction = rnorm0 > 0.0 ? m_residualNorms.back() / rnorm0 : 0.0;
+  m_result.solveTime = watch.elapsedTime();
+  logResult();
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class SStepGmresSolver< TrilinosInterface::ParallelVector >;
+template class SStepGmresSolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class SStepGmresSolver< HypreInterface::ParallelVector >;
+template class SStepGmresSolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class SStepGmresSolver< PetscInterface::ParallelVector >;
+template class SStepGmresSolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} // namespace geos
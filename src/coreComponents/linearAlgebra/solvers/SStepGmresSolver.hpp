@@ -0,0 +1,116 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file SStepGmresSolver.hpp
+ */
+
+#ifndef GEOS_LINEARALGEBRA_SOLVERS_SSTEPGMRESSOLVER_HPP_
+#define GEOS_LINEARALGEBRA_SOLVERS_SSTEPGMRESSOLVER_HPP_
+
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+
+namespace geos
+{
+
+/**
+ * @brief This class implements the s-step (communication-avoiding) Generalized Minimized
+ *        RESidual method (right-preconditioned) for monolithic and block linear operators.
+ * @tparam VECTOR type of vectors this solver operates on.
+ *
+ * Blocks of s basis vectors are generated with the monomial basis, i.e. by s consecutive
+ * applications of the preconditioned operator without any global reduction. Each block is
+ * then orthogonalized against the previous basis and orthonormalized with block classical
+ * Gram-Schmidt followed by a Cholesky QR factorization, all dot products being computed with
+ * a single global reduction. The Hessenberg matrix is recovered from the change of basis.
+ * Since the monomial basis quickly becomes ill-conditioned, s should be kept small.
+ *
+ * @note  The approach follows "Communication-avoiding Krylov subspace methods"
+ *        from M. Hoemmen (PhD thesis, UC Berkeley, 2010).
+ */
+template< typename VECTOR >
+class SStepGmresSolver : public KrylovSolver< VECTOR >
+{
+public:
+
+  /// Alias for the base type
+  using Base = KrylovSolver< VECTOR >;
+
+  /// Alias for the vector type
+  using Vector = typename Base::Vector;
+
+  /**
+   * @name Constructor/Destructor Methods
+   */
+  ///@{
+
+  /**
+   * @brief Solver object constructor.
+   * @param[in] params  parameters for the solver
+   * @param[in] matrix  reference to the system matrix
+   * @param[in] precond reference to the preconditioning operator
+   */
+  SStepGmresSolver( LinearSolverParameters params,
+                    LinearOperator< Vector > const & matrix,
+                    LinearOperator< Vector > const & precond );
+
+  ///@}
+
+  /**
+   * @name KrylovSolver interface
+   */
+  ///@{
+
+  /**
+   * @brief Solve preconditioned system
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  virtual void solve( Vector const & b, Vector & x ) const override final;
+
+  virtual string methodName() const override final
+  {
+    return "s-step GMRES";
+  };
+
+  ///@}
+
+protected:
+
+  /// Alias for vector type that can be used for temporaries
+  using VectorTemp = typename KrylovSolver< VECTOR >::VectorTemp;
+
+  using Base::m_params;
+  using Base::m_operator;
+  using Base::m_precond;
+  using Base::m_residualNorms;
+  using Base::m_result;
+  using Base::createTempVector;
+  using Base::logProgress;
+  using Base::logResult;
+
+  /// Storage for Krylov subspace vectors
+  array1d< VectorTemp > m_kspace;
+
+  /// Storage for preconditioned monomial basis vectors
+  array1d< VectorTemp > m_zspace;
+
+  /// Flag indicating whether kspace vectors have been created
+  bool mutable m_kspaceInitialized;
+};
+
+} // namespace geos
+
+#endif //GEOS_LINEARALGEBRA_SOLVERS_SSTEPGMRESSOLVER_HPP_
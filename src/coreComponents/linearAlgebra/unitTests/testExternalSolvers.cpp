@@ -88,6 +88,28 @@ LinearSolverParameters params_CG_AMG()
   return parameters;
 }
 
+LinearSolverParameters params_GMRES_Jacobi()
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 1000;
+  parameters.krylov.maxRestart = 1000;
+  parameters.solverType = LinearSolverParameters::SolverType::gmres;
+  parameters.preconditionerType = LinearSolverParameters::PreconditionerType::jacobi;
+  return parameters;
+}
+
+LinearSolverParameters params_CG_Jacobi()
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 5000;
+  parameters.isSymmetric = true;
+  parameters.solverType = LinearSolverParameters::SolverType::cg;
+  parameters.preconditionerType = LinearSolverParameters::PreconditionerType::jacobi;
+  return parameters;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////
 
 template< typename LAI >
@@ -132,6 +154,51 @@ protected:
     real64 const relTol = cond_est * params.krylov.relTolerance;
     EXPECT_LT( sol_diff.norm2() / sol_true.norm2(), relTol );
   }
+
+  /**
+   * @brief Compare the solves with the preconditioner stored in double and in single precision.
+   * @param params the solver parameters, mixed precision being toggled by the test
+   */
+  void testMixedPrecision( LinearSolverParameters params )
+  {
+    Vector sol_true;
+    sol_true.create( matrix.numLocalCols(), matrix.comm() );
+    sol_true.rand( 1984 );
+
+    Vector rhs;
+    rhs.create( matrix.numLocalRows(), matrix.comm() );
+    matrix.apply( sol_true, rhs );
+
+    auto solve = [&]( integer const mixedPrecision )
+    {
+      params.mixedPrecision = mixedPrecision;
+
+      Vector sol_comp;
+      sol_comp.create( sol_true.localSize(), sol_true.comm() );
+      sol_comp.zero();
+
+      auto solver = LAI::createSolver( params );
+      solver->setup( matrix );
+      solver->solve( rhs, sol_comp );
+      EXPECT_TRUE( solver->result().success() );
+
+      // the outer iteration is in double precision, so the attainable accuracy is not affected
+      Vector sol_diff( sol_comp );
+      sol_diff.axpy( -1.0, sol_true );
+      EXPECT_LT( sol_diff.norm2() / sol_true.norm2(), cond_est * params.krylov.relTolerance );
+
+      return solver->result().numIterations;
+    };
+
+    integer const numIterDouble = solve( 0 );
+    integer const numIterSingle = solve( 1 );
+    GEOS_LOG_RANK_0( GEOS_FMT( "Iterations with the preconditioner in double / single precision: {} / {}",
+                               numIterDouble, numIterSingle ) );
+
+    // rounding the inverse diagonal to float32 is a relative perturbation of 1e-7 of the preconditioner,
+    // which must not change the convergence of the outer iteration by more than a few percent
+    EXPECT_LE( std::abs( numIterSingle - numIterDouble ), std::max( 2, numIterDouble / 20 ) );
+  }
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -186,12 +253,24 @@ TYPED_TEST_P( SolverTestLaplace2D, CG_AMG )
   this->test( params_CG_AMG() );
 }
 
+TYPED_TEST_P( SolverTestLaplace2D, CG_MixedPrecisionJacobi )
+{
+  this->testMixedPrecision( params_CG_Jacobi() );
+}
+
+TYPED_TEST_P( SolverTestLaplace2D, GMRES_MixedPrecisionJacobi )
+{
+  this->testMixedPrecision( params_GMRES_Jacobi() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( SolverTestLaplace2D,
                              DirectSerial,
                              DirectParallel,
                              GMRES_ILU,
                              CG_SGS,
-                             CG_AMG );
+                             CG_AMG,
+                             CG_MixedPrecisionJacobi,
+                             GMRES_MixedPrecisionJacobi );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, SolverTestLaplace2D, TrilinosInterface, );
@@ -246,10 +325,16 @@ TYPED_TEST_P( SolverTestElasticity2D, GMRES_AMG )
   this->test( params );
 }
 
+TYPED_TEST_P( SolverTestElasticity2D, CG_MixedPrecisionJacobi )
+{
+  this->testMixedPrecision( params_CG_Jacobi() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( SolverTestElasticity2D,
                              DirectSerial,
                              DirectParallel,
-                             GMRES_AMG );
+                             GMRES_AMG,
+                             CG_MixedPrecisionJacobi );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, SolverTestElasticity2D, TrilinosInterface, );
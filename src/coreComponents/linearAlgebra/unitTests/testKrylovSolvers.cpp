@@ -18,6 +18,7 @@
 
 #include "common/DataTypes.hpp"
 #include "linearAlgebra/solvers/PreconditionerIdentity.hpp"
+#include "linearAlgebra/solvers/PreconditionerJacobi.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
 #include "linearAlgebra/unitTests/testLinearAlgebraUtils.hpp"
 #include "linearAlgebra/utilities/BlockOperatorWrapper.hpp"
@@ -54,6 +55,46 @@ LinearSolverParameters params_GMRES()
   return parameters;
 }
 
+LinearSolverParameters params_PipeCG()
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 500;
+  parameters.solverType = geos::LinearSolverParameters::SolverType::pipecg;
+  parameters.isSymmetric = true;
+  return parameters;
+}
+
+LinearSolverParameters params_PipeGMRES()
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 500;
+  parameters.solverType = geos::LinearSolverParameters::SolverType::pipegmres;
+  return parameters;
+}
+
+LinearSolverParameters params_SStepGMRES()
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 500;
+  parameters.krylov.sStepSize = 4;
+  parameters.solverType = geos::LinearSolverParameters::SolverType::sstepgmres;
+  return parameters;
+}
+
+LinearSolverParameters params_GCRODR()
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 500;
+  parameters.krylov.maxRestart = 30;
+  parameters.krylov.recycleSize = 10;
+  parameters.solverType = geos::LinearSolverParameters::SolverType::gcrodr;
+  return parameters;
+}
+
 template< typename OPERATOR, typename PRECOND, typename VECTOR >
 class KrylovSolverTestBase : public ::testing::Test
 {
@@ -97,6 +138,31 @@ protected:
     real64 const relTol = cond_est * params.krylov.relTolerance;
     EXPECT_LT( sol_diff.norm2() / sol_true.norm2(), relTol );
   }
+
+  void testRecycling( LinearSolverParameters const & params )
+  {
+    sol_true.rand( 1984 );
+    matrix.apply( sol_true, rhs_true );
+
+    // Solve the same system twice with the same solver, the second solve reusing the recycled subspace
+    using Vector = typename OPERATOR::Vector;
+    std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::create( params, matrix, precond );
+
+    sol_comp.zero();
+    solver->solve( rhs_true, sol_comp );
+    EXPECT_TRUE( solver->result().success() );
+    integer const numIterFirst = solver->result().numIterations;
+
+    sol_comp.zero();
+    solver->solve( rhs_true, sol_comp );
+    EXPECT_TRUE( solver->result().success() );
+    EXPECT_LT( solver->result().numIterations, numIterFirst );
+
+    VECTOR sol_diff( sol_comp );
+    sol_diff.axpy( -1.0, sol_true );
+    real64 const relTol = cond_est * params.krylov.relTolerance;
+    EXPECT_LT( sol_diff.norm2() / sol_true.norm2(), relTol );
+  }
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////
@@ -153,10 +219,72 @@ TYPED_TEST_P( KrylovSolverTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverTest, GCRODR )
+{
+  this->test( params_GCRODR() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, PipeCG )
+{
+  this->test( params_PipeCG() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, PipeGMRES )
+{
+  this->test( params_PipeGMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, SStepGMRES )
+{
+  this->test( params_SStepGMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, GCRODR_Recycling )
+{
+  this->testRecycling( params_GCRODR() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, CG_MixedPrecisionJacobi )
+{
+  using Vector = typename TypeParam::ParallelVector;
+  LinearSolverParameters const params = params_CG();
+
+  this->sol_true.rand( 1984 );
+  this->matrix.apply( this->sol_true, this->rhs_true );
+
+  // Reference solve with the inverse diagonal stored in double precision
+  PreconditionerJacobi< TypeParam > precondDouble;
+  precondDouble.setup( this->matrix );
+  this->sol_comp.zero();
+  std::unique_ptr< KrylovSolver< Vector > > const solverDouble = KrylovSolver< Vector >::create( params, this->matrix, precondDouble );
+  solverDouble->solve( this->rhs_true, this->sol_comp );
+  EXPECT_TRUE( solverDouble->result().success() );
+
+  // Same solve with the inverse diagonal stored in single precision
+  PreconditionerJacobi< TypeParam > precondSingle( true );
+  precondSingle.setup( this->matrix );
+  this->sol_comp.zero();
+  std::unique_ptr< KrylovSolver< Vector > > const solverSingle = KrylovSolver< Vector >::create( params, this->matrix, precondSingle );
+  solverSingle->solve( this->rhs_true, this->sol_comp );
+  EXPECT_TRUE( solverSingle->result().success() );
+
+  // The outer iteration is in double precision, so the attainable accuracy is not affected
+  EXPECT_LE( std::abs( solverSingle->result().numIterations - solverDouble->result().numIterations ), 1 );
+  Vector sol_diff( this->sol_comp );
+  sol_diff.axpy( -1.0, this->sol_true );
+  EXPECT_LT( sol_diff.norm2() / this->sol_true.norm2(), this->cond_est * params.krylov.relTolerance );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             GCRODR,
+                             GCRODR_Recycling,
+                             PipeCG,
+                             PipeGMRES,
+                             SStepGMRES,
+                             CG_MixedPrecisionJacobi );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverTest, TrilinosInterface, );
@@ -243,10 +371,34 @@ TYPED_TEST_P( KrylovSolverBlockTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverBlockTest, GCRODR )
+{
+  this->test( params_GCRODR() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, PipeCG )
+{
+  this->test( params_PipeCG() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, PipeGMRES )
+{
+  this->test( params_PipeGMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, SStepGMRES )
+{
+  this->test( params_SStepGMRES() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverBlockTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             GCRODR,
+                             PipeCG,
+                             PipeGMRES,
+                             SStepGMRES );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverBlockTest, TrilinosInterface, );
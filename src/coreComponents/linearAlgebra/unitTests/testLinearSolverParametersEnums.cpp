@@ -34,6 +34,10 @@ TEST( LinearSolverParametersEnums, SolverType )
   ASSERT_EQ( "fgmres", toString( EnumType::fgmres ) );
   ASSERT_EQ( "bicgstab", toString( EnumType::bicgstab ) );
   ASSERT_EQ( "preconditioner", toString( EnumType::preconditioner ) );
+  ASSERT_EQ( "gcrodr", toString( EnumType::gcrodr ) );
+  ASSERT_EQ( "pipecg", toString( EnumType::pipecg ) );
+  ASSERT_EQ( "pipegmres", toString( EnumType::pipegmres ) );
+  ASSERT_EQ( "sstepgmres", toString( EnumType::sstepgmres ) );
 }
 
 
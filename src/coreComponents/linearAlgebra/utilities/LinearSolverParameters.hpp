@@ -37,12 +37,16 @@ struct LinearSolverParameters
    */
   enum class SolverType : integer
   {
-    direct,        ///< Direct solver
-    cg,            ///< CG
-    gmres,         ///< GMRES
-    fgmres,        ///< Flexible GMRES
-    bicgstab,      ///< BiCGStab
-    preconditioner ///< Preconditioner only
+    direct,         ///< Direct solver
+    cg,             ///< CG
+    gmres,          ///< GMRES
+    fgmres,         ///< Flexible GMRES
+    bicgstab,       ///< BiCGStab
+    preconditioner, ///< Preconditioner only
+    gcrodr,         ///< GCRO-DR (GMRES with Krylov subspace recycling)
+    pipecg,         ///< Pipelined CG
+    pipegmres,      ///< Pipelined GMRES
+    sstepgmres      ///< s-step (communication-avoiding) GMRES
   };
 
   /**
@@ -68,10 +72,11 @@ struct LinearSolverParameters
     bgs,       ///< Gauss-Seidel smoothing (backward sweep)
   };
 
-  integer logLevel = 0;     ///< Output level [0=none, 1=basic, 2=everything]
-  integer dofsPerNode = 1;  ///< Dofs per node (or support location) for non-scalar problems
-  bool isSymmetric = false; ///< Whether input matrix is symmetric (may affect choice of scheme)
-  integer stopIfError = 1;  ///< Whether to stop the simulation if the linear solver reports an error
+  integer logLevel = 0;       ///< Output level [0=none, 1=basic, 2=everything]
+  integer dofsPerNode = 1;    ///< Dofs per node (or support location) for non-scalar problems
+  bool isSymmetric = false;   ///< Whether input matrix is symmetric (may affect choice of scheme)
+  integer stopIfError = 1;    ///< Whether to stop the simulation if the linear solver reports an error
+  integer mixedPrecision = 0; ///< Whether to store and apply the preconditioner in single precision (native Jacobi preconditioner only)
 
   SolverType solverType = SolverType::direct;          ///< Solver type
   PreconditionerType preconditionerType = PreconditionerType::iluk;  ///< Preconditioner type
@@ -119,6 +124,8 @@ struct LinearSolverParameters
     integer maxRestart = 200;         ///< Max number of vectors in Krylov basis before restarting
     integer useAdaptiveTol = false;   ///< Use Eisenstat-Walker adaptive tolerance
     real64 weakestTol = 1e-3;         ///< Weakest allowed tolerance when using adaptive method
+    integer recycleSize = 10;         ///< Number of approximate eigenvectors kept between solves (GCRO-DR only)
+    integer sStepSize = 4;            ///< Number of basis vectors generated per block (s-step GMRES only)
   }
   krylov;                             ///< Krylov-method parameter struct
 
@@ -316,7 +323,11 @@ ENUM_STRINGS( LinearSolverParameters::SolverType,
               "gmres",
               "fgmres",
               "bicgstab",
-              "preconditioner" );
+              "preconditioner",
+              "gcrodr",
+              "pipecg",
+              "pipegmres",
+              "sstepgmres" );
 
 /// Declare strings associated with enumeration values.
 ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
@@ -386,9 +386,9 @@ void ProblemManager::parseInputFile()
   Group & commandLine = getGroup( groupKeys.commandLine );
   string const & inputFileName = commandLine.getReference< string >( viewKeys.inputFileName );
 
-  // Load preprocessed xml file
+  // Load preprocessed xml file, read once and broadcast to avoid all ranks accessing the input files
   xmlWrapper::xmlDocument xmlDocument;
-  xmlWrapper::xmlResult const xmlResult = xmlDocument.loadFile( inputFileName, true );
+  xmlWrapper::xmlResult const xmlResult = xmlDocument.loadFileAndBroadcast( inputFileName, true );
   GEOS_THROW_IF( !xmlResult, GEOS_FMT( "Errors found while parsing XML file {}\nDescription: {}\nOffset: {}",
                                        inputFileName, xmlResult.description(), xmlResult.offset ), InputError );
 
@@ -653,6 +653,32 @@ void ProblemManager::generateMesh()
     }
   }
 
+  // Each mesh body only gets the minimal ghost layer satisfying all the solvers acting on it
+  map< string, GhostingRequirement > ghostingRequirements;
+  m_physicsSolverManager->forSubGroups< SolverBase >( [&]( SolverBase const & solver )
+  {
+    GhostingRequirement const solverGhosting = solver.getGhostingRequirement();
+    for( auto const & target : solver.getMeshTargets() )
+    {
+      string const & meshBodyName = target.first.first;
+      auto const it = ghostingRequirements.find( meshBodyName );
+      if( it == ghostingRequirements.end() )
+      {
+        ghostingRequirements.insert( { meshBodyName, solverGhosting } );
+      }
+      else
+      {
+        it->second.merge( solverGhosting );
+      }
+    }
+  } );
+  for( auto const & [meshBodyName, ghosting] : ghostingRequirements )
+  {
+    GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "Mesh body '{}': {} layer(s) of {}-neighbor ghost cells",
+                                        meshBodyName, ghosting.depth, ghosting.faceNeighborsOnly ? "face" : "node" ) );
+    domain.getMeshBody( meshBodyName ).setGhostingRequirement( ghosting );
+  }
+
   domain.setupCommunications( useNonblockingMPI );
 
   domain.forMeshBodies( [&]( MeshBody & meshBody )
@@ -0,0 +1,115 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file ElementSpatialIndex.cpp
+ */
+
+#include "ElementSpatialIndex.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "mesh/ElementRegionManager.hpp"
+#include "mesh/NodeManager.hpp"
+
+namespace geos
+{
+
+void ElementSpatialIndex::build( NodeManager const & nodeManager,
+                                 ElementRegionManager const & elemManager )
+{
+  GEOS_MARK_FUNCTION;
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+
+  localIndex numElements = 0;
+  elemManager.forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    numElements += subRegion.size();
+  } );
+
+  m_elementRegion.resize( numElements );
+  m_elementSubRegion.resize( numElements );
+  m_elementIndex.resize( numElements );
+  array2d< real64 > boxMin( numElements, 3 );
+  array2d< real64 > boxMax( numElements, 3 );
+
+  localIndex offset = 0;
+  elemManager.forElementSubRegionsComplete< CellElementSubRegion >( [&]( localIndex const er,
+                                                                         localIndex const esr,
+                                                                         ElementRegionBase const &,
+                                                                         CellElementSubRegion const & subRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = subRegion.nodeList().toViewConst();
+    arrayView1d< localIndex > const elementRegion = m_elementRegion.toView();
+    arrayView1d< localIndex > const elementSubRegion = m_elementSubRegion.toView();
+    arrayView1d< localIndex > const elementIndex = m_elementIndex.toView();
+    arrayView2d< real64 > const lo = boxMin.toView();
+    arrayView2d< real64 > const hi = boxMax.toView();
+    localIndex const subRegionOffset = offset;
+
+    forAll< parallelHostPolicy >( subRegion.size(), [=]( localIndex const ei )
+    {
+      localIndex const item = subRegionOffset + ei;
+      elementRegion[item] = er;
+      elementSubRegion[item] = esr;
+      elementIndex[item] = ei;
+      for( integer d = 0; d < 3; ++d )
+      {
+        lo[item][d] = LvArray::NumericLimits< real64 >::max;
+        hi[item][d] = LvArray::NumericLimits< real64 >::lowest;
+      }
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        localIndex const node = elemsToNodes( ei, a );
+        for( integer d = 0; d < 3; ++d )
+        {
+          lo[item][d] = LvArray::math::min( lo[item][d], X( node, d ) );
+          hi[item][d] = LvArray::math::max( hi[item][d], X( node, d ) );
+        }
+      }
+    } );
+    offset += subRegion.size();
+  } );
+
+  m_boundingVolumeHierarchy.build( boxMin.toViewConst(), boxMax.toViewConst() );
+}
+
+void ElementSpatialIndex::clear()
+{
+  m_boundingVolumeHierarchy.clear();
+  m_elementRegion.clear();
+  m_elementSubRegion.clear();
+  m_elementIndex.clear();
+}
+
+void ElementSpatialIndex::findElementsContainingPoints( localIndex const er,
+                                                        localIndex const esr,
+                                                        arrayView2d< real64 const > const & points,
+                                                        SortedArray< localIndex > & elements ) const
+{
+  for( localIndex ip = 0; ip < points.size( 0 ); ++ip )
+  {
+    real64 const point[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( points[ip] );
+    m_boundingVolumeHierarchy.forBoxesContainingPoint( point, [&]( localIndex const item )
+    {
+      if( m_elementRegion[item] == er && m_elementSubRegion[item] == esr )
+      {
+        elements.insert( m_elementIndex[item] );
+      }
+    } );
+  }
+}
+
+} // namespace geos
@@ -0,0 +1,173 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file ElementSpatialIndex.hpp
+ */
+
+#ifndef GEOS_MESH_ELEMENTSPATIALINDEX_HPP_
+#define GEOS_MESH_ELEMENTSPATIALINDEX_HPP_
+
+#include "mesh/utilities/BoundingVolumeHierarchy.hpp"
+
+#include <algorithm>
+
+namespace geos
+{
+
+class NodeManager;
+class ElementRegionManager;
+
+/**
+ * @class ElementSpatialIndex
+ * @brief Spatial index over the bounding boxes of the cell elements of a mesh level.
+ *
+ * The bounding boxes are computed from the reference position of the element nodes,
+ * and stored in a BoundingVolumeHierarchy. The queries return the candidate elements
+ * whose bounding box contains a point, overlaps a box or is cut by a plane, and are meant
+ * to replace the loops over all the elements of the mesh performed by geometric searches.
+ * Since bounding boxes are conservative, the callers still have to apply their exact test
+ * to the candidates.
+ *
+ * The candidates are visited in the order of ElementRegionManager::forElementSubRegionsComplete,
+ * and in increasing element index within a subregion, so that results do not depend on the
+ * structure of the tree. Ghost elements are included in the index.
+ */
+class ElementSpatialIndex
+{
+public:
+
+  /**
+   * @brief Build the index over the cell elements.
+   * @param[in] nodeManager the node manager providing the node reference positions
+   * @param[in] elemManager the element region manager
+   */
+  void build( NodeManager const & nodeManager,
+              ElementRegionManager const & elemManager );
+
+  /**
+   * @brief Release the storage of the index.
+   */
+  void clear();
+
+  /**
+   * @return the number of elements stored in the index
+   */
+  localIndex size() const
+  { return m_elementIndex.size(); }
+
+  /**
+   * @brief Visit the elements whose bounding box contains a point.
+   * @tparam LAMBDA type of the function called on each element
+   * @param[in] point the coordinates of the point
+   * @param[in] lambda function called with the region, subregion and element indices
+   */
+  template< typename LAMBDA >
+  void forElementsContainingPoint( real64 const ( &point )[3], LAMBDA && lambda ) const
+  {
+    array1d< localIndex > candidates;
+    m_boundingVolumeHierarchy.forBoxesContainingPoint( point, [&]( localIndex const item )
+    {
+      candidates.emplace_back( item );
+    } );
+    forCandidates( candidates, std::forward< LAMBDA >( lambda ) );
+  }
+
+  /**
+   * @brief Visit the elements whose bounding box overlaps a given box.
+   * @tparam LAMBDA type of the function called on each element
+   * @param[in] queryMin lower corner of the query box
+   * @param[in] queryMax upper corner of the query box
+   * @param[in] lambda function called with the region, subregion and element indices
+   */
+  template< typename LAMBDA >
+  void forElementsOverlappingBox( real64 const ( &queryMin )[3],
+                                  real64 const ( &queryMax )[3],
+                                  LAMBDA && lambda ) const
+  {
+    array1d< localIndex > candidates;
+    m_boundingVolumeHierarchy.forBoxesOverlappingBox( queryMin, queryMax, [&]( localIndex const item )
+    {
+      candidates.emplace_back( item );
+    } );
+    forCandidates( candidates, std::forward< LAMBDA >( lambda ) );
+  }
+
+  /**
+   * @brief Visit the elements whose bounding box is cut by a plane.
+   * @tparam LAMBDA type of the function called on each element
+   * @param[in] planeCenter a point of the plane
+   * @param[in] planeNormal the normal vector of the plane
+   * @param[in] lambda function called with the region, subregion and element indices
+   */
+  template< typename LAMBDA >
+  void forElementsIntersectingPlane( real64 const ( &planeCenter )[3],
+                                     real64 const ( &planeNormal )[3],
+                                     LAMBDA && lambda ) const
+  {
+    array1d< localIndex > candidates;
+    m_boundingVolumeHierarchy.forBoxesIntersectingPlane( planeCenter, planeNormal, [&]( localIndex const item )
+    {
+      candidates.emplace_back( item );
+    } );
+    forCandidates( candidates, std::forward< LAMBDA >( lambda ) );
+  }
+
+  /**
+   * @brief Collect the elements of a subregion whose bounding box contains at least one of a set of points.
+   * @param[in] er index of the region
+   * @param[in] esr index of the subregion
+   * @param[in] points the coordinates of the points
+   * @param[inout] elements the set to which the indices of the elements are added
+   */
+  void findElementsContainingPoints( localIndex const er,
+                                     localIndex const esr,
+                                     arrayView2d< real64 const > const & points,
+                                     SortedArray< localIndex > & elements ) const;
+
+private:
+
+  /**
+   * @brief Visit a list of candidate elements in a deterministic order.
+   * @tparam LAMBDA type of the function called on each element
+   * @param[inout] candidates the indices of the candidates in the index (sorted on output)
+   * @param[in] lambda function called with the region, subregion and element indices
+   */
+  template< typename LAMBDA >
+  void forCandidates( array1d< localIndex > & candidates, LAMBDA && lambda ) const
+  {
+    std::sort( candidates.begin(), candidates.end() );
+    for( localIndex const item : candidates )
+    {
+      lambda( m_elementRegion[item], m_elementSubRegion[item], m_elementIndex[item] );
+    }
+  }
+
+  /// Hierarchy of the element bounding boxes
+  BoundingVolumeHierarchy m_boundingVolumeHierarchy;
+
+  /// Region index of the elements stored in the index
+  array1d< localIndex > m_elementRegion;
+
+  /// Subregion index of the elements stored in the index
+  array1d< localIndex > m_elementSubRegion;
+
+  /// Index of the elements stored in the index, within their subregion
+  array1d< localIndex > m_elementIndex;
+};
+
+} // namespace geos
+
+#endif //GEOS_MESH_ELEMENTSPATIALINDEX_HPP_
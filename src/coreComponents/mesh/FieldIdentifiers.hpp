@@ -22,6 +22,8 @@
 #include "common/DataTypes.hpp"
 #include "codingUtilities/StringUtilities.hpp"
 
+#include <algorithm>
+
 namespace geos
 {
 /**
@@ -71,6 +73,26 @@ public:
     }
   }
 
+/**
+ * @brief adds all the fields of another FieldIdentifiers, skipping the ones already present.
+ *
+ * @param fieldsToBeAdded the fields to be added to the map.
+ */
+  void addFields( FieldIdentifiers const & fieldsToBeAdded )
+  {
+    for( auto const & iter : fieldsToBeAdded.getFields() )
+    {
+      array1d< string > & fields = m_fields[iter.first];
+      for( string const & field : iter.second )
+      {
+        if( std::find( fields.begin(), fields.end(), field ) == fields.end() )
+        {
+          fields.emplace_back( field );
+        }
+      }
+    }
+  }
+
 /**
  * @brief Get the Fields object which is the map containing the fields existing for each location.
  *
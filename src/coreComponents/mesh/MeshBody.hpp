@@ -181,6 +181,24 @@ public:
    */
   void setHasParticles( bool hasParticles );
 
+  /**
+   * @brief Get the ghost layer required by the discretizations acting on this mesh body
+   * @return the ghosting requirement
+   */
+  GhostingRequirement const & getGhostingRequirement() const
+  {
+    return m_ghostingRequirement;
+  }
+
+  /**
+   * @brief Set the ghost layer required by the discretizations acting on this mesh body
+   * @param ghostingRequirement the minimal ghosting satisfying all the discretizations
+   */
+  void setGhostingRequirement( GhostingRequirement const & ghostingRequirement )
+  {
+    m_ghostingRequirement = ghostingRequirement;
+  }
+
   /**
    * @brief Get the Abstract representation of the CellBlockManager attached to the MeshBody.
    * @return The CellBlockManager.
@@ -228,6 +246,9 @@ private:
   /// flag for whether MeshBody has particles
   bool m_hasParticles;
 
+  /// Ghost layer built on the mesh levels of this body
+  GhostingRequirement m_ghostingRequirement;
+
   static string intToMeshLevelString( localIndex const meshLevel );
 
 };
@@ -288,7 +288,8 @@ void MeshLevel::generateAdjacencyLists( arrayView1d< localIndex const > const &
                                         localIndex_array & edgeAdjacencyList,
                                         localIndex_array & faceAdjacencyList,
                                         ElementRegionManager::ElementViewAccessor< ReferenceWrapper< localIndex_array > > & elementAdjacencyList,
-                                        integer const depth )
+                                        integer const depth,
+                                        bool const faceNeighborsOnly )
 {
   NodeManager const & nodeManager = getNodeManager();
 
@@ -298,6 +299,7 @@ void MeshLevel::generateAdjacencyLists( arrayView1d< localIndex const > const &
 
   FaceManager const & faceManager = this->getFaceManager();
   ArrayOfArraysView< localIndex const > const & faceToEdges = faceManager.edgeList().toViewConst();
+  ArrayOfArraysView< localIndex const > const & faceToNodes = faceManager.nodeList().toViewConst();
 
   ElementRegionManager const & elemManager = this->getElemManager();
 
@@ -406,6 +408,37 @@ void MeshLevel::generateAdjacencyLists( arrayView1d< localIndex const > const &
     elementAdjacencySet[a].resize( elemManager.getRegion( a ).numSubRegions() );
   }
 
+  // The cells are only filtered by face adjacency when there are no surface elements,
+  // since the surface to cell connections need all the cells touching the surface elements.
+  bool hasSurfaceElements = false;
+  elemManager.forElementSubRegions< SurfaceElementSubRegion >( [&]( SurfaceElementSubRegion const & )
+  {
+    hasSurfaceElements = true;
+  } );
+  bool const filterByFaces = faceNeighborsOnly && !hasSurfaceElements;
+
+  // Tells if one of the faces of the cell is entirely made of already collected nodes.
+  auto const sharesFaceWithAdjacentNodes = [&]( localIndex const er,
+                                                localIndex const esr,
+                                                localIndex const ei )
+  {
+    CellElementSubRegion const * const subRegion =
+      dynamicCast< CellElementSubRegion const * >( &elemManager.getRegion( er ).getSubRegion( esr ) );
+    if( subRegion == nullptr )
+    {
+      return true;
+    }
+    for( localIndex const fi: subRegion->faceList()[ei] )
+    {
+      arraySlice1d< localIndex const > const faceNodes = faceToNodes[fi];
+      if( std::all_of( faceNodes.begin(), faceNodes.end(), [&]( localIndex const ni ) { return nodeAdjacencySet.count( ni ) > 0; } ) )
+      {
+        return true;
+      }
+    }
+    return false;
+  };
+
   nodeAdjacencySet.insert( seedNodeList.begin(), seedNodeList.end() );
 
   for( integer d = 0; d < depth; ++d )
@@ -417,7 +450,10 @@ void MeshLevel::generateAdjacencyLists( arrayView1d< localIndex const > const &
         localIndex const er = nodeToElementRegionList[nodeIndex][b];
         localIndex const esr = nodeToElementSubRegionList[nodeIndex][b];
         localIndex const ei = nodeToElementList[nodeIndex][b];
-        elementAdjacencySet[er][esr].insert( ei );
+        if( !filterByFaces || sharesFaceWithAdjacentNodes( er, esr, ei ) )
+        {
+          elementAdjacencySet[er][esr].insert( ei );
+        }
       }
     }
 
@@ -557,5 +593,25 @@ bool MeshLevel::isShallowCopyOf( MeshLevel const & comparisonLevel ) const
          isShallowCopy();
 }
 
+ElementSpatialIndex const & MeshLevel::getElementSpatialIndex() const
+{
+  localIndex numElements = 0;
+  m_elementManager->forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    numElements += subRegion.size();
+  } );
+
+  if( !m_elementSpatialIndexIsValid ||
+      m_elementSpatialIndexTimestamp != m_modificationTimestamp ||
+      m_elementSpatialIndexNumNodes != m_nodeManager->size() ||
+      m_elementSpatialIndex.size() != numElements )
+  {
+    m_elementSpatialIndex.build( *m_nodeManager, *m_elementManager );
+    m_elementSpatialIndexIsValid = true;
+    m_elementSpatialIndexTimestamp = m_modificationTimestamp;
+    m_elementSpatialIndexNumNodes = m_nodeManager->size();
+  }
+  return m_elementSpatialIndex;
+}
 
 } /* namespace geos */
@@ -24,11 +24,37 @@
 #include "EmbeddedSurfaceNodeManager.hpp"
 #include "EdgeManager.hpp"
 #include "ElementRegionManager.hpp"
+#include "ElementSpatialIndex.hpp"
 #include "FaceManager.hpp"
 
 namespace geos
 {
 class ElementRegionManager;
+struct SyncPlan;
+
+/**
+ * @struct GhostingRequirement
+ * @brief Describes the ghost layer that a discretization needs on a mesh level.
+ */
+struct GhostingRequirement
+{
+  /// Number of layers of ghost elements (first-order neighbors, neighbors of neighbors, etc)
+  integer depth = 1;
+
+  /// If true, a layer only contains the cells sharing a face with the previous one (enough for two-point stencils),
+  /// otherwise it contains all the cells sharing a node with it.
+  bool faceNeighborsOnly = false;
+
+  /**
+   * @brief Extend this requirement so that it also satisfies another one.
+   * @param[in] other the requirement to merge into this one
+   */
+  void merge( GhostingRequirement const & other )
+  {
+    depth = std::max( depth, other.depth );
+    faceNeighborsOnly = faceNeighborsOnly && other.faceNeighborsOnly;
+  }
+};
 
 /**
  * @class MeshLevel
@@ -89,6 +115,8 @@ public:
    * @param[out] faceAdjacencyList the faces adjacent to the input nodes of seedNodeList
    * @param[out] elementAdjacencyList the elements adjacent to the input nodes of seedNodeList
    * @param[in] depth the depth of the search for adjacent quantities (first-order neighbors, neighbors of neighbors, etc)
+   * @param[in] faceNeighborsOnly if true, only the cells having a full face made of already collected nodes are collected
+   *            at each level of the search (instead of all the cells touching these nodes)
    * @details All the additional information (nodes, edges, faces) connected to
    * the edges, faces, elements that touch the @p seedNodeList is also collected.
    * For instance, all the nodes, edges and faces that touch an element that relies on a node of the @p seedNodeList, will be considered.
@@ -100,7 +128,8 @@ public:
                                localIndex_array & edgeAdjacencyList,
                                localIndex_array & faceAdjacencyList,
                                ElementRegionManager::ElementViewAccessor< ReferenceWrapper< localIndex_array > > & elementAdjacencyList,
-                               integer const depth );
+                               integer const depth,
+                               bool const faceNeighborsOnly = false );
 
 
   virtual void initializePostInitialConditionsPostSubGroups() override;
@@ -251,6 +280,29 @@ public:
   void modified()
   { m_modificationTimestamp++; }
 
+  /**
+   * @brief Get the spatial index over the cell elements of the mesh level.
+   * @return the spatial index, rebuilt if the mesh has been modified since the last call
+   * @details The index is built on first use from the reference position of the nodes, and
+   *          rebuilt whenever the modification timestamp or the number of nodes or elements changes.
+   *          Code moving the reference position of the nodes must call invalidateElementSpatialIndex().
+   */
+  ElementSpatialIndex const & getElementSpatialIndex() const;
+
+  /**
+   * @brief Force the rebuild of the element spatial index on its next use.
+   */
+  void invalidateElementSpatialIndex()
+  { m_elementSpatialIndexIsValid = false; }
+
+  /**
+   * @brief Get the cache of the synchronization plans of the mesh level.
+   * @return the plans, keyed on the fields they synchronize
+   * @details The plans are validated against the state of the mesh by CommunicationTools before reuse.
+   */
+  std::map< string, std::shared_ptr< SyncPlan const > > & getSyncPlanCache() const
+  { return m_syncPlanCache; }
+
   /**
    * @return value of m_isShallowCopy.
    */
@@ -302,6 +354,21 @@ private:
   /// Timestamp of the last modification of the mesh level
   Timestamp m_modificationTimestamp;
 
+  /// Spatial index over the cell elements, built lazily
+  mutable ElementSpatialIndex m_elementSpatialIndex;
+
+  /// Flag indicating whether the element spatial index has been built
+  mutable bool m_elementSpatialIndexIsValid = false;
+
+  /// Modification timestamp of the mesh level when the element spatial index was built
+  mutable Timestamp m_elementSpatialIndexTimestamp = 0;
+
+  /// Number of nodes of the mesh level when the element spatial index was built
+  mutable localIndex m_elementSpatialIndexNumNodes = 0;
+
+  /// Synchronization plans resolved on this mesh level, keyed on the fields they synchronize
+  mutable std::map< string, std::shared_ptr< SyncPlan const > > m_syncPlanCache;
+
   bool const m_isShallowCopy = false;
 
   MeshLevel * const m_shallowParent;
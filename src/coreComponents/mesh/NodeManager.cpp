@@ -24,6 +24,7 @@
 #include "mesh/ElementRegionManager.hpp"
 #include "mesh/FaceManager.hpp"
 #include "mesh/ToElementRelation.hpp"
+#include "mesh/utilities/BoundingVolumeHierarchy.hpp"
 #include "mesh/utilities/MeshMapUtilities.hpp"
 
 namespace geos
@@ -92,21 +93,48 @@ void NodeManager::buildSets( CellBlockManagerABC const & cellBlockManager,
 
 void NodeManager::buildGeometricSets( GeometricObjectManager const & geometries )
 {
+  GEOS_MARK_FUNCTION;
+
   arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = this->referencePosition();
   localIndex const numNodes = this->size();
 
+  // The nodes are stored as degenerate boxes in a bounding volume hierarchy,
+  // so that the subtrees that cannot intersect an object are skipped.
+  array2d< real64 > nodeCoords( numNodes, 3 );
+  arrayView2d< real64 > const nodeCoordsView = nodeCoords.toView();
+  forAll< parallelHostPolicy >( numNodes, [=]( localIndex const a )
+  {
+    for( integer i = 0; i < 3; ++i )
+    {
+      nodeCoordsView[a][i] = X[a][i];
+    }
+  } );
+  BoundingVolumeHierarchy nodeHierarchy;
+  nodeHierarchy.build( nodeCoords.toViewConst(), nodeCoords.toViewConst() );
+
   geometries.forSubGroups< SimpleGeometricObjectBase >( [&]( SimpleGeometricObjectBase const & object )
   {
     string const & name = object.getName();
     SortedArray< localIndex > & targetSet = m_sets.registerWrapper< SortedArray< localIndex > >( name ).reference();
-    for( localIndex a = 0; a < numNodes; ++a )
+
+    array1d< localIndex > nodesInObject;
+    nodeHierarchy.forBoxes( [&]( arraySlice1d< real64 const > const & boxMin,
+                                 arraySlice1d< real64 const > const & boxMax )
+    {
+      real64 const lo[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( boxMin );
+      real64 const hi[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( boxMax );
+      return object.mayIntersectBox( lo, hi );
+    }, [&]( localIndex const a )
     {
       real64 nodeCoord[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( X[a] );
       if( object.isCoordInObject( nodeCoord ) )
       {
-        targetSet.insert( a );
+        nodesInObject.emplace_back( a );
       }
-    }
+    } );
+
+    std::sort( nodesInObject.begin(), nodesInObject.end() );
+    targetSet.insert( nodesInObject.begin(), nodesInObject.end() );
   } );
 }
 
@@ -119,6 +119,13 @@ public:
    */
   void excludeWrappersFromPacking( std::set< string > const & wrapperNames );
 
+  /**
+   * @brief Get the wrappers that are excluded from packing.
+   * @return The names of the excluded wrappers.
+   */
+  std::set< string > const & getPackingExclusionList() const
+  { return m_packingExclusionList; }
+
   /**
    * @brief Computes the pack size of the global maps elements in the @ packList.
    * @param packList The element we want packed.
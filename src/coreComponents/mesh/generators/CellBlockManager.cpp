@@ -14,6 +14,8 @@
 
 #include "CellBlockManager.hpp"
 
+#include "common/Stopwatch.hpp"
+#include "common/TimingMacros.hpp"
 #include "mesh/generators/CellBlockUtilities.hpp"
 #include "mesh/generators/LineBlock.hpp"
 #include "mesh/utilities/MeshMapUtilities.hpp"
@@ -398,71 +400,74 @@ void resizeFaceMaps( FaceBuilder const & faceBuilder,
  */
 FaceBuilder createLowestNodeToFaces( localIndex const numNodes, const Group & cellBlocks )
 {
-  array1d< localIndex > faceCounts( numNodes );
   localIndex totalDuplicateFaces = 0;
   localIndex totalDuplicateFaceNodes = 0;
   for( localIndex blockIndex = 0; blockIndex < cellBlocks.numSubGroups(); ++blockIndex )
+  {
+    CellBlock const & cb = cellBlocks.getGroup< CellBlock >( blockIndex );
+    totalDuplicateFaces += cb.numFacesPerElement() * cb.numElements();
+    totalDuplicateFaceNodes += cb.numElements() * cb.maxNodesPerFace() * cb.numFacesPerElement();
+  }
+
+  FaceBuilder faceBuilder;
+  faceBuilder.duplicateFaces.reserve( totalDuplicateFaces );
+  faceBuilder.duplicateFaces.reserveValues( totalDuplicateFaceNodes );
+
+  // First pass: extract the sorted nodes of every face of every cell (only once, since this is the costly part),
+  // and count the faces attached to each lowest node in the same sweep.
+  array1d< localIndex > faceCounts( numNodes );
+  array1d< localIndex > blockFaceOffsets( cellBlocks.numSubGroups() + 1 );
+  for( localIndex blockIndex = 0; blockIndex < cellBlocks.numSubGroups(); ++blockIndex )
   {
     CellBlock const & cb = cellBlocks.getGroup< CellBlock >( blockIndex );
     localIndex const numFacesPerElement = cb.numFacesPerElement();
     localIndex const numElements = cb.numElements();
 
-    forAll< parallelHostPolicy >( numElements, [&cb, numFacesPerElement,
-                                                counts = faceCounts.toView()]( localIndex const elemID )
+    localIndex const prevFaceOffset = faceBuilder.duplicateFaces.size();
+    blockFaceOffsets[ blockIndex ] = prevFaceOffset;
+    faceBuilder.duplicateFaces.resize( prevFaceOffset + numFacesPerElement * numElements, cb.maxNodesPerFace() );
+
+    forAll< parallelHostPolicy >( numElements, [&cb, numFacesPerElement, prevFaceOffset,
+                                                counts = faceCounts.toView(),
+                                                duplicateFaces = faceBuilder.duplicateFaces.toView()]( localIndex const elemID )
     {
       localIndex nodesInFace[ CellBlockManager::maxNodesPerFace() ];
       for( localIndex faceNum = 0; faceNum < numFacesPerElement; ++faceNum )
       {
+        localIndex const duplicateFaceIndex = prevFaceOffset + elemID * numFacesPerElement + faceNum;
+
         // Get all the nodes of the face
         localIndex const numNodesInFace = cb.getFaceNodes( elemID, faceNum, nodesInFace );
-        localIndex const lowestNode = *std::min_element( nodesInFace, nodesInFace + numNodesInFace );
-        RAJA::atomicInc< parallelHostAtomic >( &counts[ lowestNode ] );
+        std::sort( nodesInFace, nodesInFace + numNodesInFace );
+
+        duplicateFaces.appendToArray( duplicateFaceIndex, nodesInFace, nodesInFace + numNodesInFace );
+        RAJA::atomicInc< parallelHostAtomic >( &counts[ nodesInFace[ 0 ] ] );
       }
     } );
-
-    totalDuplicateFaces += numFacesPerElement * numElements;
-    totalDuplicateFaceNodes += numElements * cb.maxNodesPerFace() * cb.numFacesPerElement();
   }
+  blockFaceOffsets[ cellBlocks.numSubGroups() ] = faceBuilder.duplicateFaces.size();
 
-  FaceBuilder faceBuilder;
   faceBuilder.lowestNodeToFaces.resizeFromCapacities< parallelHostPolicy >( numNodes, faceCounts.data() );
 
-  faceBuilder.duplicateFaces.reserve( totalDuplicateFaces );
-  faceBuilder.duplicateFaces.reserveValues( totalDuplicateFaceNodes );
-
+  // Second pass: bucket the faces by their lowest node, reusing the node lists extracted above.
+  for( localIndex blockIndex = 0; blockIndex < cellBlocks.numSubGroups(); ++blockIndex )
   {
+    CellBlock const & cb = cellBlocks.getGroup< CellBlock >( blockIndex );
+    localIndex const numFacesPerElement = cb.numFacesPerElement();
+    localIndex const prevFaceOffset = blockFaceOffsets[ blockIndex ];
 
-    for( localIndex blockIndex = 0; blockIndex < cellBlocks.numSubGroups(); ++blockIndex )
+    forAll< parallelHostPolicy >( blockFaceOffsets[ blockIndex + 1 ] - prevFaceOffset,
+                                  [numFacesPerElement, blockIndex, prevFaceOffset,
+                                   lowestNodeToFaces = faceBuilder.lowestNodeToFaces.toView(),
+                                   duplicateFaces = faceBuilder.duplicateFaces.toViewConst()]( localIndex const i )
     {
-      CellBlock const & cb = cellBlocks.getGroup< CellBlock >( blockIndex );
-      localIndex const numFacesPerElement = cb.numFacesPerElement();
-      localIndex const numElements = cb.numElements();
-
-      localIndex const prevFaceOffset = faceBuilder.duplicateFaces.size();
-      faceBuilder.duplicateFaces.resize( faceBuilder.duplicateFaces.size() + numFacesPerElement * numElements, cb.maxNodesPerFace() );
-
-      forAll< parallelHostPolicy >( numElements, [&cb, numFacesPerElement, blockIndex, prevFaceOffset,
-                                                  lowestNodeToFaces = faceBuilder.lowestNodeToFaces.toView(),
-                                                  duplicateFaces = faceBuilder.duplicateFaces.toView()]( localIndex const elemID )
-      {
-        localIndex nodesInFace[ CellBlockManager::maxNodesPerFace() ];
-        for( localIndex faceNum = 0; faceNum < numFacesPerElement; ++faceNum )
-        {
-          localIndex const duplicateFaceIndex = prevFaceOffset + elemID * numFacesPerElement + faceNum;
-
-          localIndex const numNodesInFace = cb.getFaceNodes( elemID, faceNum, nodesInFace );
-          std::sort( nodesInFace, nodesInFace + numNodesInFace );
-
-          duplicateFaces.appendToArray( duplicateFaceIndex, nodesInFace, nodesInFace + numNodesInFace );
-
-          lowestNodeToFaces.emplaceBackAtomic< parallelHostAtomic >( nodesInFace[ 0 ],
-                                                                     duplicateFaceIndex,
-                                                                     elemID,
-                                                                     blockIndex,
-                                                                     faceNum );
-        }
-      } );
-    }
+      localIndex const duplicateFaceIndex = prevFaceOffset + i;
+      lowestNodeToFaces.emplaceBackAtomic< parallelHostAtomic >( duplicateFaces( duplicateFaceIndex, 0 ),
+                                                                 duplicateFaceIndex,
+                                                                 i / numFacesPerElement,
+                                                                 blockIndex,
+                                                                 i % numFacesPerElement );
+    } );
   }
 
   // Loop over all the nodes and sort the associated faces.
@@ -642,15 +647,38 @@ void CellBlockManager::buildMaps()
 {
   GEOS_MARK_FUNCTION;
 
-  buildFaceMaps();
-  m_numEdges = buildEdgeMaps( m_numNodes,
-                              m_faceToNodes.toViewConst(),
-                              m_faceToEdges,
-                              m_edgeToFaces,
-                              m_edgeToNodes );
-  buildNodeToEdges();
+  real64 faceMapsTime = 0.0;
+  real64 edgeMapsTime = 0.0;
+  real64 nodeToEdgesTime = 0.0;
+  real64 elemToEdgesTime = 0.0;
 
-  fillElementToEdgesOfCellBlocks( m_faceToEdges.toViewConst(), this->getCellBlocks() );
+  {
+    Stopwatch const watch( faceMapsTime );
+    buildFaceMaps();
+  }
+  {
+    Stopwatch const watch( edgeMapsTime );
+    m_numEdges = buildEdgeMaps( m_numNodes,
+                                m_faceToNodes.toViewConst(),
+                                m_faceToEdges,
+                                m_edgeToFaces,
+                                m_edgeToNodes );
+  }
+  {
+    GEOS_MARK_SCOPE( buildNodeToEdges );
+    Stopwatch const watch( nodeToEdgesTime );
+    buildNodeToEdges();
+  }
+  {
+    GEOS_MARK_SCOPE( fillElementToEdgesOfCellBlocks );
+    Stopwatch const watch( elemToEdgesTime );
+    fillElementToEdgesOfCellBlocks( m_faceToEdges.toViewConst(), this->getCellBlocks() );
+  }
+
+  GEOS_LOG_LEVEL_RANK_0( 2, GEOS_FMT( "  connectivity maps built on rank 0 ({} nodes, {} faces, {} edges): "
+                                      "faces {:.3f} s, edges {:.3f} s, node to edges {:.3f} s, cell to edges {:.3f} s",
+                                      m_numNodes, m_numFaces, m_numEdges,
+                                      faceMapsTime, edgeMapsTime, nodeToEdgesTime, elemToEdgesTime ) );
 }
 
 ArrayOfArrays< localIndex > CellBlockManager::getFaceToNodes() const
@@ -737,9 +765,8 @@ ArrayOfArrays< localIndex > CellBlockManager::getFaceToEdges() const
 
 ArrayOfArrays< localIndex > CellBlockManager::getNodeToEdges() const
 {
-  return meshMapUtilities::transposeIndexMap< parallelHostPolicy >( m_edgeToNodes.toViewConst(),
-                                                                    m_numNodes,
-                                                                    edgeMapExtraSpacePerNode() );
+  // The map has already been built by buildMaps(), there is no need to transpose the edge to nodes map again.
+  return m_nodeToEdges;
 }
 
 localIndex CellBlockManager::numEdges() const
@@ -63,6 +63,7 @@ void MeshGeneratorBase::generateMesh( Group & parent, SpatialPartition & partiti
   else
   {
     CellBlockManager & cellBlockManager = parent.registerGroup< CellBlockManager >( keys::cellManager );
+    cellBlockManager.setLogLevel( getLogLevel() );
 
     fillCellBlockManager( cellBlockManager, partition );
 
@@ -24,9 +24,12 @@
 #include "common/DataTypes.hpp"
 #include "common/DataLayouts.hpp"
 #include "common/MpiWrapper.hpp"
+#include "codingUtilities/StringUtilities.hpp"
 
 #include <vtkXMLUnstructuredGridWriter.h>
 
+#include <sys/stat.h>
+
 namespace geos
 {
 using namespace dataRepository;
@@ -72,6 +75,23 @@ VTKMeshGenerator::VTKMeshGenerator( string const & name,
                     " If set to 0 (default value), the GlobalId arrays in the input mesh are used if available, and generated otherwise."
                     " If set to a negative value, the GlobalId arrays in the input mesh are not used, and generated global Ids are automatically generated."
                     " If set to a positive value, the GlobalId arrays in the input mesh are used and required, and the simulation aborts if they are not available" );
+
+  registerWrapper( viewKeyStruct::partitionedMeshDirectoryString(), &m_partitionedMeshDirectory ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Directory where the partitioned mesh is stored (one binary .vtu file per rank) after it has been imported, "
+                    "and loaded from in later runs with the same input file and partitioning parameters, "
+                    "which skips the import and partitioning. Only the VTK cells and points of each rank are stored, with their global ids and data: "
+                    "the cell block maps, the ghosting and the geometry are rebuilt at each run. "
+                    "If the number of ranks has changed, the stored mesh is repartitioned. "
+                    "If empty (default), the partitioned mesh is not stored." );
+
+  registerWrapper( viewKeyStruct::parallelReadString(), &m_parallelRead ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Flag to read a .vtu file in parallel, each rank reading a contiguous range of cells before partitioning."
+                    " This requires a single piece with raw (uncompressed) appended data, otherwise the file is read on one rank."
+                    " The indices of the cells and points in the file are used as global IDs if the file does not provide them." );
 }
 
 void VTKMeshGenerator::fillCellBlockManager( CellBlockManager & cellBlockManager, SpatialPartition & partition )
@@ -85,13 +105,40 @@ void VTKMeshGenerator::fillCellBlockManager( CellBlockManager & cellBlockManager
 
   GEOS_LOG_RANK_0( GEOS_FMT( "{} '{}': reading mesh from {}", catalogName(), getName(), m_filePath ) );
   {
-    GEOS_LOG_LEVEL_RANK_0( 2, "  reading the dataset..." );
-    vtk::AllMeshes allMeshes = vtk::loadAllMeshes( m_filePath, m_mainBlockName, m_faceBlockNames );
-    GEOS_LOG_LEVEL_RANK_0( 2, "  redistributing mesh..." );
-    vtk::AllMeshes redistributedMeshes =
-      vtk::redistributeMeshes( getLogLevel(), allMeshes.getMainMesh(), allMeshes.getFaceBlocks(), comm, m_partitionMethod, m_partitionRefinement, m_useGlobalIds );
-    m_vtkMesh = redistributedMeshes.getMainMesh();
-    m_faceBlockMeshes = redistributedMeshes.getFaceBlocks();
+    // The signature of the input is only checked by the first rank
+    bool const storePartition = !m_partitionedMeshDirectory.empty();
+    string const partitionSignature = storePartition && MpiWrapper::commRank( comm ) == 0 ? getPartitionSignature() : string();
+    vtk::AllMeshes allMeshes;
+    int const numStoredRanks = !storePartition ? 0 :
+                               vtk::loadPartitionedMeshes( m_partitionedMeshDirectory, partitionSignature, m_faceBlockNames, comm, allMeshes );
+    if( numStoredRanks == MpiWrapper::commSize( comm ) )
+    {
+      GEOS_LOG_LEVEL_RANK_0( 2, GEOS_FMT( "  loaded partitioned mesh from {}", m_partitionedMeshDirectory ) );
+      m_vtkMesh = allMeshes.getMainMesh();
+      m_faceBlockMeshes = allMeshes.getFaceBlocks();
+    }
+    else
+    {
+      if( numStoredRanks > 0 )
+      {
+        GEOS_LOG_LEVEL_RANK_0( 2, GEOS_FMT( "  loaded mesh partitioned for {} ranks from {}", numStoredRanks, m_partitionedMeshDirectory ) );
+      }
+      else
+      {
+        GEOS_LOG_LEVEL_RANK_0( 2, "  reading the dataset..." );
+        allMeshes = vtk::loadAllMeshes( m_filePath, m_mainBlockName, m_faceBlockNames, m_parallelRead );
+      }
+      GEOS_LOG_LEVEL_RANK_0( 2, "  redistributing mesh..." );
+      vtk::AllMeshes redistributedMeshes =
+        vtk::redistributeMeshes( getLogLevel(), allMeshes.getMainMesh(), allMeshes.getFaceBlocks(), comm, m_partitionMethod, m_partitionRefinement, m_useGlobalIds );
+      if( storePartition )
+      {
+        GEOS_LOG_LEVEL_RANK_0( 2, GEOS_FMT( "  writing partitioned mesh to {}", m_partitionedMeshDirectory ) );
+        vtk::writePartitionedMeshes( m_partitionedMeshDirectory, partitionSignature, redistributedMeshes, comm );
+      }
+      m_vtkMesh = redistributedMeshes.getMainMesh();
+      m_faceBlockMeshes = redistributedMeshes.getFaceBlocks();
+    }
     GEOS_LOG_LEVEL_RANK_0( 2, "  finding neighbor ranks..." );
     std::vector< vtkBoundingBox > boxes = vtk::exchangeBoundingBoxes( *m_vtkMesh, comm );
     std::vector< int > const neighbors = vtk::findNeighborRanks( std::move( boxes ) );
@@ -125,6 +172,18 @@ void VTKMeshGenerator::fillCellBlockManager( CellBlockManager & cellBlockManager
   vtk::printMeshStatistics( *m_vtkMesh, m_cellMap, comm );
 }
 
+string VTKMeshGenerator::getPartitionSignature() const
+{
+  // The size and modification time of the file are used instead of its content, which may be very large
+  struct stat fileStatus{};
+  stat( m_filePath.c_str(), &fileStatus );
+  return GEOS_FMT( "{} {} {} {} {} {} {} {} {}",
+                   getAbsolutePath( m_filePath ), fileStatus.st_size, fileStatus.st_mtime,
+                   m_mainBlockName, stringutilities::join( m_faceBlockNames, ',' ),
+                   EnumStrings< vtk::PartitionMethod >::toString( m_partitionMethod ),
+                   m_partitionRefinement, m_useGlobalIds, m_parallelRead );
+}
+
 void VTKMeshGenerator::importVolumicFieldOnArray( string const & cellBlockName,
                                                   string const & meshFieldName,
                                                   bool isMaterialField,
@@ -108,9 +108,17 @@ private:
     constexpr static char const * partitionRefinementString() { return "partitionRefinement"; }
     constexpr static char const * partitionMethodString() { return "partitionMethod"; }
     constexpr static char const * useGlobalIdsString() { return "useGlobalIds"; }
+    constexpr static char const * parallelReadString() { return "parallelRead"; }
+    constexpr static char const * partitionedMeshDirectoryString() { return "partitionedMeshDirectory"; }
   };
   /// @endcond
 
+  /**
+   * @brief Describe the input file and the parameters that determine the partitioned mesh.
+   * @return the signature the stored partitioned mesh must match to be reused
+   */
+  string getPartitionSignature() const;
+
   void importVolumicFieldOnArray( string const & cellBlockName,
                                   string const & meshFieldName,
                                   bool isMaterialField,
@@ -148,6 +156,13 @@ private:
   /// Whether global id arrays should be used, if available
   integer m_useGlobalIds = 0;
 
+  /// Whether the mesh file is read by all ranks in parallel
+  integer m_parallelRead = 0;
+
+  /// Directory where the partitioned mesh is stored and loaded from.
+  /// It holds the redistributed VTK meshes of the ranks, i.e. the state before CellBlockManager::buildMaps.
+  Path m_partitionedMeshDirectory;
+
   /// Method (library) used to partition the mesh
   vtk::PartitionMethod m_partitionMethod = vtk::PartitionMethod::parmetis;
 
@@ -0,0 +1,457 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file VTKParallelReader.cpp
+ */
+
+#include "VTKParallelReader.hpp"
+
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "common/TimingMacros.hpp"
+#include "dataRepository/xmlWrapper.hpp"
+
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkType.h>
+#include <vtkUnsignedCharArray.h>
+
+#include <fstream>
+
+namespace geos::vtk
+{
+
+namespace
+{
+
+/// Description of a data array stored in the appended data section of a .vtu file
+struct AppendedArray
+{
+  /// Name of the array
+  string name;
+  /// VTK type of the values
+  int vtkType = VTK_VOID;
+  /// Size of a single value, in bytes
+  int typeSize = 0;
+  /// Number of components of a tuple
+  int numComponents = 1;
+  /// Position of the first value in the file, in bytes
+  std::streamoff position = 0;
+};
+
+/**
+ * @brief Fill the description of an appended data array from its XML node.
+ * @param[in] node the DataArray XML node
+ * @param[in] dataStart position of the appended data section in the file
+ * @param[in] blockHeaderSize size of the byte count preceding each array in the appended data
+ * @param[out] array the description of the array
+ * @return true if the array is supported by the parallel reader
+ */
+bool parseAppendedArray( xmlWrapper::xmlNode const & node,
+                         std::streamoff const dataStart,
+                         int const blockHeaderSize,
+                         AppendedArray & array )
+{
+  struct TypeInfo
+  {
+    char const * name;
+    int vtkType;
+    int size;
+  };
+  static TypeInfo const types[] = { { "Int8", VTK_TYPE_INT8, 1 }, { "UInt8", VTK_TYPE_UINT8, 1 },
+    { "Int16", VTK_TYPE_INT16, 2 }, { "UInt16", VTK_TYPE_UINT16, 2 },
+    { "Int32", VTK_TYPE_INT32, 4 }, { "UInt32", VTK_TYPE_UINT32, 4 },
+    { "Int64", VTK_TYPE_INT64, 8 }, { "UInt64", VTK_TYPE_UINT64, 8 },
+    { "Float32", VTK_TYPE_FLOAT32, 4 }, { "Float64", VTK_TYPE_FLOAT64, 8 } };
+
+  string const typeName = node.attribute( "type" ).value();
+  for( TypeInfo const & type : types )
+  {
+    if( typeName == type.name )
+    {
+      array.vtkType = type.vtkType;
+      array.typeSize = type.size;
+    }
+  }
+  array.name = node.attribute( "Name" ).value();
+  array.numComponents = node.attribute( "NumberOfComponents" ).as_int( 1 );
+  array.position = dataStart + blockHeaderSize + node.attribute( "offset" ).as_llong();
+
+  return string( node.attribute( "format" ).value() ) == "appended" && array.typeSize > 0 && array.numComponents > 0;
+}
+
+/**
+ * @brief Read the XML header of a .vtu file, up to the beginning of its appended data section.
+ * @param[in] filePath the path of the file
+ * @param[out] dataStart the position of the first byte of the appended data in the file
+ * @return the header as a well-formed XML document, or an empty string if the file has no raw appended data
+ */
+string readHeader( Path const & filePath, std::streamoff & dataStart )
+{
+  std::ifstream file( filePath, std::ios::binary );
+  GEOS_ERROR_IF( !file, GEOS_FMT( "Could not open file {}", filePath ) );
+
+  string buffer;
+  std::vector< char > chunk( 65536 );
+  while( file )
+  {
+    file.read( chunk.data(), LvArray::integerConversion< std::streamsize >( chunk.size() ) );
+    buffer.append( chunk.data(), file.gcount() );
+
+    size_t const appendedBegin = buffer.find( "<AppendedData" );
+
+    // Data stored inline cannot be read by ranges, no need to go further
+    if( std::min( buffer.find( "format=\"ascii\"" ), buffer.find( "format=\"binary\"" ) ) < appendedBegin )
+    {
+      return {};
+    }
+
+    size_t const appendedTagEnd = appendedBegin == string::npos ? string::npos : buffer.find( '>', appendedBegin );
+    size_t const marker = appendedTagEnd == string::npos ? string::npos : buffer.find( '_', appendedTagEnd );
+    if( marker != string::npos )
+    {
+      if( buffer.substr( appendedBegin, appendedTagEnd - appendedBegin ).find( "encoding=\"raw\"" ) == string::npos )
+      {
+        return {};
+      }
+      dataStart = LvArray::integerConversion< std::streamoff >( marker + 1 );
+      buffer.resize( appendedBegin );
+      return buffer + "</VTKFile>";
+    }
+  }
+  return {};
+}
+
+/**
+ * @brief Create an array able to hold the values of an appended array.
+ * @param[in] info the description of the appended array
+ * @param[in] numTuples the number of tuples to allocate
+ * @return the array
+ */
+vtkSmartPointer< vtkDataArray > createArray( AppendedArray const & info,
+                                             vtkIdType const numTuples )
+{
+  vtkSmartPointer< vtkDataArray > array = vtkSmartPointer< vtkDataArray >::Take( vtkDataArray::CreateDataArray( info.vtkType ) );
+  array->SetName( info.name.c_str() );
+  array->SetNumberOfComponents( info.numComponents );
+  array->SetNumberOfTuples( numTuples );
+  return array;
+}
+
+/**
+ * @brief Read a contiguous range of tuples of an appended array.
+ * @param[in] file the input file stream
+ * @param[in] info the description of the appended array
+ * @param[in] first the index of the first tuple to read in the file
+ * @param[in] count the number of tuples to read
+ * @param[inout] target the array receiving the values, must have the type of the appended array
+ * @param[in] targetFirst the index of the first tuple to write in @p target
+ */
+void readTuples( std::ifstream & file,
+                 AppendedArray const & info,
+                 vtkIdType const first,
+                 vtkIdType const count,
+                 vtkDataArray & target,
+                 vtkIdType const targetFirst )
+{
+  if( count == 0 )
+  {
+    return;
+  }
+  std::streamoff const tupleSize = info.typeSize * info.numComponents;
+  file.seekg( info.position + first * tupleSize );
+  file.read( static_cast< char * >( target.GetVoidPointer( targetFirst * info.numComponents ) ), count * tupleSize );
+  GEOS_ERROR_IF( !file, GEOS_FMT( "Error while reading the values of array '{}'", info.name ) );
+}
+
+/**
+ * @brief Read the tuples of an appended array for a sorted list of indices, by ranges of consecutive indices.
+ * @param[in] file the input file stream
+ * @param[in] info the description of the appended array
+ * @param[in] indices the sorted, unique indices of the tuples to read
+ * @return the array of the selected tuples
+ */
+vtkSmartPointer< vtkDataArray > readSelectedTuples( std::ifstream & file,
+                                                    AppendedArray const & info,
+                                                    std::vector< vtkIdType > const & indices )
+{
+  vtkIdType const numTuples = LvArray::integerConversion< vtkIdType >( indices.size() );
+  vtkSmartPointer< vtkDataArray > array = createArray( info, numTuples );
+  vtkIdType i = 0;
+  while( i < numTuples )
+  {
+    vtkIdType j = i + 1;
+    while( j < numTuples && indices[j] == indices[j - 1] + 1 )
+    {
+      ++j;
+    }
+    readTuples( file, info, indices[i], j - i, *array, i );
+    i = j;
+  }
+  return array;
+}
+
+/**
+ * @brief Convert an integer array of any type to an array of vtkIdType.
+ * @param[in] array the input array
+ * @return the converted array
+ */
+vtkSmartPointer< vtkIdTypeArray > toIdTypeArray( vtkDataArray & array )
+{
+  vtkSmartPointer< vtkIdTypeArray > ids = vtkSmartPointer< vtkIdTypeArray >::New();
+  ids->DeepCopy( &array );
+  ids->SetName( array.GetName() );
+  return ids;
+}
+
+/**
+ * @brief Create global ids equal to the indices of the entities in the file.
+ * @tparam FUNC the type of the function returning the file index of a local entity
+ * @param[in] name the name of the array
+ * @param[in] numValues the number of local entities
+ * @param[in] fileIndex the function returning the file index of a local entity
+ * @return the global ids array
+ */
+template< typename FUNC >
+vtkSmartPointer< vtkIdTypeArray > createGlobalIds( string const & name,
+                                                   vtkIdType const numValues,
+                                                   FUNC && fileIndex )
+{
+  vtkSmartPointer< vtkIdTypeArray > ids = vtkSmartPointer< vtkIdTypeArray >::New();
+  ids->SetName( name.c_str() );
+  ids->SetNumberOfTuples( numValues );
+  for( vtkIdType i = 0; i < numValues; ++i )
+  {
+    ids->SetValue( i, fileIndex( i ) );
+  }
+  return ids;
+}
+
+} // namespace
+
+vtkSmartPointer< vtkUnstructuredGrid >
+readUnstructuredGridInParallel( Path const & filePath,
+                                MPI_Comm const comm )
+{
+  GEOS_MARK_FUNCTION;
+
+  int const rank = MpiWrapper::commRank( comm );
+  int const numRanks = MpiWrapper::commSize( comm );
+
+  // Only the first rank reads the header, the other ones only access the data they own
+  string header;
+  long long dataStart = 0;
+  if( rank == 0 )
+  {
+    std::streamoff start = 0;
+    header = readHeader( filePath, start );
+    dataStart = start;
+  }
+  MpiWrapper::broadcast( header, 0, comm );
+  MpiWrapper::broadcast( dataStart, 0, comm );
+  if( header.empty() )
+  {
+    return {};
+  }
+
+  xmlWrapper::xmlDocument document;
+  xmlWrapper::xmlResult const xmlResult = document.loadString( header );
+  GEOS_ERROR_IF( !xmlResult, GEOS_FMT( "Errors found while parsing the header of file {}\nDescription: {}",
+                                       filePath, xmlResult.description() ) );
+
+  // Check that the layout of the file allows to read it by ranges.
+  // All ranks share the same header, and therefore take the same decision.
+  xmlWrapper::xmlNode const vtkFileNode = document.getChild( "VTKFile" );
+  xmlWrapper::xmlNode const gridNode = vtkFileNode.child( "UnstructuredGrid" );
+  xmlWrapper::xmlNode const pieceNode = gridNode.child( "Piece" );
+  if( string( vtkFileNode.attribute( "type" ).value() ) != "UnstructuredGrid" ||
+      !vtkFileNode.attribute( "compressor" ).empty() ||
+      !pieceNode || pieceNode.next_sibling( "Piece" ) )
+  {
+    return {};
+  }
+
+  std::uint16_t const endiannessProbe = 1;
+  bool const isLittleEndian = *reinterpret_cast< unsigned char const * >( &endiannessProbe ) == 1;
+  string const byteOrder = vtkFileNode.attribute( "byte_order" ).value();
+  if( byteOrder != ( isLittleEndian ? "LittleEndian" : "BigEndian" ) )
+  {
+    return {};
+  }
+
+  string const headerType = vtkFileNode.attribute( "header_type" ).value();
+  int const blockHeaderSize = headerType == "UInt64" ? 8 : 4;
+  if( !headerType.empty() && headerType != "UInt32" && headerType != "UInt64" )
+  {
+    return {};
+  }
+
+  bool supported = true;
+  auto const parseNamedArray = [&]( xmlWrapper::xmlNode const & parentNode, string const & name )
+  {
+    AppendedArray array;
+    xmlWrapper::xmlNode const arrayNode = parentNode.find_child_by_attribute( "DataArray", "Name", name.c_str() );
+    supported = supported && arrayNode && parseAppendedArray( arrayNode, dataStart, blockHeaderSize, array );
+    return array;
+  };
+  auto const parseAllArrays = [&]( xmlWrapper::xmlNode const & parentNode )
+  {
+    std::vector< AppendedArray > arrays;
+    for( xmlWrapper::xmlNode const & arrayNode : parentNode.children( "DataArray" ) )
+    {
+      arrays.emplace_back();
+      supported = supported && parseAppendedArray( arrayNode, dataStart, blockHeaderSize, arrays.back() );
+    }
+    return arrays;
+  };
+
+  xmlWrapper::xmlNode const cellsNode = pieceNode.child( "Cells" );
+  AppendedArray const connectivityInfo = parseNamedArray( cellsNode, "connectivity" );
+  AppendedArray const offsetsInfo = parseNamedArray( cellsNode, "offsets" );
+  AppendedArray const typesInfo = parseNamedArray( cellsNode, "types" );
+  AppendedArray pointsInfo;
+  {
+    xmlWrapper::xmlNode const pointsArrayNode = pieceNode.child( "Points" ).child( "DataArray" );
+    supported = supported && pointsArrayNode && parseAppendedArray( pointsArrayNode, dataStart, blockHeaderSize, pointsInfo );
+  }
+  std::vector< AppendedArray > const cellDataInfo = parseAllArrays( pieceNode.child( "CellData" ) );
+  std::vector< AppendedArray > const pointDataInfo = parseAllArrays( pieceNode.child( "PointData" ) );
+
+  // Polyhedra are described by an additional list of faces, not supported here
+  supported = supported &&
+              !cellsNode.find_child_by_attribute( "DataArray", "Name", "faces" ) &&
+              typesInfo.vtkType == VTK_TYPE_UINT8 && typesInfo.numComponents == 1 &&
+              pointsInfo.numComponents == 3;
+  if( !supported )
+  {
+    return {};
+  }
+
+  // Each rank reads a contiguous range of cells
+  vtkIdType const numCells = pieceNode.attribute( "NumberOfCells" ).as_llong();
+  vtkIdType const cellBegin = numCells * rank / numRanks;
+  vtkIdType const cellEnd = numCells * ( rank + 1 ) / numRanks;
+  vtkIdType const numLocalCells = cellEnd - cellBegin;
+
+  std::ifstream file( filePath, std::ios::binary );
+  GEOS_ERROR_IF( !file, GEOS_FMT( "Could not open file {}", filePath ) );
+
+  // The offsets store the end of each cell in the connectivity:
+  // the end of the previous cell (if any) gives the beginning of the local range.
+  vtkIdType const offsetsBegin = cellBegin > 0 ? cellBegin - 1 : 0;
+  vtkSmartPointer< vtkIdTypeArray > cellEnds;
+  {
+    vtkSmartPointer< vtkDataArray > rawOffsets = createArray( offsetsInfo, cellEnd - offsetsBegin );
+    readTuples( file, offsetsInfo, offsetsBegin, cellEnd - offsetsBegin, *rawOffsets, 0 );
+    cellEnds = toIdTypeArray( *rawOffsets );
+  }
+  vtkIdType const shift = cellBegin - offsetsBegin;
+  vtkIdType const connectivityBegin = shift > 0 ? cellEnds->GetValue( 0 ) : 0;
+  vtkIdType const connectivityEnd = numLocalCells > 0 ? cellEnds->GetValue( numLocalCells - 1 + shift ) : connectivityBegin;
+
+  vtkNew< vtkIdTypeArray > offsets;
+  offsets->SetNumberOfTuples( numLocalCells + 1 );
+  offsets->SetValue( 0, 0 );
+  for( vtkIdType c = 0; c < numLocalCells; ++c )
+  {
+    offsets->SetValue( c + 1, cellEnds->GetValue( c + shift ) - connectivityBegin );
+  }
+
+  vtkSmartPointer< vtkIdTypeArray > connectivity;
+  {
+    vtkSmartPointer< vtkDataArray > rawConnectivity = createArray( connectivityInfo, connectivityEnd - connectivityBegin );
+    readTuples( file, connectivityInfo, connectivityBegin, connectivityEnd - connectivityBegin, *rawConnectivity, 0 );
+    connectivity = toIdTypeArray( *rawConnectivity );
+  }
+
+  vtkNew< vtkUnsignedCharArray > types;
+  types->SetNumberOfTuples( numLocalCells );
+  readTuples( file, typesInfo, cellBegin, numLocalCells, *types, 0 );
+
+  // The points supported by the local cells, sorted by their index in the file
+  vtkIdType const connectivitySize = connectivity->GetNumberOfTuples();
+  std::vector< vtkIdType > pointIds( connectivity->GetPointer( 0 ), connectivity->GetPointer( 0 ) + connectivitySize );
+  std::sort( pointIds.begin(), pointIds.end() );
+  pointIds.erase( std::unique( pointIds.begin(), pointIds.end() ), pointIds.end() );
+  vtkIdType const numLocalPoints = LvArray::integerConversion< vtkIdType >( pointIds.size() );
+
+  // Switch the connectivity to local point indices
+  vtkIdType * const connectivityData = connectivity->GetPointer( 0 );
+  forAll< parallelHostPolicy >( connectivitySize, [&pointIds, connectivityData]( localIndex const i )
+  {
+    connectivityData[i] = std::distance( pointIds.begin(), std::lower_bound( pointIds.begin(), pointIds.end(), connectivityData[i] ) );
+  } );
+
+  vtkNew< vtkPoints > points;
+  points->SetData( readSelectedTuples( file, pointsInfo, pointIds ) );
+
+  vtkNew< vtkCellArray > cells;
+  cells->SetData( offsets.GetPointer(), connectivity.GetPointer() );
+
+  vtkSmartPointer< vtkUnstructuredGrid > mesh = vtkSmartPointer< vtkUnstructuredGrid >::New();
+  mesh->SetPoints( points );
+  mesh->SetCells( types, cells );
+
+  // Attach the data arrays, the ones flagged as global ids in the file are used as such
+  string const cellGlobalIdsName = pieceNode.child( "CellData" ).attribute( "GlobalIds" ).value();
+  for( AppendedArray const & info : cellDataInfo )
+  {
+    vtkSmartPointer< vtkDataArray > array = createArray( info, numLocalCells );
+    readTuples( file, info, cellBegin, numLocalCells, *array, 0 );
+    if( info.name == cellGlobalIdsName )
+    {
+      mesh->GetCellData()->SetGlobalIds( toIdTypeArray( *array ) );
+    }
+    else
+    {
+      mesh->GetCellData()->AddArray( array );
+    }
+  }
+
+  string const pointGlobalIdsName = pieceNode.child( "PointData" ).attribute( "GlobalIds" ).value();
+  for( AppendedArray const & info : pointDataInfo )
+  {
+    vtkSmartPointer< vtkDataArray > array = readSelectedTuples( file, info, pointIds );
+    if( info.name == pointGlobalIdsName )
+    {
+      mesh->GetPointData()->SetGlobalIds( toIdTypeArray( *array ) );
+    }
+    else
+    {
+      mesh->GetPointData()->AddArray( array );
+    }
+  }
+
+  // Otherwise, the positions in the file are a natural global numbering
+  if( mesh->GetCellData()->GetGlobalIds() == nullptr )
+  {
+    mesh->GetCellData()->SetGlobalIds( createGlobalIds( "GlobalCellIds", numLocalCells,
+                                                        [&]( vtkIdType const i ) { return cellBegin + i; } ) );
+  }
+  if( mesh->GetPointData()->GetGlobalIds() == nullptr )
+  {
+    mesh->GetPointData()->SetGlobalIds( createGlobalIds( "GlobalPointIds", numLocalPoints,
+                                                         [&]( vtkIdType const i ) { return pointIds[i]; } ) );
+  }
+
+  return mesh;
+}
+
+} // namespace geos::vtk
@@ -0,0 +1,54 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file VTKParallelReader.hpp
+ */
+
+#ifndef GEOS_MESH_GENERATORS_VTKPARALLELREADER_HPP
+#define GEOS_MESH_GENERATORS_VTKPARALLELREADER_HPP
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+
+#include <vtkSmartPointer.h>
+#include <vtkUnstructuredGrid.h>
+
+namespace geos::vtk
+{
+
+/**
+ * @brief Read a single-piece .vtu file collectively, each rank reading a contiguous range of cells.
+ * @param[in] filePath the path of the .vtu file
+ * @param[in] comm the MPI communicator
+ * @return the cells of the local range with the points they reference, or an empty pointer on all ranks
+ *         if the layout of the file does not allow a parallel read.
+ *
+ * Only the first rank reads the XML header, which is then broadcast. Each rank then reads its own
+ * cells (connectivity, types and cell data), and the points (with point data) they are supported by,
+ * directly from the appended data section using byte offsets. No rank ever holds the whole mesh.
+ *
+ * The parallel read requires a file with a single piece, raw (non-base64, uncompressed) appended data
+ * in the byte order of the machine, and no polyhedral faces.
+ *
+ * Unless the file already provides them, the indices of the cells and points in the file are used as global ids.
+ */
+vtkSmartPointer< vtkUnstructuredGrid >
+readUnstructuredGridInParallel( Path const & filePath,
+                                MPI_Comm const comm );
+
+} // namespace geos::vtk
+
+#endif // GEOS_MESH_GENERATORS_VTKPARALLELREADER_HPP
@@ -15,6 +15,7 @@
 
 #include "mesh/generators/CollocatedNodes.hpp"
 #include "mesh/generators/VTKMeshGeneratorTools.hpp"
+#include "mesh/generators/VTKParallelReader.hpp"
 #include "mesh/generators/VTKUtilities.hpp"
 
 #include "mesh/generators/ParMETISInterface.hpp"
@@ -24,6 +25,7 @@
 
 #include "common/TypeDispatch.hpp"
 
+#include <vtkAppendFilter.h>
 #include <vtkArrayDispatch.h>
 #include <vtkBoundingBox.h>
 #include <vtkCellData.h>
@@ -54,6 +56,7 @@
 #include <vtkXMLRectilinearGridReader.h>
 #include <vtkXMLStructuredGridReader.h>
 #include <vtkXMLUnstructuredGridReader.h>
+#include <vtkXMLUnstructuredGridWriter.h>
 
 #ifdef GEOSX_USE_MPI
 #include <vtkMPIController.h>
@@ -62,6 +65,7 @@
 #include <vtkDummyController.h>
 #endif
 
+#include <fstream>
 #include <numeric>
 
 namespace geos
@@ -434,7 +438,8 @@ VTKLegacyDatasetType getVTKLegacyDatasetType( vtkSmartPointer< vtkDataSetReader
 vtkSmartPointer< vtkDataSet >
 loadMesh( Path const & filePath,
           string const & blockName,
-          int readerRank = 0 )
+          int readerRank = 0,
+          bool const readByCellRanges = false )
 {
   string const extension = filePath.extension();
 
@@ -518,7 +523,20 @@ loadMesh( Path const & filePath,
       }
       break;
     }
-    case VTKMeshExtension::vtu: return serialRead( vtkSmartPointer< vtkXMLUnstructuredGridReader >::New() );
+    case VTKMeshExtension::vtu:
+    {
+      if( readByCellRanges )
+      {
+        vtkSmartPointer< vtkUnstructuredGrid > mesh = readUnstructuredGridInParallel( filePath, MPI_COMM_GEOSX );
+        if( mesh )
+        {
+          return mesh;
+        }
+        GEOS_LOG_RANK_0( GEOS_FMT( "File {} cannot be read in parallel (single piece with raw appended data required), "
+                                   "reading it on a single rank", filePath ) );
+      }
+      return serialRead( vtkSmartPointer< vtkXMLUnstructuredGridReader >::New() );
+    }
     case VTKMeshExtension::vtr: return serialRead( vtkSmartPointer< vtkXMLRectilinearGridReader >::New() );
     case VTKMeshExtension::vts: return serialRead( vtkSmartPointer< vtkXMLStructuredGridReader >::New() );
     case VTKMeshExtension::vti: return serialRead( vtkSmartPointer< vtkXMLImageDataReader >::New() );
@@ -545,10 +563,11 @@ loadMesh( Path const & filePath,
 
 AllMeshes loadAllMeshes( Path const & filePath,
                          string const & mainBlockName,
-                         array1d< string > const & faceBlockNames )
+                         array1d< string > const & faceBlockNames,
+                         bool const parallelRead )
 {
   int const lastRank = MpiWrapper::commSize() - 1;
-  vtkSmartPointer< vtkDataSet > main = loadMesh( filePath, mainBlockName );
+  vtkSmartPointer< vtkDataSet > main = loadMesh( filePath, mainBlockName, 0, parallelRead );
   std::map< string, vtkSmartPointer< vtkDataSet > > faces;
 
   for( string const & faceBlockName: faceBlockNames )
@@ -559,6 +578,178 @@ AllMeshes loadAllMeshes( Path const & filePath,
   return AllMeshes( main, faces );
 }
 
+/// Name of the file describing the stored partitioned meshes
+constexpr char const partitionedMeshInfoFileName[] = "partition.txt";
+
+/**
+ * @brief Get the path of the file holding the part of a mesh for a given rank.
+ * @param[in] directory the directory holding the partitioned meshes
+ * @param[in] meshName the name of the mesh
+ * @param[in] rank the rank the part belongs to
+ * @return the file path
+ */
+string getPartitionedMeshFileName( Path const & directory,
+                                   string const & meshName,
+                                   int const rank )
+{
+  return joinPath( directory, GEOS_FMT( "{}_{}.vtu", meshName, rank ) );
+}
+
+int loadPartitionedMeshes( Path const & directory,
+                           string const & signature,
+                           array1d< string > const & faceBlockNames,
+                           MPI_Comm const comm,
+                           AllMeshes & meshes )
+{
+  GEOS_MARK_FUNCTION;
+
+  int const rank = MpiWrapper::commRank( comm );
+  int const numRanks = MpiWrapper::commSize( comm );
+
+  // Only the first rank checks that the stored meshes match the current input
+  int numStoredRanks = 0;
+  if( rank == 0 )
+  {
+    std::ifstream info( joinPath( directory, partitionedMeshInfoFileName ) );
+    string storedSignature;
+    int storedNumRanks = 0;
+    if( std::getline( info, storedSignature ) && ( info >> storedNumRanks ) && storedSignature == signature )
+    {
+      numStoredRanks = storedNumRanks;
+    }
+  }
+  MpiWrapper::broadcast( numStoredRanks, 0, comm );
+
+  // The face blocks are expected on the last rank before redistribution, they can only be reused as they are
+  if( numStoredRanks == 0 || ( numStoredRanks != numRanks && !faceBlockNames.empty() ) )
+  {
+    return 0;
+  }
+
+  // Each rank loads its own part, or a contiguous range of parts if the number of ranks has changed
+  int const firstPart = LvArray::integerConversion< int >( std::int64_t( numStoredRanks ) * rank / numRanks );
+  int const lastPart = LvArray::integerConversion< int >( std::int64_t( numStoredRanks ) * ( rank + 1 ) / numRanks );
+
+  std::vector< string > fileNames;
+  for( int part = firstPart; part < lastPart; ++part )
+  {
+    fileNames.emplace_back( getPartitionedMeshFileName( directory, "main", part ) );
+  }
+  if( numStoredRanks == numRanks )
+  {
+    for( string const & faceBlockName : faceBlockNames )
+    {
+      fileNames.emplace_back( getPartitionedMeshFileName( directory, "face_" + faceBlockName, rank ) );
+    }
+  }
+  bool const filesAvailable = std::all_of( fileNames.begin(), fileNames.end(),
+                                           []( string const & fileName ) { return std::ifstream( fileName ).good(); } );
+  if( MpiWrapper::min( filesAvailable ? 1 : 0, comm ) == 0 )
+  {
+    GEOS_LOG_RANK_0( GEOS_FMT( "Partitioned mesh in {} is incomplete and will be regenerated", directory ) );
+    return 0;
+  }
+
+  auto const readPart = []( string const & fileName ) -> vtkSmartPointer< vtkUnstructuredGrid >
+  {
+    vtkNew< vtkXMLUnstructuredGridReader > reader;
+    reader->SetFileName( fileName.c_str() );
+    reader->Update();
+    return vtkSmartPointer< vtkUnstructuredGrid >( reader->GetOutput() );
+  };
+
+  vtkSmartPointer< vtkDataSet > main;
+  if( lastPart - firstPart == 1 )
+  {
+    main = readPart( fileNames[0] );
+  }
+  else if( lastPart > firstPart )
+  {
+    vtkNew< vtkAppendFilter > appender;
+    appender->MergePointsOn();
+    for( int part = firstPart; part < lastPart; ++part )
+    {
+      appender->AddInputData( readPart( fileNames[part - firstPart] ) );
+    }
+    appender->Update();
+    main = vtkSmartPointer< vtkUnstructuredGrid >( appender->GetOutput() );
+  }
+  else
+  {
+    main = vtkSmartPointer< vtkUnstructuredGrid >::New();
+  }
+
+  std::map< string, vtkSmartPointer< vtkDataSet > > faceBlocks;
+  for( localIndex i = 0; i < faceBlockNames.size(); ++i )
+  {
+    faceBlocks[faceBlockNames[i]] = readPart( fileNames[lastPart - firstPart + i] );
+  }
+
+  meshes = AllMeshes( main, faceBlocks );
+  return numStoredRanks;
+}
+
+void writePartitionedMeshes( Path const & directory,
+                             string const & signature,
+                             AllMeshes & meshes,
+                             MPI_Comm const comm )
+{
+  GEOS_MARK_FUNCTION;
+
+  int const rank = MpiWrapper::commRank( comm );
+  int const numRanks = MpiWrapper::commSize( comm );
+
+  // Invalidate any previously stored meshes before overwriting their files
+  string const infoFileName = joinPath( directory, partitionedMeshInfoFileName );
+  if( rank == 0 )
+  {
+    makeDirsForPath( directory );
+    std::remove( infoFileName.c_str() );
+  }
+  MpiWrapper::barrier( comm );
+
+  auto const writePart = []( vtkSmartPointer< vtkDataSet > const & mesh, string const & fileName )
+  {
+    // Structured datasets (not redistributed, e.g. in serial) are converted first
+    vtkSmartPointer< vtkUnstructuredGrid > grid = vtkUnstructuredGrid::SafeDownCast( mesh );
+    if( !grid )
+    {
+      vtkNew< vtkAppendFilter > converter;
+      converter->AddInputData( mesh );
+      converter->Update();
+      grid = converter->GetOutput();
+    }
+    // Raw appended data is the fastest to write and read back
+    vtkNew< vtkXMLUnstructuredGridWriter > writer;
+    writer->SetFileName( fileName.c_str() );
+    writer->SetInputData( grid );
+    writer->SetDataModeToAppended();
+    writer->EncodeAppendedDataOff();
+    writer->SetCompressorTypeToNone();
+    return writer->Write() == 1;
+  };
+
+  bool success = writePart( meshes.getMainMesh(), getPartitionedMeshFileName( directory, "main", rank ) );
+  for( auto const & [faceBlockName, faceBlockMesh] : meshes.getFaceBlocks() )
+  {
+    success = writePart( faceBlockMesh, getPartitionedMeshFileName( directory, "face_" + faceBlockName, rank ) ) && success;
+  }
+
+  // The description is written last, so that an incomplete set of files is never loaded
+  if( MpiWrapper::min( success ? 1 : 0, comm ) == 1 )
+  {
+    if( rank == 0 )
+    {
+      std::ofstream info( infoFileName );
+      info << signature << '\n' << numRanks << '\n';
+    }
+  }
+  else
+  {
+    GEOS_WARNING_IF( rank == 0, GEOS_FMT( "The partitioned mesh could not be written to {}", directory ) );
+  }
+}
+
 
 /**
  * @brief Redistributes the mesh using cell graphds methods (ParMETIS or PTScotch)
@@ -134,11 +134,43 @@ private:
  * @param[in] filePath the Path of the file to load
  * @param[in] mainBlockName The name of the block to import (will be considered for multi-block files only).
  * @param[in] faceBlockNames The names of the face blocks to import  (will be considered for multi-block files only).
+ * @param[in] parallelRead Whether all ranks should read a part of the main mesh (will be considered for .vtu files only).
  * @return The compound of the main mesh and the face block meshes.
  */
 AllMeshes loadAllMeshes( Path const & filePath,
                          string const & mainBlockName,
-                         array1d< string > const & faceBlockNames );
+                         array1d< string > const & faceBlockNames,
+                         bool const parallelRead = false );
+
+/**
+ * @brief Load the meshes partitioned and stored by a previous run with writePartitionedMeshes().
+ * @param[in] directory the directory holding the partitioned meshes
+ * @param[in] signature description of the input file and partitioning parameters the stored meshes must match
+ * @param[in] faceBlockNames the names of the face blocks to load
+ * @param[in] comm the MPI communicator
+ * @param[out] meshes the local part of the main mesh and face block meshes, if loaded
+ * @return the number of ranks the stored meshes are partitioned for, or 0 if no matching meshes were loaded
+ *
+ * If the meshes were partitioned for the current number of ranks, each rank loads its own part.
+ * Otherwise, the parts are spread over the current ranks, and must be redistributed.
+ */
+int loadPartitionedMeshes( Path const & directory,
+                           string const & signature,
+                           array1d< string > const & faceBlockNames,
+                           MPI_Comm const comm,
+                           AllMeshes & meshes );
+
+/**
+ * @brief Store the partitioned meshes, one binary .vtu file per rank and mesh, for later runs.
+ * @param[in] directory the directory where the meshes are written
+ * @param[in] signature description of the input file and partitioning parameters, checked when loading
+ * @param[in] meshes the local part of the main mesh and face block meshes
+ * @param[in] comm the MPI communicator
+ */
+void writePartitionedMeshes( Path const & directory,
+                             string const & signature,
+                             AllMeshes & meshes,
+                             MPI_Comm const comm );
 
 /**
  * @brief Compute the rank neighbor candidate list.
@@ -800,7 +800,8 @@ void waitOrderedOrWaitAll( int const n,
 
 void CommunicationTools::setupGhosts( MeshLevel & meshLevel,
                                       std::vector< NeighborCommunicator > & neighbors,
-                                      bool const unorderedComms )
+                                      bool const unorderedComms,
+                                      GhostingRequirement const & ghosting )
 {
   GEOS_MARK_FUNCTION;
   MPI_iCommData commData( getCommID() );
@@ -814,7 +815,8 @@ void CommunicationTools::setupGhosts( MeshLevel & meshLevel,
   auto sendGhosts = [&] ( int idx )
   {
     neighbors[idx].prepareAndSendGhosts( false,
-                                         1,
+                                         ghosting.depth,
+                                         ghosting.faceNeighborsOnly,
                                          meshLevel,
                                          commData.commID(),
                                          commData.mpiRecvBufferSizeRequest( idx ),
@@ -922,6 +924,252 @@ void CommunicationTools::setupGhosts( MeshLevel & meshLevel,
   faceManager.compressRelationMaps();
 }
 
+namespace
+{
+
+/**
+ * @brief Resolve the fields to synchronize on the object managers of the mesh.
+ * @param fieldsToBeSync the fields to synchronize, keyed on their location
+ * @param mesh the mesh level holding the fields
+ * @param neighbors the neighbors to communicate with
+ * @return the fields to pack/unpack, grouped by object manager, in the same order on all ranks
+ * @details The selection is the one of ObjectManagerBase::pack: requested wrappers must exist on the
+ *          object managers that have indices to exchange, excluded wrappers are skipped, and only wrappers
+ *          sized from their parent are packed by index.
+ *          Resolving them once allows to pack all the neighbor buffers without any name lookup nor metadata.
+ */
+std::vector< SyncFieldEntry > resolveSyncFields( FieldIdentifiers const & fieldsToBeSync,
+                                                 MeshLevel & mesh,
+                                                 std::vector< NeighborCommunicator > const & neighbors )
+{
+  std::vector< SyncFieldEntry > entries;
+
+  auto addFields = [&]( ObjectManagerBase & manager,
+                        array1d< string > const & fieldNames,
+                        bool const useOp )
+  {
+    // as in ObjectManagerBase::pack, a manager without any index to exchange is not required to hold the fields
+    bool hasIndicesToExchange = false;
+    for( NeighborCommunicator const & neighbor : neighbors )
+    {
+      int const neighborRank = neighbor.neighborRank();
+      hasIndicesToExchange = hasIndicesToExchange ||
+                             manager.getNeighborData( neighborRank ).ghostsToSend().size() > 0 ||
+                             manager.getNeighborData( neighborRank ).ghostsToReceive().size() > 0;
+    }
+
+    std::set< string > const names( fieldNames.begin(), fieldNames.end() );
+    std::set< string > const & exclusion = manager.getPackingExclusionList();
+    for( string const & name : names )
+    {
+      if( !manager.hasWrapper( name ) )
+      {
+        GEOS_ERROR_IF( hasIndicesToExchange,
+                       "Wrapper \"" << name << "\" was requested from \"" << manager.getName() << "\" but is not available." );
+        continue;
+      }
+      WrapperBase & wrapper = manager.getWrapperBase( name );
+      if( exclusion.count( name ) == 0 && wrapper.sizedFromParent() )
+      {
+        entries.push_back( { &manager, &wrapper, useOp, NeighborCommunicator::isFusedForSync( wrapper ) } );
+      }
+    }
+  };
+
+  for( auto const & iter : fieldsToBeSync.getFields() )
+  {
+    FieldLocation location{};
+    fieldsToBeSync.getLocation( iter.first, location );
+    switch( location )
+    {
+      case FieldLocation::Node:
+      {
+        // only nodal fields are reduced with the synchronization operation
+        addFields( mesh.getNodeManager(), iter.second, true );
+        break;
+      }
+      case FieldLocation::Edge:
+      {
+        addFields( mesh.getEdgeManager(), iter.second, false );
+        break;
+      }
+      case FieldLocation::Face:
+      {
+        addFields( mesh.getFaceManager(), iter.second, false );
+        break;
+      }
+      case FieldLocation::Elem:
+      {
+        ElementRegionManager & elemManager = mesh.getElemManager();
+        elemManager.getRegion( fieldsToBeSync.getRegionName( iter.first ) ).forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase & subRegion )
+        {
+          addFields( subRegion, iter.second, false );
+        } );
+        break;
+      }
+    }
+  }
+
+  return entries;
+}
+
+/**
+ * @brief Apply @p lambda to every value describing the state of the mesh a synchronization plan depends on.
+ * @param fieldsToBeSync the fields to synchronize, keyed on their location
+ * @param mesh the mesh level holding the fields
+ * @param neighbors the neighbors to communicate with
+ * @param entries the resolved fields of the plan
+ * @param lambda the function called on each value of the signature
+ * @details Besides the mesh timestamp and the neighbors, the signature holds the number of sub-regions
+ *          and wrappers of the object managers (a field may appear), their size and ghost lists, and the
+ *          size of the resolved fields (their number of components sets the buffer layout).
+ */
+template< typename LAMBDA >
+void forSyncPlanSignature( FieldIdentifiers const & fieldsToBeSync,
+                           MeshLevel const & mesh,
+                           std::vector< NeighborCommunicator > const & neighbors,
+                           std::vector< SyncFieldEntry > const & entries,
+                           LAMBDA && lambda )
+{
+  lambda( LvArray::integerConversion< localIndex >( mesh.getModificationTimestamp() ) );
+  lambda( LvArray::integerConversion< localIndex >( neighbors.size() ) );
+  for( NeighborCommunicator const & neighbor : neighbors )
+  {
+    lambda( neighbor.neighborRank() );
+  }
+  for( auto const & iter : fieldsToBeSync.getFields() )
+  {
+    FieldLocation location{};
+    fieldsToBeSync.getLocation( iter.first, location );
+    if( location == FieldLocation::Elem )
+    {
+      lambda( mesh.getElemManager().getRegion( fieldsToBeSync.getRegionName( iter.first ) ).numSubRegions() );
+    }
+  }
+
+  ObjectManagerBase const * currentManager = nullptr;
+  for( SyncFieldEntry const & entry : entries )
+  {
+    if( entry.manager != currentManager )
+    {
+      currentManager = entry.manager;
+      lambda( currentManager->size() );
+      lambda( currentManager->numWrappers() );
+      for( NeighborCommunicator const & neighbor : neighbors )
+      {
+        NeighborData const & neighborData = currentManager->getNeighborData( neighbor.neighborRank() );
+        lambda( neighborData.ghostsToSend().size() );
+        lambda( neighborData.ghostsToReceive().size() );
+      }
+    }
+    lambda( entry.wrapper->size() );
+  }
+}
+
+/**
+ * @brief Build the synchronization plan of a set of fields.
+ * @param fieldsToBeSync the fields to synchronize, keyed on their location
+ * @param mesh the mesh level holding the fields
+ * @param neighbors the neighbors to communicate with
+ * @return the resolved fields, with the layout of the buffer exchanged with each neighbor
+ */
+std::shared_ptr< SyncPlan const > buildSyncPlan( FieldIdentifiers const & fieldsToBeSync,
+                                                 MeshLevel & mesh,
+                                                 std::vector< NeighborCommunicator > const & neighbors )
+{
+  std::shared_ptr< SyncPlan > plan = std::make_shared< SyncPlan >();
+  plan->entries = resolveSyncFields( fieldsToBeSync, mesh, neighbors );
+
+  for( NeighborCommunicator const & neighbor : neighbors )
+  {
+    SyncNeighborPlan neighborPlan;
+    for( std::size_t entryIndex = 0; entryIndex < plan->entries.size(); ++entryIndex )
+    {
+      SyncFieldEntry const & entry = plan->entries[entryIndex];
+      NeighborData const & neighborData = entry.manager->getNeighborData( neighbor.neighborRank() );
+      localIndex const numSend = neighborData.ghostsToSend().size();
+      localIndex const numReceive = neighborData.ghostsToReceive().size();
+      localIndex const numComponents = entry.manager->size() > 0 ? entry.wrapper->size() / entry.manager->size() : 0;
+
+      // send and receive lists are built independently, since a field may only have ghosts in one direction
+      if( entry.fused )
+      {
+        if( numSend > 0 )
+        {
+          neighborPlan.fusedSend.push_back( { LvArray::integerConversion< localIndex >( entryIndex ), neighborPlan.fusedSendSize } );
+          neighborPlan.fusedSendSize += numSend * numComponents;
+          neighborPlan.fusedSendItems += numSend;
+        }
+        if( numReceive > 0 )
+        {
+          neighborPlan.fusedReceive.push_back( { LvArray::integerConversion< localIndex >( entryIndex ), neighborPlan.fusedReceiveSize } );
+          neighborPlan.fusedReceiveSize += numReceive * numComponents;
+          neighborPlan.fusedReceiveItems += numReceive;
+        }
+      }
+      else
+      {
+        if( numSend > 0 )
+        {
+          neighborPlan.otherSend.push_back( LvArray::integerConversion< localIndex >( entryIndex ) );
+        }
+        if( numReceive > 0 )
+        {
+          neighborPlan.otherReceive.push_back( LvArray::integerConversion< localIndex >( entryIndex ) );
+        }
+      }
+    }
+    plan->neighbors.push_back( std::move( neighborPlan ) );
+  }
+
+  forSyncPlanSignature( fieldsToBeSync, mesh, neighbors, plan->entries, [&]( localIndex const value )
+  {
+    plan->signature.push_back( value );
+  } );
+
+  return plan;
+}
+
+/**
+ * @brief Get the synchronization plan of a set of fields from the cache of the mesh level.
+ * @param fieldsToBeSync the fields to synchronize, keyed on their location
+ * @param mesh the mesh level holding the fields
+ * @param neighbors the neighbors to communicate with
+ * @return the cached plan if the mesh did not change since it was built, a new plan otherwise
+ */
+std::shared_ptr< SyncPlan const > getSyncPlan( FieldIdentifiers const & fieldsToBeSync,
+                                               MeshLevel & mesh,
+                                               std::vector< NeighborCommunicator > const & neighbors )
+{
+  string key;
+  for( auto const & iter : fieldsToBeSync.getFields() )
+  {
+    key += iter.first + ":" + stringutilities::join( iter.second, "," ) + ";";
+  }
+
+  std::shared_ptr< SyncPlan const > & plan = mesh.getSyncPlanCache()[key];
+  if( plan != nullptr )
+  {
+    std::vector< localIndex > const & signature = plan->signature;
+    std::size_t position = 0;
+    bool isValid = true;
+    forSyncPlanSignature( fieldsToBeSync, mesh, neighbors, plan->entries, [&]( localIndex const value )
+    {
+      isValid = isValid && position < signature.size() && signature[position] == value;
+      ++position;
+    } );
+    if( isValid && position == signature.size() )
+    {
+      return plan;
+    }
+  }
+
+  plan = buildSyncPlan( fieldsToBeSync, mesh, neighbors );
+  return plan;
+}
+
+}
+
 void CommunicationTools::synchronizePackSendRecvSizes( FieldIdentifiers const & fieldsToBeSync,
                                                        MeshLevel & mesh,
                                                        std::vector< NeighborCommunicator > & neighbors,
@@ -930,13 +1178,15 @@ void CommunicationTools::synchronizePackSendRecvSizes( FieldIdentifiers const &
 {
   GEOS_MARK_FUNCTION;
   icomm.setFieldsToBeSync( fieldsToBeSync );
+  icomm.setSyncPlan( getSyncPlan( fieldsToBeSync, mesh, neighbors ) );
   icomm.resize( neighbors.size() );
 
+  SyncPlan const & plan = icomm.getSyncPlan();
   parallelDeviceEvents events;
   for( std::size_t neighborIndex = 0; neighborIndex < neighbors.size(); ++neighborIndex )
   {
     NeighborCommunicator & neighbor = neighbors[neighborIndex];
-    int const bufferSize = neighbor.packCommSizeForSync( fieldsToBeSync, mesh, icomm.commID(), onDevice, events );
+    int const bufferSize = neighbor.packCommSizeForSync( plan, neighborIndex, icomm.commID(), onDevice, events );
 
     neighbor.mpiISendReceiveBufferSizes( icomm.commID(),
                                          icomm.mpiSendBufferSizeRequest( neighborIndex ),
@@ -949,17 +1199,20 @@ void CommunicationTools::synchronizePackSendRecvSizes( FieldIdentifiers const &
 }
 
 
-void CommunicationTools::asyncPack( FieldIdentifiers const & fieldsToBeSync,
-                                    MeshLevel & mesh,
-                                    std::vector< NeighborCommunicator > & neighbors,
+void CommunicationTools::asyncPack( std::vector< NeighborCommunicator > & neighbors,
                                     MPI_iCommData & icomm,
                                     bool onDevice,
                                     parallelDeviceEvents & events )
 {
   GEOS_MARK_FUNCTION;
-  for( NeighborCommunicator & neighbor : neighbors )
+  for( std::size_t neighborIndex = 0; neighborIndex < neighbors.size(); ++neighborIndex )
   {
-    neighbor.packCommBufferForSync( fieldsToBeSync, mesh, icomm.commID(), onDevice, events );
+    neighbors[neighborIndex].packCommBufferForSync( icomm.getSyncPlan(),
+                                                    neighborIndex,
+                                                    icomm.fusedSendFields( neighborIndex ),
+                                                    icomm.commID(),
+                                                    onDevice,
+                                                    events );
   }
 }
 
@@ -995,21 +1248,18 @@ void CommunicationTools::asyncSendRecv( std::vector< NeighborCommunicator > & ne
   }
 }
 
-void CommunicationTools::synchronizePackSendRecv( FieldIdentifiers const & fieldsToBeSync,
-                                                  MeshLevel & mesh,
-                                                  std::vector< NeighborCommunicator > & neighbors,
+void CommunicationTools::synchronizePackSendRecv( std::vector< NeighborCommunicator > & neighbors,
                                                   MPI_iCommData & icomm,
                                                   bool onDevice )
 {
   GEOS_MARK_FUNCTION;
   parallelDeviceEvents events;
-  asyncPack( fieldsToBeSync, mesh, neighbors, icomm, onDevice, events );
+  asyncPack( neighbors, icomm, onDevice, events );
   asyncSendRecv( neighbors, icomm, onDevice, events );
 }
 
 
-bool CommunicationTools::asyncUnpack( MeshLevel & mesh,
-                                      std::vector< NeighborCommunicator > & neighbors,
+bool CommunicationTools::asyncUnpack( std::vector< NeighborCommunicator > & neighbors,
                                       MPI_iCommData & icomm,
                                       bool onDevice,
                                       parallelDeviceEvents & events,
@@ -1028,8 +1278,14 @@ bool CommunicationTools::asyncUnpack( MeshLevel & mesh,
 
   for( int recvIdx = 0; recvIdx < recvCount; ++recvIdx )
   {
-    NeighborCommunicator & neighbor = neighbors[ neighborIndices[ recvIdx ] ];
-    neighbor.unpackBufferForSync( icomm.getFieldsToBeSync(), mesh, icomm.commID(), onDevice, events, op );
+    int const neighborIndex = neighborIndices[ recvIdx ];
+    neighbors[ neighborIndex ].unpackBufferForSync( icomm.getSyncPlan(),
+                                                    neighborIndex,
+                                                    icomm.fusedReceiveFields( neighborIndex ),
+                                                    icomm.commID(),
+                                                    onDevice,
+                                                    events,
+                                                    op );
   }
 
   // we don't want to check if the request has completed,
@@ -1050,8 +1306,7 @@ bool CommunicationTools::asyncUnpack( MeshLevel & mesh,
   return allDone;
 }
 
-void CommunicationTools::finalizeUnpack( MeshLevel & mesh,
-                                         std::vector< NeighborCommunicator > & neighbors,
+void CommunicationTools::finalizeUnpack( std::vector< NeighborCommunicator > & neighbors,
                                          MPI_iCommData & icomm,
                                          bool onDevice,
                                          parallelDeviceEvents & events,
@@ -1060,7 +1315,7 @@ void CommunicationTools::finalizeUnpack( MeshLevel & mesh,
   GEOS_MARK_FUNCTION;
 
   // poll mpi for completion then wait 10 nanoseconds 6,000,000,000 times (60 sec timeout)
-  GEOS_ASYNC_WAIT( 6000000000, 10, asyncUnpack( mesh, neighbors, icomm, onDevice, events, op ) );
+  GEOS_ASYNC_WAIT( 6000000000, 10, asyncUnpack( neighbors, icomm, onDevice, events, op ) );
   if( onDevice )
   {
     waitAllDeviceEvents( events );
@@ -1076,14 +1331,18 @@ void CommunicationTools::finalizeUnpack( MeshLevel & mesh,
 
 }
 
-void CommunicationTools::synchronizeUnpack( MeshLevel & mesh,
-                                            std::vector< NeighborCommunicator > & neighbors,
+void CommunicationTools::synchronizeUnpack( std::vector< NeighborCommunicator > & neighbors,
                                             MPI_iCommData & icomm,
                                             bool onDevice )
 {
   GEOS_MARK_FUNCTION;
   parallelDeviceEvents events;
-  finalizeUnpack( mesh, neighbors, icomm, onDevice, events );
+  finalizeUnpack( neighbors, icomm, onDevice, events );
+}
+
+bool CommunicationTools::sharesObjectManagers( MeshLevel const & mesh0, MeshLevel const & mesh1 )
+{
+  return &mesh0.getNodeManager() == &mesh1.getNodeManager() && &mesh0.getElemManager() == &mesh1.getElemManager();
 }
 
 void CommunicationTools::synchronizeFields( FieldIdentifiers const & fieldsToBeSync,
@@ -1091,11 +1350,74 @@ void CommunicationTools::synchronizeFields( FieldIdentifiers const & fieldsToBeS
                                             std::vector< NeighborCommunicator > & neighbors,
                                             bool onDevice )
 {
+  if( m_deferralDepth > 0 )
+  {
+    // shallow mesh levels (e.g. the levels of the different discretizations of a mesh body) share
+    // the object managers of their source level, so their fields are merged in the same exchange
+    auto const it = std::find_if( m_pendingSynchronizations.begin(), m_pendingSynchronizations.end(),
+                                  [&]( PendingSynchronization const & pending ) { return sharesObjectManagers( *pending.mesh, mesh ); } );
+    if( it == m_pendingSynchronizations.end() )
+    {
+      m_pendingSynchronizations.push_back( { &mesh, &neighbors, fieldsToBeSync, onDevice } );
+    }
+    else
+    {
+      it->fields.addFields( fieldsToBeSync );
+      it->onDevice = it->onDevice || onDevice;
+    }
+    return;
+  }
+
   MPI_iCommData icomm( getCommID() );
   icomm.resize( neighbors.size() );
   synchronizePackSendRecvSizes( fieldsToBeSync, mesh, neighbors, icomm, onDevice );
-  synchronizePackSendRecv( fieldsToBeSync, mesh, neighbors, icomm, onDevice );
-  synchronizeUnpack( mesh, neighbors, icomm, onDevice );
+  synchronizePackSendRecv( neighbors, icomm, onDevice );
+  synchronizeUnpack( neighbors, icomm, onDevice );
+}
+
+void CommunicationTools::beginDeferredSynchronization()
+{
+  ++m_deferralDepth;
+}
+
+void CommunicationTools::endDeferredSynchronization()
+{
+  GEOS_MARK_FUNCTION;
+  GEOS_ERROR_IF_LE_MSG( m_deferralDepth, 0, "No deferred synchronization to end." );
+  if( --m_deferralDepth > 0 )
+  {
+    return;
+  }
+
+  std::vector< PendingSynchronization > pendingSynchronizations;
+  pendingSynchronizations.swap( m_pendingSynchronizations );
+  for( PendingSynchronization const & pending : pendingSynchronizations )
+  {
+    synchronizeFields( pending.fields, *pending.mesh, *pending.neighbors, pending.onDevice );
+  }
+}
+
+void CommunicationTools::cancelDeferredSynchronization()
+{
+  GEOS_ERROR_IF_LE_MSG( m_deferralDepth, 0, "No deferred synchronization to cancel." );
+  if( --m_deferralDepth == 0 )
+  {
+    m_pendingSynchronizations.clear();
+  }
+}
+
+void CommunicationTools::checkNoPendingSynchronization( MeshLevel const & mesh ) const
+{
+#if !defined(NDEBUG)
+  for( PendingSynchronization const & pending : m_pendingSynchronizations )
+  {
+    GEOS_ERROR_IF( sharesObjectManagers( *pending.mesh, mesh ) && !pending.fields.getFields().empty(),
+                   "Ghost values are read on mesh level \"" << mesh.getName() <<
+                   "\" while a deferred synchronization of its fields is still pending." );
+  }
+#else
+  GEOS_UNUSED_VAR( mesh );
+#endif
 }
 
 } /* namespace geos */
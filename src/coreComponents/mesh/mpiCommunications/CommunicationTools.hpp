@@ -26,6 +26,7 @@
 
 #include "mesh/FieldIdentifiers.hpp"
 
+#include <exception>
 #include <set>
 
 namespace geos
@@ -36,6 +37,7 @@ class ObjectManagerBase;
 class NodeManager;
 class NeighborCommunicator;
 class MeshLevel;
+struct GhostingRequirement;
 class ElementRegionManager;
 
 class MPI_iCommData;
@@ -76,7 +78,8 @@ public:
 
   void setupGhosts( MeshLevel & meshLevel,
                     std::vector< NeighborCommunicator > & neighbors,
-                    bool use_nonblocking );
+                    bool use_nonblocking,
+                    GhostingRequirement const & ghosting );
 
   CommID getCommID()
   { return CommID( m_freeCommIDs ); }
@@ -89,26 +92,75 @@ public:
                                           std::set< std::set< globalIndex > > const & collocatedNodesBuckets,
                                           std::set< globalIndex > const & requestedNodes );
 
+  /**
+   * @brief Synchronize the ghost values of the fields with the neighbors.
+   * @details Within a deferred synchronization (see DeferredSynchronization), the fields are only
+   *          registered as pending, and are synchronized when the outermost deferral ends.
+   * @param fieldsToBeSync the fields to synchronize
+   * @param mesh the mesh level holding the fields
+   * @param allNeighbors the neighbors to communicate with
+   * @param onDevice whether to pack the data on device
+   */
   void synchronizeFields( FieldIdentifiers const & fieldsToBeSync,
                           MeshLevel & mesh,
                           std::vector< NeighborCommunicator > & allNeighbors,
                           bool onDevice );
 
+  /**
+   * @brief Start deferring the field synchronizations. Deferrals can be nested.
+   */
+  void beginDeferredSynchronization();
+
+  /**
+   * @brief End a deferral of the field synchronizations.
+   * @details When the outermost deferral ends, the pending fields of the mesh levels sharing the same
+   *          object managers are merged and synchronized in a single exchange, in the order they were first registered.
+   *          This is a collective operation.
+   */
+  void endDeferredSynchronization();
+
+  /**
+   * @brief End a deferral of the field synchronizations without synchronizing the pending fields.
+   * @details When the outermost deferral ends, the pending fields are dropped. This does not communicate,
+   *          and is meant for the unwinding of a rank on an exception.
+   */
+  void cancelDeferredSynchronization();
+
+  /**
+   * @brief Get the number of pending synchronizations, i.e. the number of exchanges the end of the deferral will perform.
+   * @return the number of pending synchronizations
+   */
+  localIndex numPendingSynchronizations() const
+  { return LvArray::integerConversion< localIndex >( m_pendingSynchronizations.size() ); }
+
+  /**
+   * @brief Check that no synchronization is pending on a mesh level, i.e. that its ghost values can be read.
+   * @param mesh the mesh level
+   * @note The check is only performed in debug builds.
+   */
+  void checkNoPendingSynchronization( MeshLevel const & mesh ) const;
+
+  /**
+   * @brief Resolve the fields to synchronize on their object managers and exchange the buffer sizes with the neighbors.
+   * @details The resolved fields are stored in @p icomm, and are the ones packed/unpacked by
+   *          asyncPack and asyncUnpack, so this function must be called first.
+   * @param fieldsToBeSync the fields to synchronize
+   * @param mesh the mesh level holding the fields
+   * @param neighbors the neighbors to communicate with
+   * @param icomm the communication data of this synchronization
+   * @param onDevice whether to pack the data on device
+   */
   void synchronizePackSendRecvSizes( FieldIdentifiers const & fieldsToBeSync,
                                      MeshLevel & mesh,
                                      std::vector< NeighborCommunicator > & neighbors,
                                      MPI_iCommData & icomm,
                                      bool onDevice );
 
-  void synchronizePackSendRecv( FieldIdentifiers const & fieldsToBeSync,
-                                MeshLevel & mesh,
-                                std::vector< NeighborCommunicator > & allNeighbors,
+  void synchronizePackSendRecv( std::vector< NeighborCommunicator > & allNeighbors,
                                 MPI_iCommData & icomm,
                                 bool onDevice );
 
-  void asyncPack( FieldIdentifiers const & fieldsToBeSync,
-                  MeshLevel & mesh,
-                  std::vector< NeighborCommunicator > & neighbors,
+  void asyncPack( std::vector< NeighborCommunicator > & neighbors,
                   MPI_iCommData & icomm,
                   bool onDevice,
                   parallelDeviceEvents & events );
@@ -118,29 +170,54 @@ public:
                       bool onDevice,
                       parallelDeviceEvents & events );
 
-  void synchronizeUnpack( MeshLevel & mesh,
-                          std::vector< NeighborCommunicator > & neighbors,
+  void synchronizeUnpack( std::vector< NeighborCommunicator > & neighbors,
                           MPI_iCommData & icomm,
                           bool onDevice );
 
-  bool asyncUnpack( MeshLevel & mesh,
-                    std::vector< NeighborCommunicator > & neighbors,
+  bool asyncUnpack( std::vector< NeighborCommunicator > & neighbors,
                     MPI_iCommData & icomm,
                     bool onDevice,
                     parallelDeviceEvents & events,
                     MPI_Op op=MPI_REPLACE );
 
-  void finalizeUnpack( MeshLevel & mesh,
-                       std::vector< NeighborCommunicator > & neighbors,
+  void finalizeUnpack( std::vector< NeighborCommunicator > & neighbors,
                        MPI_iCommData & icomm,
                        bool onDevice,
                        parallelDeviceEvents & events,
                        MPI_Op op=MPI_REPLACE );
 
 private:
+
+  /**
+   * @brief Check whether two mesh levels hold the same nodes and elements, i.e. are shallow copies of the same level.
+   * @param mesh0 the first mesh level
+   * @param mesh1 the second mesh level
+   * @return true if the mesh levels share their object managers
+   */
+  static bool sharesObjectManagers( MeshLevel const & mesh0, MeshLevel const & mesh1 );
+
+  /// Fields waiting for a deferred synchronization on the object managers of a mesh level
+  struct PendingSynchronization
+  {
+    /// The first registered mesh level holding the fields
+    MeshLevel * mesh;
+    /// The neighbors to communicate with
+    std::vector< NeighborCommunicator > * neighbors;
+    /// The merged fields to synchronize
+    FieldIdentifiers fields;
+    /// Whether any of the requests asked to pack the data on device
+    bool onDevice;
+  };
+
   std::set< int > m_freeCommIDs;
   static CommunicationTools * m_instance;
 
+  /// Nesting depth of the deferred synchronizations
+  integer m_deferralDepth = 0;
+
+  /// The pending synchronizations, in the order of registration (the same on all ranks)
+  std::vector< PendingSynchronization > m_pendingSynchronizations;
+
   /**
    * @brief Exchange the boundary objects managed by the @p manager and
    * find the objects that are equivalent in order to assign them a unique global id.
@@ -155,7 +232,61 @@ private:
 
 };
 
+/**
+ * @class DeferredSynchronization
+ * @brief Scope guard deferring the field synchronizations issued during its lifetime.
+ *
+ * The synchronizations requested through CommunicationTools::synchronizeFields are merged
+ * per mesh (shallow levels included) and performed as a single exchange when the outermost
+ * guard is flushed. This is meant for sequences of independent synchronizations (e.g. the
+ * application of the solution by the sub-solvers of a coupled solver) whose ghost values
+ * are not read in between.
+ *
+ * Since the exchange is collective, it should be triggered explicitly with flush().
+ * A guard destroyed without being flushed only synchronizes if no exception is in flight,
+ * otherwise the pending fields are dropped so that a rank unwinding on an exception does
+ * not wait for its neighbors.
+ */
+class DeferredSynchronization
+{
+public:
+
+  /// Constructor, starts the deferral
+  DeferredSynchronization()
+  { CommunicationTools::getInstance().beginDeferredSynchronization(); }
+
+  /// Destructor, ends the deferral if it has not been flushed
+  ~DeferredSynchronization()
+  {
+    if( m_active )
+    {
+      if( std::uncaught_exceptions() == 0 )
+      {
+        CommunicationTools::getInstance().endDeferredSynchronization();
+      }
+      else
+      {
+        CommunicationTools::getInstance().cancelDeferredSynchronization();
+      }
+    }
+  }
+
+  /// End the deferral, synchronizing the pending fields if this is the outermost guard
+  void flush()
+  {
+    GEOS_ERROR_IF( !m_active, "The deferred synchronization has already been flushed." );
+    m_active = false;
+    CommunicationTools::getInstance().endDeferredSynchronization();
+  }
+
+  DeferredSynchronization( DeferredSynchronization const & ) = delete;
+  DeferredSynchronization & operator=( DeferredSynchronization const & ) = delete;
+
+private:
 
+  /// Whether the deferral has not been ended yet
+  bool m_active = true;
+};
 
 } /* namespace geos */
 
@@ -69,6 +69,8 @@ void MPI_iCommData::resize( localIndex numMessages )
   m_mpiRecvBufferSizeRequest.resize( numMessages );
   m_mpiSendBufferSizeStatus.resize( numMessages );
   m_mpiRecvBufferSizeStatus.resize( numMessages );
+  m_fusedSendFields.resize( numMessages );
+  m_fusedReceiveFields.resize( numMessages );
   m_size = static_cast< int >(numMessages);
 
   for( int neighbor=0; neighbor<numMessages; ++neighbor )
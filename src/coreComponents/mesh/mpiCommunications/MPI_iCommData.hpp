@@ -19,9 +19,116 @@
 
 #include "mesh/FieldIdentifiers.hpp"
 
+#include <memory>
+#include <vector>
+
 namespace geos
 {
 
+class ObjectManagerBase;
+namespace dataRepository
+{
+class WrapperBase;
+}
+
+/**
+ * @brief A field to synchronize, resolved on the object manager that holds it.
+ *
+ * The list of entries is resolved once per set of fields (see SyncPlan),
+ * and then used to pack and unpack the buffers of all the neighbors without
+ * looking up (nor sending) the wrapper names again.
+ */
+struct SyncFieldEntry
+{
+  /// The object manager (node, edge, face manager or element sub-region) holding the field
+  ObjectManagerBase * manager;
+  /// The wrapper of the field
+  dataRepository::WrapperBase * wrapper;
+  /// Whether the reduction operation of the synchronization is used to unpack the field
+  bool useOp;
+  /// Whether the field is a real64 array packed by the fused kernel of its neighbor
+  bool fused;
+};
+
+/**
+ * @brief Position of a fused field in the buffer exchanged with a neighbor.
+ */
+struct FusedSyncSlot
+{
+  /// The index of the field in SyncPlan::entries
+  localIndex entry;
+  /// The offset of the field in the fused part of the buffer, in number of real64 values
+  localIndex offset;
+};
+
+/**
+ * @brief Layout of the buffers exchanged with one neighbor.
+ *
+ * The buffer starts with the values of all the fused fields, contiguous per field,
+ * followed by the other fields packed wrapper by wrapper.
+ */
+struct SyncNeighborPlan
+{
+  /// The fused fields with ghosts to send, with their offset in the send buffer
+  std::vector< FusedSyncSlot > fusedSend;
+  /// The fused fields with ghosts to receive, with their offset in the receive buffer
+  std::vector< FusedSyncSlot > fusedReceive;
+  /// The number of real64 values of the fused part of the send buffer
+  localIndex fusedSendSize = 0;
+  /// The number of real64 values of the fused part of the receive buffer
+  localIndex fusedReceiveSize = 0;
+  /// The number of (field, ghost) pairs of the fused part of the send buffer
+  localIndex fusedSendItems = 0;
+  /// The number of (field, ghost) pairs of the fused part of the receive buffer
+  localIndex fusedReceiveItems = 0;
+  /// The other fields with ghosts to send, as indices in SyncPlan::entries
+  std::vector< localIndex > otherSend;
+  /// The other fields with ghosts to receive, as indices in SyncPlan::entries
+  std::vector< localIndex > otherReceive;
+};
+
+/**
+ * @brief The fields of a FieldIdentifiers resolved on a mesh level, and the layout of their buffers.
+ *
+ * Plans are cached on the MeshLevel, keyed on the field identifiers, and reused as long as
+ * their signature (mesh timestamp, neighbors, sizes of the managers, ghosts and fields) is unchanged.
+ */
+struct SyncPlan
+{
+  /// The fields to pack/unpack, grouped by object manager, in the same order on all ranks
+  std::vector< SyncFieldEntry > entries;
+  /// The buffer layout for each neighbor, in the order of the neighbor communicators
+  std::vector< SyncNeighborPlan > neighbors;
+  /// The state of the mesh the plan was built for
+  std::vector< localIndex > signature;
+};
+
+/**
+ * @brief Description of a fused field for the gather/scatter kernel of a neighbor.
+ *
+ * The value (i, j, k) of the slice of the ghost @p indices[ i ] is stored at
+ * data[ indices[ i ] * indexStride + j * strides[ 0 ] + k * strides[ 1 ] ].
+ */
+struct FusedSyncField
+{
+  /// Pointer to the data of the field, in the memory space of the kernel
+  real64 * data;
+  /// Pointer to the ghost list, in the memory space of the kernel
+  localIndex const * indices;
+  /// The first (field, ghost) pair of the field in the kernel
+  localIndex firstItem;
+  /// The offset of the field in the fused part of the buffer, in number of real64 values
+  localIndex offset;
+  /// The stride of the first dimension of the field
+  localIndex indexStride;
+  /// The sizes of the second and third dimensions of the field (1 if absent)
+  localIndex dims[2];
+  /// The strides of the second and third dimensions of the field (0 if absent)
+  localIndex strides[2];
+  /// Whether the reduction operation of the synchronization is used to unpack the field
+  bool useOp;
+};
+
 /**
  * Class to manage the MPI requests and status data for a collection
  * of neighbor communication pipelines.
@@ -69,6 +176,33 @@ public:
    */
   void setFieldsToBeSync( FieldIdentifiers const & fieldsToBeSync ) { m_fieldsToBeSync = fieldsToBeSync; }
 
+  /**
+   * @return The resolved fields and buffer layouts registered with the communication data.
+   */
+  SyncPlan const & getSyncPlan() const
+  {
+    GEOS_ERROR_IF( m_syncPlan == nullptr, "No synchronization plan registered with the communication data." );
+    return *m_syncPlan;
+  }
+
+  /**
+   * @brief Setter of the resolved fields and buffer layouts registered with the communication data.
+   * @param syncPlan The plan, shared with the cache of the mesh level.
+   */
+  void setSyncPlan( std::shared_ptr< SyncPlan const > syncPlan ) { m_syncPlan = std::move( syncPlan ); }
+
+  /**
+   * @param neighborIndex The index of the neighbor.
+   * @return The descriptors of the fused fields sent to the neighbor, alive until the synchronization completes.
+   */
+  array1d< FusedSyncField > & fusedSendFields( localIndex const neighborIndex ) { return m_fusedSendFields[neighborIndex]; }
+
+  /**
+   * @param neighborIndex The index of the neighbor.
+   * @return The descriptors of the fused fields received from the neighbor, alive until the synchronization completes.
+   */
+  array1d< FusedSyncField > & fusedReceiveFields( localIndex const neighborIndex ) { return m_fusedReceiveFields[neighborIndex]; }
+
 
   MPI_Request * mpiSendBufferRequest() { return m_mpiSendBufferRequest.data(); }
   MPI_Request * mpiRecvBufferRequest() { return m_mpiRecvBufferRequest.data(); }
@@ -102,6 +236,15 @@ private:
 
   FieldIdentifiers m_fieldsToBeSync;
 
+  /// The fields to be synchronized, resolved on their object managers, and the layout of their buffers.
+  std::shared_ptr< SyncPlan const > m_syncPlan;
+
+  /// The descriptors of the fused fields sent to each neighbor
+  std::vector< array1d< FusedSyncField > > m_fusedSendFields;
+
+  /// The descriptors of the fused fields received from each neighbor
+  std::vector< array1d< FusedSyncField > > m_fusedReceiveFields;
+
   array1d< MPI_Request > m_mpiSendBufferRequest;
   array1d< MPI_Request > m_mpiRecvBufferRequest;
   array1d< MPI_Status >  m_mpiSendBufferStatus;
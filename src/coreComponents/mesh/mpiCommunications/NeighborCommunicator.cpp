@@ -23,6 +23,7 @@
 #include "common/TimingMacros.hpp"
 #include "mesh/ObjectManagerBase.hpp"
 #include "mesh/MeshLevel.hpp"
+#include "dataRepository/Wrapper.hpp"
 
 namespace geos
 {
@@ -232,6 +233,7 @@ inline int PackGhosts( buffer_unit_type * sendBufferPtr,
 
 void NeighborCommunicator::prepareAndSendGhosts( bool const GEOS_UNUSED_PARAM( contactActive ),
                                                  integer const depth,
+                                                 bool const faceNeighborsOnly,
                                                  MeshLevel & mesh,
                                                  int const commID,
                                                  MPI_Request & mpiRecvSizeRequest,
@@ -261,7 +263,8 @@ void NeighborCommunicator::prepareAndSendGhosts( bool const GEOS_UNUSED_PARAM( c
                                  edgeAdjacencyList,
                                  faceAdjacencyList,
                                  elementAdjacencyList,
-                                 depth );
+                                 depth,
+                                 faceNeighborsOnly );
   }
 
   ElemAdjListViewType const elemAdjacencyList =
@@ -480,121 +483,242 @@ void NeighborCommunicator::unpackAndRebuildSyncLists( MeshLevel & mesh,
 }
 
 
-int NeighborCommunicator::packCommSizeForSync( FieldIdentifiers const & fieldsToBeSync,
-                                               MeshLevel const & mesh,
-                                               int const commID,
-                                               bool onDevice,
-                                               parallelDeviceEvents & events )
+namespace
 {
-  GEOS_MARK_FUNCTION;
 
-  NodeManager const & nodeManager = mesh.getNodeManager();
-  EdgeManager const & edgeManager = mesh.getEdgeManager();
-  FaceManager const & faceManager = mesh.getFaceManager();
-  ElementRegionManager const & elemManager = mesh.getElemManager();
+/**
+ * @brief The types of the fields synchronized by the fused gather/scatter kernel.
+ * @tparam T the array types
+ */
+template< typename ... T >
+struct FusedSyncArrays
+{
+  /**
+   * @brief Whether a wrapper holds one of the types.
+   * @param wrapper the wrapper
+   * @return true if the wrapper holds one of the types
+   */
+  static bool contains( WrapperBase const & wrapper )
+  {
+    return ( ( wrapper.getTypeId() == typeid( T ) ) || ... );
+  }
 
-  arrayView1d< localIndex const > const & nodeGhostsToSend = nodeManager.getNeighborData( m_neighborRank ).ghostsToSend();
-  arrayView1d< localIndex const > const & edgeGhostsToSend = edgeManager.getNeighborData( m_neighborRank ).ghostsToSend();
-  arrayView1d< localIndex const > const & faceGhostsToSend = faceManager.getNeighborData( m_neighborRank ).ghostsToSend();
+  /**
+   * @brief Apply @p lambda to the array held by a wrapper holding one of the types.
+   * @param wrapper the wrapper
+   * @param lambda the function called on the array
+   */
+  template< typename LAMBDA >
+  static void apply( WrapperBase & wrapper, LAMBDA && lambda )
+  {
+    bool const found = ( applyIfType< T >( wrapper, lambda ) || ... );
+    GEOS_ERROR_IF( !found, "Wrapper \"" << wrapper.getName() << "\" is not synchronized by the fused kernel." );
+  }
 
-  int bufferSize = 0;
+private:
+  template< typename U, typename LAMBDA >
+  static bool applyIfType( WrapperBase & wrapper, LAMBDA & lambda )
+  {
+    if( wrapper.getTypeId() != typeid( U ) )
+    {
+      return false;
+    }
+    lambda( Wrapper< U >::cast( wrapper ).reference() );
+    return true;
+  }
+};
+
+/// The fields gathered and scattered by a single kernel per neighbor
+using FusedSyncTypes = FusedSyncArrays< array1d< real64 >,
+                                        array2d< real64, RAJA::PERM_IJ >,
+                                        array2d< real64, RAJA::PERM_JI >,
+                                        array3d< real64, RAJA::PERM_IJK > >;
 
-  for( auto const & iter : fieldsToBeSync.getFields() )
+/**
+ * @brief Fill the descriptors of the fused fields exchanged with a neighbor.
+ * @param plan the resolved fields of the synchronization
+ * @param slots the fused fields exchanged with the neighbor, with their offset in the buffer
+ * @param neighborRank the rank of the neighbor
+ * @param send whether the fields are sent (gathered) or received (scattered)
+ * @param onDevice whether the kernel runs on device
+ * @param fusedFields the descriptors
+ * @return the number of (field, ghost) pairs of the kernel
+ * @details The fields and ghost lists are moved to the memory space of the kernel before their data pointer is taken.
+ */
+localIndex fillFusedFields( SyncPlan const & plan,
+                            std::vector< FusedSyncSlot > const & slots,
+                            int const neighborRank,
+                            bool const send,
+                            bool const onDevice,
+                            array1d< FusedSyncField > & fusedFields )
+{
+  LvArray::MemorySpace const space = onDevice ? parallelDeviceMemorySpace : hostMemorySpace;
+
+  fusedFields.move( hostMemorySpace, true );
+  fusedFields.resize( LvArray::integerConversion< localIndex >( slots.size() ) );
+
+  localIndex numItems = 0;
+  for( std::size_t slotIndex = 0; slotIndex < slots.size(); ++slotIndex )
   {
-    FieldLocation location{};
-    fieldsToBeSync.getLocation( iter.first, location );
-    switch( location )
+    SyncFieldEntry const & entry = plan.entries[ slots[slotIndex].entry ];
+    NeighborData & neighborData = entry.manager->getNeighborData( neighborRank );
+    array1d< localIndex > & list = send ? neighborData.ghostsToSend() : neighborData.ghostsToReceive();
+    list.move( space, false );
+
+    FusedSyncField & field = fusedFields[slotIndex];
+    field.indices = list.data();
+    field.firstItem = numItems;
+    field.offset = slots[slotIndex].offset;
+    field.useOp = entry.useOp;
+    FusedSyncTypes::apply( *entry.wrapper, [&]( auto & array )
     {
-      case FieldLocation::Node:
+      constexpr int numDims = std::remove_reference_t< decltype( array ) >::NDIM;
+      // received values are written, sent values are only read
+      array.move( space, !send );
+      field.data = array.data();
+      field.indexStride = array.strides()[0];
+      for( int dim = 0; dim < 2; ++dim )
       {
-        bufferSize += nodeManager.packSize( iter.second, nodeGhostsToSend, 0, onDevice, events );
-        break;
+        field.dims[dim] = dim + 1 < numDims ? array.size( dim + 1 ) : 1;
+        field.strides[dim] = dim + 1 < numDims ? array.strides()[dim + 1] : 0;
       }
-      case FieldLocation::Edge:
-      {
-        bufferSize += edgeManager.packSize( iter.second, edgeGhostsToSend, 0, onDevice, events );
-        break;
-      }
-      case FieldLocation::Face:
-      {
-        bufferSize += faceManager.packSize( iter.second, faceGhostsToSend, 0, onDevice, events );
-        break;
-      }
-      case FieldLocation::Elem:
-      {
-        elemManager.getRegion( fieldsToBeSync.getRegionName( iter.first ) ).forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase const & subRegion )
-        {
-          bufferSize += subRegion.packSize( iter.second, subRegion.getNeighborData( m_neighborRank ).ghostsToSend(), 0, onDevice, events );
-        } );
-        break;
-      }
-    }
+    } );
+    numItems += list.size();
+  }
+  return numItems;
+}
+
+/**
+ * @brief Find the fused field of a (field, ghost) pair.
+ * @param fields the descriptors of the fused fields
+ * @param item the index of the (field, ghost) pair
+ * @return the descriptor of the field
+ */
+GEOS_HOST_DEVICE
+inline FusedSyncField const & findFusedField( arrayView1d< FusedSyncField const > const & fields,
+                                              localIndex const item )
+{
+  // the number of fused fields is small, a linear search is enough
+  localIndex fieldIndex = 0;
+  while( fieldIndex + 1 < fields.size() && fields[fieldIndex + 1].firstItem <= item )
+  {
+    ++fieldIndex;
   }
+  return fields[fieldIndex];
+}
+
+/**
+ * @brief Launch a kernel over the (field, ghost) pairs of the fused fields.
+ * @param onDevice whether the kernel runs on device (asynchronously) or on host
+ * @param numItems the number of (field, ghost) pairs
+ * @param events the device events, the event of the kernel is added to them
+ * @param kernel the kernel
+ */
+template< typename KERNEL >
+void forFusedItems( bool const onDevice,
+                    localIndex const numItems,
+                    parallelDeviceEvents & events,
+                    KERNEL && kernel )
+{
+  if( numItems == 0 )
+  {
+    return;
+  }
+  if( onDevice )
+  {
+    parallelDeviceStream stream;
+    events.emplace_back( forAll< parallelDeviceAsyncPolicy<> >( stream, numItems, std::forward< KERNEL >( kernel ) ) );
+  }
+  else
+  {
+    forAll< parallelHostPolicy >( numItems, std::forward< KERNEL >( kernel ) );
+  }
+}
+
+}
+
+bool NeighborCommunicator::isFusedForSync( WrapperBase const & wrapper )
+{
+  return FusedSyncTypes::contains( wrapper );
+}
+
+int NeighborCommunicator::packCommSizeForSync( SyncPlan const & plan,
+                                               localIndex const neighborIndex,
+                                               int const commID,
+                                               bool onDevice,
+                                               parallelDeviceEvents & events )
+{
+  GEOS_MARK_FUNCTION;
+
+  SyncNeighborPlan const & neighborPlan = plan.neighbors[neighborIndex];
+
+  buffer_unit_type * junk = nullptr;
+  int bufferSize = LvArray::integerConversion< int >( neighborPlan.fusedSendSize * sizeof( real64 ) );
+  for( localIndex const entryIndex : neighborPlan.otherSend )
+  {
+    SyncFieldEntry const & entry = plan.entries[entryIndex];
+    arrayView1d< localIndex const > const ghostsToSend = entry.manager->getNeighborData( m_neighborRank ).ghostsToSend().toViewConst();
+    bufferSize += LvArray::integerConversion< int >( entry.wrapper->packByIndex< false >( junk, ghostsToSend, false, onDevice, events ) );
+  }
+
   this->m_sendBufferSize[commID] = bufferSize;
   return bufferSize;
 }
 
-void NeighborCommunicator::packCommBufferForSync( FieldIdentifiers const & fieldsToBeSync,
-                                                  MeshLevel const & mesh,
+void NeighborCommunicator::packCommBufferForSync( SyncPlan const & plan,
+                                                  localIndex const neighborIndex,
+                                                  array1d< FusedSyncField > & fusedFields,
                                                   int const commID,
                                                   bool onDevice,
                                                   parallelDeviceEvents & events )
 {
   GEOS_MARK_FUNCTION;
 
-  NodeManager const & nodeManager = mesh.getNodeManager();
-  EdgeManager const & edgeManager = mesh.getEdgeManager();
-  FaceManager const & faceManager = mesh.getFaceManager();
-  ElementRegionManager const & elemManager = mesh.getElemManager();
-
-  arrayView1d< localIndex const > const & nodeGhostsToSend = nodeManager.getNeighborData( m_neighborRank ).ghostsToSend();
-  arrayView1d< localIndex const > const & edgeGhostsToSend = edgeManager.getNeighborData( m_neighborRank ).ghostsToSend();
-  arrayView1d< localIndex const > const & faceGhostsToSend = faceManager.getNeighborData( m_neighborRank ).ghostsToSend();
+  SyncNeighborPlan const & neighborPlan = plan.neighbors[neighborIndex];
 
   buffer_type & sendBuff = sendBuffer( commID );
   int const bufferSize =  LvArray::integerConversion< int >( sendBuff.size());
   buffer_unit_type * sendBufferPtr = sendBuff.data();
 
-  int packedSize = 0;
-
-  for( auto const & iter : fieldsToBeSync.getFields() )
+  // gather the values of all the fused fields with a single kernel
+  localIndex const numItems = fillFusedFields( plan, neighborPlan.fusedSend, m_neighborRank, true, onDevice, fusedFields );
+  GEOS_ERROR_IF_NE( numItems, neighborPlan.fusedSendItems );
   {
-    FieldLocation location{};
-    fieldsToBeSync.getLocation( iter.first, location );
-    switch( location )
+    arrayView1d< FusedSyncField const > const fields = fusedFields.toViewConst();
+    real64 * const buffer = reinterpret_cast< real64 * >( sendBufferPtr );
+    forFusedItems( onDevice, numItems, events, [=] GEOS_HOST_DEVICE ( localIndex const item )
     {
-      case FieldLocation::Node:
-      {
-        packedSize += nodeManager.pack( sendBufferPtr, iter.second, nodeGhostsToSend, 0, onDevice, events );
-        break;
-      }
-      case FieldLocation::Edge:
-      {
-        packedSize += edgeManager.pack( sendBufferPtr, iter.second, edgeGhostsToSend, 0, onDevice, events );
-        break;
-      }
-      case FieldLocation::Face:
-      {
-        packedSize += faceManager.pack( sendBufferPtr, iter.second, faceGhostsToSend, 0, onDevice, events );
-        break;
-      }
-      case FieldLocation::Elem:
+      FusedSyncField const & field = findFusedField( fields, item );
+      localIndex const ii = item - field.firstItem;
+      real64 const * const slice = field.data + field.indices[ii] * field.indexStride;
+      real64 * value = buffer + field.offset + ii * field.dims[0] * field.dims[1];
+      for( localIndex j = 0; j < field.dims[0]; ++j )
       {
-        elemManager.getRegion( fieldsToBeSync.getRegionName( iter.first ) ).forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase const & subRegion )
+        for( localIndex k = 0; k < field.dims[1]; ++k )
         {
-          packedSize += subRegion.pack( sendBufferPtr, iter.second, subRegion.getNeighborData( m_neighborRank ).ghostsToSend(), 0, onDevice, events );
-        } );
-        break;
+          *value = slice[ j * field.strides[0] + k * field.strides[1] ];
+          ++value;
+        }
       }
-    }
+    } );
+  }
+
+  int packedSize = LvArray::integerConversion< int >( neighborPlan.fusedSendSize * sizeof( real64 ) );
+  sendBufferPtr += packedSize;
+  for( localIndex const entryIndex : neighborPlan.otherSend )
+  {
+    SyncFieldEntry const & entry = plan.entries[entryIndex];
+    arrayView1d< localIndex const > const ghostsToSend = entry.manager->getNeighborData( m_neighborRank ).ghostsToSend().toViewConst();
+    packedSize += LvArray::integerConversion< int >( entry.wrapper->packByIndex< true >( sendBufferPtr, ghostsToSend, false, onDevice, events ) );
   }
 
   GEOS_ERROR_IF_NE( bufferSize, packedSize );
 }
 
 
-void NeighborCommunicator::unpackBufferForSync( FieldIdentifiers const & fieldsToBeSync,
-                                                MeshLevel & mesh,
+void NeighborCommunicator::unpackBufferForSync( SyncPlan const & plan,
+                                                localIndex const neighborIndex,
+                                                array1d< FusedSyncField > & fusedFields,
                                                 int const commID,
                                                 bool onDevice,
                                                 parallelDeviceEvents & events,
@@ -602,50 +726,69 @@ void NeighborCommunicator::unpackBufferForSync( FieldIdentifiers const & fieldsT
 {
   GEOS_MARK_FUNCTION;
 
+  SyncNeighborPlan const & neighborPlan = plan.neighbors[neighborIndex];
+
   buffer_type const & receiveBuff = receiveBuffer( commID );
   buffer_unit_type const * receiveBufferPtr = receiveBuff.data();
 
-  NodeManager & nodeManager = mesh.getNodeManager();
-  EdgeManager & edgeManager = mesh.getEdgeManager();
-  FaceManager & faceManager = mesh.getFaceManager();
-  ElementRegionManager & elemManager = mesh.getElemManager();
-
-  array1d< localIndex > & nodeGhostsToReceive = nodeManager.getNeighborData( m_neighborRank ).ghostsToReceive();
-  array1d< localIndex > & edgeGhostsToReceive = edgeManager.getNeighborData( m_neighborRank ).ghostsToReceive();
-  array1d< localIndex > & faceGhostsToReceive = faceManager.getNeighborData( m_neighborRank ).ghostsToReceive();
+  // as in Wrapper::unpackByIndex, the reduction operation is only applied on device, host unpacking replaces the values
+  GEOS_ERROR_IF( onDevice && op != MPI_REPLACE && op != MPI_SUM && op != MPI_MAX,
+                 "Unsupported reduction operation for the synchronization of fields on device." );
+  int const opKind = ( !onDevice || op == MPI_REPLACE ) ? 0 : ( op == MPI_SUM ? 1 : 2 );
 
-  int unpackedSize = 0;
-
-  for( auto const & iter : fieldsToBeSync.getFields() )
+  // scatter the values of all the fused fields with a single kernel
+  localIndex const numItems = fillFusedFields( plan, neighborPlan.fusedReceive, m_neighborRank, false, onDevice, fusedFields );
+  GEOS_ERROR_IF_NE( numItems, neighborPlan.fusedReceiveItems );
   {
-    FieldLocation location{};
-    fieldsToBeSync.getLocation( iter.first, location );
-    switch( location )
+    arrayView1d< FusedSyncField const > const fields = fusedFields.toViewConst();
+    real64 const * const buffer = reinterpret_cast< real64 const * >( receiveBufferPtr );
+    forFusedItems( onDevice, numItems, events, [=] GEOS_HOST_DEVICE ( localIndex const item )
     {
-      case FieldLocation::Node:
-      {
-        unpackedSize += nodeManager.unpack( receiveBufferPtr, nodeGhostsToReceive, 0, onDevice, events, op );
-        break;
-      }
-      case FieldLocation::Edge:
-      {
-        unpackedSize += edgeManager.unpack( receiveBufferPtr, edgeGhostsToReceive, 0, onDevice, events );
-        break;
-      }
-      case FieldLocation::Face:
+      FusedSyncField const & field = findFusedField( fields, item );
+      localIndex const ii = item - field.firstItem;
+      real64 * const slice = field.data + field.indices[ii] * field.indexStride;
+      real64 const * const values = buffer + field.offset + ii * field.dims[0] * field.dims[1];
+      int const fieldOp = field.useOp ? opKind : 0;
+
+      if( fieldOp == 2 )
       {
-        unpackedSize += faceManager.unpack( receiveBufferPtr, faceGhostsToReceive, 0, onDevice, events );
-        break;
+        // as in UnpackDataByIndexDevice, the slice with the highest norm is kept
+        real64 currentNormSquared = 0.0;
+        real64 incomingNormSquared = 0.0;
+        for( localIndex j = 0; j < field.dims[0]; ++j )
+        {
+          for( localIndex k = 0; k < field.dims[1]; ++k )
+          {
+            real64 const current = slice[ j * field.strides[0] + k * field.strides[1] ];
+            real64 const incoming = values[ j * field.dims[1] + k ];
+            currentNormSquared += current * current;
+            incomingNormSquared += incoming * incoming;
+          }
+        }
+        if( currentNormSquared >= incomingNormSquared )
+        {
+          return;
+        }
       }
-      case FieldLocation::Elem:
+
+      for( localIndex j = 0; j < field.dims[0]; ++j )
       {
-        elemManager.getRegion( fieldsToBeSync.getRegionName( iter.first ) ).forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase & subRegion )
+        for( localIndex k = 0; k < field.dims[1]; ++k )
         {
-          unpackedSize += subRegion.unpack( receiveBufferPtr, subRegion.getNeighborData( m_neighborRank ).ghostsToReceive(), 0, onDevice, events );
-        } );
-        break;
+          real64 & current = slice[ j * field.strides[0] + k * field.strides[1] ];
+          real64 const incoming = values[ j * field.dims[1] + k ];
+          current = fieldOp == 1 ? current + incoming : incoming;
+        }
       }
-    }
+    } );
+  }
+
+  receiveBufferPtr += neighborPlan.fusedReceiveSize * sizeof( real64 );
+  for( localIndex const entryIndex : neighborPlan.otherReceive )
+  {
+    SyncFieldEntry const & entry = plan.entries[entryIndex];
+    arrayView1d< localIndex const > const ghostsToReceive = entry.manager->getNeighborData( m_neighborRank ).ghostsToReceive().toViewConst();
+    entry.wrapper->unpackByIndex( receiveBufferPtr, ghostsToReceive, false, onDevice, events, entry.useOp ? op : MPI_REPLACE );
   }
 }
 
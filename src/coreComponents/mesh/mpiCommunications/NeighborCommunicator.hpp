@@ -22,6 +22,8 @@
 #include "dataRepository/ReferenceWrapper.hpp"
 #include "LvArray/src/limits.hpp"
 
+#include <vector>
+
 namespace geos
 {
 inline int CommTag( int const GEOS_UNUSED_PARAM( senderRank ),
@@ -36,6 +38,12 @@ inline int CommTag( int const GEOS_UNUSED_PARAM( senderRank ),
 
 class MeshLevel;
 class MPI_iCommData;
+struct SyncPlan;
+struct FusedSyncField;
+namespace dataRepository
+{
+class WrapperBase;
+}
 
 class NeighborCommunicator
 {
@@ -176,6 +184,7 @@ public:
    */
   void prepareAndSendGhosts( bool const contactActive,
                              integer const depth,
+                             bool const faceNeighborsOnly,
                              MeshLevel & mesh,
                              int const commID,
                              MPI_Request & mpiRecvSizeRequest,
@@ -217,25 +226,64 @@ public:
   void unpackAndRebuildSyncLists( MeshLevel & meshLevel,
                                   int const CommID );
 
-  void packCommBufferForSync( FieldIdentifiers const & fieldsToBeSync,
-                              MeshLevel const & meshLevel,
+  /**
+   * @brief Pack the buffer sent to the neighbor for a synchronization.
+   * @param plan the resolved fields and buffer layouts of the synchronization
+   * @param neighborIndex the index of the neighbor in the plan
+   * @param fusedFields storage of the descriptors of the fused fields, alive until the packing completes
+   * @param commID the communication pipeline
+   * @param onDevice whether the fields are packed on device
+   * @param events the device events of the packing
+   * @details The real64 array fields are gathered by a single kernel, the other fields are packed wrapper by wrapper.
+   */
+  void packCommBufferForSync( SyncPlan const & plan,
+                              localIndex const neighborIndex,
+                              array1d< FusedSyncField > & fusedFields,
                               int const commID,
                               bool onDevice,
                               parallelDeviceEvents & events );
 
-  int packCommSizeForSync( FieldIdentifiers const & fieldsToBeSync,
-                           MeshLevel const & meshLevel,
+  /**
+   * @brief Compute the size of the buffer sent to the neighbor for a synchronization.
+   * @param plan the resolved fields and buffer layouts of the synchronization
+   * @param neighborIndex the index of the neighbor in the plan
+   * @param commID the communication pipeline
+   * @param onDevice whether the fields are packed on device
+   * @param events the device events of the packing
+   * @return the size of the buffer
+   */
+  int packCommSizeForSync( SyncPlan const & plan,
+                           localIndex const neighborIndex,
                            int const commID,
                            bool onDevice,
                            parallelDeviceEvents & events );
 
-  void unpackBufferForSync( FieldIdentifiers const & fieldsToBeSync,
-                            MeshLevel & meshLevel,
+  /**
+   * @brief Unpack the buffer received from the neighbor for a synchronization.
+   * @param plan the resolved fields and buffer layouts of the synchronization
+   * @param neighborIndex the index of the neighbor in the plan
+   * @param fusedFields storage of the descriptors of the fused fields, alive until the unpacking completes
+   * @param commID the communication pipeline
+   * @param onDevice whether the fields are unpacked on device
+   * @param events the device events of the unpacking
+   * @param op the reduction operation applied to the fields using it
+   * @details The real64 array fields are scattered by a single kernel, the other fields are unpacked wrapper by wrapper.
+   */
+  void unpackBufferForSync( SyncPlan const & plan,
+                            localIndex const neighborIndex,
+                            array1d< FusedSyncField > & fusedFields,
                             int const commID,
                             bool onDevice,
                             parallelDeviceEvents & events,
                             MPI_Op op=MPI_REPLACE );
 
+  /**
+   * @brief Whether a field is synchronized by the fused gather/scatter kernel.
+   * @param wrapper the wrapper of the field
+   * @return true for the real64 arrays of up to three dimensions
+   */
+  static bool isFusedForSync( dataRepository::WrapperBase const & wrapper );
+
   int neighborRank() const { return m_neighborRank; }
 
   void clear();
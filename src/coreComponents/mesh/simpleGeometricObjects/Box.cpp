@@ -110,6 +110,32 @@ bool Box::isCoordInObject( real64 const ( &coord ) [3] ) const
   return true;
 }
 
+bool Box::mayIntersectBox( real64 const ( &boxMin ) [3],
+                           real64 const ( &boxMax ) [3] ) const
+{
+  real64 lo[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( m_min );
+  real64 hi[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( m_max );
+  if( std::fabs( m_strikeAngle ) >= 1e-20 )
+  {
+    // the rotated box is enclosed in the disc circumscribing its horizontal section
+    real64 const halfDiagonal = 0.5 * std::sqrt( ( m_max[0] - m_min[0] ) * ( m_max[0] - m_min[0] ) +
+                                                 ( m_max[1] - m_min[1] ) * ( m_max[1] - m_min[1] ) );
+    for( int i = 0; i < 2; ++i )
+    {
+      lo[i] = m_boxCenter[i] - halfDiagonal;
+      hi[i] = m_boxCenter[i] + halfDiagonal;
+    }
+  }
+  for( int i = 0; i < 3; ++i )
+  {
+    if( boxMax[i] < lo[i] || boxMin[i] > hi[i] )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, Box, string const &, Group * const )
 
 } /* namespace geos */
@@ -68,6 +68,9 @@ public:
 
   bool isCoordInObject( real64 const ( &coord ) [3] ) const override final;
 
+  bool mayIntersectBox( real64 const ( &boxMin ) [3],
+                        real64 const ( &boxMax ) [3] ) const override final;
+
 protected:
 
   /**
@@ -98,6 +98,22 @@ bool Cylinder::isCoordInObject( real64 const ( &targetPt ) [3] ) const
   return rval;
 }
 
+bool Cylinder::mayIntersectBox( real64 const ( &boxMin ) [3],
+                                real64 const ( &boxMax ) [3] ) const
+{
+  // the cylinder is enclosed in the bounding box of its axis, enlarged by its radius
+  for( int i = 0; i < 3; ++i )
+  {
+    real64 const lo = std::min( m_point1[i], m_point2[i] ) - m_radius;
+    real64 const hi = std::max( m_point1[i], m_point2[i] ) + m_radius;
+    if( boxMax[i] < lo || boxMin[i] > hi )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, Cylinder, string const &, Group * const )
 
 } /* namespace geos */
@@ -93,6 +93,22 @@ public:
    */
   virtual bool isCoordInObject( real64 const ( &coord ) [3] ) const = 0;
 
+  /**
+   * @brief Check if an axis-aligned box may intersect the object.
+   * @param[in] boxMin the lower corner of the box
+   * @param[in] boxMax the upper corner of the box
+   * @return false if no point of the box is in the object, true otherwise
+   * @details The test is conservative: it may return true for boxes that do not intersect the object,
+   *          but never false for boxes that do. It is used to prune spatial searches. The default
+   *          implementation always returns true.
+   */
+  virtual bool mayIntersectBox( real64 const ( &boxMin ) [3],
+                                real64 const ( &boxMax ) [3] ) const
+  {
+    GEOS_UNUSED_VAR( boxMin, boxMax );
+    return true;
+  }
+
 };
 
 
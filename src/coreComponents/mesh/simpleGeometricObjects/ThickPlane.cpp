@@ -69,6 +69,21 @@ bool ThickPlane::isCoordInObject( real64 const ( &coord ) [3] ) const
   return std::fabs( normalDistance ) <= m_thickness;
 }
 
+bool ThickPlane::mayIntersectBox( real64 const ( &boxMin ) [3],
+                                  real64 const ( &boxMax ) [3] ) const
+{
+  // compare the normal distance of the box center with the projected half-extent of the box
+  real64 normalDistance = 0.0;
+  real64 projectedHalfExtent = 0.0;
+  for( int i=0; i<3; ++i )
+  {
+    normalDistance += m_normal[i]*(0.5*(boxMin[i]+boxMax[i])-m_origin[i]);
+    projectedHalfExtent += std::fabs( m_normal[i] )*0.5*(boxMax[i]-boxMin[i]);
+  }
+
+  return std::fabs( normalDistance ) <= m_thickness + projectedHalfExtent;
+}
+
 REGISTER_CATALOG_ENTRY( SimpleGeometricObjectBase, ThickPlane, string const &, Group * const )
 
 } /* namespace geos */
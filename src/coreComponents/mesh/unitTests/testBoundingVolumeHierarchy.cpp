@@ -0,0 +1,146 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file testBoundingVolumeHierarchy.cpp
+ */
+
+#include "mesh/utilities/BoundingVolumeHierarchy.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+namespace geos
+{
+
+class BoundingVolumeHierarchyTest : public ::testing::Test
+{
+protected:
+
+  void SetUp() override
+  {
+    std::mt19937 gen( 2023 );
+    std::uniform_real_distribution< real64 > position( 0.0, 10.0 );
+    std::uniform_real_distribution< real64 > extent( 0.0, 0.5 );
+
+    localIndex const numBoxes = 1000;
+    boxMin.resize( numBoxes, 3 );
+    boxMax.resize( numBoxes, 3 );
+    for( localIndex i = 0; i < numBoxes; ++i )
+    {
+      for( integer d = 0; d < 3; ++d )
+      {
+        boxMin[i][d] = position( gen );
+        boxMax[i][d] = boxMin[i][d] + extent( gen );
+      }
+    }
+    hierarchy.build( boxMin.toViewConst(), boxMax.toViewConst() );
+  }
+
+  /// Compare the boxes visited by the hierarchy with a brute force loop using the same test
+  template< typename TEST, typename QUERY >
+  void checkQuery( TEST && test, QUERY && query ) const
+  {
+    std::vector< localIndex > expected;
+    for( localIndex i = 0; i < boxMin.size( 0 ); ++i )
+    {
+      if( test( boxMin[i], boxMax[i] ) )
+      {
+        expected.push_back( i );
+      }
+    }
+
+    std::vector< localIndex > found;
+    query( [&]( localIndex const i ) { found.push_back( i ); } );
+    std::sort( found.begin(), found.end() );
+
+    EXPECT_EQ( found, expected );
+  }
+
+  array2d< real64 > boxMin;
+  array2d< real64 > boxMax;
+  BoundingVolumeHierarchy hierarchy;
+};
+
+TEST_F( BoundingVolumeHierarchyTest, build )
+{
+  EXPECT_EQ( hierarchy.size(), boxMin.size( 0 ) );
+  EXPECT_GT( hierarchy.numTreeNodes(), 1 );
+  EXPECT_LE( hierarchy.numTreeNodes(), 2 * boxMin.size( 0 ) - 1 );
+}
+
+TEST_F( BoundingVolumeHierarchyTest, pointQuery )
+{
+  for( real64 const x : { 0.1, 2.5, 5.0, 7.3, 9.9 } )
+  {
+    real64 const point[3] = { x, 10.0 - x, 0.5 * x };
+    auto const test = [&]( auto const & lo, auto const & hi )
+    {
+      return BoundingVolumeHierarchy::boxContainsPoint( lo, hi, point );
+    };
+    auto const query = [&]( auto && lambda ) { hierarchy.forBoxesContainingPoint( point, lambda ); };
+    checkQuery( test, query );
+  }
+}
+
+TEST_F( BoundingVolumeHierarchyTest, boxQuery )
+{
+  real64 const queryMin[3] = { 2.0, 3.0, 4.0 };
+  real64 const queryMax[3] = { 3.0, 5.0, 4.5 };
+  auto const test = [&]( auto const & lo, auto const & hi )
+  {
+    return BoundingVolumeHierarchy::boxesOverlap( lo, hi, queryMin, queryMax );
+  };
+  auto const query = [&]( auto && lambda ) { hierarchy.forBoxesOverlappingBox( queryMin, queryMax, lambda ); };
+  checkQuery( test, query );
+}
+
+TEST_F( BoundingVolumeHierarchyTest, planeQuery )
+{
+  real64 const planeCenter[3] = { 5.0, 5.0, 5.0 };
+  real64 const planeNormal[3] = { 0.48, 0.6, 0.64 };
+  auto const test = [&]( auto const & lo, auto const & hi )
+  {
+    return BoundingVolumeHierarchy::boxIntersectsPlane( lo, hi, planeCenter, planeNormal );
+  };
+  auto const query = [&]( auto && lambda ) { hierarchy.forBoxesIntersectingPlane( planeCenter, planeNormal, lambda ); };
+  checkQuery( test, query );
+}
+
+TEST( BoundingVolumeHierarchy, boxTests )
+{
+  real64 const lo[3] = { 0.0, 0.0, 0.0 };
+  real64 const hi[3] = { 1.0, 1.0, 1.0 };
+
+  real64 const inside[3] = { 0.5, 1.0, 0.0 };
+  real64 const outside[3] = { 0.5, 1.1, 0.0 };
+  EXPECT_TRUE( BoundingVolumeHierarchy::boxContainsPoint( lo, hi, inside ) );
+  EXPECT_FALSE( BoundingVolumeHierarchy::boxContainsPoint( lo, hi, outside ) );
+
+  real64 const touchingMin[3] = { 1.0, 0.5, 0.5 };
+  real64 const touchingMax[3] = { 2.0, 2.0, 2.0 };
+  real64 const disjointMin[3] = { 1.5, 0.5, 0.5 };
+  EXPECT_TRUE( BoundingVolumeHierarchy::boxesOverlap( lo, hi, touchingMin, touchingMax ) );
+  EXPECT_FALSE( BoundingVolumeHierarchy::boxesOverlap( lo, hi, disjointMin, touchingMax ) );
+
+  real64 const normal[3] = { 1.0, 0.0, 0.0 };
+  real64 const cutting[3] = { 0.3, 7.0, 7.0 };
+  real64 const missing[3] = { 1.3, 0.5, 0.5 };
+  EXPECT_TRUE( BoundingVolumeHierarchy::boxIntersectsPlane( lo, hi, cutting, normal ) );
+  EXPECT_FALSE( BoundingVolumeHierarchy::boxIntersectsPlane( lo, hi, missing, normal ) );
+}
+
+} // namespace geos
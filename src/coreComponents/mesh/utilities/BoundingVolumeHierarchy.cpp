@@ -0,0 +1,154 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file BoundingVolumeHierarchy.cpp
+ */
+
+#include "BoundingVolumeHierarchy.hpp"
+
+#include "common/TimingMacros.hpp"
+
+#include <algorithm>
+
+namespace geos
+{
+
+void BoundingVolumeHierarchy::build( arrayView2d< real64 const > const & boxMin,
+                                     arrayView2d< real64 const > const & boxMax )
+{
+  GEOS_MARK_FUNCTION;
+
+  GEOS_ERROR_IF_NE( boxMin.size( 0 ), boxMax.size( 0 ) );
+  localIndex const numBoxes = boxMin.size( 0 );
+
+  clear();
+  if( numBoxes == 0 )
+  {
+    return;
+  }
+
+  m_boxMin.resize( numBoxes, 3 );
+  m_boxMax.resize( numBoxes, 3 );
+  m_boxOrder.resize( numBoxes );
+
+  array2d< real64 > centroids( numBoxes, 3 );
+  for( localIndex i = 0; i < numBoxes; ++i )
+  {
+    for( integer d = 0; d < 3; ++d )
+    {
+      m_boxMin[i][d] = boxMin[i][d];
+      m_boxMax[i][d] = boxMax[i][d];
+      centroids[i][d] = 0.5 * ( boxMin[i][d] + boxMax[i][d] );
+    }
+    m_boxOrder[i] = i;
+  }
+
+  // every leaf holds at least one box, hence a binary tree has at most 2 * numBoxes - 1 nodes
+  localIndex const maxNumTreeNodes = 2 * numBoxes - 1;
+  m_treeNodeMin.resize( maxNumTreeNodes, 3 );
+  m_treeNodeMax.resize( maxNumTreeNodes, 3 );
+  m_treeNodeLeft.reserve( maxNumTreeNodes );
+  m_treeNodeRight.reserve( maxNumTreeNodes );
+  m_treeNodeBegin.reserve( maxNumTreeNodes );
+  m_treeNodeEnd.reserve( maxNumTreeNodes );
+
+  buildTreeNode( 0, numBoxes, centroids.toViewConst() );
+
+  localIndex const numTreeNodes = m_treeNodeLeft.size();
+  m_treeNodeMin.resize( numTreeNodes, 3 );
+  m_treeNodeMax.resize( numTreeNodes, 3 );
+}
+
+void BoundingVolumeHierarchy::clear()
+{
+  m_boxMin.clear();
+  m_boxMax.clear();
+  m_boxOrder.clear();
+  m_treeNodeMin.clear();
+  m_treeNodeMax.clear();
+  m_treeNodeLeft.clear();
+  m_treeNodeRight.clear();
+  m_treeNodeBegin.clear();
+  m_treeNodeEnd.clear();
+}
+
+localIndex BoundingVolumeHierarchy::buildTreeNode( localIndex const begin,
+                                                   localIndex const end,
+                                                   arrayView2d< real64 const > const & centroids )
+{
+  localIndex const treeNode = m_treeNodeLeft.size();
+  m_treeNodeLeft.emplace_back( -1 );
+  m_treeNodeRight.emplace_back( -1 );
+  m_treeNodeBegin.emplace_back( begin );
+  m_treeNodeEnd.emplace_back( end );
+
+  // bounding box of the boxes and of their centroids
+  real64 centroidMin[3] = { LvArray::NumericLimits< real64 >::max,
+                            LvArray::NumericLimits< real64 >::max,
+                            LvArray::NumericLimits< real64 >::max };
+  real64 centroidMax[3] = { LvArray::NumericLimits< real64 >::lowest,
+                            LvArray::NumericLimits< real64 >::lowest,
+                            LvArray::NumericLimits< real64 >::lowest };
+  for( integer d = 0; d < 3; ++d )
+  {
+    m_treeNodeMin[treeNode][d] = LvArray::NumericLimits< real64 >::max;
+    m_treeNodeMax[treeNode][d] = LvArray::NumericLimits< real64 >::lowest;
+  }
+  for( localIndex i = begin; i < end; ++i )
+  {
+    localIndex const box = m_boxOrder[i];
+    for( integer d = 0; d < 3; ++d )
+    {
+      m_treeNodeMin[treeNode][d] = std::min( m_treeNodeMin[treeNode][d], m_boxMin[box][d] );
+      m_treeNodeMax[treeNode][d] = std::max( m_treeNodeMax[treeNode][d], m_boxMax[box][d] );
+      centroidMin[d] = std::min( centroidMin[d], centroids[box][d] );
+      centroidMax[d] = std::max( centroidMax[d], centroids[box][d] );
+    }
+  }
+
+  if( end - begin <= maxLeafSize )
+  {
+    return treeNode;
+  }
+
+  // split at the median centroid along the axis of largest centroid extent
+  integer axis = 0;
+  for( integer d = 1; d < 3; ++d )
+  {
+    if( centroidMax[d] - centroidMin[d] > centroidMax[axis] - centroidMin[axis] )
+    {
+      axis = d;
+    }
+  }
+
+  localIndex const middle = begin + ( end - begin ) / 2;
+  std::nth_element( m_boxOrder.begin() + begin,
+                    m_boxOrder.begin() + middle,
+                    m_boxOrder.begin() + end,
+                    [&]( localIndex const a, localIndex const b )
+  {
+    return centroids[a][axis] < centroids[b][axis];
+  } );
+
+  localIndex const left = buildTreeNode( begin, middle, centroids );
+  localIndex const right = buildTreeNode( middle, end, centroids );
+  m_treeNodeLeft[treeNode] = left;
+  m_treeNodeRight[treeNode] = right;
+
+  return treeNode;
+}
+
+} // namespace geos
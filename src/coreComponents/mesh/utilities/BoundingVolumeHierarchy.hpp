@@ -0,0 +1,295 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file BoundingVolumeHierarchy.hpp
+ */
+
+#ifndef GEOS_MESH_UTILITIES_BOUNDINGVOLUMEHIERARCHY_HPP_
+#define GEOS_MESH_UTILITIES_BOUNDINGVOLUMEHIERARCHY_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geos
+{
+
+/**
+ * @class BoundingVolumeHierarchy
+ * @brief Binary tree of axis-aligned bounding boxes used to accelerate geometric queries.
+ *
+ * The hierarchy is built once over a set of (possibly degenerate) axis-aligned boxes,
+ * for instance the bounding boxes of the mesh elements, or the positions of the mesh nodes.
+ * Queries then only visit the subtrees whose bounding box passes a user-provided test,
+ * reducing the cost of locating the boxes that contain a point, overlap a box or are cut
+ * by a plane from linear to (roughly) logarithmic in the number of boxes.
+ *
+ * The tree is built top-down on the host by splitting the box centroids at the median
+ * along the axis of largest extent, which guarantees a balanced tree.
+ */
+class BoundingVolumeHierarchy
+{
+public:
+
+  /// Maximum number of boxes stored in a leaf of the tree
+  static constexpr localIndex maxLeafSize = 8;
+
+  /**
+   * @brief Build the hierarchy over a set of boxes.
+   * @param[in] boxMin lower corners of the boxes (numBoxes x 3)
+   * @param[in] boxMax upper corners of the boxes (numBoxes x 3)
+   */
+  void build( arrayView2d< real64 const > const & boxMin,
+              arrayView2d< real64 const > const & boxMax );
+
+  /**
+   * @brief Release the storage of the hierarchy.
+   */
+  void clear();
+
+  /**
+   * @return the number of boxes stored in the hierarchy
+   */
+  localIndex size() const
+  { return m_boxMin.size( 0 ); }
+
+  /**
+   * @return the number of nodes of the tree
+   */
+  localIndex numTreeNodes() const
+  { return m_treeNodeMin.size( 0 ); }
+
+  /**
+   * @brief Visit the boxes that pass a given test.
+   * @tparam PREDICATE type of the box test
+   * @tparam LAMBDA type of the function called on each box passing the test
+   * @param[in] predicate test called with the lower and upper corners of a box; it must
+   *                      return true for every box that contains a box passing the test
+   * @param[in] lambda function called with the index of each box passing the test
+   *
+   * @note The boxes are visited in no particular order.
+   */
+  template< typename PREDICATE, typename LAMBDA >
+  void forBoxes( PREDICATE && predicate, LAMBDA && lambda ) const
+  {
+    if( numTreeNodes() == 0 )
+    {
+      return;
+    }
+
+    // the tree is balanced, so its depth is bounded by the bit size of localIndex
+    localIndex stack[ 2 * sizeof( localIndex ) * 8 ];
+    integer stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while( stackSize > 0 )
+    {
+      localIndex const treeNode = stack[--stackSize];
+      if( !predicate( m_treeNodeMin[treeNode], m_treeNodeMax[treeNode] ) )
+      {
+        continue;
+      }
+      if( m_treeNodeLeft[treeNode] < 0 )
+      {
+        for( localIndex i = m_treeNodeBegin[treeNode]; i < m_treeNodeEnd[treeNode]; ++i )
+        {
+          localIndex const box = m_boxOrder[i];
+          if( predicate( m_boxMin[box], m_boxMax[box] ) )
+          {
+            lambda( box );
+          }
+        }
+      }
+      else
+      {
+        stack[stackSize++] = m_treeNodeRight[treeNode];
+        stack[stackSize++] = m_treeNodeLeft[treeNode];
+      }
+    }
+  }
+
+  /**
+   * @brief Visit the boxes containing a point.
+   * @tparam LAMBDA type of the function called on each box
+   * @param[in] point the coordinates of the point
+   * @param[in] lambda function called with the index of each box containing @p point
+   */
+  template< typename LAMBDA >
+  void forBoxesContainingPoint( real64 const ( &point )[3], LAMBDA && lambda ) const
+  {
+    forBoxes( [&]( arraySlice1d< real64 const > const & lo, arraySlice1d< real64 const > const & hi )
+    {
+      return boxContainsPoint( lo, hi, point );
+    }, std::forward< LAMBDA >( lambda ) );
+  }
+
+  /**
+   * @brief Visit the boxes overlapping a given box.
+   * @tparam LAMBDA type of the function called on each box
+   * @param[in] queryMin lower corner of the query box
+   * @param[in] queryMax upper corner of the query box
+   * @param[in] lambda function called with the index of each box overlapping the query box
+   */
+  template< typename LAMBDA >
+  void forBoxesOverlappingBox( real64 const ( &queryMin )[3],
+                               real64 const ( &queryMax )[3],
+                               LAMBDA && lambda ) const
+  {
+    forBoxes( [&]( arraySlice1d< real64 const > const & lo, arraySlice1d< real64 const > const & hi )
+    {
+      return boxesOverlap( lo, hi, queryMin, queryMax );
+    }, std::forward< LAMBDA >( lambda ) );
+  }
+
+  /**
+   * @brief Visit the boxes intersected by a plane.
+   * @tparam LAMBDA type of the function called on each box
+   * @param[in] planeCenter a point of the plane
+   * @param[in] planeNormal the normal vector of the plane
+   * @param[in] lambda function called with the index of each box intersected by the plane
+   */
+  template< typename LAMBDA >
+  void forBoxesIntersectingPlane( real64 const ( &planeCenter )[3],
+                                  real64 const ( &planeNormal )[3],
+                                  LAMBDA && lambda ) const
+  {
+    forBoxes( [&]( arraySlice1d< real64 const > const & lo, arraySlice1d< real64 const > const & hi )
+    {
+      return boxIntersectsPlane( lo, hi, planeCenter, planeNormal );
+    }, std::forward< LAMBDA >( lambda ) );
+  }
+
+  /**
+   * @brief Check whether a box contains a point.
+   * @tparam BOX_MIN type of the lower corner of the box
+   * @tparam BOX_MAX type of the upper corner of the box
+   * @param[in] boxMin lower corner of the box
+   * @param[in] boxMax upper corner of the box
+   * @param[in] point the coordinates of the point
+   * @return true if the point is inside the box or on its boundary
+   */
+  template< typename BOX_MIN, typename BOX_MAX >
+  static bool boxContainsPoint( BOX_MIN const & boxMin,
+                                BOX_MAX const & boxMax,
+                                real64 const ( &point )[3] )
+  {
+    for( integer i = 0; i < 3; ++i )
+    {
+      if( point[i] < boxMin[i] || point[i] > boxMax[i] )
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Check whether two boxes overlap.
+   * @tparam BOX_MIN type of the lower corner of the first box
+   * @tparam BOX_MAX type of the upper corner of the first box
+   * @param[in] boxMin lower corner of the first box
+   * @param[in] boxMax upper corner of the first box
+   * @param[in] otherMin lower corner of the second box
+   * @param[in] otherMax upper corner of the second box
+   * @return true if the boxes overlap or touch
+   */
+  template< typename BOX_MIN, typename BOX_MAX >
+  static bool boxesOverlap( BOX_MIN const & boxMin,
+                            BOX_MAX const & boxMax,
+                            real64 const ( &otherMin )[3],
+                            real64 const ( &otherMax )[3] )
+  {
+    for( integer i = 0; i < 3; ++i )
+    {
+      if( otherMax[i] < boxMin[i] || otherMin[i] > boxMax[i] )
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Check whether a box is intersected by a plane.
+   * @tparam BOX_MIN type of the lower corner of the box
+   * @tparam BOX_MAX type of the upper corner of the box
+   * @param[in] boxMin lower corner of the box
+   * @param[in] boxMax upper corner of the box
+   * @param[in] planeCenter a point of the plane
+   * @param[in] planeNormal the normal vector of the plane
+   * @return true if the plane intersects or touches the box
+   */
+  template< typename BOX_MIN, typename BOX_MAX >
+  static bool boxIntersectsPlane( BOX_MIN const & boxMin,
+                                  BOX_MAX const & boxMax,
+                                  real64 const ( &planeCenter )[3],
+                                  real64 const ( &planeNormal )[3] )
+  {
+    // signed distance of the box center to the plane, compared to the projected half-extent of the box
+    real64 distance = 0.0;
+    real64 radius = 0.0;
+    for( integer i = 0; i < 3; ++i )
+    {
+      real64 const center = 0.5 * ( boxMin[i] + boxMax[i] );
+      real64 const halfExtent = 0.5 * ( boxMax[i] - boxMin[i] );
+      distance += planeNormal[i] * ( center - planeCenter[i] );
+      radius += std::abs( planeNormal[i] ) * halfExtent;
+    }
+    return std::abs( distance ) <= radius;
+  }
+
+private:
+
+  /**
+   * @brief Recursively build the subtree over a range of boxes.
+   * @param[in] begin first position of the range in the box ordering
+   * @param[in] end one past the last position of the range in the box ordering
+   * @param[in] centroids the centroids of the boxes
+   * @return the index of the root of the subtree
+   */
+  localIndex buildTreeNode( localIndex const begin,
+                            localIndex const end,
+                            arrayView2d< real64 const > const & centroids );
+
+  /// Lower corners of the boxes
+  array2d< real64 > m_boxMin;
+
+  /// Upper corners of the boxes
+  array2d< real64 > m_boxMax;
+
+  /// Ordering of the boxes such that the boxes of each tree node are contiguous
+  array1d< localIndex > m_boxOrder;
+
+  /// Lower corners of the bounding boxes of the tree nodes
+  array2d< real64 > m_treeNodeMin;
+
+  /// Upper corners of the bounding boxes of the tree nodes
+  array2d< real64 > m_treeNodeMax;
+
+  /// Left child of the tree nodes (-1 for leaves)
+  array1d< localIndex > m_treeNodeLeft;
+
+  /// Right child of the tree nodes (-1 for leaves)
+  array1d< localIndex > m_treeNodeRight;
+
+  /// First position of the tree node boxes in the ordering
+  array1d< localIndex > m_treeNodeBegin;
+
+  /// One past the last position of the tree node boxes in the ordering
+  array1d< localIndex > m_treeNodeEnd;
+};
+
+} // namespace geos
+
+#endif //GEOS_MESH_UTILITIES_BOUNDINGVOLUMEHIERARCHY_HPP_
@@ -47,6 +47,12 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Whether to stop the simulation if the linear solver reports an error" );
 
+  registerWrapper( viewKeyStruct::mixedPrecisionString(), &m_parameters.mixedPrecision ).
+    setApplyDefaultValue( m_parameters.mixedPrecision ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Whether to store and apply the preconditioner in single precision, the Krylov solver remaining in double precision.\n"
+                    "Only available for the native ``jacobi`` preconditioner, and for the Jacobi blocks of the ``block`` preconditioner" );
+
   registerWrapper( viewKeyStruct::directCheckResidualString(), &m_parameters.direct.checkResidual ).
     setApplyDefaultValue( m_parameters.direct.checkResidual ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -94,6 +100,16 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Maximum iterations before restart (GMRES only)" );
 
+  registerWrapper( viewKeyStruct::krylovRecycleSizeString(), &m_parameters.krylov.recycleSize ).
+    setApplyDefaultValue( m_parameters.krylov.recycleSize ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of approximate eigenvectors recycled between solves (GCRO-DR only)" );
+
+  registerWrapper( viewKeyStruct::krylovSStepSizeString(), &m_parameters.krylov.sStepSize ).
+    setApplyDefaultValue( m_parameters.krylov.sStepSize ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of basis vectors generated per block (s-step GMRES only)" );
+
   registerWrapper( viewKeyStruct::krylovTolString(), &m_parameters.krylov.relTolerance ).
     setApplyDefaultValue( m_parameters.krylov.relTolerance ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -209,6 +225,21 @@ void LinearSolverParametersInput::postProcessInput()
   GEOS_ERROR_IF( binaryOptions.count( m_parameters.stopIfError ) == 0,
                  getWrapperDataContext( viewKeyStruct::stopIfErrorString() ) <<
                  ": option can be either 0 (false) or 1 (true)" );
+  GEOS_ERROR_IF( binaryOptions.count( m_parameters.mixedPrecision ) == 0,
+                 getWrapperDataContext( viewKeyStruct::mixedPrecisionString() ) <<
+                 ": option can be either 0 (false) or 1 (true)" );
+  GEOS_WARNING_IF( m_parameters.mixedPrecision &&
+                   ( m_parameters.solverType == LinearSolverParameters::SolverType::direct ||
+                     ( m_parameters.preconditionerType != LinearSolverParameters::PreconditionerType::jacobi &&
+                       m_parameters.preconditionerType != LinearSolverParameters::PreconditionerType::block ) ),
+                   getWrapperDataContext( viewKeyStruct::mixedPrecisionString() ) <<
+                   ": mixed precision is not supported by the selected solver or preconditioner and will be ignored" );
+  GEOS_ERROR_IF( m_parameters.mixedPrecision &&
+                 m_parameters.preconditionerType == LinearSolverParameters::PreconditionerType::jacobi &&
+                 ( m_parameters.solverType == LinearSolverParameters::SolverType::fgmres ||
+                   m_parameters.solverType == LinearSolverParameters::SolverType::preconditioner ),
+                 getWrapperDataContext( viewKeyStruct::mixedPrecisionString() ) <<
+                 ": mixed precision Jacobi requires a native Krylov solver (cg, gmres, bicgstab, gcrodr, pipecg, pipegmres or sstepgmres)" );
   GEOS_ERROR_IF( binaryOptions.count( m_parameters.direct.checkResidual ) == 0,
                  getWrapperDataContext( viewKeyStruct::directCheckResidualString() ) <<
                  ": option can be either 0 (false) or 1 (true)" );
@@ -231,6 +262,12 @@ void LinearSolverParametersInput::postProcessInput()
   GEOS_ERROR_IF_LT_MSG( m_parameters.krylov.maxRestart, 0,
                         getWrapperDataContext( viewKeyStruct::krylovMaxRestartString() ) <<
                         ": Invalid value." );
+  GEOS_ERROR_IF_LT_MSG( m_parameters.krylov.recycleSize, 0,
+                        getWrapperDataContext( viewKeyStruct::krylovRecycleSizeString() ) <<
+                        ": Invalid value." );
+  GEOS_ERROR_IF_LE_MSG( m_parameters.krylov.sStepSize, 0,
+                        getWrapperDataContext( viewKeyStruct::krylovSStepSizeString() ) <<
+                        ": Invalid value." );
 
   GEOS_ERROR_IF_LT_MSG( m_parameters.krylov.relTolerance, 0.0,
                         getWrapperDataContext( viewKeyStruct::krylovTolString() ) <<
@@ -74,6 +74,8 @@ public:
     static constexpr char const * preconditionerTypeString() { return "preconditionerType"; }
     /// stop if error key
     static constexpr char const * stopIfErrorString() { return "stopIfError"; }
+    /// mixed precision key
+    static constexpr char const * mixedPrecisionString() { return "mixedPrecision"; }
 
     /// direct solver check residual key
     static constexpr char const * directCheckResidualString() { return "directCheckResidual"; }
@@ -94,6 +96,10 @@ public:
     static constexpr char const * krylovMaxIterString() { return "krylovMaxIter"; }
     /// Krylov max iterations key
     static constexpr char const * krylovMaxRestartString() { return "krylovMaxRestart"; }
+    /// Krylov recycled subspace size key
+    static constexpr char const * krylovRecycleSizeString() { return "krylovRecycleSize"; }
+    /// Krylov s-step block size key
+    static constexpr char const * krylovSStepSizeString() { return "krylovSStepSize"; }
     /// Krylov tolerance key
     static constexpr char const * krylovTolString() { return "krylovTol"; }
     /// Krylov adaptive tolerance key
@@ -43,6 +43,13 @@ NonlinearSolverParameters::NonlinearSolverParameters( string const & name,
                     "* Linear\n"
                     "* Parabolic" );
 
+  registerWrapper( viewKeysStruct::solutionExtrapolationString(), &m_solutionExtrapolation ).
+    setApplyDefaultValue( SolutionExtrapolationType::None ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Extrapolation of the primary variables from the last converged time steps used as initial guess of the Newton loop. "
+                    "The prediction falls back to a lower order (and eventually to no extrapolation) if it fails the solution check of the solver. "
+                    "Valid options:\n* " + EnumStrings< SolutionExtrapolationType >::concat( "\n* " ) );
+
   registerWrapper( viewKeysStruct::lineSearchMaxCutsString(), &m_lineSearchMaxCuts ).
     setApplyDefaultValue( 4 ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -116,6 +123,34 @@ NonlinearSolverParameters::NonlinearSolverParameters( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Factor by which the time step is increased when the number of Newton iterations is small." );
 
+  registerWrapper( viewKeysStruct::timeStepControlString(), &m_timeStepControl ).
+    setApplyDefaultValue( TimeStepControlType::NewtonIterations ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Strategy used to select the size of the next time step. Options are: \n"
+                    "* NewtonIterations - Increase or decrease the time step based on the number of Newton iterations, "
+                    "limited by the state change targets of the solver (if any).\n"
+                    "* TargetChange     - PID control of the change of the primary variables relative to the state change targets of the solver.\n"
+                    "* ErrorEstimate    - Control of the relative local truncation error estimated from the increments of the last two time steps.\n"
+                    "With TargetChange and ErrorEstimate, the time step cannot increase by more than " +
+                    string( viewKeysStruct::timeStepIncreaseFactorString() ) + " between two steps, and it is decreased as with "
+                    "NewtonIterations when the Newton convergence is slow." );
+
+  registerWrapper( viewKeysStruct::timeStepErrorToleranceString(), &m_timeStepErrorTolerance ).
+    setApplyDefaultValue( 1.0e-2 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Target value of the relative local truncation error estimate, used if timeStepControl is set to ErrorEstimate." );
+
+  registerWrapper( viewKeysStruct::timeStepGrowthDelayString(), &m_timeStepGrowthDelayAfterCut ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of time steps following a time step cut during which the time step size is not allowed to increase." );
+
+  registerWrapper( viewKeysStruct::timeStepMinDecreaseFactorString(), &m_timeStepMinDecreaseFactor ).
+    setApplyDefaultValue( 0.1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Minimum ratio between two consecutive time step sizes chosen by the TargetChange and ErrorEstimate strategies, "
+                    "so that a single large error measure does not collapse the time step size." );
+
   registerWrapper( viewKeysStruct::timeStepCutFactorString(), &m_timeStepCutFactor ).
     setApplyDefaultValue( 0.5 ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -161,6 +196,15 @@ void NonlinearSolverParameters::postProcessInput()
   GEOS_ERROR_IF_LE_MSG( m_timeStepDecreaseIterLimit, m_timeStepIncreaseIterLimit,
                         getWrapperDataContext( viewKeysStruct::timeStepIncreaseIterLimString() ) <<
                         ": should be smaller than " << viewKeysStruct::timeStepDecreaseIterLimString() );
+  GEOS_ERROR_IF_LE_MSG( m_timeStepErrorTolerance, 0.0,
+                        getWrapperDataContext( viewKeysStruct::timeStepErrorToleranceString() ) <<
+                        ": should be positive" );
+  GEOS_ERROR_IF_LT_MSG( m_timeStepGrowthDelayAfterCut, 0,
+                        getWrapperDataContext( viewKeysStruct::timeStepGrowthDelayString() ) <<
+                        ": should be non-negative" );
+  GEOS_ERROR_IF( m_timeStepMinDecreaseFactor <= 0.0 || m_timeStepMinDecreaseFactor > 1.0,
+                 getWrapperDataContext( viewKeysStruct::timeStepMinDecreaseFactorString() ) <<
+                 ": should be in (0, 1]" );
 }
 
 
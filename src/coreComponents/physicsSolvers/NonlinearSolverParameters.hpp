@@ -71,6 +71,8 @@ public:
     static constexpr char const * lineSearchCutFactorString()     { return "lineSearchCutFactor"; }
     static constexpr char const * lineSearchInterpolationTypeString() { return "lineSearchInterpolationType"; }
 
+    static constexpr char const * solutionExtrapolationString()   { return "solutionExtrapolation"; }
+
     static constexpr char const * normTypeString()                { return "normType"; }
     static constexpr char const * minNormalizerString()           { return "minNormalizer"; }
     static constexpr char const * newtonTolString()               { return "newtonTol"; }
@@ -84,6 +86,10 @@ public:
     static constexpr char const * timeStepIncreaseIterLimString() { return "timeStepIncreaseIterLimit"; }
     static constexpr char const * timeStepDecreaseFactorString()  { return "timeStepDecreaseFactor"; }
     static constexpr char const * timeStepIncreaseFactorString()  { return "timeStepIncreaseFactor"; }
+    static constexpr char const * timeStepControlString()         { return "timeStepControl"; }
+    static constexpr char const * timeStepErrorToleranceString()  { return "timeStepErrorTolerance"; }
+    static constexpr char const * timeStepGrowthDelayString()     { return "timeStepGrowthDelayAfterCut"; }
+    static constexpr char const * timeStepMinDecreaseFactorString() { return "timeStepMinDecreaseFactor"; }
 
     static constexpr char const * maxSubStepsString()             { return "maxSubSteps"; }
     static constexpr char const * maxTimeStepCutsString()         { return "maxTimeStepCuts"; }
@@ -118,6 +124,26 @@ public:
     Parabolic, ///< use parabolic interpolation to define line search scaling factor.
   };
 
+  /**
+   * @brief Indicates how the initial guess of the Newton loop is computed.
+   */
+  enum class SolutionExtrapolationType : integer
+  {
+    None,      ///< start from the solution at the beginning of the step
+    Linear,    ///< linear extrapolation from the last converged step
+    Quadratic, ///< quadratic extrapolation from the last two converged steps
+  };
+
+  /**
+   * @brief Strategy used to select the size of the next time step.
+   */
+  enum class TimeStepControlType : integer
+  {
+    NewtonIterations, ///< based on the number of Newton iterations, limited by the solver-specific state change targets
+    TargetChange,     ///< PID control of the change of the solution relative to the solver-specific targets
+    ErrorEstimate,    ///< based on an estimate of the local truncation error
+  };
+
   /**
    * @brief Coupling type.
    */
@@ -208,6 +234,9 @@ public:
   /// Flag to pick the type of linesearch
   LineSearchInterpolationType m_lineSearchInterpType;
 
+  /// Type of extrapolation used to compute the initial guess of the Newton loop
+  SolutionExtrapolationType m_solutionExtrapolation;
+
   /// The maximum number of line search cuts to attempt.
   integer m_lineSearchMaxCuts;
 
@@ -247,6 +276,18 @@ public:
   /// Factor used to increase the time step size
   real64 m_timeStepIncreaseFactor;
 
+  /// Strategy used to select the size of the next time step
+  TimeStepControlType m_timeStepControl;
+
+  /// Target value of the relative local truncation error estimate
+  real64 m_timeStepErrorTolerance;
+
+  /// Number of time steps following a time step cut during which the time step size cannot increase
+  integer m_timeStepGrowthDelayAfterCut;
+
+  /// Minimum ratio between two consecutive time step sizes chosen by the TargetChange and ErrorEstimate strategies
+  real64 m_timeStepMinDecreaseFactor;
+
   /// Maximum number of time sub-steps allowed for the solver
   integer m_maxSubSteps;
 
@@ -287,6 +328,16 @@ ENUM_STRINGS( NonlinearSolverParameters::LineSearchInterpolationType,
               "Linear",
               "Parabolic" );
 
+ENUM_STRINGS( NonlinearSolverParameters::SolutionExtrapolationType,
+              "None",
+              "Linear",
+              "Quadratic" );
+
+ENUM_STRINGS( NonlinearSolverParameters::TimeStepControlType,
+              "NewtonIterations",
+              "TargetChange",
+              "ErrorEstimate" );
+
 ENUM_STRINGS( NonlinearSolverParameters::CouplingType,
               "FullyImplicit",
               "Sequential" );
@@ -0,0 +1,171 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file SolutionExtrapolator.cpp
+ */
+
+#include "SolutionExtrapolator.hpp"
+
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "common/MpiWrapper.hpp"
+
+namespace geos
+{
+
+void SolutionExtrapolator::beginStep( localIndex const numLocalDofs )
+{
+  if( m_stepIncrement.size() != numLocalDofs )
+  {
+    clearHistory();
+    m_stepIncrement.resize( numLocalDofs );
+    m_prediction.resize( numLocalDofs );
+    m_history.resize( maxNumSteps, numLocalDofs );
+  }
+  restartStep();
+  m_isActive = true;
+}
+
+void SolutionExtrapolator::restartStep()
+{
+  m_stepIncrement.zero();
+}
+
+void SolutionExtrapolator::accumulate( arrayView1d< real64 const > const & localSolution,
+                                       real64 const scalingFactor )
+{
+  if( !m_isActive )
+  {
+    return;
+  }
+  GEOS_ASSERT_EQ( localSolution.size(), m_stepIncrement.size() );
+
+  arrayView1d< real64 > const stepIncrement = m_stepIncrement.toView();
+  forAll< parallelDevicePolicy<> >( stepIncrement.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    stepIncrement[i] += scalingFactor * localSolution[i];
+  } );
+}
+
+void SolutionExtrapolator::completeStep( real64 const dt,
+                                         bool const converged )
+{
+  if( !m_isActive )
+  {
+    return;
+  }
+  m_isActive = false;
+
+  if( !converged || dt <= 0.0 )
+  {
+    clearHistory();
+    return;
+  }
+
+  // shift the history by one step and store the new increment in front
+  arrayView1d< real64 const > const stepIncrement = m_stepIncrement.toViewConst();
+  arrayView2d< real64 > const history = m_history.toView();
+  forAll< parallelDevicePolicy<> >( stepIncrement.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    for( integer k = maxNumSteps - 1; k > 0; --k )
+    {
+      history( k, i ) = history( k - 1, i );
+    }
+    history( 0, i ) = stepIncrement[i];
+  } );
+
+  for( integer k = maxNumSteps - 1; k > 0; --k )
+  {
+    m_historyDt[k] = m_historyDt[k - 1];
+  }
+  m_historyDt[0] = dt;
+  m_numStoredSteps = LvArray::math::min( m_numStoredSteps + 1, maxNumSteps );
+}
+
+void SolutionExtrapolator::clearHistory()
+{
+  m_numStoredSteps = 0;
+}
+
+arrayView1d< real64 const > SolutionExtrapolator::predict( integer const order,
+                                                           real64 const dt )
+{
+  GEOS_ERROR_IF( order < 1 || order > m_numStoredSteps,
+                 GEOS_FMT( "Extrapolation of order {} requested with {} stored step(s)", order, m_numStoredSteps ) );
+
+  arrayView2d< real64 const > const history = m_history.toViewConst();
+  arrayView1d< real64 > const prediction = m_prediction.toView();
+
+  if( order == 1 )
+  {
+    // constant rate of change over the last step
+    real64 const ratio = dt / m_historyDt[0];
+    forAll< parallelDevicePolicy<> >( prediction.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+    {
+      prediction[i] = ratio * history( 0, i );
+    } );
+  }
+  else
+  {
+    // quadratic polynomial through the states at the end of the last three steps (Newton form),
+    // evaluated at the end of the upcoming step of size dt
+    real64 const dt1 = m_historyDt[0];
+    real64 const dt2 = m_historyDt[1];
+    real64 const c1 = dt;
+    real64 const c2 = dt * ( dt + dt1 ) / ( dt1 + dt2 );
+    forAll< parallelDevicePolicy<> >( prediction.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+    {
+      real64 const rate1 = history( 0, i ) / dt1;
+      real64 const rate2 = history( 1, i ) / dt2;
+      prediction[i] = c1 * rate1 + c2 * ( rate1 - rate2 );
+    } );
+  }
+
+  return m_prediction.toViewConst();
+}
+
+real64 SolutionExtrapolator::estimateRelativeError() const
+{
+  if( m_numStoredSteps < 2 )
+  {
+    return -1.0;
+  }
+
+  real64 const dt1 = m_historyDt[0];
+  real64 const dt2 = m_historyDt[1];
+  real64 const ratio = dt1 / dt2;
+
+  arrayView2d< real64 const > const history = m_history.toViewConst();
+  RAJA::ReduceSum< parallelDeviceReduce, real64 > localDiffNormSq( 0.0 );
+  RAJA::ReduceSum< parallelDeviceReduce, real64 > localIncrementNormSq( 0.0 );
+  forAll< parallelDevicePolicy<> >( history.size( 1 ), [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    real64 const diff = history( 0, i ) - ratio * history( 1, i );
+    localDiffNormSq += diff * diff;
+    localIncrementNormSq += history( 0, i ) * history( 0, i );
+  } );
+
+  real64 const diffNorm = std::sqrt( MpiWrapper::sum( localDiffNormSq.get() ) );
+  real64 const incrementNorm = std::sqrt( MpiWrapper::sum( localIncrementNormSq.get() ) );
+  if( incrementNorm <= 0.0 )
+  {
+    return 0.0;
+  }
+
+  // for a first-order scheme, the error is the fraction dt1 / ( dt1 + dt2 ) of the deviation from the linear predictor
+  return dt1 / ( dt1 + dt2 ) * diffNorm / incrementNorm;
+}
+
+} // namespace geos
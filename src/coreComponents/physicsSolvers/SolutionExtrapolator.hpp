@@ -0,0 +1,148 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file SolutionExtrapolator.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_SOLUTIONEXTRAPOLATOR_HPP_
+#define GEOS_PHYSICSSOLVERS_SOLUTIONEXTRAPOLATOR_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geos
+{
+
+/**
+ * @class SolutionExtrapolator
+ * @brief Builds an initial guess for the Newton loop by extrapolating in time
+ *        the increments of the primary variables over the last converged steps.
+ *
+ * The extrapolator works on DofManager-ordered local vectors, i.e. the same
+ * vectors that are passed to SolverBase::applySystemSolution. During a time step,
+ * the increments applied to the primary variables are accumulated, including the
+ * corrections made by the solver on top of them (e.g., chopping), and once the
+ * step has converged the total increment is stored along with the step size.
+ * At the beginning of the next step, a polynomial in time fitted to the stored
+ * increments is evaluated for the new step size, which yields the predicted increment.
+ */
+class SolutionExtrapolator
+{
+public:
+
+  /// Maximum number of past steps kept in the history (i.e. maximum extrapolation order)
+  static constexpr integer maxNumSteps = 2;
+
+  /**
+   * @brief Prepare the accumulation of the increment for a new time step.
+   * @param[in] numLocalDofs number of locally owned degrees of freedom of the system
+   *
+   * The history is discarded if the number of degrees of freedom has changed
+   * since the last step, since the stored increments are not meaningful anymore.
+   */
+  void beginStep( localIndex const numLocalDofs );
+
+  /**
+   * @brief Zero out the increment accumulated so far, when the state is reset to the beginning of the step.
+   */
+  void restartStep();
+
+  /**
+   * @brief Accumulate an increment applied to the primary variables during the current step.
+   * @param[in] localSolution the local increment vector, as passed to applySystemSolution
+   * @param[in] scalingFactor the factor used to scale @p localSolution when it was applied
+   */
+  void accumulate( arrayView1d< real64 const > const & localSolution,
+                   real64 const scalingFactor );
+
+  /**
+   * @brief Accumulate the corrections made to the primary variables on top of the applied increments (e.g., chopping).
+   * @tparam LAMBDA the type of the function adding the corrections
+   * @param[in] addCorrections function adding the corrections to the DofManager-ordered increment it is given
+   */
+  template< typename LAMBDA >
+  void accumulateCorrections( LAMBDA && addCorrections )
+  {
+    if( m_isActive )
+    {
+      addCorrections( m_stepIncrement.toView() );
+    }
+  }
+
+  /**
+   * @brief Finalize the current step and update the history.
+   * @param[in] dt the time step size that was achieved
+   * @param[in] converged whether the step has converged; if not, the history is discarded
+   */
+  void completeStep( real64 const dt,
+                     bool const converged );
+
+  /**
+   * @brief Discard all stored steps.
+   */
+  void clearHistory();
+
+  /**
+   * @brief Compute the predicted increment over a step of size @p dt.
+   * @param[in] order the order of the extrapolation (1 = linear, 2 = quadratic)
+   * @param[in] dt the size of the upcoming step
+   * @return a view to the predicted increment, with the same layout as the system solution
+   */
+  arrayView1d< real64 const > predict( integer const order,
+                                       real64 const dt );
+
+  /**
+   * @brief Estimate the local truncation error of the last converged step.
+   * @return the norm of the difference between the last increment and its linear extrapolation
+   *         from the previous step, scaled for a first-order scheme and relative to the norm of the last increment,
+   *         or a negative value if less than two steps are stored
+   * @note This function is collective over MPI_COMM_GEOSX.
+   */
+  real64 estimateRelativeError() const;
+
+  /**
+   * @return true if a step is currently being accumulated
+   */
+  bool isActive() const { return m_isActive; }
+
+  /**
+   * @return the number of converged steps currently stored in the history
+   */
+  integer numStoredSteps() const { return m_numStoredSteps; }
+
+private:
+
+  /// Increment of the primary variables accumulated over the current step
+  array1d< real64 > m_stepIncrement;
+
+  /// Increments of the primary variables over the last converged steps (most recent first)
+  array2d< real64 > m_history;
+
+  /// Sizes of the last converged steps (most recent first)
+  real64 m_historyDt[maxNumSteps]{};
+
+  /// Storage for the predicted increment
+  array1d< real64 > m_prediction;
+
+  /// Number of converged steps currently stored in the history
+  integer m_numStoredSteps = 0;
+
+  /// Flag indicating whether a step is currently being accumulated
+  bool m_isActive = false;
+};
+
+} // namespace geos
+
+#endif //GEOS_PHYSICSSOLVERS_SOLUTIONEXTRAPOLATOR_HPP_
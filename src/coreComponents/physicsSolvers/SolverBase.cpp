@@ -17,6 +17,7 @@
 
 #include "common/TimingMacros.hpp"
 #include "linearAlgebra/utilities/LinearSolverParameters.hpp"
+#include "linearAlgebra/solvers/GcrodrSolver.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
 #include "mesh/DomainPartition.hpp"
 #include "math/interpolation/Interpolation.hpp"
@@ -101,6 +102,8 @@ SolverBase::~SolverBase() = default;
 void SolverBase::initialize_postMeshGeneration()
 {
   ExecutableGroup::initialize_postMeshGeneration();
+  // the statistics are printed according to the log level of the solver
+  m_solverStatistics.setLogLevel( getLogLevel() );
   DomainPartition const & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
   generateMeshTargetsFromTargetRegions( domain.getMeshBodies());
 }
@@ -256,6 +259,26 @@ bool SolverBase::execute( real64 const time_n,
     // increment the cumulative number of nonlinear and linear iterations
     m_solverStatistics.saveTimeStepStatistics();
 
+    // record the error measure of the accepted step used by the time step control
+    real64 timeStepControlError = -1.0;
+    switch( m_nonlinearSolverParameters.m_timeStepControl )
+    {
+      case NonlinearSolverParameters::TimeStepControlType::TargetChange:
+      {
+        timeStepControlError = computeNormalizedStateChange( domain );
+        break;
+      }
+      case NonlinearSolverParameters::TimeStepControlType::ErrorEstimate:
+      {
+        real64 const relativeError = m_solutionExtrapolator.estimateRelativeError();
+        timeStepControlError = relativeError < 0.0 ? relativeError : relativeError / m_nonlinearSolverParameters.m_timeStepErrorTolerance;
+        break;
+      }
+      default:
+        break;
+    }
+    m_timeStepController.recordStep( m_nonlinearSolverParameters.m_numTimeStepAttempts, timeStepControlError );
+
     /*
      * Let us check convergence history of previous solve:
      * - number of nonlinear iter.
@@ -287,6 +310,34 @@ bool SolverBase::execute( real64 const time_n,
 real64 SolverBase::setNextDt( real64 const & currentDt,
                               DomainPartition & domain )
 {
+  using TimeStepControlType = NonlinearSolverParameters::TimeStepControlType;
+
+  TimeStepControlType const timeStepControl = m_nonlinearSolverParameters.m_timeStepControl;
+  integer const growthDelay = m_nonlinearSolverParameters.m_timeStepGrowthDelayAfterCut;
+
+  if( timeStepControl != TimeStepControlType::NewtonIterations && m_timeStepController.hasError() )
+  {
+    real64 const controlledDt = ( timeStepControl == TimeStepControlType::TargetChange )
+                                ? m_timeStepController.targetChangeDt( currentDt )
+                                : m_timeStepController.errorEstimateDt( currentDt );
+    real64 nextDt = m_timeStepController.limitChange( currentDt,
+                                                      controlledDt,
+                                                      m_nonlinearSolverParameters.timeStepIncreaseFactor(),
+                                                      m_nonlinearSolverParameters.m_timeStepMinDecreaseFactor,
+                                                      growthDelay );
+
+    // keep decreasing the time step if the Newton convergence is difficult
+    if( m_nonlinearSolverParameters.m_numNewtonIterations > m_nonlinearSolverParameters.timeStepDecreaseIterLimit() )
+    {
+      nextDt = LvArray::math::min( nextDt, currentDt * m_nonlinearSolverParameters.timeStepDecreaseFactor() );
+    }
+
+    GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "{}: {} time step control, normalized error = {:.3e}, next time step = {}",
+                                        getName(), EnumStrings< TimeStepControlType >::toString( timeStepControl ),
+                                        m_timeStepController.lastError(), nextDt ) );
+    return nextDt;
+  }
+
   real64 const nextDtNewton = setNextDtBasedOnNewtonIter( currentDt );
   real64 const nextDtStateChange = setNextDtBasedOnStateChange( currentDt, domain );
 
@@ -319,7 +370,13 @@ real64 SolverBase::setNextDt( real64 const & currentDt,
     }
   }
 
-  return std::min( nextDtNewton, nextDtStateChange );
+  real64 const nextDt = std::min( nextDtNewton, nextDtStateChange );
+  if( nextDt > currentDt && m_timeStepController.isGrowthDelayed( growthDelay ) )
+  {
+    GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "{}: Time-step increase delayed after a recent time-step cut.", getName() ) );
+    return currentDt;
+  }
+  return nextDt;
 }
 
 real64 SolverBase::setNextDtBasedOnStateChange( real64 const & currentDt,
@@ -329,6 +386,12 @@ real64 SolverBase::setNextDtBasedOnStateChange( real64 const & currentDt,
   return LvArray::NumericLimits< real64 >::max; // i.e., not implemented
 }
 
+real64 SolverBase::computeNormalizedStateChange( DomainPartition & domain )
+{
+  GEOS_UNUSED_VAR( domain );
+  return -1.0; // i.e., not implemented
+}
+
 real64 SolverBase::setNextDtBasedOnNewtonIter( real64 const & currentDt )
 {
   integer & newtonIter = m_nonlinearSolverParameters.m_numNewtonIterations;
@@ -492,6 +555,7 @@ bool SolverBase::lineSearch( real64 const & time_n,
       }
 
       applySystemSolution( dofManager, solution.values(), localScaleFactor, dt, domain );
+      accumulateAppliedSolution( solution.values(), localScaleFactor );
     }
 
     {
@@ -598,6 +662,7 @@ bool SolverBase::lineSearchWithParabolicInterpolation( real64 const & time_n,
       }
 
       applySystemSolution( dofManager, solution.values(), deltaLocalScaleFactor, dt, domain );
+      accumulateAppliedSolution( solution.values(), deltaLocalScaleFactor );
     }
 
     {
@@ -723,6 +788,14 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
 
   bool isConfigurationLoopConverged = false;
 
+  // start recording the increments of this step if the initial guess is extrapolated or the error is estimated.
+  // This is done here rather than in solverStep, since several solvers override solverStep but all use this loop.
+  if( m_nonlinearSolverParameters.m_solutionExtrapolation != NonlinearSolverParameters::SolutionExtrapolationType::None ||
+      m_nonlinearSolverParameters.m_timeStepControl == NonlinearSolverParameters::TimeStepControlType::ErrorEstimate )
+  {
+    m_solutionExtrapolator.beginStep( m_dofManager.numLocalDofs() );
+  }
+
   // outer loop attempts to apply full timestep, and managed the cutting of the timestep if
   // required.
   for( dtAttempt = 0; dtAttempt < maxNumberDtCuts; ++dtAttempt )
@@ -734,6 +807,13 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
       resetConfigurationToBeginningOfStep( domain );
     }
 
+    // use the extrapolation of the previous steps as initial guess
+    if( m_solutionExtrapolator.isActive() )
+    {
+      m_solutionExtrapolator.restartStep();
+      applySolutionExtrapolation( stepDt, domain );
+    }
+
     // it's the simplest configuration that can be attempted whenever Newton's fails as a last resource.
     bool attemptedSimplestConfiguration = false;
 
@@ -767,6 +847,7 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
       else if( !attemptedSimplestConfiguration )
       {
         resetStateToBeginningOfStep( domain );
+        m_solutionExtrapolator.restartStep();
         bool const breakLoop = resetConfigurationToDefault( domain );
         attemptedSimplestConfiguration = true;
         if( breakLoop )
@@ -797,6 +878,9 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
     }
   } // end of outer loop (dt chopping strategy)
 
+  // only keep the increment of a converged step in the extrapolation history
+  m_solutionExtrapolator.completeStep( stepDt, isConfigurationLoopConverged );
+
   if( !isConfigurationLoopConverged )
   {
     GEOS_LOG_RANK_0( "Convergence not achieved." );
@@ -815,6 +899,52 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
   return stepDt;
 }
 
+bool SolverBase::applySolutionExtrapolation( real64 const & dt,
+                                             DomainPartition & domain )
+{
+  GEOS_MARK_FUNCTION;
+
+  integer const requestedOrder = static_cast< integer >( m_nonlinearSolverParameters.m_solutionExtrapolation );
+  integer const maxOrder = LvArray::math::min( requestedOrder, m_solutionExtrapolator.numStoredSteps() );
+
+  for( integer order = maxOrder; order > 0; --order )
+  {
+    arrayView1d< real64 const > const prediction = m_solutionExtrapolator.predict( order, dt );
+
+    if( !checkSystemSolution( domain, m_dofManager, prediction, 1.0 ) )
+    {
+      GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "    {}: solution extrapolation of order {} failed the solution check", getName(), order ) );
+      continue;
+    }
+
+    {
+      Timer timer( m_timers["apply solution"] );
+      applySystemSolution( m_dofManager, prediction, 1.0, dt, domain );
+      accumulateAppliedSolution( prediction, 1.0 );
+    }
+
+    {
+      Timer timer( m_timers["update state"] );
+      updateState( domain );
+    }
+
+    GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "    {}: initial guess extrapolated with order {}", getName(), order ) );
+    return true;
+  }
+
+  return false;
+}
+
+void SolverBase::accumulateAppliedSolution( arrayView1d< real64 const > const & localSolution,
+                                            real64 const scalingFactor )
+{
+  m_solutionExtrapolator.accumulate( localSolution, scalingFactor );
+  m_solutionExtrapolator.accumulateCorrections( [&]( arrayView1d< real64 > const & stepIncrement )
+  {
+    addSolutionCorrections( stepIncrement );
+  } );
+}
+
 bool SolverBase::solveNonlinearSystem( real64 const & time_n,
                                        real64 const & stepDt,
                                        integer const cycleNumber,
@@ -1015,6 +1145,7 @@ bool SolverBase::solveNonlinearSystem( real64 const & time_n,
 
       // apply the system solution to the fields/variables
       applySystemSolution( m_dofManager, m_solution.values(), scaleFactor, stepDt, domain );
+      accumulateAppliedSolution( m_solution.values(), scaleFactor );
     }
 
     {
@@ -1206,6 +1337,20 @@ void SolverBase::solveLinearSystem( DofManager const & dofManager,
   LinearSolverParameters const & params = m_linearSolverParameters.get();
   matrix.setDofManager( &dofManager );
 
+  // Some Krylov methods are only available as native solvers, wrapped around the preconditioner provided by the LA package
+  bool const nativeOnly = params.solverType == LinearSolverParameters::SolverType::gcrodr ||
+                          params.solverType == LinearSolverParameters::SolverType::pipecg ||
+                          params.solverType == LinearSolverParameters::SolverType::pipegmres ||
+                          params.solverType == LinearSolverParameters::SolverType::sstepgmres;
+  // The single precision Jacobi preconditioner is a native one, so the Krylov solver must be the native one as well
+  bool const nativePrecond = params.solverType != LinearSolverParameters::SolverType::direct &&
+                             params.mixedPrecision &&
+                             params.preconditionerType == LinearSolverParameters::PreconditionerType::jacobi;
+  if( ( nativeOnly || nativePrecond ) && !m_precond )
+  {
+    m_precond = LAInterface::createPreconditioner( params );
+  }
+
   if( params.solverType == LinearSolverParameters::SolverType::direct || !m_precond )
   {
     std::unique_ptr< LinearSolverBase< LAInterface > > solver = LAInterface::createSolver( params );
@@ -1225,7 +1370,28 @@ void SolverBase::solveLinearSystem( DofManager const & dofManager,
       Timer timer_setup( m_timers["linear solver setup"] );
       m_precond->setup( matrix );
     }
-    std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::create( params, matrix, *m_precond );
+    std::unique_ptr< KrylovSolver< ParallelVector > > solver;
+    if( params.solverType == LinearSolverParameters::SolverType::gcrodr )
+    {
+      // The recycled subspace is discarded whenever the system size changes (e.g. after remeshing or a change
+      // of the active set). The decision is collective, since the solver reduces over all the recycled vectors.
+      if( !m_krylovRecycleSpace )
+      {
+        m_krylovRecycleSpace = std::make_unique< GcrodrRecycleSpace< ParallelVector > >();
+      }
+      bool const sizeChanged = !m_krylovRecycleSpace->vectors.empty() &&
+                               ( m_krylovRecycleSpace->vectors[0].localSize() != rhs.localSize() ||
+                                 m_krylovRecycleSpace->vectors[0].globalSize() != rhs.globalSize() );
+      if( MpiWrapper::max( static_cast< int >( sizeChanged ), rhs.comm() ) > 0 )
+      {
+        m_krylovRecycleSpace->clear();
+      }
+      solver = std::make_unique< GcrodrSolver< ParallelVector > >( params, matrix, *m_precond, m_krylovRecycleSpace.get() );
+    }
+    else
+    {
+      solver = KrylovSolver< ParallelVector >::create( params, matrix, *m_precond );
+    }
     {
       Timer timer_setup( m_timers["linear solver solve"] );
       solver->solve( rhs, solution );
@@ -1267,6 +1433,29 @@ void SolverBase::applySystemSolution( DofManager const & GEOS_UNUSED_PARAM( dofM
   GEOS_ERROR( "SolverBase::applySystemSolution called!. Should be overridden." );
 }
 
+arrayView1d< real64 > SolverBase::resetSolutionCorrections( DofManager const & dofManager )
+{
+  m_solutionCorrections.resize( dofManager.numLocalDofs() );
+  m_solutionCorrections.zero();
+  return m_solutionCorrections.toView();
+}
+
+void SolverBase::addSolutionCorrections( arrayView1d< real64 > const & localIncrement )
+{
+  if( m_solutionCorrections.empty() )
+  {
+    return;
+  }
+  GEOS_ASSERT_EQ( m_solutionCorrections.size(), localIncrement.size() );
+
+  arrayView1d< real64 const > const corrections = m_solutionCorrections.toViewConst();
+  forAll< parallelDevicePolicy<> >( localIncrement.size(), [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    localIncrement[i] += corrections[i];
+  } );
+  m_solutionCorrections.clear();
+}
+
 void SolverBase::updateState( DomainPartition & GEOS_UNUSED_PARAM( domain ) )
 {
   GEOS_ERROR( "SolverBase::updateState called!. Should be overridden." );
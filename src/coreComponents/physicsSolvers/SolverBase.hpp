@@ -25,7 +25,9 @@
 #include "mesh/MeshBody.hpp"
 #include "physicsSolvers/NonlinearSolverParameters.hpp"
 #include "physicsSolvers/LinearSolverParameters.hpp"
+#include "physicsSolvers/SolutionExtrapolator.hpp"
 #include "physicsSolvers/SolverStatistics.hpp"
+#include "physicsSolvers/TimeStepController.hpp"
 
 
 #include <limits>
@@ -34,6 +36,7 @@ namespace geos
 {
 
 class DomainPartition;
+template< typename VECTOR > struct GcrodrRecycleSpace;
 
 class SolverBase : public ExecutableGroup
 {
@@ -159,6 +162,14 @@ public:
   virtual real64 setNextDtBasedOnStateChange( real64 const & currentDt,
                                               DomainPartition & domain );
 
+  /**
+   * @brief function to compute the change of the primary variables over the last step relative to the target change
+   * @param[in] domain the domain object
+   * @return the maximum ratio between the change of a primary variable and its target change,
+   *         or a negative value if the solver does not define state change targets
+   */
+  virtual real64 computeNormalizedStateChange( DomainPartition & domain );
+
   /**
    * @brief Entry function for an explicit time integration step
    * @param time_n time at the beginning of the step
@@ -247,6 +258,27 @@ public:
                                          real64 & lastResidual,
                                          real64 & residualNormT );
 
+  /**
+   * @brief Apply the extrapolation of the last converged increments as initial guess of the Newton loop.
+   * @param dt the size of the step that is being attempted
+   * @param domain the domain object
+   * @return true if a prediction has been applied, false otherwise
+   *
+   * The highest extrapolation order allowed by the nonlinear solver parameters and the stored history is
+   * tried first. If the predicted solution does not pass checkSystemSolution (e.g., negative densities),
+   * lower orders are attempted, and the state at the beginning of the step is kept if none of them pass.
+   */
+  bool applySolutionExtrapolation( real64 const & dt,
+                                   DomainPartition & domain );
+
+  /**
+   * @brief Accumulate an applied solution, and the corrections made on top of it, in the increment of the step.
+   * @param localSolution the local solution vector passed to applySystemSolution
+   * @param scalingFactor the factor used to scale @p localSolution
+   */
+  void accumulateAppliedSolution( arrayView1d< real64 const > const & localSolution,
+                                  real64 const scalingFactor );
+
   /**
    * @brief Function for a linear implicit integration step
    * @param time_n time at the beginning of the step
@@ -484,6 +516,15 @@ public:
                        real64 const dt,
                        DomainPartition & domain );
 
+  /**
+   * @brief Add the corrections made to the primary variables by the last call to applySystemSolution
+   *        on top of the scaled solution (e.g., chopping of negative densities).
+   * @param localIncrement the local increment vector, in the ordering of the DofManager passed to applySystemSolution
+   *
+   * The corrections are added at most once, and the increment is unchanged if no correction has been made.
+   */
+  virtual void addSolutionCorrections( arrayView1d< real64 > const & localIncrement );
+
   /**
    * @brief updates the configuration (if needed) based on the state after a converged Newton loop.
    * @param domain the domain containing the mesh and fields
@@ -711,6 +752,17 @@ public:
 
   string getDiscretizationName() const {return m_discretizationName;}
 
+  /**
+   * @brief Get the ghost layer needed by the discretization of this solver on its mesh targets.
+   * @return the ghosting requirement
+   * @note The default (one layer of node neighbors) is what finite element methods need.
+   *       The mesh builds the minimal ghosting satisfying all the solvers acting on it.
+   */
+  virtual GhostingRequirement getGhostingRequirement() const
+  {
+    return GhostingRequirement();
+  }
+
   virtual bool registerCallback( void * func, const std::type_info & funcType ) final override;
 
   SolverStatistics & getSolverStatistics() { return m_solverStatistics; }
@@ -733,6 +785,13 @@ protected:
                                  real64 const oldNewtonNorm,
                                  real64 const weakestTol );
 
+  /**
+   * @brief Get a zeroed vector to record the corrections made to the primary variables in applySystemSolution.
+   * @param dofManager the DofManager passed to applySystemSolution
+   * @return the local vector of corrections, in the ordering of @p dofManager
+   */
+  arrayView1d< real64 > resetSolutionCorrections( DofManager const & dofManager );
+
   /**
    * @brief Get the Constitutive Name object
    *
@@ -783,6 +842,9 @@ protected:
   /// Custom preconditioner for the "native" iterative solver
   std::unique_ptr< PreconditionerBase< LAInterface > > m_precond;
 
+  /// Recycled Krylov subspace kept across linear solves (GCRO-DR only)
+  std::unique_ptr< GcrodrRecycleSpace< ParallelVector > > m_krylovRecycleSpace;
+
   /// Linear solver parameters
   LinearSolverParametersInput m_linearSolverParameters;
 
@@ -795,6 +857,15 @@ protected:
   /// Solver statistics
   SolverStatistics m_solverStatistics;
 
+  /// History of the converged increments used to extrapolate the initial guess of the Newton loop
+  SolutionExtrapolator m_solutionExtrapolator;
+
+  /// History of the accepted time steps used to select the next time step size
+  TimeStepController m_timeStepController;
+
+  /// Corrections made to the primary variables by the last call to applySystemSolution, not yet added to an increment
+  array1d< real64 > m_solutionCorrections;
+
   /// Timestamp of the last call to setup system
   Timestamp m_systemSetupTimestamp;
 
@@ -113,6 +113,13 @@ void SolverStatistics::saveTimeStepStatistics()
   m_numTimeSteps++;
 }
 
+real64 SolverStatistics::timeStepCutRate() const
+{
+  // each cut corresponds to an attempted time step that has been discarded
+  integer const numAttemptedTimeSteps = m_numTimeSteps + m_numTimeStepCuts;
+  return numAttemptedTimeSteps > 0 ? static_cast< real64 >( m_numTimeStepCuts ) / numAttemptedTimeSteps : 0.0;
+}
+
 void SolverStatistics::outputStatistics() const
 {
   bool const printOuterLoopIterations = !(m_numSuccessfulOuterLoopIterations == 0 && m_numDiscardedOuterLoopIterations == 0);
@@ -145,6 +152,8 @@ void SolverStatistics::outputStatistics() const
     }
 
     logStat( "time step cuts", m_numTimeStepCuts );
+    GEOS_LOG_RANK_0( GEOS_FMT( "{}, time step cut rate: {:.2f} %",
+                               getParent().getName(), 100.0 * timeStepCutRate() ) );
     if( printOuterLoopIterations )
     {
       logStat( "discarded outer loop iterations", m_numDiscardedOuterLoopIterations );
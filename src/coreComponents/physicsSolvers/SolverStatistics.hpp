@@ -74,6 +74,12 @@ public:
    */
   void saveTimeStepStatistics();
 
+  /**
+   * @brief Compute the fraction of the attempted time steps that had to be cut
+   * @return the number of time step cuts divided by the number of attempted time steps
+   */
+  real64 timeStepCutRate() const;
+
   /**
    * @brief Output the cumulative statistics to the terminal
    */
@@ -0,0 +1,111 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file TimeStepController.cpp
+ */
+
+#include "TimeStepController.hpp"
+
+namespace geos
+{
+
+namespace
+{
+
+/// Lower bound of the normalized errors, to avoid divisions by zero when the solution does not change
+constexpr real64 minError = 1e-8;
+
+/// Safety factor applied to the time step predicted by the error estimate
+constexpr real64 safetyFactor = 0.9;
+
+/// PID gains (see Valli et al., 2002)
+constexpr real64 kP = 0.075;
+constexpr real64 kI = 0.175;
+constexpr real64 kD = 0.01;
+
+}
+
+void TimeStepController::recordStep( integer const numTimeStepCuts,
+                                     real64 const error )
+{
+  if( numTimeStepCuts > 0 )
+  {
+    m_numStepsSinceLastCut = 0;
+  }
+  else if( m_numStepsSinceLastCut < std::numeric_limits< integer >::max() )
+  {
+    ++m_numStepsSinceLastCut;
+  }
+
+  if( error < 0.0 )
+  {
+    // the history must be made of consecutive steps
+    m_numErrors = 0;
+    return;
+  }
+
+  for( integer k = historySize - 1; k > 0; --k )
+  {
+    m_errors[k] = m_errors[k - 1];
+  }
+  m_errors[0] = LvArray::math::max( error, minError );
+  m_numErrors = LvArray::math::min( m_numErrors + 1, historySize );
+}
+
+real64 TimeStepController::targetChangeDt( real64 const currentDt ) const
+{
+  if( m_numErrors == 0 )
+  {
+    return currentDt;
+  }
+
+  real64 const e0 = m_errors[0];
+  if( m_numErrors < historySize )
+  {
+    return currentDt / e0;
+  }
+
+  real64 const e1 = m_errors[1];
+  real64 const e2 = m_errors[2];
+  return currentDt
+         * std::pow( e1 / e0, kP )
+         * std::pow( 1.0 / e0, kI )
+         * std::pow( e1 * e1 / ( e0 * e2 ), kD );
+}
+
+real64 TimeStepController::errorEstimateDt( real64 const currentDt ) const
+{
+  if( m_numErrors == 0 )
+  {
+    return currentDt;
+  }
+
+  // the local truncation error of a first-order scheme scales with dt^2
+  return currentDt * safetyFactor / std::sqrt( m_errors[0] );
+}
+
+real64 TimeStepController::limitChange( real64 const currentDt,
+                                        real64 const proposedDt,
+                                        real64 const maxIncreaseFactor,
+                                        real64 const minDecreaseFactor,
+                                        integer const growthDelayAfterCut ) const
+{
+  real64 const maxDt = isGrowthDelayed( growthDelayAfterCut ) ? currentDt : currentDt * maxIncreaseFactor;
+  real64 const minDt = currentDt * minDecreaseFactor;
+  return LvArray::math::max( LvArray::math::min( proposedDt, maxDt ), minDt );
+}
+
+} // namespace geos
@@ -0,0 +1,124 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file TimeStepController.hpp
+ */
+
+#ifndef GEOS_PHYSICSSOLVERS_TIMESTEPCONTROLLER_HPP_
+#define GEOS_PHYSICSSOLVERS_TIMESTEPCONTROLLER_HPP_
+
+#include "common/DataTypes.hpp"
+
+namespace geos
+{
+
+/**
+ * @class TimeStepController
+ * @brief Keeps the history of the accepted time steps and computes the next time step size
+ *        from an error measure of the last steps.
+ *
+ * The error measure is provided by the solver after each accepted step, already normalized
+ * by its target value (i.e., a measure equal to one means that the step hit the target exactly).
+ * Two control laws are available:
+ *  - a PID control of the change of the solution over the step (target change);
+ *  - an elementary controller driven by an estimate of the local truncation error of a first-order scheme.
+ * The growth of the time step is limited using the history of time step cuts, and its decrease
+ * is bounded so that a single large error measure does not collapse the time step size.
+ */
+class TimeStepController
+{
+public:
+
+  /// Number of past error measures kept in the history
+  static constexpr integer historySize = 3;
+
+  /**
+   * @brief Record the measures of a newly accepted time step.
+   * @param[in] numTimeStepCuts number of time step cuts needed to achieve the step
+   * @param[in] error error measure of the step normalized by its target, or a negative value if not available
+   */
+  void recordStep( integer const numTimeStepCuts,
+                   real64 const error );
+
+  /**
+   * @brief Compute the next time step size with a PID control of the normalized solution change.
+   * @param[in] currentDt the current time step size
+   * @return the next time step size
+   *
+   * The controller is taken from A.M.P. Valli, G.F. Carey and A.L.G.A. Coutinho,
+   * "Control strategies for timestep selection in simulation of coupled viscous flow
+   * and heat transfer" (Commun. Numer. Meth. Engng, 2002). Until enough history is available,
+   * the time step is simply scaled to hit the target change.
+   */
+  real64 targetChangeDt( real64 const currentDt ) const;
+
+  /**
+   * @brief Compute the next time step size from the normalized estimate of the local truncation error.
+   * @param[in] currentDt the current time step size
+   * @return the next time step size
+   */
+  real64 errorEstimateDt( real64 const currentDt ) const;
+
+  /**
+   * @brief Limit the growth and the decrease of a proposed time step size.
+   * @param[in] currentDt the current time step size
+   * @param[in] proposedDt the proposed time step size
+   * @param[in] maxIncreaseFactor maximum ratio between two consecutive time step sizes
+   * @param[in] minDecreaseFactor minimum ratio between two consecutive time step sizes
+   * @param[in] growthDelayAfterCut number of steps following a cut during which the time step size cannot increase
+   * @return the limited time step size, between @p minDecreaseFactor * @p currentDt and @p maxIncreaseFactor * @p currentDt
+   */
+  real64 limitChange( real64 const currentDt,
+                      real64 const proposedDt,
+                      real64 const maxIncreaseFactor,
+                      real64 const minDecreaseFactor,
+                      integer const growthDelayAfterCut ) const;
+
+  /**
+   * @brief Check whether the time step size is currently not allowed to increase.
+   * @param[in] growthDelayAfterCut number of steps following a cut during which the time step size cannot increase
+   * @return true if a time step cut happened during the last @p growthDelayAfterCut accepted steps
+   */
+  bool isGrowthDelayed( integer const growthDelayAfterCut ) const
+  {
+    return m_numStepsSinceLastCut < growthDelayAfterCut;
+  }
+
+  /**
+   * @return true if an error measure is available for the last accepted step
+   */
+  bool hasError() const { return m_numErrors > 0; }
+
+  /**
+   * @return the error measure of the last accepted step
+   */
+  real64 lastError() const { return m_errors[0]; }
+
+private:
+
+  /// Normalized error measures of the last accepted steps (most recent first)
+  real64 m_errors[historySize]{};
+
+  /// Number of consecutive error measures available in the history
+  integer m_numErrors = 0;
+
+  /// Number of accepted steps since the last time step cut
+  integer m_numStepsSinceLastCut = std::numeric_limits< integer >::max();
+};
+
+} // namespace geos
+
+#endif //GEOS_PHYSICSSOLVERS_TIMESTEPCONTROLLER_HPP_
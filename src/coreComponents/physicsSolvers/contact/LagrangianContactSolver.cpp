@@ -742,10 +742,15 @@ void LagrangianContactSolver::createPreconditioner( DomainPartition const & doma
       // Using LAI implementation of Jacobi preconditioner
       LinearSolverParameters tracParams;
       tracParams.preconditionerType = LinearSolverParameters::PreconditionerType::jacobi;
+      tracParams.mixedPrecision = m_linearSolverParameters.get().mixedPrecision;
       tracPrecond = LAInterface::createPreconditioner( tracParams );
     }
     else if( leadingBlockApproximation == "blockJacobi" )
     {
+      // the Schur complement is built from the block Jacobi matrix, which is stored in double precision
+      GEOS_THROW_IF( m_linearSolverParameters.get().mixedPrecision,
+                     getDataContext() << ": mixed precision is only supported with the jacobi leading block approximation",
+                     InputError );
       precond = std::make_unique< BlockPreconditioner< LAInterface > >( BlockShapeOption::LowerUpperTriangular,
                                                                         SchurComplementOption::FirstBlockUserDefined,
                                                                         BlockScalingOption::UserProvided );
@@ -67,7 +67,8 @@ CompositionalMultiphaseBase::CompositionalMultiphaseBase( const string & name,
   m_hasDispersion( 0 ),
   m_keepFlowVariablesConstantDuringInitStep( 0 ),
   m_minScalingFactor( 0.01 ),
-  m_allowCompDensChopping( 1 )
+  m_allowCompDensChopping( 1 ),
+  m_constitutiveUpdateTolerance( 0.0 )
 {
 //START_SPHINX_INCLUDE_00
   this->registerWrapper( viewKeyStruct::inputTemperatureString(), &m_inputTemperature ).
@@ -122,6 +123,15 @@ CompositionalMultiphaseBase::CompositionalMultiphaseBase( const string & name,
     setApplyDefaultValue( 1 ).
     setDescription( "Flag indicating whether local (cell-wise) chopping of negative compositions is allowed" );
 
+  this->registerWrapper( viewKeyStruct::constitutiveUpdateToleranceString(), &m_constitutiveUpdateTolerance ).
+    setSizedFromParent( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0.0 ).
+    setDescription( "Tolerance on the change of the constitutive inputs of a cell since their last evaluation "
+                    "(relative for pressure and temperature, absolute for component and phase volume fractions) "
+                    "below which the fluid and relative permeability updates of this cell are skipped during the Newton iterations. "
+                    "The default value of 0 means that all the cells are always updated." );
+
 }
 
 void CompositionalMultiphaseBase::postProcessInput()
@@ -164,6 +174,13 @@ void CompositionalMultiphaseBase::postProcessInput()
                         getWrapperDataContext( viewKeyStruct::solutionChangeScalingFactorString() ) <<
                         ": The solution change scaling factor must be smaller or equal to 1.0" );
 
+  GEOS_ERROR_IF_LT_MSG( m_constitutiveUpdateTolerance, 0.0,
+                        getWrapperDataContext( viewKeyStruct::constitutiveUpdateToleranceString() ) <<
+                        ": The constitutive update tolerance must be larger or equal to 0.0" );
+  GEOS_ERROR_IF_GE_MSG( m_constitutiveUpdateTolerance, 1.0,
+                        getWrapperDataContext( viewKeyStruct::constitutiveUpdateToleranceString() ) <<
+                        ": The constitutive update tolerance must be smaller than 1.0" );
+
 }
 
 void CompositionalMultiphaseBase::registerDataOnMesh( Group & meshBodies )
@@ -339,6 +356,17 @@ void CompositionalMultiphaseBase::registerDataOnMesh( Group & meshBodies )
         reference().resizeDimension< 1 >( m_numPhases );
       subRegion.registerField< phaseMobility_n >( getName() ).
         reference().resizeDimension< 1 >( m_numPhases );
+
+      if( m_constitutiveUpdateTolerance > 0.0 )
+      {
+        // needed to skip the constitutive updates of the cells whose inputs did not change
+        subRegion.registerField< pressureAtLastFluidUpdate >( getName() );
+        subRegion.registerField< temperatureAtLastFluidUpdate >( getName() );
+        subRegion.registerField< globalCompFractionAtLastFluidUpdate >( getName() ).
+          reference().resizeDimension< 1 >( m_numComponents );
+        subRegion.registerField< phaseVolumeFractionAtLastRelPermUpdate >( getName() ).
+          reference().resizeDimension< 1 >( m_numPhases );
+      }
     } );
 
     FaceManager & faceManager = mesh.getFaceManager();
@@ -600,7 +628,8 @@ real64 CompositionalMultiphaseBase::updatePhaseVolumeFraction( ObjectManagerBase
   return maxDeltaPhaseVolFrac;
 }
 
-void CompositionalMultiphaseBase::updateFluidModel( ObjectManagerBase & dataGroup ) const
+void CompositionalMultiphaseBase::updateFluidModel( ObjectManagerBase & dataGroup,
+                                                    bool const onlyChangedCells ) const
 {
   GEOS_MARK_FUNCTION;
 
@@ -612,23 +641,52 @@ void CompositionalMultiphaseBase::updateFluidModel( ObjectManagerBase & dataGrou
   string const & fluidName = dataGroup.getReference< string >( viewKeyStruct::fluidNamesString() );
   MultiFluidBase & fluid = getConstitutiveModel< MultiFluidBase >( dataGroup, fluidName );
 
+  array1d< localIndex > activeSet;
+  if( onlyChangedCells )
+  {
+    isothermalCompositionalMultiphaseBaseKernels::
+      ConstitutiveUpdateActiveSetKernel::
+      buildFluidActiveSet( m_constitutiveUpdateTolerance,
+                           pres,
+                           temp,
+                           compFrac,
+                           dataGroup.getField< fields::flow::pressureAtLastFluidUpdate >(),
+                           dataGroup.getField< fields::flow::temperatureAtLastFluidUpdate >(),
+                           dataGroup.getField< fields::flow::globalCompFractionAtLastFluidUpdate >(),
+                           activeSet );
+  }
+
   constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
   {
     using FluidType = TYPEOFREF( castedFluid );
     using ExecPolicy = typename FluidType::exec_policy;
     typename FluidType::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
 
-    thermalCompositionalMultiphaseBaseKernels::
-      FluidUpdateKernel::
-      launch< ExecPolicy >( dataGroup.size(),
-                            fluidWrapper,
-                            pres,
-                            temp,
-                            compFrac );
+    if( onlyChangedCells )
+    {
+      thermalCompositionalMultiphaseBaseKernels::
+        FluidUpdateKernel::
+        launch< ExecPolicy >( activeSet.toViewConst(),
+                              fluidWrapper,
+                              pres,
+                              temp,
+                              compFrac );
+    }
+    else
+    {
+      thermalCompositionalMultiphaseBaseKernels::
+        FluidUpdateKernel::
+        launch< ExecPolicy >( dataGroup.size(),
+                              fluidWrapper,
+                              pres,
+                              temp,
+                              compFrac );
+    }
   } );
 }
 
-void CompositionalMultiphaseBase::updateRelPermModel( ObjectManagerBase & dataGroup ) const
+void CompositionalMultiphaseBase::updateRelPermModel( ObjectManagerBase & dataGroup,
+                                                      bool const onlyChangedCells ) const
 {
   GEOS_MARK_FUNCTION;
 
@@ -638,15 +696,37 @@ void CompositionalMultiphaseBase::updateRelPermModel( ObjectManagerBase & dataGr
   string const & relPermName = dataGroup.getReference< string >( viewKeyStruct::relPermNamesString() );
   RelativePermeabilityBase & relPerm = getConstitutiveModel< RelativePermeabilityBase >( dataGroup, relPermName );
 
+  array1d< localIndex > activeSet;
+  if( onlyChangedCells )
+  {
+    isothermalCompositionalMultiphaseBaseKernels::
+      ConstitutiveUpdateActiveSetKernel::
+      buildRelPermActiveSet( m_constitutiveUpdateTolerance,
+                             phaseVolFrac,
+                             dataGroup.getField< fields::flow::phaseVolumeFractionAtLastRelPermUpdate >(),
+                             activeSet );
+  }
+
   constitutive::constitutiveUpdatePassThru( relPerm, [&] ( auto & castedRelPerm )
   {
     typename TYPEOFREF( castedRelPerm ) ::KernelWrapper relPermWrapper = castedRelPerm.createKernelWrapper();
 
-    isothermalCompositionalMultiphaseBaseKernels::
-      RelativePermeabilityUpdateKernel::
-      launch< parallelDevicePolicy<> >( dataGroup.size(),
-                                        relPermWrapper,
-                                        phaseVolFrac );
+    if( onlyChangedCells )
+    {
+      isothermalCompositionalMultiphaseBaseKernels::
+        RelativePermeabilityUpdateKernel::
+        launch< parallelDevicePolicy<> >( activeSet.toViewConst(),
+                                          relPermWrapper,
+                                          phaseVolFrac );
+    }
+    else
+    {
+      isothermalCompositionalMultiphaseBaseKernels::
+        RelativePermeabilityUpdateKernel::
+        launch< parallelDevicePolicy<> >( dataGroup.size(),
+                                          relPermWrapper,
+                                          phaseVolFrac );
+    }
   } );
 }
 
@@ -697,10 +777,13 @@ real64 CompositionalMultiphaseBase::updateFluidState( ObjectManagerBase & subReg
 {
   GEOS_MARK_FUNCTION;
 
+  // with a constitutive update tolerance, the cells whose inputs did not change enough keep their properties
+  bool const onlyChangedCells = m_constitutiveUpdateTolerance > 0.0;
+
   updateComponentFraction( subRegion );
-  updateFluidModel( subRegion );
+  updateFluidModel( subRegion, onlyChangedCells );
   real64 const maxDeltaPhaseVolFrac = updatePhaseVolumeFraction( subRegion );
-  updateRelPermModel( subRegion );
+  updateRelPermModel( subRegion, onlyChangedCells );
   updatePhaseMobility( subRegion );
   updateCapPressureModel( subRegion );
 
@@ -1892,7 +1975,8 @@ void CompositionalMultiphaseBase::keepFlowVariablesConstantDuringInitStep( real6
   } );
 }
 
-void CompositionalMultiphaseBase::chopNegativeDensities( DomainPartition & domain )
+void CompositionalMultiphaseBase::chopNegativeDensities( DofManager const & dofManager,
+                                                        DomainPartition & domain )
 {
   GEOS_MARK_FUNCTION;
 
@@ -1900,6 +1984,11 @@ void CompositionalMultiphaseBase::chopNegativeDensities( DomainPartition & domai
 
   integer const numComp = m_numComponents;
 
+  // the chopped amounts are part of the increment of the step
+  arrayView1d< real64 > const corrections = resetSolutionCorrections( dofManager );
+  globalIndex const rankOffset = dofManager.rankOffset();
+  string const dofKey = dofManager.getKey( viewKeyStruct::elemDofFieldString() );
+
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
                                                                arrayView1d< string const > const & regionNames )
@@ -1909,6 +1998,7 @@ void CompositionalMultiphaseBase::chopNegativeDensities( DomainPartition & domai
                                                      ElementSubRegionBase & subRegion )
     {
       arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+      arrayView1d< globalIndex const > const dofNumber = subRegion.getReference< array1d< globalIndex > >( dofKey );
 
       arrayView2d< real64, compflow::USD_COMP > const compDens =
         subRegion.getField< fields::flow::globalCompDensity >();
@@ -1921,6 +2011,7 @@ void CompositionalMultiphaseBase::chopNegativeDensities( DomainPartition & domai
           {
             if( compDens[ei][ic] < minDensForDivision )
             {
+              corrections[dofNumber[ei] - rankOffset + ic + 1] = minDensForDivision - compDens[ei][ic];
               compDens[ei][ic] = minDensForDivision;
             }
           }
@@ -1930,29 +2021,23 @@ void CompositionalMultiphaseBase::chopNegativeDensities( DomainPartition & domai
   } );
 }
 
-real64 CompositionalMultiphaseBase::setNextDtBasedOnStateChange( real64 const & currentDt,
-                                                                 DomainPartition & domain )
+void CompositionalMultiphaseBase::computeMaxStateChange( DomainPartition const & domain,
+                                                        real64 & maxRelativePresChange,
+                                                        real64 & maxRelativeTempChange,
+                                                        real64 & maxAbsolutePhaseVolFracChange ) const
 {
-  if( m_targetRelativePresChange >= 1.0 &&
-      m_targetPhaseVolFracChange >= 1.0 &&
-      ( !m_isThermal || m_targetRelativeTempChange >= 1.0 ) )
-  {
-    return LvArray::NumericLimits< real64 >::max;
-  }
-
-  real64 maxRelativePresChange = 0.0;
-  real64 maxRelativeTempChange = 0.0;
-  real64 maxAbsolutePhaseVolFracChange = 0.0;
-
+  maxRelativePresChange = 0.0;
+  maxRelativeTempChange = 0.0;
+  maxAbsolutePhaseVolFracChange = 0.0;
   real64 const numPhase = m_numPhases;
 
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
-                                                               MeshLevel & mesh,
+                                                               MeshLevel const & mesh,
                                                                arrayView1d< string const > const & regionNames )
   {
     mesh.getElemManager().forElementSubRegions( regionNames,
                                                 [&]( localIndex const,
-                                                     ElementSubRegionBase & subRegion )
+                                                     ElementSubRegionBase const & subRegion )
     {
       arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
 
@@ -1991,6 +2076,26 @@ real64 CompositionalMultiphaseBase::setNextDtBasedOnStateChange( real64 const &
 
   maxRelativePresChange = MpiWrapper::max( maxRelativePresChange );
   maxAbsolutePhaseVolFracChange = MpiWrapper::max( maxAbsolutePhaseVolFracChange );
+  if( m_isThermal )
+  {
+    maxRelativeTempChange = MpiWrapper::max( maxRelativeTempChange );
+  }
+}
+
+real64 CompositionalMultiphaseBase::setNextDtBasedOnStateChange( real64 const & currentDt,
+                                                                 DomainPartition & domain )
+{
+  if( m_targetRelativePresChange >= 1.0 &&
+      m_targetPhaseVolFracChange >= 1.0 &&
+      ( !m_isThermal || m_targetRelativeTempChange >= 1.0 ) )
+  {
+    return LvArray::NumericLimits< real64 >::max;
+  }
+
+  real64 maxRelativePresChange = 0.0;
+  real64 maxRelativeTempChange = 0.0;
+  real64 maxAbsolutePhaseVolFracChange = 0.0;
+  computeMaxStateChange( domain, maxRelativePresChange, maxRelativeTempChange, maxAbsolutePhaseVolFracChange );
 
   GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "{}: Max relative pressure change during time step: {} %",
                                       getName(), fmt::format( "{:.{}f}", 100*maxRelativePresChange, 3 ) ) );
@@ -1999,7 +2104,6 @@ real64 CompositionalMultiphaseBase::setNextDtBasedOnStateChange( real64 const &
 
   if( m_isThermal )
   {
-    maxRelativeTempChange = MpiWrapper::max( maxRelativeTempChange );
     GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "{}: Max relative temperature change during time step: {} %",
                                         getName(), fmt::format( "{:.{}f}", 100*maxRelativeTempChange, 3 ) ) );
   }
@@ -2018,6 +2122,37 @@ real64 CompositionalMultiphaseBase::setNextDtBasedOnStateChange( real64 const &
   return std::min( std::min( nextDtPressure, nextDtPhaseVolFrac ), nextDtTemperature );
 }
 
+real64 CompositionalMultiphaseBase::computeNormalizedStateChange( DomainPartition & domain )
+{
+  if( m_targetRelativePresChange >= 1.0 &&
+      m_targetPhaseVolFracChange >= 1.0 &&
+      ( !m_isThermal || m_targetRelativeTempChange >= 1.0 ) )
+  {
+    return -1.0;
+  }
+
+  real64 maxRelativePresChange = 0.0;
+  real64 maxRelativeTempChange = 0.0;
+  real64 maxAbsolutePhaseVolFracChange = 0.0;
+  computeMaxStateChange( domain, maxRelativePresChange, maxRelativeTempChange, maxAbsolutePhaseVolFracChange );
+
+  // a target greater or equal to one means that the corresponding change is not controlled
+  real64 normalizedChange = 0.0;
+  if( m_targetRelativePresChange < 1.0 )
+  {
+    normalizedChange = LvArray::math::max( normalizedChange, maxRelativePresChange / m_targetRelativePresChange );
+  }
+  if( m_targetPhaseVolFracChange < 1.0 )
+  {
+    normalizedChange = LvArray::math::max( normalizedChange, maxAbsolutePhaseVolFracChange / m_targetPhaseVolFracChange );
+  }
+  if( m_isThermal && m_targetRelativeTempChange < 1.0 )
+  {
+    normalizedChange = LvArray::math::max( normalizedChange, maxRelativeTempChange / m_targetRelativeTempChange );
+  }
+  return normalizedChange;
+}
+
 void CompositionalMultiphaseBase::resetStateToBeginningOfStep( DomainPartition & domain )
 {
   GEOS_MARK_FUNCTION;
@@ -2195,6 +2330,9 @@ void CompositionalMultiphaseBase::updateState( DomainPartition & domain )
                                                                MeshLevel & mesh,
                                                                arrayView1d< string const > const & regionNames )
   {
+    // the ghost values of the primary variables are read below
+    CommunicationTools::getInstance().checkNoPendingSynchronization( mesh );
+
     mesh.getElemManager().forElementSubRegions< CellElementSubRegion,
                                                 SurfaceElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                              auto & subRegion )
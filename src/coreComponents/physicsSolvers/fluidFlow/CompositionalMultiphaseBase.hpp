@@ -122,14 +122,20 @@ public:
   /**
    * @brief Update all relevant fluid models using current values of pressure and composition
    * @param dataGroup the group storing the required fields
+   * @param onlyChangedCells if true, only update the cells whose pressure, temperature or composition
+   *                         changed by more than the constitutive update tolerance since their last update
    */
-  void updateFluidModel( ObjectManagerBase & dataGroup ) const;
+  void updateFluidModel( ObjectManagerBase & dataGroup,
+                         bool const onlyChangedCells = false ) const;
 
   /**
    * @brief Update all relevant relperm models using current values of phase volume fraction
    * @param dataGroup the group storing the required fields
+   * @param onlyChangedCells if true, only update the cells whose phase volume fractions
+   *                         changed by more than the constitutive update tolerance since their last update
    */
-  void updateRelPermModel( ObjectManagerBase & dataGroup ) const;
+  void updateRelPermModel( ObjectManagerBase & dataGroup,
+                           bool const onlyChangedCells = false ) const;
 
   /**
    * @brief Update all relevant capillary pressure models using current values of phase volume fraction
@@ -253,6 +259,7 @@ public:
     static constexpr char const * maxRelativePresChangeString() { return "maxRelativePressureChange"; }
     static constexpr char const * maxRelativeTempChangeString() { return "maxRelativeTemperatureChange"; }
     static constexpr char const * allowLocalCompDensChoppingString() { return "allowLocalCompDensityChopping"; }
+    static constexpr char const * constitutiveUpdateToleranceString() { return "constitutiveUpdateTolerance"; }
 
   };
 
@@ -348,19 +355,35 @@ public:
 
   /**
    * @brief Sets all the negative component densities (if any) to zero.
+   * @param dofManager the DofManager passed to applySystemSolution, used to record the corrections of the densities
    * @param domain the physical domain object
    */
-  void chopNegativeDensities( DomainPartition & domain );
+  void chopNegativeDensities( DofManager const & dofManager,
+                              DomainPartition & domain );
 
   virtual real64 setNextDtBasedOnStateChange( real64 const & currentDt,
                                               DomainPartition & domain ) override;
 
+  virtual real64 computeNormalizedStateChange( DomainPartition & domain ) override;
+
   virtual void initializePostInitialConditionsPreSubGroups() override;
 
 protected:
 
   virtual void postProcessInput() override;
 
+  /**
+   * @brief Compute the maximum change of the primary variables since the beginning of the time step
+   * @param[in] domain the domain partition
+   * @param[out] maxRelativePresChange the maximum relative pressure change
+   * @param[out] maxRelativeTempChange the maximum relative temperature change (thermal case only)
+   * @param[out] maxAbsolutePhaseVolFracChange the maximum absolute phase volume fraction change
+   */
+  void computeMaxStateChange( DomainPartition const & domain,
+                              real64 & maxRelativePresChange,
+                              real64 & maxRelativeTempChange,
+                              real64 & maxAbsolutePhaseVolFracChange ) const;
+
   virtual void initializePreSubGroups() override;
 
   /**
@@ -445,6 +468,9 @@ protected:
   /// flag indicating whether local (cell-wise) chopping of negative compositions is allowed
   integer m_allowCompDensChopping;
 
+  /// tolerance on the change of the constitutive inputs below which the fluid and relperm updates of a cell are skipped
+  real64 m_constitutiveUpdateTolerance;
+
   /// name of the fluid constitutive model used as a reference for component/phase description
   string m_referenceFluidModelName;
 
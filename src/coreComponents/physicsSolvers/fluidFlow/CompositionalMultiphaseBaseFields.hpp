@@ -175,6 +175,38 @@ DECLARE_FIELD( globalCompDensityScalingFactor,
                NO_WRITE,
                "Scaling factors for global component densities" );
 
+DECLARE_FIELD( pressureAtLastFluidUpdate,
+               "pressureAtLastFluidUpdate",
+               array1d< real64 >,
+               -1,
+               NOPLOT,
+               NO_WRITE,
+               "Pressure at the last evaluation of the fluid model (only used with a constitutive update tolerance)" );
+
+DECLARE_FIELD( temperatureAtLastFluidUpdate,
+               "temperatureAtLastFluidUpdate",
+               array1d< real64 >,
+               -1,
+               NOPLOT,
+               NO_WRITE,
+               "Temperature at the last evaluation of the fluid model (only used with a constitutive update tolerance)" );
+
+DECLARE_FIELD( globalCompFractionAtLastFluidUpdate,
+               "globalCompFractionAtLastFluidUpdate",
+               array2dLayoutComp,
+               -1,
+               NOPLOT,
+               NO_WRITE,
+               "Global component fraction at the last evaluation of the fluid model (only used with a constitutive update tolerance)" );
+
+DECLARE_FIELD( phaseVolumeFractionAtLastRelPermUpdate,
+               "phaseVolumeFractionAtLastRelPermUpdate",
+               array2dLayoutPhase,
+               -1,
+               NOPLOT,
+               NO_WRITE,
+               "Phase volume fraction at the last evaluation of the relative permeability model (only used with a constitutive update tolerance)" );
+
 }
 
 }
@@ -620,7 +620,7 @@ void CompositionalMultiphaseFVM::applySystemSolution( DofManager const & dofMana
   // these negative component densities are set to zero in this function
   if( m_allowCompDensChopping )
   {
-    chopNegativeDensities( domain );
+    chopNegativeDensities( dofManager, domain );
   }
 
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
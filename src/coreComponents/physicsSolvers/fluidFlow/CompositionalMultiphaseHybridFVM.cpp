@@ -741,7 +741,7 @@ void CompositionalMultiphaseHybridFVM::applySystemSolution( DofManager const & d
   // these negative component densities are set to zero in this function
   if( m_allowCompDensChopping )
   {
-    chopNegativeDensities( domain );
+    chopNegativeDensities( dofManager, domain );
   }
 
   // 2. apply the face-based update
@@ -28,6 +28,7 @@
 #include "fieldSpecification/SourceFluxBoundaryCondition.hpp"
 #include "finiteVolume/FiniteVolumeManager.hpp"
 #include "finiteVolume/FluxApproximationBase.hpp"
+#include "finiteVolume/TwoPointFluxApproximation.hpp"
 #include "mesh/DomainPartition.hpp"
 #include "physicsSolvers/fluidFlow/FluxKernelsHelper.hpp"
 #include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
@@ -125,6 +126,20 @@ FlowSolverBase::FlowSolverBase( string const & name,
   getNonlinearSolverParameters().getWrapper< solverBaseKernels::NormType >( NonlinearSolverParameters::viewKeysStruct::normTypeString() ).setInputFlag( InputFlags::OPTIONAL );
 }
 
+GhostingRequirement FlowSolverBase::getGhostingRequirement() const
+{
+  GhostingRequirement ghosting = SolverBase::getGhostingRequirement();
+
+  // Two-point stencils only connect cells sharing a face, there is no need to ghost the cells touching a corner
+  DomainPartition const & domain = this->getGroupByPath< DomainPartition >( "/Problem/domain" );
+  FiniteVolumeManager const & fvManager = domain.getNumericalMethodManager().getFiniteVolumeManager();
+  if( fvManager.hasGroup< TwoPointFluxApproximation >( m_discretizationName ) )
+  {
+    ghosting.faceNeighborsOnly = true;
+  }
+  return ghosting;
+}
+
 void FlowSolverBase::registerDataOnMesh( Group & meshBodies )
 {
   SolverBase::registerDataOnMesh( meshBodies );
@@ -63,6 +63,8 @@ public:
 
   virtual void registerDataOnMesh( Group & MeshBodies ) override;
 
+  virtual GhostingRequirement getGhostingRequirement() const override;
+
   localIndex numDofPerCell() const { return m_numDofPerCell; }
 
   struct viewKeyStruct : SolverBase::viewKeyStruct
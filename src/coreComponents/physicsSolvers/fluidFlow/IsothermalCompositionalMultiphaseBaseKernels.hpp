@@ -455,6 +455,147 @@ public:
 };
 
 
+/******************************** ConstitutiveUpdateActiveSetKernel ********************************/
+
+/**
+ * @struct ConstitutiveUpdateActiveSetKernel
+ * @brief Collect the cells whose constitutive inputs changed by more than a tolerance since their last evaluation
+ *
+ * The inputs of the collected cells are saved as the new reference values, so the error made on
+ * the other cells stays bounded by the tolerance however many updates are skipped.
+ * The reference values are initialized to -1 (see the *AtLast*Update fields), which guarantees
+ * that all the cells are collected the first time.
+ *
+ * The active set is built on device: the changed cells are flagged, the flags are scanned to
+ * get the position of each cell in the set, and the flagged cells are compacted in increasing order.
+ */
+struct ConstitutiveUpdateActiveSetKernel
+{
+  /**
+   * @brief Collect the cells whose fluid model inputs changed
+   * @param[in] tol relative tolerance on pressure and temperature, and absolute tolerance on component fractions
+   * @param[in] pres the pressure
+   * @param[in] temp the temperature
+   * @param[in] compFrac the global component fractions
+   * @param[inout] presRef the pressure at the last fluid update
+   * @param[inout] tempRef the temperature at the last fluid update
+   * @param[inout] compFracRef the global component fractions at the last fluid update
+   * @param[out] activeSet the sorted list of the cells to update
+   */
+  static void
+  buildFluidActiveSet( real64 const tol,
+                       arrayView1d< real64 const > const & pres,
+                       arrayView1d< real64 const > const & temp,
+                       arrayView2d< real64 const, compflow::USD_COMP > const & compFrac,
+                       arrayView1d< real64 > const & presRef,
+                       arrayView1d< real64 > const & tempRef,
+                       arrayView2d< real64, compflow::USD_COMP > const & compFracRef,
+                       array1d< localIndex > & activeSet )
+  {
+    localIndex const size = pres.size();
+    array1d< localIndex > offsets( size + 1 );
+    arrayView1d< localIndex > const isActive = offsets.toView();
+    RAJA::ReduceSum< ReducePolicy< parallelDevicePolicy<> >, localIndex > numActive( 0 );
+
+    forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      integer const numComp = compFrac.size( 1 );
+      bool changed = LvArray::math::abs( pres[k] - presRef[k] ) > tol * LvArray::math::abs( presRef[k] )
+                     || LvArray::math::abs( temp[k] - tempRef[k] ) > tol * LvArray::math::abs( tempRef[k] );
+      for( integer ic = 0; ic < numComp && !changed; ++ic )
+      {
+        changed = LvArray::math::abs( compFrac[k][ic] - compFracRef[k][ic] ) > tol;
+      }
+
+      isActive[k+1] = changed ? 1 : 0;
+      if( changed )
+      {
+        numActive += 1;
+        presRef[k] = pres[k];
+        tempRef[k] = temp[k];
+        for( integer ic = 0; ic < numComp; ++ic )
+        {
+          compFracRef[k][ic] = compFrac[k][ic];
+        }
+      }
+    } );
+
+    compactActiveSet( offsets, numActive.get(), activeSet );
+  }
+
+  /**
+   * @brief Collect the cells whose relative permeability model inputs changed
+   * @param[in] tol absolute tolerance on phase volume fractions
+   * @param[in] phaseVolFrac the phase volume fractions
+   * @param[inout] phaseVolFracRef the phase volume fractions at the last relative permeability update
+   * @param[out] activeSet the sorted list of the cells to update
+   */
+  static void
+  buildRelPermActiveSet( real64 const tol,
+                         arrayView2d< real64 const, compflow::USD_PHASE > const & phaseVolFrac,
+                         arrayView2d< real64, compflow::USD_PHASE > const & phaseVolFracRef,
+                         array1d< localIndex > & activeSet )
+  {
+    localIndex const size = phaseVolFrac.size( 0 );
+    array1d< localIndex > offsets( size + 1 );
+    arrayView1d< localIndex > const isActive = offsets.toView();
+    RAJA::ReduceSum< ReducePolicy< parallelDevicePolicy<> >, localIndex > numActive( 0 );
+
+    forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      integer const numPhase = phaseVolFrac.size( 1 );
+      bool changed = false;
+      for( integer ip = 0; ip < numPhase && !changed; ++ip )
+      {
+        changed = LvArray::math::abs( phaseVolFrac[k][ip] - phaseVolFracRef[k][ip] ) > tol;
+      }
+
+      isActive[k+1] = changed ? 1 : 0;
+      if( changed )
+      {
+        numActive += 1;
+        for( integer ip = 0; ip < numPhase; ++ip )
+        {
+          phaseVolFracRef[k][ip] = phaseVolFrac[k][ip];
+        }
+      }
+    } );
+
+    compactActiveSet( offsets, numActive.get(), activeSet );
+  }
+
+  /**
+   * @brief Compact the flagged cells into a sorted list
+   * @param[inout] offsets the flag of cell k in entry k+1 (entry 0 is zero), scanned in place into the position of the cells
+   * @param[in] numActive the number of flagged cells
+   * @param[out] activeSet the sorted list of the flagged cells
+   */
+  static void
+  compactActiveSet( array1d< localIndex > & offsets,
+                    localIndex const numActive,
+                    array1d< localIndex > & activeSet )
+  {
+    activeSet.resize( numActive );
+    if( numActive == 0 )
+    {
+      return;
+    }
+
+    offsets.move( parallelDeviceMemorySpace );
+    RAJA::inclusive_scan_inplace< parallelDevicePolicy<> >( RAJA::make_span( offsets.data(), offsets.size() ) );
+
+    arrayView1d< localIndex const > const position = offsets.toViewConst();
+    arrayView1d< localIndex > const activeSetView = activeSet.toView();
+    forAll< parallelDevicePolicy<> >( offsets.size() - 1, [=] GEOS_HOST_DEVICE ( localIndex const k )
+    {
+      if( position[k+1] > position[k] )
+      {
+        activeSetView[position[k]] = k;
+      }
+    } );
+  }
+};
+
 /******************************** RelativePermeabilityUpdateKernel ********************************/
 
 struct RelativePermeabilityUpdateKernel
@@ -489,6 +630,22 @@ struct RelativePermeabilityUpdateKernel
       }
     } );
   }
+
+  template< typename POLICY, typename RELPERM_WRAPPER >
+  static void
+  launch( arrayView1d< localIndex const > const & targetList,
+          RELPERM_WRAPPER const & relPermWrapper,
+          arrayView2d< real64 const, compflow::USD_PHASE > const & phaseVolFrac )
+  {
+    forAll< POLICY >( targetList.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+    {
+      localIndex const k = targetList[a];
+      for( localIndex q = 0; q < relPermWrapper.numGauss(); ++q )
+      {
+        relPermWrapper.update( k, q, phaseVolFrac[k] );
+      }
+    } );
+  }
 };
 
 /******************************** CapillaryPressureUpdateKernel ********************************/
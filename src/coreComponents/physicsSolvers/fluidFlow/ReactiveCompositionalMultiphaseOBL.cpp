@@ -42,8 +42,11 @@ using namespace reactiveCompositionalMultiphaseOBLKernels;
 namespace
 {
 
-MultivariableTableFunction const * makeOBLOperatorsTable( string const & OBLOperatorsTableFile,
-                                                          FunctionManager & functionManager )
+MultivariableTableFunction * makeOBLOperatorsTable( string const & OBLOperatorsTableFile,
+                                                    bool const useNodeSharedStorage,
+                                                    MultivariableTableFunction::PointGenerator pointGenerator,
+                                                    string const & pointCacheFile,
+                                                    FunctionManager & functionManager )
 {
   string const tableName = "OBL_operators_table";
   if( functionManager.hasGroup< MultivariableTableFunction >( tableName ) )
@@ -53,7 +56,14 @@ MultivariableTableFunction const * makeOBLOperatorsTable( string const & OBLOper
   else
   {
     MultivariableTableFunction * const table = dynamicCast< MultivariableTableFunction * >( functionManager.createChild( "MultivariableTableFunction", tableName ) );
-    table->initializeFunctionFromFile ( OBLOperatorsTableFile );
+    if( pointGenerator )
+    {
+      table->initializeAdaptiveFunctionFromFile( OBLOperatorsTableFile, std::move( pointGenerator ), pointCacheFile );
+    }
+    else
+    {
+      table->initializeFunctionFromFile ( OBLOperatorsTableFile, useNodeSharedStorage );
+    }
     return table;
   }
 }
@@ -86,6 +96,27 @@ ReactiveCompositionalMultiphaseOBL::ReactiveCompositionalMultiphaseOBL( const st
     setRestartFlags( RestartFlags::NO_WRITE ).
     setDescription( "File containing OBL operator values" );
 
+  this->registerWrapper( viewKeyStruct::OBLOperatorsTableSharedMemoryString(), &m_OBLOperatorsTableSharedMemory ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Flag indicating whether the OBL operators table is read by a single rank per node and stored once per node "
+                    "in MPI shared memory, instead of once per rank. Only used in CPU builds, and not compatible with " +
+                    string( viewKeyStruct::OBLOperatorsFunctionNamesString() ) );
+
+  this->registerWrapper( viewKeyStruct::OBLOperatorsFunctionNamesString(), &m_OBLOperatorsFunctionNames ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Names of the functions (one per OBL operator, taking the OBL state as input) used to generate the operator values on demand. "
+                    "If provided, only the table axes are read from the OBL operators table file, and the operators are only evaluated "
+                    "at the vertices of the table hypercubes visited during the simulation" );
+
+  this->registerWrapper( viewKeyStruct::OBLOperatorsCacheFileString(), &m_OBLOperatorsCacheFile ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "File in which the OBL operator values generated on demand are saved, and from which they are read back in "
+                    "subsequent runs. Only used if " + string( viewKeyStruct::OBLOperatorsFunctionNamesString() ) + " is provided" );
+
   this->registerWrapper( viewKeyStruct::maxCompFracChangeString(), &m_maxCompFracChange ).
     setApplyDefaultValue( 1.0 ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -197,7 +228,41 @@ void ReactiveCompositionalMultiphaseOBL::postProcessInput()
                                   getWrapperDataContext( viewKeyStruct::maxCompFracChangeString() ), m_maxCompFracChange ),
                         InputError );
 
-  m_OBLOperatorsTable = makeOBLOperatorsTable( m_OBLOperatorsTableFile, FunctionManager::getInstance());
+  // adaptive table: the operators are evaluated on demand with the user-provided functions
+  FunctionManager & functionManager = FunctionManager::getInstance();
+  MultivariableTableFunction::PointGenerator pointGenerator;
+  if( !m_OBLOperatorsFunctionNames.empty() )
+  {
+    // the generated hypercubes are stored per rank, the shared table is only filled once from file
+    GEOS_THROW_IF( m_OBLOperatorsTableSharedMemory,
+                   GEOS_FMT( "{}: the OBL operators table cannot be stored in shared memory when its values are generated on demand with {}",
+                             getWrapperDataContext( viewKeyStruct::OBLOperatorsTableSharedMemoryString() ),
+                             viewKeyStruct::OBLOperatorsFunctionNamesString() ),
+                   InputError );
+
+    std::vector< FunctionBase const * > operatorFunctions;
+    for( string const & functionName : m_OBLOperatorsFunctionNames )
+    {
+      GEOS_THROW_IF( !functionManager.hasGroup< FunctionBase >( functionName ),
+                     GEOS_FMT( "{}: function {} not found",
+                               getWrapperDataContext( viewKeyStruct::OBLOperatorsFunctionNamesString() ), functionName ),
+                     InputError );
+      operatorFunctions.push_back( &functionManager.getGroup< FunctionBase >( functionName ) );
+    }
+    pointGenerator = [operatorFunctions]( real64 const * const coordinates, real64 * const values )
+    {
+      for( std::size_t op = 0; op < operatorFunctions.size(); ++op )
+      {
+        values[op] = operatorFunctions[op]->evaluate( coordinates );
+      }
+    };
+  }
+
+  m_OBLOperatorsTable = makeOBLOperatorsTable( m_OBLOperatorsTableFile,
+                                               m_OBLOperatorsTableSharedMemory,
+                                               std::move( pointGenerator ),
+                                               m_OBLOperatorsCacheFile,
+                                               functionManager );
 
   // Equations: [NC] Molar mass balance, ([1] energy balance if enabled)
   // Primary variables: [1] pressure, [NC-1] global component fractions, ([1] temperature)
@@ -221,6 +286,11 @@ void ReactiveCompositionalMultiphaseOBL::postProcessInput()
                                   m_OBLOperatorsTableFile ),
                         InputError );
 
+  GEOS_THROW_IF( !m_OBLOperatorsFunctionNames.empty() && m_OBLOperatorsFunctionNames.size() != m_numOBLOperators,
+                 GEOS_FMT( "{}: {} functions are expected, one per OBL operator, but {} are provided",
+                           getWrapperDataContext( viewKeyStruct::OBLOperatorsFunctionNamesString() ),
+                           m_numOBLOperators, m_OBLOperatorsFunctionNames.size() ),
+                 InputError );
 }
 
 void ReactiveCompositionalMultiphaseOBL::registerDataOnMesh( Group & meshBodies )
@@ -534,7 +604,7 @@ void ReactiveCompositionalMultiphaseOBL::applySystemSolution( DofManager const &
 
   if( m_allowOBLChopping )
   {
-    chopPrimaryVariables( domain );
+    chopPrimaryVariables( dofManager, domain );
   }
 
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
@@ -609,6 +679,8 @@ ReactiveCompositionalMultiphaseOBL::implicitStepSetup( real64 const & GEOS_UNUSE
                                                        real64 const & GEOS_UNUSED_PARAM( dt ),
                                                        DomainPartition & domain )
 {
+  generateOBLHypercubes( domain );
+
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
                                                                arrayView1d< string const > const & regionNames )
@@ -1209,11 +1281,17 @@ void ReactiveCompositionalMultiphaseOBL::applyDirichletBC( real64 const time,
   } );
 }
 
-void ReactiveCompositionalMultiphaseOBL::chopPrimaryVariables( DomainPartition & domain )
+void ReactiveCompositionalMultiphaseOBL::chopPrimaryVariables( DofManager const & dofManager,
+                                                               DomainPartition & domain )
 {
   real64 const eps = LvArray::NumericLimits< real64 >::epsilon;
   integer const numComp = m_numComponents;
 
+  // the chopped amounts are part of the increment of the step
+  arrayView1d< real64 > const corrections = resetSolutionCorrections( dofManager );
+  globalIndex const rankOffset = dofManager.rankOffset();
+  string const dofKey = dofManager.getKey( viewKeyStruct::elemDofFieldString() );
+
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
                                                                arrayView1d< string const > const & regionNames )
@@ -1222,12 +1300,22 @@ void ReactiveCompositionalMultiphaseOBL::chopPrimaryVariables( DomainPartition &
                                                 [&]( localIndex const,
                                                      ElementSubRegionBase & subRegion )
     {
+      arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+      arrayView1d< globalIndex const > const dofNumber = subRegion.getReference< array1d< globalIndex > >( dofKey );
       arrayView2d< real64, compflow::USD_COMP > const compFrac =
         subRegion.template getField< fields::flow::globalCompFraction >();
 
       forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const ei )
       {
         bool isScalingRequired = false;
+        localIndex const localRow = ( ghostRank[ei] < 0 ) ? dofNumber[ei] - rankOffset : -1;
+        if( localRow >= 0 )
+        {
+          for( integer ic = 0; ic < numComp-1; ++ic )
+          {
+            corrections[localRow + ic + 1] = -compFrac[ei][ic];
+          }
+        }
 
         // the following code implements the DARTS local chopping of component fractions
 
@@ -1266,6 +1354,14 @@ void ReactiveCompositionalMultiphaseOBL::chopPrimaryVariables( DomainPartition &
           }
         }
 
+        if( localRow >= 0 )
+        {
+          for( integer ic = 0; ic < numComp-1; ++ic )
+          {
+            corrections[localRow + ic + 1] += compFrac[ei][ic];
+          }
+        }
+
       } );
     } );
 
@@ -1310,7 +1406,8 @@ void ReactiveCompositionalMultiphaseOBL::resetStateToBeginningOfStep( DomainPart
         temp.setValues< parallelDevicePolicy<> >( temp_n );
       }
 
-      // update operator values
+      // update operator values (with an adaptive table, the hypercubes visited by the states
+      // at the beginning of the step have been generated in implicitStepSetup)
       updateOBLOperators( subRegion );
 
     } );
@@ -1331,8 +1428,50 @@ void ReactiveCompositionalMultiphaseOBL::updateOBLOperators( ObjectManagerBase &
 }
 
 
+void ReactiveCompositionalMultiphaseOBL::generateOBLHypercubes( DomainPartition & domain )
+{
+  GEOS_MARK_FUNCTION;
+
+  if( !m_OBLOperatorsTable->isAdaptive() )
+  {
+    return;
+  }
+
+  // collect the hypercubes containing the states of all the local elements
+  std::vector< globalIndex > visitedHypercubes;
+  forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
+                                                               MeshLevel & mesh,
+                                                               arrayView1d< string const > const & regionNames )
+  {
+    mesh.getElemManager().forElementSubRegions( regionNames,
+                                                [&]( localIndex const,
+                                                     ElementSubRegionBase & subRegion )
+    {
+      array1d< globalIndex > hypercubeIndices( subRegion.size() );
+      OBLOperatorsKernelFactory::
+        createAndLaunchHypercubeIndices< parallelDevicePolicy<> >( m_numPhases,
+                                                                   m_numComponents,
+                                                                   m_enableEnergyBalance,
+                                                                   subRegion,
+                                                                   *m_OBLOperatorsTable,
+                                                                   hypercubeIndices.toView() );
+      hypercubeIndices.move( hostMemorySpace, false );
+      visitedHypercubes.insert( visitedHypercubes.end(), hypercubeIndices.begin(), hypercubeIndices.end() );
+    } );
+  } );
+
+  std::sort( visitedHypercubes.begin(), visitedHypercubes.end() );
+  visitedHypercubes.erase( std::unique( visitedHypercubes.begin(), visitedHypercubes.end() ), visitedHypercubes.end() );
+
+  array1d< globalIndex > hypercubeIndices( LvArray::integerConversion< localIndex >( visitedHypercubes.size() ) );
+  std::copy( visitedHypercubes.begin(), visitedHypercubes.end(), hypercubeIndices.begin() );
+  m_OBLOperatorsTable->generateHypercubes( hypercubeIndices.toViewConst() );
+}
+
 void ReactiveCompositionalMultiphaseOBL::updateState( DomainPartition & domain )
 {
+  generateOBLHypercubes( domain );
+
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
                                                                MeshLevel & mesh,
                                                                arrayView1d< string const > const & regionNames )
@@ -173,6 +173,13 @@ public:
    */
   void updateOBLOperators( ObjectManagerBase & dataGroup ) const;
 
+  /**
+   * @brief Generate the operator values in the table hypercubes visited by the current states (adaptive table only)
+   * @param domain the domain containing the mesh and fields
+   * @note This function is collective and must be called before updateOBLOperators
+   */
+  void generateOBLHypercubes( DomainPartition & domain );
+
   /**
    * @brief Get the number of fluid components (species)
    * @return the number of components
@@ -238,6 +245,12 @@ public:
 
     static constexpr char const * OBLOperatorsTableFileString() { return "OBLOperatorsTableFile"; }
 
+    static constexpr char const * OBLOperatorsTableSharedMemoryString() { return "OBLOperatorsTableSharedMemory"; }
+
+    static constexpr char const * OBLOperatorsFunctionNamesString() { return "OBLOperatorsFunctionNames"; }
+
+    static constexpr char const * OBLOperatorsCacheFileString() { return "OBLOperatorsCacheFile"; }
+
     static constexpr char const * transMultExpString() { return "transMultExp"; }
 
     static constexpr char const * maxCompFracChangeString() { return "maxCompFractionChange"; }
@@ -295,9 +308,11 @@ public:
    * Does not help in case if the model is defined inconsistently:
    *    for instance, if minimum pressure value in OBL table is higher, than BHP used by a producer/sink
    *    In that case, the solution will be chopped all the time and Newton will never converge
+   * @param dofManager the DofManager passed to applySystemSolution, used to record the corrections of the primary variables
    * @param domain the physical domain object
    */
-  void chopPrimaryVariables( DomainPartition & domain );
+  void chopPrimaryVariables( DofManager const & dofManager,
+                             DomainPartition & domain );
 
   virtual void initializePostInitialConditionsPreSubGroups() override;
 
@@ -326,8 +341,17 @@ private:
   /// OBL operators table file (if OBL physics becomes consitutive, multiple regions will be supported )
   Path m_OBLOperatorsTableFile;
 
+  /// Flag to store the OBL operators table once per node in shared memory
+  integer m_OBLOperatorsTableSharedMemory;
+
+  /// Names of the functions used to generate the OBL operator values on demand (adaptive table)
+  string_array m_OBLOperatorsFunctionNames;
+
+  /// File caching the OBL operator values generated on demand
+  Path m_OBLOperatorsCacheFile;
+
   /// OBL operators table function tabulated vs all primary variables
-  MultivariableTableFunction const * m_OBLOperatorsTable;
+  MultivariableTableFunction * m_OBLOperatorsTable;
 
   /// flag indicating whether energy balance will be enabled or not
   integer m_enableEnergyBalance;
@@ -196,10 +196,44 @@ public:
   inline
   void compute( localIndex const ei ) const
   {
-    arraySlice1d< real64 const, compflow::USD_COMP - 1 > const compFrac = m_compFrac[ei];
     arraySlice1d< real64, compflow::USD_OBL_VAL - 1 > const & OBLVals = m_OBLOperatorValues[ei];
     arraySlice2d< real64, compflow::USD_OBL_DER - 1 > const & OBLDers = m_OBLOperatorDerivatives[ei];
     real64 state[numDofs];
+    computeState( ei, state );
+
+    m_OBLOperatorsTable.compute( state, OBLVals, OBLDers );
+
+    // we do not perform derivatives unit conversion here:
+    // instead we postpone it till all the derivatives are fully formed, and only then apply the factor only once in 'complete' function
+    // scaling the whole system might be even better solution (every pressure column needs to be multiplied by pascalToBarMult)
+  }
+
+  /**
+   * @brief Compute the index of the table hypercube containing the state of an element
+   * @param[in] ei the element index
+   * @return the hypercube index
+   */
+  GEOS_HOST_DEVICE
+  inline
+  globalIndex hypercubeIndex( localIndex const ei ) const
+  {
+    real64 state[numDofs];
+    computeState( ei, state );
+    return m_OBLOperatorsTable.getHypercubeIndex( state );
+  }
+
+private:
+
+  /**
+   * @brief Compute the OBL state (table coordinates) of an element
+   * @param[in] ei the element index
+   * @param[out] state the OBL state
+   */
+  GEOS_HOST_DEVICE
+  inline
+  void computeState( localIndex const ei, real64 ( & state )[numDofs] ) const
+  {
+    arraySlice1d< real64 const, compflow::USD_COMP - 1 > const compFrac = m_compFrac[ei];
 
     // we need to convert pressure from Pa (internal unit in GEOSX) to bar (internal unit in DARTS)
     state[0] = m_pressure[ei] * pascalToBarMult;
@@ -214,16 +248,8 @@ public:
     {
       state[numDofs - 1] = m_temperature[ei];
     }
-
-    m_OBLOperatorsTable.compute( state, OBLVals, OBLDers );
-
-    // we do not perform derivatives unit conversion here:
-    // instead we postpone it till all the derivatives are fully formed, and only then apply the factor only once in 'complete' function
-    // scaling the whole system might be even better solution (every pressure column needs to be multiplied by pascalToBarMult)
   }
 
-private:
-
   // inputs
   MultivariableTableFunctionStaticKernel< numDofs, numOps > m_OBLOperatorsTable;
 
@@ -279,12 +305,59 @@ public:
                                                                            function.getAxisSteps(),
                                                                            function.getAxisStepInvs(),
                                                                            function.getAxisHypercubeMults(),
-                                                                           function.getHypercubeData()
+                                                                           function.getHypercubeData(),
+                                                                           function.getHypercubeIndices(),
+                                                                           function.getSharedHypercubeData()
                                                                            ) );
       OBLOperatorsKernel< NUM_PHASES, NUM_COMPS, ENABLE_ENERGY >::template launch< POLICY >( subRegion.size(), kernel );
     } );
   }
 
+  /**
+   * @brief Create a new kernel and launch it to compute the table hypercube containing the state of each element
+   * @tparam POLICY the policy used in the RAJA kernel
+   * @param[in] numPhases the number of phases
+   * @param[in] numComponents the number of components
+   * @param[in] enableEnergyBalance flag if energy balance equation is assembled
+   * @param[in] subRegion the element subregion
+   * @param[in] function the OBL table function
+   * @param[out] hypercubeIndices the hypercube index of each element
+   */
+  template< typename POLICY >
+  static void
+  createAndLaunchHypercubeIndices( integer const numPhases,
+                                   integer const numComponents,
+                                   bool const enableEnergyBalance,
+                                   ObjectManagerBase & subRegion,
+                                   MultivariableTableFunction const & function,
+                                   arrayView1d< globalIndex > const & hypercubeIndices )
+  {
+    internal::kernelLaunchSelectorEnergySwitch( numPhases, numComponents, enableEnergyBalance, [&] ( auto NP, auto NC, auto E )
+    {
+      integer constexpr ENABLE_ENERGY = E();
+      integer constexpr NUM_PHASES = NP();
+      integer constexpr NUM_COMPS = NC();
+      integer constexpr NUM_DIMS = ENABLE_ENERGY + NUM_COMPS;
+      integer constexpr NUM_OPS  = COMPUTE_NUM_OPS( NUM_PHASES, NUM_COMPS, ENABLE_ENERGY );
+
+      OBLOperatorsKernel< NUM_PHASES, NUM_COMPS, ENABLE_ENERGY >
+      kernel( subRegion,
+              MultivariableTableFunctionStaticKernel< NUM_DIMS, NUM_OPS >( function.getAxisMinimums(),
+                                                                           function.getAxisMaximums(),
+                                                                           function.getAxisPoints(),
+                                                                           function.getAxisSteps(),
+                                                                           function.getAxisStepInvs(),
+                                                                           function.getAxisHypercubeMults(),
+                                                                           function.getHypercubeData(),
+                                                                           function.getHypercubeIndices()
+                                                                           ) );
+      forAll< POLICY >( subRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const ei )
+      {
+        hypercubeIndices[ei] = kernel.hypercubeIndex( ei );
+      } );
+    } );
+  }
+
 };
 
 /******************************** ElementBasedAssemblyKernel ********************************/
@@ -1222,6 +1222,9 @@ void SinglePhaseBase::updateState( DomainPartition & domain )
                                                                MeshLevel & mesh,
                                                                arrayView1d< string const > const & regionNames )
   {
+    // the ghost values of the primary variables are read below
+    CommunicationTools::getInstance().checkNoPendingSynchronization( mesh );
+
     mesh.getElemManager().forElementSubRegions< CellElementSubRegion, SurfaceElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                                                    auto & subRegion )
     {
@@ -490,6 +490,24 @@ struct FluidUpdateKernel
       }
     } );
   }
+
+  template< typename POLICY, typename FLUID_WRAPPER >
+  static void
+  launch( arrayView1d< localIndex const > const & targetList,
+          FLUID_WRAPPER const & fluidWrapper,
+          arrayView1d< real64 const > const & pres,
+          arrayView1d< real64 const > const & temp,
+          arrayView2d< real64 const, compflow::USD_COMP > const & compFrac )
+  {
+    forAll< POLICY >( targetList.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+    {
+      localIndex const k = targetList[a];
+      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+      {
+        fluidWrapper.update( k, q, pres[k], temp[k], compFrac[k] );
+      }
+    } );
+  }
 };
 
 /******************************** SolidInternalEnergyUpdateKernel ********************************/
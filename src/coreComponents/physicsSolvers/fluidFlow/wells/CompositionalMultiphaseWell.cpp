@@ -1005,47 +1005,63 @@ void CompositionalMultiphaseWell::assembleFluxTerms( real64 const GEOS_UNUSED_PA
 {
   GEOS_MARK_FUNCTION;
 
-  // loop over the wells
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                                 MeshLevel const & mesh,
                                                                 arrayView1d< string const > const & regionNames )
   {
     ElementRegionManager const & elemManager = mesh.getElemManager();
 
+    string const wellDofKey = dofManager.getKey( wellElementDofName() );
+
+    // Pack the well elements of all the wells of this rank, so that the fluxes of all the wells
+    // are assembled in a single kernel launch instead of one launch per well.
+    // The well elements of the well iwell are [ wellElemOffsets[iwell], wellElemOffsets[iwell+1] ).
+    array1d< localIndex > wellElemOffsets( 1 );
+    array1d< integer > isProducer;
+    WellViewAccessor< arrayView1d< real64 const > > injection;
+    WellViewAccessor< arrayView1d< globalIndex const > > wellElemDofNumber;
+    WellViewAccessor< arrayView1d< localIndex const > > nextWellElemIndex;
+    WellViewAccessor< arrayView1d< real64 const > > connRate;
+    WellViewAccessor< arrayView2d< real64 const, compflow::USD_COMP > > wellElemCompFrac;
+    WellViewAccessor< arrayView3d< real64 const, compflow::USD_COMP_DC > > dWellElemCompFrac_dCompDens;
+
     elemManager.forElementSubRegions< WellElementSubRegion >( regionNames,
                                                               [&]( localIndex const,
                                                                    WellElementSubRegion const & subRegion )
     {
       WellControls const & wellControls = getWellControls( subRegion );
 
+      wellElemOffsets.emplace_back( wellElemOffsets.back() + subRegion.size() );
+      isProducer.emplace_back( wellControls.isProducer() );
+      injection.emplace_back( wellControls.getInjectionStream() );
+
       // get a reference to the degree-of-freedom numbers
-      string const wellDofKey = dofManager.getKey( wellElementDofName() );
-      arrayView1d< globalIndex const > const & wellElemDofNumber =
-        subRegion.getReference< array1d< globalIndex > >( wellDofKey );
-      arrayView1d< localIndex const > const & nextWellElemIndex =
-        subRegion.getReference< array1d< localIndex > >( WellElementSubRegion::viewKeyStruct::nextWellElementIndexString() );
+      wellElemDofNumber.emplace_back( subRegion.getReference< array1d< globalIndex > >( wellDofKey ).toViewConst() );
+      nextWellElemIndex.emplace_back( subRegion.getReference< array1d< localIndex > >( WellElementSubRegion::viewKeyStruct::nextWellElementIndexString() ).toViewConst() );
 
       // get a reference to the primary variables on well elements
-      arrayView1d< real64 const > const & connRate = subRegion.getField< fields::well::mixtureConnectionRate >();
+      connRate.emplace_back( subRegion.getField< fields::well::mixtureConnectionRate >() );
 
       // get the info stored on well elements
-      arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompFrac = subRegion.getField< fields::well::globalCompFraction >();
-      arrayView3d< real64 const, compflow::USD_COMP_DC > const & dWellElemCompFrac_dCompDens = subRegion.getField< fields::well::dGlobalCompFraction_dGlobalCompDensity >();
-
-      isothermalCompositionalMultiphaseBaseKernels::
-        KernelLaunchSelector1< FluxKernel >( numFluidComponents(),
-                                             subRegion.size(),
-                                             dofManager.rankOffset(),
-                                             wellControls,
-                                             wellElemDofNumber,
-                                             nextWellElemIndex,
-                                             connRate,
-                                             wellElemCompFrac,
-                                             dWellElemCompFrac_dCompDens,
-                                             dt,
-                                             localMatrix,
-                                             localRhs );
+      wellElemCompFrac.emplace_back( subRegion.getField< fields::well::globalCompFraction >() );
+      dWellElemCompFrac_dCompDens.emplace_back( subRegion.getField< fields::well::dGlobalCompFraction_dGlobalCompDensity >() );
     } );
+
+    isothermalCompositionalMultiphaseBaseKernels::
+      KernelLaunchSelector1< FluxKernel >( numFluidComponents(),
+                                           wellElemOffsets.back(),
+                                           wellElemOffsets.toViewConst(),
+                                           dofManager.rankOffset(),
+                                           isProducer.toViewConst(),
+                                           injection.toNestedViewConst(),
+                                           wellElemDofNumber.toNestedViewConst(),
+                                           nextWellElemIndex.toNestedViewConst(),
+                                           connRate.toNestedViewConst(),
+                                           wellElemCompFrac.toNestedViewConst(),
+                                           dWellElemCompFrac_dCompDens.toNestedViewConst(),
+                                           dt,
+                                           localMatrix,
+                                           localRhs );
   } );
 }
 
@@ -1350,95 +1366,109 @@ void CompositionalMultiphaseWell::computePerforationRates( DomainPartition & dom
     PerforationKernel::MultiFluidAccessors resMultiFluidAccessors( mesh.getElemManager(), flowSolver.getName() );
     PerforationKernel::RelPermAccessors resRelPermAccessors( mesh.getElemManager(), flowSolver.getName() );
 
+    // Pack the perforations of all the wells of this rank, so that the perforation rates of all the wells
+    // are computed in a single kernel launch instead of one launch per well.
+    // The perforations of the well iwell are [ perfOffsets[iwell], perfOffsets[iwell+1] ).
+    array1d< localIndex > perfOffsets( 1 );
+    array1d< integer > disableReservoirToWellFlow;
+
+    WellViewAccessor< arrayView1d< real64 const > > wellElemGravCoef;
+    WellViewAccessor< arrayView1d< real64 const > > wellElemPres;
+    WellViewAccessor< arrayView2d< real64 const, compflow::USD_COMP > > wellElemCompDens;
+    WellViewAccessor< arrayView1d< real64 const > > wellElemTotalMassDens;
+    WellViewAccessor< arrayView1d< real64 const > > dWellElemTotalMassDens_dPres;
+    WellViewAccessor< arrayView2d< real64 const, compflow::USD_FLUID_DC > > dWellElemTotalMassDens_dCompDens;
+    WellViewAccessor< arrayView2d< real64 const, compflow::USD_COMP > > wellElemCompFrac;
+    WellViewAccessor< arrayView3d< real64 const, compflow::USD_COMP_DC > > dWellElemCompFrac_dCompDens;
+
+    WellViewAccessor< arrayView1d< real64 const > > perfGravCoef;
+    WellViewAccessor< arrayView1d< localIndex const > > perfWellElemIndex;
+    WellViewAccessor< arrayView1d< real64 const > > perfTrans;
+    WellViewAccessor< arrayView1d< localIndex const > > resElementRegion;
+    WellViewAccessor< arrayView1d< localIndex const > > resElementSubRegion;
+    WellViewAccessor< arrayView1d< localIndex const > > resElementIndex;
+
+    WellViewAccessor< arrayView2d< real64 > > compPerfRate;
+    WellViewAccessor< arrayView3d< real64 > > dCompPerfRate_dPres;
+    WellViewAccessor< arrayView4d< real64 > > dCompPerfRate_dComp;
+
     mesh.getElemManager().forElementSubRegions< WellElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                           WellElementSubRegion & subRegion )
     {
 
       WellControls const & wellControls = getWellControls( subRegion );
-      bool const disableReservoirToWellFlow = wellControls.isInjector() and !wellControls.isCrossflowEnabled();
 
       PerforationData * const perforationData = subRegion.getPerforationData();
 
+      perfOffsets.emplace_back( perfOffsets.back() + perforationData->size() );
+      disableReservoirToWellFlow.emplace_back( wellControls.isInjector() and !wellControls.isCrossflowEnabled() );
+
       // get depth
-      arrayView1d< real64 const > const & wellElemGravCoef = subRegion.getField< fields::well::gravityCoefficient >();
+      wellElemGravCoef.emplace_back( subRegion.getField< fields::well::gravityCoefficient >() );
 
       // get well primary variables on well elements
-      arrayView1d< real64 const > const & wellElemPres =
-        subRegion.getField< fields::well::pressure >();
-      arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompDens =
-        subRegion.getField< fields::well::globalCompDensity >();
+      wellElemPres.emplace_back( subRegion.getField< fields::well::pressure >() );
+      wellElemCompDens.emplace_back( subRegion.getField< fields::well::globalCompDensity >() );
 
-      arrayView1d< real64 const > const & wellElemTotalMassDens =
-        subRegion.getField< fields::well::totalMassDensity >();
-      arrayView1d< real64 const > const & dWellElemTotalMassDens_dPres =
-        subRegion.getField< fields::well::dTotalMassDensity_dPressure >();
-      arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens =
-        subRegion.getField< fields::well::dTotalMassDensity_dGlobalCompDensity >();
+      wellElemTotalMassDens.emplace_back( subRegion.getField< fields::well::totalMassDensity >() );
+      dWellElemTotalMassDens_dPres.emplace_back( subRegion.getField< fields::well::dTotalMassDensity_dPressure >() );
+      dWellElemTotalMassDens_dCompDens.emplace_back( subRegion.getField< fields::well::dTotalMassDensity_dGlobalCompDensity >() );
 
-      arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompFrac =
-        subRegion.getField< fields::well::globalCompFraction >();
-      arrayView3d< real64 const, compflow::USD_COMP_DC > const & dWellElemCompFrac_dCompDens =
-        subRegion.getField< fields::well::dGlobalCompFraction_dGlobalCompDensity >();
+      wellElemCompFrac.emplace_back( subRegion.getField< fields::well::globalCompFraction >() );
+      dWellElemCompFrac_dCompDens.emplace_back( subRegion.getField< fields::well::dGlobalCompFraction_dGlobalCompDensity >() );
 
       // get well variables on perforations
-      arrayView1d< real64 const > const & perfGravCoef =
-        perforationData->getField< fields::well::gravityCoefficient >();
-      arrayView1d< localIndex const > const perfWellElemIndex =
-        perforationData->getField< fields::perforation::wellElementIndex >();
-      arrayView1d< real64 const > const perfTrans =
-        perforationData->getField< fields::perforation::wellTransmissibility >();
-
-      arrayView2d< real64 > const & compPerfRate =
-        perforationData->getField< fields::well::compPerforationRate >();
-      arrayView3d< real64 > const & dCompPerfRate_dPres =
-        perforationData->getField< fields::well::dCompPerforationRate_dPres >();
-      arrayView4d< real64 > const & dCompPerfRate_dComp =
-        perforationData->getField< fields::well::dCompPerforationRate_dComp >();
+      perfGravCoef.emplace_back( perforationData->getField< fields::well::gravityCoefficient >() );
+      perfWellElemIndex.emplace_back( perforationData->getField< fields::perforation::wellElementIndex >() );
+      perfTrans.emplace_back( perforationData->getField< fields::perforation::wellTransmissibility >() );
 
-      // get the element region, subregion, index
-      arrayView1d< localIndex const > const resElementRegion =
-        perforationData->getField< fields::perforation::reservoirElementRegion >();
-      arrayView1d< localIndex const > const resElementSubRegion =
-        perforationData->getField< fields::perforation::reservoirElementSubRegion >();
-      arrayView1d< localIndex const > const resElementIndex =
-        perforationData->getField< fields::perforation::reservoirElementIndex >();
+      compPerfRate.emplace_back( perforationData->getField< fields::well::compPerforationRate >() );
+      dCompPerfRate_dPres.emplace_back( perforationData->getField< fields::well::dCompPerforationRate_dPres >() );
+      dCompPerfRate_dComp.emplace_back( perforationData->getField< fields::well::dCompPerforationRate_dComp >() );
 
-      isothermalCompositionalMultiphaseBaseKernels::
-        KernelLaunchSelector2< PerforationKernel >( numFluidComponents(),
-                                                    numFluidPhases(),
-                                                    perforationData->size(),
-                                                    disableReservoirToWellFlow,
-                                                    resCompFlowAccessors.get( fields::flow::pressure{} ),
-                                                    resCompFlowAccessors.get( fields::flow::phaseVolumeFraction{} ),
-                                                    resCompFlowAccessors.get( fields::flow::dPhaseVolumeFraction{} ),
-                                                    resCompFlowAccessors.get( fields::flow::dGlobalCompFraction_dGlobalCompDensity{} ),
-                                                    resMultiFluidAccessors.get( fields::multifluid::phaseDensity{} ),
-                                                    resMultiFluidAccessors.get( fields::multifluid::dPhaseDensity{} ),
-                                                    resMultiFluidAccessors.get( fields::multifluid::phaseViscosity{} ),
-                                                    resMultiFluidAccessors.get( fields::multifluid::dPhaseViscosity{} ),
-                                                    resMultiFluidAccessors.get( fields::multifluid::phaseCompFraction{} ),
-                                                    resMultiFluidAccessors.get( fields::multifluid::dPhaseCompFraction{} ),
-                                                    resRelPermAccessors.get( fields::relperm::phaseRelPerm{} ),
-                                                    resRelPermAccessors.get( fields::relperm::dPhaseRelPerm_dPhaseVolFraction{} ),
-                                                    wellElemGravCoef,
-                                                    wellElemPres,
-                                                    wellElemCompDens,
-                                                    wellElemTotalMassDens,
-                                                    dWellElemTotalMassDens_dPres,
-                                                    dWellElemTotalMassDens_dCompDens,
-                                                    wellElemCompFrac,
-                                                    dWellElemCompFrac_dCompDens,
-                                                    perfGravCoef,
-                                                    perfWellElemIndex,
-                                                    perfTrans,
-                                                    resElementRegion,
-                                                    resElementSubRegion,
-                                                    resElementIndex,
-                                                    compPerfRate,
-                                                    dCompPerfRate_dPres,
-                                                    dCompPerfRate_dComp );
+      // get the element region, subregion, index
+      resElementRegion.emplace_back( perforationData->getField< fields::perforation::reservoirElementRegion >() );
+      resElementSubRegion.emplace_back( perforationData->getField< fields::perforation::reservoirElementSubRegion >() );
+      resElementIndex.emplace_back( perforationData->getField< fields::perforation::reservoirElementIndex >() );
 
     } );
+
+    isothermalCompositionalMultiphaseBaseKernels::
+      KernelLaunchSelector2< PerforationKernel >( numFluidComponents(),
+                                                  numFluidPhases(),
+                                                  perfOffsets.back(),
+                                                  perfOffsets.toViewConst(),
+                                                  disableReservoirToWellFlow.toViewConst(),
+                                                  resCompFlowAccessors.get( fields::flow::pressure{} ),
+                                                  resCompFlowAccessors.get( fields::flow::phaseVolumeFraction{} ),
+                                                  resCompFlowAccessors.get( fields::flow::dPhaseVolumeFraction{} ),
+                                                  resCompFlowAccessors.get( fields::flow::dGlobalCompFraction_dGlobalCompDensity{} ),
+                                                  resMultiFluidAccessors.get( fields::multifluid::phaseDensity{} ),
+                                                  resMultiFluidAccessors.get( fields::multifluid::dPhaseDensity{} ),
+                                                  resMultiFluidAccessors.get( fields::multifluid::phaseViscosity{} ),
+                                                  resMultiFluidAccessors.get( fields::multifluid::dPhaseViscosity{} ),
+                                                  resMultiFluidAccessors.get( fields::multifluid::phaseCompFraction{} ),
+                                                  resMultiFluidAccessors.get( fields::multifluid::dPhaseCompFraction{} ),
+                                                  resRelPermAccessors.get( fields::relperm::phaseRelPerm{} ),
+                                                  resRelPermAccessors.get( fields::relperm::dPhaseRelPerm_dPhaseVolFraction{} ),
+                                                  wellElemGravCoef.toNestedViewConst(),
+                                                  wellElemPres.toNestedViewConst(),
+                                                  wellElemCompDens.toNestedViewConst(),
+                                                  wellElemTotalMassDens.toNestedViewConst(),
+                                                  dWellElemTotalMassDens_dPres.toNestedViewConst(),
+                                                  dWellElemTotalMassDens_dCompDens.toNestedViewConst(),
+                                                  wellElemCompFrac.toNestedViewConst(),
+                                                  dWellElemCompFrac_dCompDens.toNestedViewConst(),
+                                                  perfGravCoef.toNestedViewConst(),
+                                                  perfWellElemIndex.toNestedViewConst(),
+                                                  perfTrans.toNestedViewConst(),
+                                                  resElementRegion.toNestedViewConst(),
+                                                  resElementSubRegion.toNestedViewConst(),
+                                                  resElementIndex.toNestedViewConst(),
+                                                  compPerfRate.toNestedView(),
+                                                  dCompPerfRate_dPres.toNestedView(),
+                                                  dCompPerfRate_dComp.toNestedView() );
+
   } );
 
 }
@@ -1475,7 +1505,7 @@ CompositionalMultiphaseWell::applySystemSolution( DofManager const & dofManager,
   // these negative component densities are set to zero in this function
   if( m_allowCompDensChopping )
   {
-    chopNegativeDensities( domain );
+    chopNegativeDensities( dofManager, domain );
   }
 
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&]( string const &,
@@ -1497,10 +1527,16 @@ CompositionalMultiphaseWell::applySystemSolution( DofManager const & dofManager,
   } );
 }
 
-void CompositionalMultiphaseWell::chopNegativeDensities( DomainPartition & domain )
+void CompositionalMultiphaseWell::chopNegativeDensities( DofManager const & dofManager,
+                                                        DomainPartition & domain )
 {
   integer const numComp = m_numComponents;
 
+  // the chopped amounts are part of the increment of the step
+  arrayView1d< real64 > const corrections = resetSolutionCorrections( dofManager );
+  globalIndex const rankOffset = dofManager.rankOffset();
+  string const wellDofKey = dofManager.getKey( wellElementDofName() );
+
   forDiscretizationOnMeshTargets( domain.getMeshBodies(), [&] ( string const &,
                                                                 MeshLevel & mesh,
                                                                 arrayView1d< string const > const & regionNames )
@@ -1513,6 +1549,7 @@ void CompositionalMultiphaseWell::chopNegativeDensities( DomainPartition & domai
                                                                    WellElementSubRegion & subRegion )
     {
       arrayView1d< integer const > const & wellElemGhostRank = subRegion.ghostRank();
+      arrayView1d< globalIndex const > const & wellElemDofNumber = subRegion.getReference< array1d< globalIndex > >( wellDofKey );
 
       arrayView2d< real64, compflow::USD_COMP > const & wellElemCompDens =
         subRegion.getField< fields::well::globalCompDensity >();
@@ -1527,6 +1564,7 @@ void CompositionalMultiphaseWell::chopNegativeDensities( DomainPartition & domai
             // if the new density is negative, chop back to zero
             if( wellElemCompDens[iwelem][ic] < 0 )
             {
+              corrections[wellElemDofNumber[iwelem] - rankOffset + ic + 1] = -wellElemCompDens[iwelem][ic];
               wellElemCompDens[iwelem][ic] = 0;
             }
           }
@@ -1591,86 +1629,107 @@ void CompositionalMultiphaseWell::assemblePressureRelations( real64 const & time
 
     ElementRegionManager const & elemManager = mesh.getElemManager();
 
+    string const wellDofKey = dofManager.getKey( wellElementDofName() );
+
+    // Pack the well elements of all the wells of this rank, so that the pressure relations of all the wells
+    // are assembled in a single kernel launch instead of one launch per well.
+    // The well elements of the well iwell are [ wellElemOffsets[iwell], wellElemOffsets[iwell+1] ).
+    std::vector< WellElementSubRegion const * > wells;
+    array1d< localIndex > wellElemOffsets( 1 );
+    PackedWellControls packedWellControls;
+    WellViewAccessor< arrayView1d< globalIndex const > > wellElemDofNumber;
+    WellViewAccessor< arrayView1d< real64 const > > wellElemGravCoef;
+    WellViewAccessor< arrayView1d< localIndex const > > nextWellElemIndex;
+    WellViewAccessor< arrayView1d< real64 const > > wellElemPres;
+    WellViewAccessor< arrayView1d< real64 const > > wellElemTotalMassDens;
+    WellViewAccessor< arrayView1d< real64 const > > dWellElemTotalMassDens_dPres;
+    WellViewAccessor< arrayView2d< real64 const, compflow::USD_FLUID_DC > > dWellElemTotalMassDens_dCompDens;
+
     elemManager.forElementSubRegions< WellElementSubRegion >( regionNames,
                                                               [&]( localIndex const,
                                                                    WellElementSubRegion const & subRegion )
     {
 
-      WellControls & wellControls = getWellControls( subRegion );
+      WellControls const & wellControls = getWellControls( subRegion );
+
+      wells.emplace_back( &subRegion );
+      wellElemOffsets.emplace_back( wellElemOffsets.back() + subRegion.size() );
+      packedWellControls.addWell( wellControls,
+                                  time_n + dt, // controls evaluated with BHP/rate of the end of step
+                                  subRegion.isLocallyOwned(),
+                                  subRegion.getTopWellElementIndex() );
 
       // get the degrees of freedom, depth info, next welem index
-      string const wellDofKey = dofManager.getKey( wellElementDofName() );
-      arrayView1d< globalIndex const > const & wellElemDofNumber =
-        subRegion.getReference< array1d< globalIndex > >( wellDofKey );
-      arrayView1d< real64 const > const & wellElemGravCoef =
-        subRegion.getField< fields::well::gravityCoefficient >();
-      arrayView1d< localIndex const > const & nextWellElemIndex =
-        subRegion.getReference< array1d< localIndex > >( WellElementSubRegion::viewKeyStruct::nextWellElementIndexString() );
+      wellElemDofNumber.emplace_back( subRegion.getReference< array1d< globalIndex > >( wellDofKey ).toViewConst() );
+      wellElemGravCoef.emplace_back( subRegion.getField< fields::well::gravityCoefficient >() );
+      nextWellElemIndex.emplace_back( subRegion.getReference< array1d< localIndex > >( WellElementSubRegion::viewKeyStruct::nextWellElementIndexString() ).toViewConst() );
 
       // get primary variables on well elements
-      arrayView1d< real64 const > const & wellElemPres =
-        subRegion.getField< fields::well::pressure >();
+      wellElemPres.emplace_back( subRegion.getField< fields::well::pressure >() );
 
       // get total mass density on well elements (for potential calculations)
-      arrayView1d< real64 const > const & wellElemTotalMassDens =
-        subRegion.getField< fields::well::totalMassDensity >();
-      arrayView1d< real64 const > const & dWellElemTotalMassDens_dPres =
-        subRegion.getField< fields::well::dTotalMassDensity_dPressure >();
-      arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens =
-        subRegion.getField< fields::well::dTotalMassDensity_dGlobalCompDensity >();
-
+      wellElemTotalMassDens.emplace_back( subRegion.getField< fields::well::totalMassDensity >() );
+      dWellElemTotalMassDens_dPres.emplace_back( subRegion.getField< fields::well::dTotalMassDensity_dPressure >() );
+      dWellElemTotalMassDens_dCompDens.emplace_back( subRegion.getField< fields::well::dTotalMassDensity_dGlobalCompDensity >() );
+    } );
 
-      bool controlHasSwitched = false;
-      isothermalCompositionalMultiphaseBaseKernels::
-        KernelLaunchSelector1< PressureRelationKernel >( numFluidComponents(),
-                                                         subRegion.size(),
-                                                         dofManager.rankOffset(),
-                                                         subRegion.isLocallyOwned(),
-                                                         subRegion.getTopWellElementIndex(),
-                                                         m_targetPhaseIndex,
-                                                         wellControls,
-                                                         time_n + dt, // controls evaluated with BHP/rate of the end of step
-                                                         wellElemDofNumber,
-                                                         wellElemGravCoef,
-                                                         nextWellElemIndex,
-                                                         wellElemPres,
-                                                         wellElemTotalMassDens,
-                                                         dWellElemTotalMassDens_dPres,
-                                                         dWellElemTotalMassDens_dCompDens,
-                                                         controlHasSwitched,
-                                                         localMatrix,
-                                                         localRhs );
-
-      if( controlHasSwitched )
+    array1d< integer > controlHasSwitched( packedWellControls.size() );
+    isothermalCompositionalMultiphaseBaseKernels::
+      KernelLaunchSelector1< PressureRelationKernel >( numFluidComponents(),
+                                                       wellElemOffsets.back(),
+                                                       wellElemOffsets.toViewConst(),
+                                                       dofManager.rankOffset(),
+                                                       m_targetPhaseIndex,
+                                                       packedWellControls,
+                                                       wellElemDofNumber.toNestedViewConst(),
+                                                       wellElemGravCoef.toNestedViewConst(),
+                                                       nextWellElemIndex.toNestedViewConst(),
+                                                       wellElemPres.toNestedViewConst(),
+                                                       wellElemTotalMassDens.toNestedViewConst(),
+                                                       dWellElemTotalMassDens_dPres.toNestedViewConst(),
+                                                       dWellElemTotalMassDens_dCompDens.toNestedViewConst(),
+                                                       controlHasSwitched.toView(),
+                                                       localMatrix,
+                                                       localRhs );
+
+    // the control switches are applied well by well, in the same order as the wells were packed
+    controlHasSwitched.move( hostMemorySpace, false );
+    for( std::size_t iwell = 0; iwell < wells.size(); ++iwell )
+    {
+      if( !controlHasSwitched[iwell] )
       {
-        // TODO: move the switch logic into wellControls
-        // TODO: implement a more general switch when more then two constraints per well type are allowed
+        continue;
+      }
 
-        real64 const timeAtEndOfStep = time_n + dt;
+      // TODO: move the switch logic into wellControls
+      // TODO: implement a more general switch when more then two constraints per well type are allowed
 
-        if( wellControls.getControl() == WellControls::Control::BHP )
+      WellElementSubRegion const & subRegion = *wells[iwell];
+      WellControls & wellControls = getWellControls( subRegion );
+      real64 const timeAtEndOfStep = time_n + dt;
+
+      if( wellControls.getControl() == WellControls::Control::BHP )
+      {
+        if( wellControls.isProducer() )
         {
-          if( wellControls.isProducer() )
-          {
-            wellControls.switchToPhaseRateControl( wellControls.getTargetPhaseRate( timeAtEndOfStep ) );
-            GEOS_LOG_LEVEL( 1, "Control switch for well " << subRegion.getName()
-                                                          << " from BHP constraint to phase volumetric rate constraint" );
-          }
-          else
-          {
-            wellControls.switchToTotalRateControl( wellControls.getTargetTotalRate( timeAtEndOfStep ) );
-            GEOS_LOG_LEVEL( 1, "Control switch for well " << subRegion.getName()
-                                                          << " from BHP constraint to total volumetric rate constraint" );
-          }
+          wellControls.switchToPhaseRateControl( wellControls.getTargetPhaseRate( timeAtEndOfStep ) );
+          GEOS_LOG_LEVEL( 1, "Control switch for well " << subRegion.getName()
+                                                        << " from BHP constraint to phase volumetric rate constraint" );
         }
         else
         {
-          wellControls.switchToBHPControl( wellControls.getTargetBHP( timeAtEndOfStep ) );
+          wellControls.switchToTotalRateControl( wellControls.getTargetTotalRate( timeAtEndOfStep ) );
           GEOS_LOG_LEVEL( 1, "Control switch for well " << subRegion.getName()
-                                                        << " from rate constraint to BHP constraint" );
+                                                        << " from BHP constraint to total volumetric rate constraint" );
         }
       }
-    } );
+      else
+      {
+        wellControls.switchToBHPControl( wellControls.getTargetBHP( timeAtEndOfStep ) );
+        GEOS_LOG_LEVEL( 1, "Control switch for well " << subRegion.getName()
+                                                      << " from rate constraint to BHP constraint" );
+      }
+    }
   } );
 }
 
@@ -262,9 +262,11 @@ public:
 
   /**
    * @brief Sets all the negative component densities (if any) to zero.
+   * @param dofManager the DofManager passed to applySystemSolution, used to record the corrections of the densities
    * @param domain the physical domain object
    */
-  void chopNegativeDensities( DomainPartition & domain );
+  void chopNegativeDensities( DofManager const & dofManager,
+                              DomainPartition & domain );
 
   arrayView1d< string const > relPermModelNames() const { return m_relPermModelNames; }
 
@@ -28,6 +28,43 @@ namespace geos
 namespace compositionalMultiphaseWellKernels
 {
 
+/******************************** PackedWellControls ********************************/
+
+void
+PackedWellControls::
+  addWell( WellControls const & wellControls,
+           real64 const & timeAtEndOfStep,
+           bool const isLocallyOwned,
+           localIndex const iwelemControl )
+{
+  using keys = CompositionalMultiphaseWell::viewKeyStruct;
+
+  m_isLocallyOwned.emplace_back( isLocallyOwned );
+  m_iwelemControl.emplace_back( iwelemControl );
+
+  // static well control data
+  m_isProducer.emplace_back( wellControls.isProducer() );
+  m_currentControl.emplace_back( static_cast< integer >( wellControls.getControl() ) );
+  m_targetBHP.emplace_back( wellControls.getTargetBHP( timeAtEndOfStep ) );
+  m_targetTotalRate.emplace_back( wellControls.getTargetTotalRate( timeAtEndOfStep ) );
+  m_targetPhaseRate.emplace_back( wellControls.getTargetPhaseRate( timeAtEndOfStep ) );
+
+  // dynamic well control data
+  m_currentBHP.emplace_back( wellControls.getReference< real64 >( keys::currentBHPString() ) );
+  m_dCurrentBHP_dPres.emplace_back( wellControls.getReference< real64 >( keys::dCurrentBHP_dPresString() ) );
+  m_dCurrentBHP_dCompDens.emplace_back( wellControls.getReference< array1d< real64 > >( keys::dCurrentBHP_dCompDensString() ).toViewConst() );
+
+  m_currentPhaseVolRate.emplace_back( wellControls.getReference< array1d< real64 > >( keys::currentPhaseVolRateString() ).toViewConst() );
+  m_dCurrentPhaseVolRate_dPres.emplace_back( wellControls.getReference< array1d< real64 > >( keys::dCurrentPhaseVolRate_dPresString() ).toViewConst() );
+  m_dCurrentPhaseVolRate_dCompDens.emplace_back( wellControls.getReference< array2d< real64 > >( keys::dCurrentPhaseVolRate_dCompDensString() ).toViewConst() );
+  m_dCurrentPhaseVolRate_dRate.emplace_back( wellControls.getReference< array1d< real64 > >( keys::dCurrentPhaseVolRate_dRateString() ).toViewConst() );
+
+  m_currentTotalVolRate.emplace_back( wellControls.getReference< real64 >( keys::currentTotalVolRateString() ) );
+  m_dCurrentTotalVolRate_dPres.emplace_back( wellControls.getReference< real64 >( keys::dCurrentTotalVolRate_dPresString() ) );
+  m_dCurrentTotalVolRate_dCompDens.emplace_back( wellControls.getReference< array1d< real64 > >( keys::dCurrentTotalVolRate_dCompDensString() ).toViewConst() );
+  m_dCurrentTotalVolRate_dRate.emplace_back( wellControls.getReference< real64 >( keys::dCurrentTotalVolRate_dRateString() ) );
+}
+
 /******************************** ControlEquationHelper ********************************/
 
 GEOS_HOST_DEVICE
@@ -281,25 +318,28 @@ template< integer NC >
 void
 FluxKernel::
   launch( localIndex const size,
+          arrayView1d< localIndex const > const & wellElemOffsets,
           globalIndex const rankOffset,
-          WellControls const & wellControls,
-          arrayView1d< globalIndex const > const & wellElemDofNumber,
-          arrayView1d< localIndex const > const & nextWellElemIndex,
-          arrayView1d< real64 const > const & connRate,
-          arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompFrac,
-          arrayView3d< real64 const, compflow::USD_COMP_DC > const & dWellElemCompFrac_dCompDens,
+          arrayView1d< integer const > const & isProducer,
+          WellViewConst< arrayView1d< real64 const > > const & injection,
+          WellViewConst< arrayView1d< globalIndex const > > const & wellElemDofNumber,
+          WellViewConst< arrayView1d< localIndex const > > const & nextWellElemIndex,
+          WellViewConst< arrayView1d< real64 const > > const & connRate,
+          WellViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & wellElemCompFrac,
+          WellViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dWellElemCompFrac_dCompDens,
           real64 const & dt,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs )
 {
   using namespace compositionalMultiphaseUtilities;
 
-  bool const isProducer = wellControls.isProducer();
-  arrayView1d< real64 const > const & injection = wellControls.getInjectionStream();
-
-  // loop over the well elements to compute the fluxes between elements
-  forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
+  // loop over the well elements of all the wells to compute the fluxes between elements
+  forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelemPacked )
   {
+    // find the well of this element
+    localIndex const iwell = findPackedWell( wellElemOffsets, iwelemPacked );
+    localIndex const iwelem = iwelemPacked - wellElemOffsets[iwell];
+
     // create local work arrays
     real64 compFracUp[NC]{};
     real64 dCompFrac_dCompDensUp[NC][NC]{};
@@ -317,11 +357,11 @@ FluxKernel::
      *                        currentConnRate > 0 at the last connection for a injector
      */
 
-    localIndex const iwelemNext = nextWellElemIndex[iwelem];
-    real64 const currentConnRate = connRate[iwelem];
+    localIndex const iwelemNext = nextWellElemIndex[iwell][iwelem];
+    real64 const currentConnRate = connRate[iwell][iwelem];
     localIndex iwelemUp = -1;
 
-    if( iwelemNext < 0 && !isProducer ) // exit connection, injector
+    if( iwelemNext < 0 && !isProducer[iwell] ) // exit connection, injector
     {
       // we still need to define iwelemUp for Jacobian assembly
       iwelemUp = iwelem;
@@ -329,7 +369,7 @@ FluxKernel::
       // just copy the injection stream into compFrac
       for( integer ic = 0; ic < NC; ++ic )
       {
-        compFracUp[ic] = injection[ic];
+        compFracUp[ic] = injection[iwell][ic];
         for( integer jc = 0; jc < NC; ++jc )
         {
           dCompFrac_dCompDensUp[ic][jc] = 0.0;
@@ -339,7 +379,7 @@ FluxKernel::
     else
     {
       // first set iwelemUp to the upstream cell
-      if( ( iwelemNext < 0 && isProducer )  // exit connection, producer
+      if( ( iwelemNext < 0 && isProducer[iwell] )  // exit connection, producer
           || currentConnRate < 0 ) // not an exit connection, iwelem is upstream
       {
         iwelemUp = iwelem;
@@ -352,10 +392,10 @@ FluxKernel::
       // copy the vars of iwelemUp into compFrac
       for( integer ic = 0; ic < NC; ++ic )
       {
-        compFracUp[ic] = wellElemCompFrac[iwelemUp][ic];
+        compFracUp[ic] = wellElemCompFrac[iwell][iwelemUp][ic];
         for( integer jc = 0; jc < NC; ++jc )
         {
-          dCompFrac_dCompDensUp[ic][jc] = dWellElemCompFrac_dCompDens[iwelemUp][ic][jc];
+          dCompFrac_dCompDensUp[ic][jc] = dWellElemCompFrac_dCompDens[iwell][iwelemUp][ic][jc];
         }
       }
     }
@@ -373,8 +413,8 @@ FluxKernel::
       }
     }
 
-    globalIndex const offsetUp = wellElemDofNumber[iwelemUp];
-    globalIndex const offsetCurrent = wellElemDofNumber[iwelem];
+    globalIndex const offsetUp = wellElemDofNumber[iwell][iwelemUp];
+    globalIndex const offsetCurrent = wellElemDofNumber[iwell][iwelem];
 
     if( iwelemNext < 0 )  // exit connection
     {
@@ -458,7 +498,7 @@ FluxKernel::
       globalIndex dofColIndices_dPresCompUp[NC+1]{};
       globalIndex dofColIndices_dRate = 0;
 
-      globalIndex const offsetNext = wellElemDofNumber[iwelemNext];
+      globalIndex const offsetNext = wellElemDofNumber[iwell][iwelemNext];
 
       // jacobian indices
       for( integer ic = 0; ic < NC; ++ic )
@@ -508,13 +548,15 @@ FluxKernel::
   template \
   void FluxKernel:: \
     launch< NC >( localIndex const size, \
+                  arrayView1d< localIndex const > const & wellElemOffsets, \
                   globalIndex const rankOffset, \
-                  WellControls const & wellControls, \
-                  arrayView1d< globalIndex const > const & wellElemDofNumber, \
-                  arrayView1d< localIndex const > const & nextWellElemIndex, \
-                  arrayView1d< real64 const > const & connRate, \
-                  arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompFrac, \
-                  arrayView3d< real64 const, compflow::USD_COMP_DC > const & dWellElemCompFrac_dCompDens, \
+                  arrayView1d< integer const > const & isProducer, \
+                  WellViewConst< arrayView1d< real64 const > > const & injection, \
+                  WellViewConst< arrayView1d< globalIndex const > > const & wellElemDofNumber, \
+                  WellViewConst< arrayView1d< localIndex const > > const & nextWellElemIndex, \
+                  WellViewConst< arrayView1d< real64 const > > const & connRate, \
+                  WellViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & wellElemCompFrac, \
+                  WellViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dWellElemCompFrac_dCompDens, \
                   real64 const & dt, \
                   CRSMatrixView< real64, globalIndex const > const & localMatrix, \
                   arrayView1d< real64 > const & localRhs )
@@ -578,100 +620,95 @@ template< integer NC >
 void
 PressureRelationKernel::
   launch( localIndex const size,
+          arrayView1d< localIndex const > const & wellElemOffsets,
           globalIndex const rankOffset,
-          bool const isLocallyOwned,
-          localIndex const iwelemControl,
           integer const targetPhaseIndex,
-          WellControls const & wellControls,
-          real64 const & timeAtEndOfStep,
-          arrayView1d< globalIndex const > const & wellElemDofNumber,
-          arrayView1d< real64 const > const & wellElemGravCoef,
-          arrayView1d< localIndex const > const & nextWellElemIndex,
-          arrayView1d< real64 const > const & wellElemPressure,
-          arrayView1d< real64 const > const & wellElemTotalMassDens,
-          arrayView1d< real64 const > const & dWellElemTotalMassDens_dPres,
-          arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens,
-          bool & controlHasSwitched,
+          PackedWellControls const & wellControls,
+          WellViewConst< arrayView1d< globalIndex const > > const & wellElemDofNumber,
+          WellViewConst< arrayView1d< real64 const > > const & wellElemGravCoef,
+          WellViewConst< arrayView1d< localIndex const > > const & nextWellElemIndex,
+          WellViewConst< arrayView1d< real64 const > > const & wellElemPressure,
+          WellViewConst< arrayView1d< real64 const > > const & wellElemTotalMassDens,
+          WellViewConst< arrayView1d< real64 const > > const & dWellElemTotalMassDens_dPres,
+          WellViewConst< arrayView2d< real64 const, compflow::USD_FLUID_DC > > const & dWellElemTotalMassDens_dCompDens,
+          arrayView1d< integer > const & controlHasSwitched,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs )
 {
 
+  // position of the control equations
+  arrayView1d< integer const > const isLocallyOwned = wellControls.m_isLocallyOwned.toViewConst();
+  arrayView1d< localIndex const > const iwelemControl = wellControls.m_iwelemControl.toViewConst();
+
   // static well control data
-  bool const isProducer = wellControls.isProducer();
-  WellControls::Control const currentControl = wellControls.getControl();
-  real64 const targetBHP = wellControls.getTargetBHP( timeAtEndOfStep );
-  real64 const targetTotalRate = wellControls.getTargetTotalRate( timeAtEndOfStep );
-  real64 const targetPhaseRate = wellControls.getTargetPhaseRate( timeAtEndOfStep );
+  arrayView1d< integer const > const isProducer = wellControls.m_isProducer.toViewConst();
+  arrayView1d< integer const > const currentControl = wellControls.m_currentControl.toViewConst();
+  arrayView1d< real64 const > const targetBHP = wellControls.m_targetBHP.toViewConst();
+  arrayView1d< real64 const > const targetTotalRate = wellControls.m_targetTotalRate.toViewConst();
+  arrayView1d< real64 const > const targetPhaseRate = wellControls.m_targetPhaseRate.toViewConst();
 
   // dynamic well control data
-  real64 const & currentBHP =
-    wellControls.getReference< real64 >( CompositionalMultiphaseWell::viewKeyStruct::currentBHPString() );
-  real64 const & dCurrentBHP_dPres =
-    wellControls.getReference< real64 >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentBHP_dPresString() );
-  arrayView1d< real64 const > const & dCurrentBHP_dCompDens =
-    wellControls.getReference< array1d< real64 > >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentBHP_dCompDensString() );
-
-  arrayView1d< real64 const > const & currentPhaseVolRate =
-    wellControls.getReference< array1d< real64 > >( CompositionalMultiphaseWell::viewKeyStruct::currentPhaseVolRateString() );
-  arrayView1d< real64 const > const & dCurrentPhaseVolRate_dPres =
-    wellControls.getReference< array1d< real64 > >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentPhaseVolRate_dPresString() );
-  arrayView2d< real64 const > const & dCurrentPhaseVolRate_dCompDens =
-    wellControls.getReference< array2d< real64 > >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentPhaseVolRate_dCompDensString() );
-  arrayView1d< real64 const > const & dCurrentPhaseVolRate_dRate =
-    wellControls.getReference< array1d< real64 > >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentPhaseVolRate_dRateString() );
-
-  real64 const & currentTotalVolRate =
-    wellControls.getReference< real64 >( CompositionalMultiphaseWell::viewKeyStruct::currentTotalVolRateString() );
-  real64 const & dCurrentTotalVolRate_dPres =
-    wellControls.getReference< real64 >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentTotalVolRate_dPresString() );
-  arrayView1d< real64 const > const & dCurrentTotalVolRate_dCompDens =
-    wellControls.getReference< array1d< real64 > >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentTotalVolRate_dCompDensString() );
-  real64 const & dCurrentTotalVolRate_dRate =
-    wellControls.getReference< real64 >( CompositionalMultiphaseWell::viewKeyStruct::dCurrentTotalVolRate_dRateString() );
-
-  RAJA::ReduceMax< parallelDeviceReduce, localIndex > switchControl( 0 );
-
-  // loop over the well elements to compute the pressure relations between well elements
-  forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelem )
+  arrayView1d< real64 const > const currentBHP = wellControls.m_currentBHP.toViewConst();
+  arrayView1d< real64 const > const dCurrentBHP_dPres = wellControls.m_dCurrentBHP_dPres.toViewConst();
+  WellViewConst< arrayView1d< real64 const > > const dCurrentBHP_dCompDens = wellControls.m_dCurrentBHP_dCompDens.toNestedViewConst();
+
+  WellViewConst< arrayView1d< real64 const > > const currentPhaseVolRate = wellControls.m_currentPhaseVolRate.toNestedViewConst();
+  WellViewConst< arrayView1d< real64 const > > const dCurrentPhaseVolRate_dPres = wellControls.m_dCurrentPhaseVolRate_dPres.toNestedViewConst();
+  WellViewConst< arrayView2d< real64 const > > const dCurrentPhaseVolRate_dCompDens = wellControls.m_dCurrentPhaseVolRate_dCompDens.toNestedViewConst();
+  WellViewConst< arrayView1d< real64 const > > const dCurrentPhaseVolRate_dRate = wellControls.m_dCurrentPhaseVolRate_dRate.toNestedViewConst();
+
+  arrayView1d< real64 const > const currentTotalVolRate = wellControls.m_currentTotalVolRate.toViewConst();
+  arrayView1d< real64 const > const dCurrentTotalVolRate_dPres = wellControls.m_dCurrentTotalVolRate_dPres.toViewConst();
+  WellViewConst< arrayView1d< real64 const > > const dCurrentTotalVolRate_dCompDens = wellControls.m_dCurrentTotalVolRate_dCompDens.toNestedViewConst();
+  arrayView1d< real64 const > const dCurrentTotalVolRate_dRate = wellControls.m_dCurrentTotalVolRate_dRate.toViewConst();
+
+  // loop over the well elements of all the wells to compute the pressure relations between well elements
+  forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iwelemPacked )
   {
-    localIndex const iwelemNext = nextWellElemIndex[iwelem];
+    // find the well of this element
+    localIndex const iwell = findPackedWell( wellElemOffsets, iwelemPacked );
+    localIndex const iwelem = iwelemPacked - wellElemOffsets[iwell];
+
+    localIndex const iwelemNext = nextWellElemIndex[iwell][iwelem];
 
-    if( iwelemNext < 0 && isLocallyOwned ) // if iwelemNext < 0, form control equation
+    if( iwelemNext < 0 && isLocallyOwned[iwell] ) // if iwelemNext < 0, form control equation
     {
-      WellControls::Control newControl = currentControl;
-      ControlEquationHelper::switchControl( isProducer,
-                                            currentControl,
+      WellControls::Control const wellCurrentControl = static_cast< WellControls::Control >( currentControl[iwell] );
+      WellControls::Control newControl = wellCurrentControl;
+      ControlEquationHelper::switchControl( isProducer[iwell],
+                                            wellCurrentControl,
                                             targetPhaseIndex,
-                                            targetBHP,
-                                            targetPhaseRate,
-                                            targetTotalRate,
-                                            currentBHP,
-                                            currentPhaseVolRate,
-                                            currentTotalVolRate,
+                                            targetBHP[iwell],
+                                            targetPhaseRate[iwell],
+                                            targetTotalRate[iwell],
+                                            currentBHP[iwell],
+                                            currentPhaseVolRate[iwell],
+                                            currentTotalVolRate[iwell],
                                             newControl );
-      if( currentControl != newControl )
+      // there is a single exit element per well, so the flag of the well is written by one thread only
+      if( wellCurrentControl != newControl )
       {
-        switchControl.max( 1 );
+        controlHasSwitched[iwell] = 1;
       }
 
       ControlEquationHelper::compute< NC >( rankOffset,
                                             newControl,
                                             targetPhaseIndex,
-                                            targetBHP,
-                                            targetPhaseRate,
-                                            targetTotalRate,
-                                            currentBHP,
-                                            dCurrentBHP_dPres,
-                                            dCurrentBHP_dCompDens,
-                                            currentPhaseVolRate,
-                                            dCurrentPhaseVolRate_dPres,
-                                            dCurrentPhaseVolRate_dCompDens,
-                                            dCurrentPhaseVolRate_dRate,
-                                            currentTotalVolRate,
-                                            dCurrentTotalVolRate_dPres,
-                                            dCurrentTotalVolRate_dCompDens,
-                                            dCurrentTotalVolRate_dRate,
-                                            wellElemDofNumber[iwelemControl],
+                                            targetBHP[iwell],
+                                            targetPhaseRate[iwell],
+                                            targetTotalRate[iwell],
+                                            currentBHP[iwell],
+                                            dCurrentBHP_dPres[iwell],
+                                            dCurrentBHP_dCompDens[iwell],
+                                            currentPhaseVolRate[iwell],
+                                            dCurrentPhaseVolRate_dPres[iwell],
+                                            dCurrentPhaseVolRate_dCompDens[iwell],
+                                            dCurrentPhaseVolRate_dRate[iwell],
+                                            currentTotalVolRate[iwell],
+                                            dCurrentTotalVolRate_dPres[iwell],
+                                            dCurrentTotalVolRate_dCompDens[iwell],
+                                            dCurrentTotalVolRate_dRate[iwell],
+                                            wellElemDofNumber[iwell][iwelemControl[iwell]],
                                             localMatrix,
                                             localRhs );
 
@@ -684,16 +721,16 @@ PressureRelationKernel::
       real64 localPresRel = 0;
       real64 localPresRelJacobian[2*(NC+1)]{};
 
-      compute< NC >( wellElemGravCoef[iwelem],
-                     wellElemGravCoef[iwelemNext],
-                     wellElemPressure[iwelem],
-                     wellElemPressure[iwelemNext],
-                     wellElemTotalMassDens[iwelem],
-                     wellElemTotalMassDens[iwelemNext],
-                     dWellElemTotalMassDens_dPres[iwelem],
-                     dWellElemTotalMassDens_dPres[iwelemNext],
-                     dWellElemTotalMassDens_dCompDens[iwelem],
-                     dWellElemTotalMassDens_dCompDens[iwelemNext],
+      compute< NC >( wellElemGravCoef[iwell][iwelem],
+                     wellElemGravCoef[iwell][iwelemNext],
+                     wellElemPressure[iwell][iwelem],
+                     wellElemPressure[iwell][iwelemNext],
+                     wellElemTotalMassDens[iwell][iwelem],
+                     wellElemTotalMassDens[iwell][iwelemNext],
+                     dWellElemTotalMassDens_dPres[iwell][iwelem],
+                     dWellElemTotalMassDens_dPres[iwell][iwelemNext],
+                     dWellElemTotalMassDens_dCompDens[iwell][iwelem],
+                     dWellElemTotalMassDens_dCompDens[iwell][iwelemNext],
                      localPresRel,
                      localPresRelJacobian );
 
@@ -701,14 +738,14 @@ PressureRelationKernel::
       // local working variables and arrays
       globalIndex dofColIndices[2*(NC+1)];
 
-      globalIndex const eqnRowIndex = wellElemDofNumber[iwelem] + ROFFSET::CONTROL - rankOffset;
-      dofColIndices[TAG::NEXT *(NC+1)]    = wellElemDofNumber[iwelemNext] + COFFSET::DPRES;
-      dofColIndices[TAG::CURRENT *(NC+1)] = wellElemDofNumber[iwelem] + COFFSET::DPRES;
+      globalIndex const eqnRowIndex = wellElemDofNumber[iwell][iwelem] + ROFFSET::CONTROL - rankOffset;
+      dofColIndices[TAG::NEXT *(NC+1)]    = wellElemDofNumber[iwell][iwelemNext] + COFFSET::DPRES;
+      dofColIndices[TAG::CURRENT *(NC+1)] = wellElemDofNumber[iwell][iwelem] + COFFSET::DPRES;
 
       for( integer ic = 0; ic < NC; ++ic )
       {
-        dofColIndices[TAG::NEXT *(NC+1) + ic+1]    = wellElemDofNumber[iwelemNext] + COFFSET::DCOMP + ic;
-        dofColIndices[TAG::CURRENT *(NC+1) + ic+1] = wellElemDofNumber[iwelem] + COFFSET::DCOMP + ic;
+        dofColIndices[TAG::NEXT *(NC+1) + ic+1]    = wellElemDofNumber[iwell][iwelemNext] + COFFSET::DCOMP + ic;
+        dofColIndices[TAG::CURRENT *(NC+1) + ic+1] = wellElemDofNumber[iwell][iwelem] + COFFSET::DCOMP + ic;
       }
 
       if( eqnRowIndex >= 0 && eqnRowIndex < localMatrix.numRows() )
@@ -721,27 +758,24 @@ PressureRelationKernel::
       }
     }
   } );
-  controlHasSwitched = ( switchControl.get() == 1 );
 }
 
 #define INST_PressureRelationKernel( NC ) \
   template \
   void PressureRelationKernel:: \
     launch< NC >( localIndex const size, \
+                  arrayView1d< localIndex const > const & wellElemOffsets, \
                   globalIndex const rankOffset, \
-                  bool const isLocallyOwned, \
-                  localIndex const iwelemControl, \
                   integer const targetPhaseIndex, \
-                  WellControls const & wellControls, \
-                  real64 const & timeAtEndOfStep, \
-                  arrayView1d< globalIndex const > const & wellElemDofNumber, \
-                  arrayView1d< real64 const > const & wellElemGravCoef, \
-                  arrayView1d< localIndex const > const & nextWellElemIndex, \
-                  arrayView1d< real64 const > const & wellElemPressure, \
-                  arrayView1d< real64 const > const & wellElemTotalMassDens, \
-                  arrayView1d< real64 const > const & dWellElemTotalMassDens_dPres, \
-                  arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens, \
-                  bool & controlHasSwitched, \
+                  PackedWellControls const & wellControls, \
+                  WellViewConst< arrayView1d< globalIndex const > > const & wellElemDofNumber, \
+                  WellViewConst< arrayView1d< real64 const > > const & wellElemGravCoef, \
+                  WellViewConst< arrayView1d< localIndex const > > const & nextWellElemIndex, \
+                  WellViewConst< arrayView1d< real64 const > > const & wellElemPressure, \
+                  WellViewConst< arrayView1d< real64 const > > const & wellElemTotalMassDens, \
+                  WellViewConst< arrayView1d< real64 const > > const & dWellElemTotalMassDens_dPres, \
+                  WellViewConst< arrayView2d< real64 const, compflow::USD_FLUID_DC > > const & dWellElemTotalMassDens_dCompDens, \
+                  arrayView1d< integer > const & controlHasSwitched, \
                   CRSMatrixView< real64, globalIndex const > const & localMatrix, \
                   arrayView1d< real64 > const & localRhs )
 
@@ -1073,7 +1107,8 @@ template< integer NC, integer NP >
 void
 PerforationKernel::
   launch( localIndex const size,
-          bool const disableReservoirToWellFlow,
+          arrayView1d< localIndex const > const & perfOffsets,
+          arrayView1d< integer const > const & disableReservoirToWellFlow,
           ElementViewConst< arrayView1d< real64 const > > const & resPres,
           ElementViewConst< arrayView2d< real64 const, compflow::USD_PHASE > > const & resPhaseVolFrac,
           ElementViewConst< arrayView3d< real64 const, compflow::USD_PHASE_DC > > const & dResPhaseVolFrac,
@@ -1086,38 +1121,41 @@ PerforationKernel::
           ElementViewConst< arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > > const & dResPhaseCompFrac,
           ElementViewConst< arrayView3d< real64 const, relperm::USD_RELPERM > > const & resPhaseRelPerm,
           ElementViewConst< arrayView4d< real64 const, relperm::USD_RELPERM_DS > > const & dResPhaseRelPerm_dPhaseVolFrac,
-          arrayView1d< real64 const > const & wellElemGravCoef,
-          arrayView1d< real64 const > const & wellElemPres,
-          arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompDens,
-          arrayView1d< real64 const > const & wellElemTotalMassDens,
-          arrayView1d< real64 const > const & dWellElemTotalMassDens_dPres,
-          arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens,
-          arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompFrac,
-          arrayView3d< real64 const, compflow::USD_COMP_DC > const & dWellElemCompFrac_dCompDens,
-          arrayView1d< real64 const > const & perfGravCoef,
-          arrayView1d< localIndex const > const & perfWellElemIndex,
-          arrayView1d< real64 const > const & perfTrans,
-          arrayView1d< localIndex const > const & resElementRegion,
-          arrayView1d< localIndex const > const & resElementSubRegion,
-          arrayView1d< localIndex const > const & resElementIndex,
-          arrayView2d< real64 > const & compPerfRate,
-          arrayView3d< real64 > const & dCompPerfRate_dPres,
-          arrayView4d< real64 > const & dCompPerfRate_dComp )
+          WellViewConst< arrayView1d< real64 const > > const & wellElemGravCoef,
+          WellViewConst< arrayView1d< real64 const > > const & wellElemPres,
+          WellViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & wellElemCompDens,
+          WellViewConst< arrayView1d< real64 const > > const & wellElemTotalMassDens,
+          WellViewConst< arrayView1d< real64 const > > const & dWellElemTotalMassDens_dPres,
+          WellViewConst< arrayView2d< real64 const, compflow::USD_FLUID_DC > > const & dWellElemTotalMassDens_dCompDens,
+          WellViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & wellElemCompFrac,
+          WellViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dWellElemCompFrac_dCompDens,
+          WellViewConst< arrayView1d< real64 const > > const & perfGravCoef,
+          WellViewConst< arrayView1d< localIndex const > > const & perfWellElemIndex,
+          WellViewConst< arrayView1d< real64 const > > const & perfTrans,
+          WellViewConst< arrayView1d< localIndex const > > const & resElementRegion,
+          WellViewConst< arrayView1d< localIndex const > > const & resElementSubRegion,
+          WellViewConst< arrayView1d< localIndex const > > const & resElementIndex,
+          WellView< arrayView2d< real64 > > const & compPerfRate,
+          WellView< arrayView3d< real64 > > const & dCompPerfRate_dPres,
+          WellView< arrayView4d< real64 > > const & dCompPerfRate_dComp )
 {
 
-  // loop over the perforations to compute the perforation rates
-  forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iperf )
+  // loop over the perforations of all the wells to compute the perforation rates
+  forAll< parallelDevicePolicy<> >( size, [=] GEOS_HOST_DEVICE ( localIndex const iperfPacked )
   {
+    // find the well of this perforation
+    localIndex const iwell = findPackedWell( perfOffsets, iperfPacked );
+    localIndex const iperf = iperfPacked - perfOffsets[iwell];
 
     // get the index of the reservoir elem
-    localIndex const er  = resElementRegion[iperf];
-    localIndex const esr = resElementSubRegion[iperf];
-    localIndex const ei  = resElementIndex[iperf];
+    localIndex const er  = resElementRegion[iwell][iperf];
+    localIndex const esr = resElementSubRegion[iwell][iperf];
+    localIndex const ei  = resElementIndex[iwell][iperf];
 
     // get the index of the well elem
-    localIndex const iwelem = perfWellElemIndex[iperf];
+    localIndex const iwelem = perfWellElemIndex[iwell][iperf];
 
-    compute< NC, NP >( disableReservoirToWellFlow,
+    compute< NC, NP >( disableReservoirToWellFlow[iwell],
                        resPres[er][esr][ei],
                        resPhaseVolFrac[er][esr][ei],
                        dResPhaseVolFrac[er][esr][ei],
@@ -1130,19 +1168,19 @@ PerforationKernel::
                        dResPhaseCompFrac[er][esr][ei][0],
                        resPhaseRelPerm[er][esr][ei][0],
                        dResPhaseRelPerm_dPhaseVolFrac[er][esr][ei][0],
-                       wellElemGravCoef[iwelem],
-                       wellElemPres[iwelem],
-                       wellElemCompDens[iwelem],
-                       wellElemTotalMassDens[iwelem],
-                       dWellElemTotalMassDens_dPres[iwelem],
-                       dWellElemTotalMassDens_dCompDens[iwelem],
-                       wellElemCompFrac[iwelem],
-                       dWellElemCompFrac_dCompDens[iwelem],
-                       perfGravCoef[iperf],
-                       perfTrans[iperf],
-                       compPerfRate[iperf],
-                       dCompPerfRate_dPres[iperf],
-                       dCompPerfRate_dComp[iperf] );
+                       wellElemGravCoef[iwell][iwelem],
+                       wellElemPres[iwell][iwelem],
+                       wellElemCompDens[iwell][iwelem],
+                       wellElemTotalMassDens[iwell][iwelem],
+                       dWellElemTotalMassDens_dPres[iwell][iwelem],
+                       dWellElemTotalMassDens_dCompDens[iwell][iwelem],
+                       wellElemCompFrac[iwell][iwelem],
+                       dWellElemCompFrac_dCompDens[iwell][iwelem],
+                       perfGravCoef[iwell][iperf],
+                       perfTrans[iwell][iperf],
+                       compPerfRate[iwell][iperf],
+                       dCompPerfRate_dPres[iwell][iperf],
+                       dCompPerfRate_dComp[iwell][iperf] );
 
   } );
 }
@@ -1151,7 +1189,8 @@ PerforationKernel::
   template \
   void PerforationKernel:: \
     launch< NC, NP >( localIndex const size, \
-                      bool const disableReservoirToWellFlow, \
+                      arrayView1d< localIndex const > const & perfOffsets, \
+                      arrayView1d< integer const > const & disableReservoirToWellFlow, \
                       ElementViewConst< arrayView1d< real64 const > > const & resPres, \
                       ElementViewConst< arrayView2d< real64 const, compflow::USD_PHASE > > const & resPhaseVolFrac, \
                       ElementViewConst< arrayView3d< real64 const, compflow::USD_PHASE_DC > > const & dResPhaseVolFrac, \
@@ -1164,23 +1203,23 @@ PerforationKernel::
                       ElementViewConst< arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > > const & dResPhaseCompFrac, \
                       ElementViewConst< arrayView3d< real64 const, relperm::USD_RELPERM > > const & resPhaseRelPerm, \
                       ElementViewConst< arrayView4d< real64 const, relperm::USD_RELPERM_DS > > const & dResPhaseRelPerm_dPhaseVolFrac, \
-                      arrayView1d< real64 const > const & wellElemGravCoef, \
-                      arrayView1d< real64 const > const & wellElemPres, \
-                      arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompDens, \
-                      arrayView1d< real64 const > const & wellElemTotalMassDens, \
-                      arrayView1d< real64 const > const & dWellElemTotalMassDens_dPres, \
-                      arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens, \
-                      arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompFrac, \
-                      arrayView3d< real64 const, compflow::USD_COMP_DC > const & dWellElemCompFrac_dCompDens, \
-                      arrayView1d< real64 const > const & perfGravCoef, \
-                      arrayView1d< localIndex const > const & perfWellElemIndex, \
-                      arrayView1d< real64 const > const & perfTrans, \
-                      arrayView1d< localIndex const > const & resElementRegion, \
-                      arrayView1d< localIndex const > const & resElementSubRegion, \
-                      arrayView1d< localIndex const > const & resElementIndex, \
-                      arrayView2d< real64 > const & compPerfRate, \
-                      arrayView3d< real64 > const & dCompPerfRate_dPres, \
-                      arrayView4d< real64 > const & dCompPerfRate_dComp )
+                      WellViewConst< arrayView1d< real64 const > > const & wellElemGravCoef, \
+                      WellViewConst< arrayView1d< real64 const > > const & wellElemPres, \
+                      WellViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & wellElemCompDens, \
+                      WellViewConst< arrayView1d< real64 const > > const & wellElemTotalMassDens, \
+                      WellViewConst< arrayView1d< real64 const > > const & dWellElemTotalMassDens_dPres, \
+                      WellViewConst< arrayView2d< real64 const, compflow::USD_FLUID_DC > > const & dWellElemTotalMassDens_dCompDens, \
+                      WellViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & wellElemCompFrac, \
+                      WellViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dWellElemCompFrac_dCompDens, \
+                      WellViewConst< arrayView1d< real64 const > > const & perfGravCoef, \
+                      WellViewConst< arrayView1d< localIndex const > > const & perfWellElemIndex, \
+                      WellViewConst< arrayView1d< real64 const > > const & perfTrans, \
+                      WellViewConst< arrayView1d< localIndex const > > const & resElementRegion, \
+                      WellViewConst< arrayView1d< localIndex const > > const & resElementSubRegion, \
+                      WellViewConst< arrayView1d< localIndex const > > const & resElementIndex, \
+                      WellView< arrayView2d< real64 > > const & compPerfRate, \
+                      WellView< arrayView3d< real64 > > const & dCompPerfRate_dPres, \
+                      WellView< arrayView4d< real64 > > const & dCompPerfRate_dComp )
 
 INST_PerforationKernel( 1, 2 );
 INST_PerforationKernel( 2, 2 );
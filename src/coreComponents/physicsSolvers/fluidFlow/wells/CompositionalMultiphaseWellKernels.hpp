@@ -74,6 +74,107 @@ struct RowOffset
   static constexpr integer MASSBAL = 1;
 };
 
+/******************************** Packed wells ********************************/
+
+/**
+ * @brief The views on a field of the wells of a rank, used to process all the wells in a single kernel launch.
+ *
+ * The field of the well iwell is accessed with [iwell], and the objects (elements or perforations) of the
+ * wells are numbered contiguously behind an offset array: the objects of the well iwell are the entries
+ * [ offsets[iwell], offsets[iwell+1] ) of the packing.
+ */
+template< typename VIEWTYPE >
+using WellViewAccessor = array1d< VIEWTYPE >;
+
+/**
+ * @brief The type of the nested view of a WellViewAccessor
+ */
+template< typename VIEWTYPE >
+using WellView = typename WellViewAccessor< VIEWTYPE >::NestedViewType;
+
+/**
+ * @brief The type of the nested const view of a WellViewAccessor
+ */
+template< typename VIEWTYPE >
+using WellViewConst = typename WellViewAccessor< VIEWTYPE >::NestedViewTypeConst;
+
+/**
+ * @brief Find the well of an object in the packing of the objects of all the wells
+ * @param[in] offsets the offsets of the wells in the packing, of size numWells+1
+ * @param[in] ipacked the index of the object in the packing
+ * @return the index iwell of the well such that offsets[iwell] <= ipacked < offsets[iwell+1]
+ *
+ * Empty wells share their offset with the next well, so the search always lands on a non-empty well.
+ */
+GEOS_HOST_DEVICE
+inline
+localIndex findPackedWell( arrayView1d< localIndex const > const & offsets,
+                           localIndex const ipacked )
+{
+  localIndex iwell = 0;
+  localIndex iwellEnd = offsets.size() - 1;
+  while( iwellEnd - iwell > 1 )
+  {
+    localIndex const mid = ( iwell + iwellEnd ) / 2;
+    if( offsets[mid] <= ipacked )
+    {
+      iwell = mid;
+    }
+    else
+    {
+      iwellEnd = mid;
+    }
+  }
+  return iwell;
+}
+
+/**
+ * @brief The control data of the wells whose pressure relations are assembled in a single kernel launch
+ */
+struct PackedWellControls
+{
+  /**
+   * @brief Append the control data of a well
+   * @param[in] wellControls the controls of the well
+   * @param[in] timeAtEndOfStep the time at which the targets are evaluated
+   * @param[in] isLocallyOwned true if the control equation of the well is assembled on this rank
+   * @param[in] iwelemControl the index of the well element on which the control equation is formed
+   */
+  void addWell( WellControls const & wellControls,
+                real64 const & timeAtEndOfStep,
+                bool const isLocallyOwned,
+                localIndex const iwelemControl );
+
+  /// @return the number of wells
+  localIndex size() const { return m_isProducer.size(); }
+
+  // position of the control equation
+  array1d< integer > m_isLocallyOwned;
+  array1d< localIndex > m_iwelemControl;
+
+  // static well control data
+  array1d< integer > m_isProducer;
+  array1d< integer > m_currentControl;
+  array1d< real64 > m_targetBHP;
+  array1d< real64 > m_targetTotalRate;
+  array1d< real64 > m_targetPhaseRate;
+
+  // dynamic well control data
+  array1d< real64 > m_currentBHP;
+  array1d< real64 > m_dCurrentBHP_dPres;
+  WellViewAccessor< arrayView1d< real64 const > > m_dCurrentBHP_dCompDens;
+
+  WellViewAccessor< arrayView1d< real64 const > > m_currentPhaseVolRate;
+  WellViewAccessor< arrayView1d< real64 const > > m_dCurrentPhaseVolRate_dPres;
+  WellViewAccessor< arrayView2d< real64 const > > m_dCurrentPhaseVolRate_dCompDens;
+  WellViewAccessor< arrayView1d< real64 const > > m_dCurrentPhaseVolRate_dRate;
+
+  array1d< real64 > m_currentTotalVolRate;
+  array1d< real64 > m_dCurrentTotalVolRate_dPres;
+  WellViewAccessor< arrayView1d< real64 const > > m_dCurrentTotalVolRate_dCompDens;
+  array1d< real64 > m_dCurrentTotalVolRate_dRate;
+};
+
 /******************************** ControlEquationHelper ********************************/
 
 struct ControlEquationHelper
@@ -162,13 +263,15 @@ struct FluxKernel
   template< integer NC >
   static void
   launch( localIndex const size,
+          arrayView1d< localIndex const > const & wellElemOffsets,
           globalIndex const rankOffset,
-          WellControls const & wellControls,
-          arrayView1d< globalIndex const > const & wellElemDofNumber,
-          arrayView1d< localIndex const > const & nextWellElemIndex,
-          arrayView1d< real64 const > const & connRate,
-          arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompFrac,
-          arrayView3d< real64 const, compflow::USD_COMP_DC > const & dWellElemCompFrac_dCompDens,
+          arrayView1d< integer const > const & isProducer,
+          WellViewConst< arrayView1d< real64 const > > const & injection,
+          WellViewConst< arrayView1d< globalIndex const > > const & wellElemDofNumber,
+          WellViewConst< arrayView1d< localIndex const > > const & nextWellElemIndex,
+          WellViewConst< arrayView1d< real64 const > > const & connRate,
+          WellViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & wellElemCompFrac,
+          WellViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dWellElemCompFrac_dCompDens,
           real64 const & dt,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs );
@@ -204,20 +307,18 @@ struct PressureRelationKernel
   template< integer NC >
   static void
   launch( localIndex const size,
+          arrayView1d< localIndex const > const & wellElemOffsets,
           globalIndex const rankOffset,
-          bool const isLocallyOwned,
-          localIndex const iwelemControl,
           integer const targetPhaseIndex,
-          WellControls const & wellControls,
-          real64 const & timeAtEndOfStep,
-          arrayView1d< globalIndex const > const & wellElemDofNumber,
-          arrayView1d< real64 const > const & wellElemGravCoef,
-          arrayView1d< localIndex const > const & nextWellElemIndex,
-          arrayView1d< real64 const > const & wellElemPressure,
-          arrayView1d< real64 const > const & wellElemTotalMassDens,
-          arrayView1d< real64 const > const & dWellElemTotalMassDens_dPres,
-          arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens,
-          bool & controlHasSwitched,
+          PackedWellControls const & wellControls,
+          WellViewConst< arrayView1d< globalIndex const > > const & wellElemDofNumber,
+          WellViewConst< arrayView1d< real64 const > > const & wellElemGravCoef,
+          WellViewConst< arrayView1d< localIndex const > > const & nextWellElemIndex,
+          WellViewConst< arrayView1d< real64 const > > const & wellElemPressure,
+          WellViewConst< arrayView1d< real64 const > > const & wellElemTotalMassDens,
+          WellViewConst< arrayView1d< real64 const > > const & dWellElemTotalMassDens_dPres,
+          WellViewConst< arrayView2d< real64 const, compflow::USD_FLUID_DC > > const & dWellElemTotalMassDens_dCompDens,
+          arrayView1d< integer > const & controlHasSwitched,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs );
 
@@ -296,7 +397,8 @@ struct PerforationKernel
   template< integer NC, integer NP >
   static void
   launch( localIndex const size,
-          bool const disableReservoirToWellFlow,
+          arrayView1d< localIndex const > const & perfOffsets,
+          arrayView1d< integer const > const & disableReservoirToWellFlow,
           ElementViewConst< arrayView1d< real64 const > > const & resPres,
           ElementViewConst< arrayView2d< real64 const, compflow::USD_PHASE > > const & resPhaseVolFrac,
           ElementViewConst< arrayView3d< real64 const, compflow::USD_PHASE_DC > > const & dResPhaseVolFrac_dComp,
@@ -309,23 +411,23 @@ struct PerforationKernel
           ElementViewConst< arrayView5d< real64 const, multifluid::USD_PHASE_COMP_DC > > const & dResPhaseCompFrac,
           ElementViewConst< arrayView3d< real64 const, relperm::USD_RELPERM > > const & resPhaseRelPerm,
           ElementViewConst< arrayView4d< real64 const, relperm::USD_RELPERM_DS > > const & dResPhaseRelPerm_dPhaseVolFrac,
-          arrayView1d< real64 const > const & wellElemGravCoef,
-          arrayView1d< real64 const > const & wellElemPres,
-          arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompDens,
-          arrayView1d< real64 const > const & wellElemTotalMassDens,
-          arrayView1d< real64 const > const & dWellElemTotalMassDens_dPres,
-          arrayView2d< real64 const, compflow::USD_FLUID_DC > const & dWellElemTotalMassDens_dCompDens,
-          arrayView2d< real64 const, compflow::USD_COMP > const & wellElemCompFrac,
-          arrayView3d< real64 const, compflow::USD_COMP_DC > const & dWellElemCompFrac_dCompDens,
-          arrayView1d< real64 const > const & perfGravCoef,
-          arrayView1d< localIndex const > const & perfWellElemIndex,
-          arrayView1d< real64 const > const & perfTrans,
-          arrayView1d< localIndex const > const & resElementRegion,
-          arrayView1d< localIndex const > const & resElementSubRegion,
-          arrayView1d< localIndex const > const & resElementIndex,
-          arrayView2d< real64 > const & compPerfRate,
-          arrayView3d< real64 > const & dCompPerfRate_dPres,
-          arrayView4d< real64 > const & dCompPerfRate_dComp );
+          WellViewConst< arrayView1d< real64 const > > const & wellElemGravCoef,
+          WellViewConst< arrayView1d< real64 const > > const & wellElemPres,
+          WellViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & wellElemCompDens,
+          WellViewConst< arrayView1d< real64 const > > const & wellElemTotalMassDens,
+          WellViewConst< arrayView1d< real64 const > > const & dWellElemTotalMassDens_dPres,
+          WellViewConst< arrayView2d< real64 const, compflow::USD_FLUID_DC > > const & dWellElemTotalMassDens_dCompDens,
+          WellViewConst< arrayView2d< real64 const, compflow::USD_COMP > > const & wellElemCompFrac,
+          WellViewConst< arrayView3d< real64 const, compflow::USD_COMP_DC > > const & dWellElemCompFrac_dCompDens,
+          WellViewConst< arrayView1d< real64 const > > const & perfGravCoef,
+          WellViewConst< arrayView1d< localIndex const > > const & perfWellElemIndex,
+          WellViewConst< arrayView1d< real64 const > > const & perfTrans,
+          WellViewConst< arrayView1d< localIndex const > > const & resElementRegion,
+          WellViewConst< arrayView1d< localIndex const > > const & resElementSubRegion,
+          WellViewConst< arrayView1d< localIndex const > > const & resElementIndex,
+          WellView< arrayView2d< real64 > > const & compPerfRate,
+          WellView< arrayView3d< real64 > > const & dCompPerfRate_dPres,
+          WellView< arrayView4d< real64 > > const & dCompPerfRate_dComp );
 
 };
 
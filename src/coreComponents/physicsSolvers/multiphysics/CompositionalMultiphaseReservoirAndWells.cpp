@@ -305,17 +305,29 @@ assembleCouplingTerms( real64 const time_n,
       resDofNumberAccessor.toNestedViewConst();
     globalIndex const rankOffset = dofManager.rankOffset();
 
+    string const wellDofKey = dofManager.getKey( Base::wellSolver()->wellElementDofName() );
+
+    // Pack the perforations of all the open wells of this rank, so that the coupling terms
+    // of all the wells are assembled in a single kernel launch instead of one launch per well.
+    // The perforations of the well iwell are [ perfOffsets[iwell], perfOffsets[iwell+1] ).
+    std::vector< WellElementSubRegion const * > openWells;
+    array1d< localIndex > perfOffsets( 1 );
+    array1d< integer > detectCrossflow;
+    array1d< arrayView1d< globalIndex const > > wellElemDofNumber;
+    array1d< arrayView2d< real64 const > > compPerfRate;
+    array1d< arrayView3d< real64 const > > dCompPerfRate_dPres;
+    array1d< arrayView4d< real64 const > > dCompPerfRate_dComp;
+    array1d< arrayView1d< localIndex const > > perfWellElemIndex;
+    array1d< arrayView1d< localIndex const > > resElementRegion;
+    array1d< arrayView1d< localIndex const > > resElementSubRegion;
+    array1d< arrayView1d< localIndex const > > resElementIndex;
+
     elemManager.forElementSubRegions< WellElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                 WellElementSubRegion const & subRegion )
     {
-
       // if the well is shut, we neglect reservoir-well flow that may occur despite the zero rate
       // therefore, we do not want to compute perforation rates and we simply assume they are zero
       WellControls const & wellControls = Base::wellSolver()->getWellControls( subRegion );
-      bool const detectCrossflow =
-        ( wellControls.isInjector() ) && wellControls.isCrossflowEnabled() &&
-        getLogLevel() >= 1; // since detect crossflow requires communication, we detect it only if the logLevel is sufficiently high
-
       if( !wellControls.isWellOpen( time_n + dt ) )
       {
         return;
@@ -325,123 +337,140 @@ assembleCouplingTerms( real64 const time_n,
 
       PerforationData const * const perforationData = subRegion.getPerforationData();
 
+      openWells.emplace_back( &subRegion );
+      perfOffsets.emplace_back( perfOffsets.back() + perforationData->size() );
+      // since detect crossflow requires communication, we detect it only if the logLevel is sufficiently high
+      detectCrossflow.emplace_back( wellControls.isInjector() && wellControls.isCrossflowEnabled() && getLogLevel() >= 1 );
+
       // get the degrees of freedom
-      string const wellDofKey = dofManager.getKey( Base::wellSolver()->wellElementDofName() );
-      arrayView1d< globalIndex const > const & wellElemDofNumber =
-        subRegion.getReference< array1d< globalIndex > >( wellDofKey );
+      wellElemDofNumber.emplace_back( subRegion.getReference< array1d< globalIndex > >( wellDofKey ).toViewConst() );
 
       // get well variables on perforations
-      arrayView2d< real64 const > const & compPerfRate =
-        perforationData->getField< fields::well::compPerforationRate >();
-      arrayView3d< real64 const > const & dCompPerfRate_dPres =
-        perforationData->getField< fields::well::dCompPerforationRate_dPres >();
-      arrayView4d< real64 const > const & dCompPerfRate_dComp =
-        perforationData->getField< fields::well::dCompPerforationRate_dComp >();
-
-      arrayView1d< localIndex const > const & perfWellElemIndex =
-        perforationData->getField< fields::perforation::wellElementIndex >();
+      compPerfRate.emplace_back( perforationData->getField< fields::well::compPerforationRate >() );
+      dCompPerfRate_dPres.emplace_back( perforationData->getField< fields::well::dCompPerforationRate_dPres >() );
+      dCompPerfRate_dComp.emplace_back( perforationData->getField< fields::well::dCompPerforationRate_dComp >() );
+      perfWellElemIndex.emplace_back( perforationData->getField< fields::perforation::wellElementIndex >() );
 
       // get the element region, subregion, index
-      arrayView1d< localIndex const > const & resElementRegion =
-        perforationData->getField< fields::perforation::reservoirElementRegion >();
-      arrayView1d< localIndex const > const & resElementSubRegion =
-        perforationData->getField< fields::perforation::reservoirElementSubRegion >();
-      arrayView1d< localIndex const > const & resElementIndex =
-        perforationData->getField< fields::perforation::reservoirElementIndex >();
+      resElementRegion.emplace_back( perforationData->getField< fields::perforation::reservoirElementRegion >() );
+      resElementSubRegion.emplace_back( perforationData->getField< fields::perforation::reservoirElementSubRegion >() );
+      resElementIndex.emplace_back( perforationData->getField< fields::perforation::reservoirElementIndex >() );
+    } );
 
-      RAJA::ReduceSum< parallelDeviceReduce, integer > numCrossflowPerforations( 0 );
+    localIndex const numOpenWells = LvArray::integerConversion< localIndex >( openWells.size() );
+    array1d< integer > numCrossflowPerforations( numOpenWells );
+
+    arrayView1d< localIndex const > const perfOffsetsView = perfOffsets.toViewConst();
+    arrayView1d< integer const > const detectCrossflowView = detectCrossflow.toViewConst();
+    arrayView1d< integer > const numCrossflowPerforationsView = numCrossflowPerforations.toView();
+    auto const wellElemDofNumberView = wellElemDofNumber.toNestedViewConst();
+    auto const compPerfRateView = compPerfRate.toNestedViewConst();
+    auto const dCompPerfRate_dPresView = dCompPerfRate_dPres.toNestedViewConst();
+    auto const dCompPerfRate_dCompView = dCompPerfRate_dComp.toNestedViewConst();
+    auto const perfWellElemIndexView = perfWellElemIndex.toNestedViewConst();
+    auto const resElementRegionView = resElementRegion.toNestedViewConst();
+    auto const resElementSubRegionView = resElementSubRegion.toNestedViewConst();
+    auto const resElementIndexView = resElementIndex.toNestedViewConst();
+
+    // loop over the perforations of all the open wells and add the rates to the residual and jacobian
+    forAll< parallelDevicePolicy<> >( perfOffsets.back(), [=] GEOS_HOST_DEVICE ( localIndex const iperfPacked )
+    {
+      // find the well of this perforation
+      localIndex const iwell = compositionalMultiphaseWellKernels::findPackedWell( perfOffsetsView, iperfPacked );
+      localIndex const iperf = iperfPacked - perfOffsetsView[iwell];
 
-      // loop over the perforations and add the rates to the residual and jacobian
-      forAll< parallelDevicePolicy<> >( perforationData->size(), [=] GEOS_HOST_DEVICE ( localIndex const iperf )
-      {
-        // local working variables and arrays
-        stackArray1d< localIndex, 2 * MAX_NUM_COMP > eqnRowIndices( 2 * numComps );
-        stackArray1d< globalIndex, 2 * MAX_NUM_DOF > dofColIndices( 2 * resNumDofs );
+      // local working variables and arrays
+      stackArray1d< localIndex, 2 * MAX_NUM_COMP > eqnRowIndices( 2 * numComps );
+      stackArray1d< globalIndex, 2 * MAX_NUM_DOF > dofColIndices( 2 * resNumDofs );
 
-        stackArray1d< real64, 2 * MAX_NUM_COMP > localPerf( 2 * numComps );
-        stackArray2d< real64, 2 * MAX_NUM_COMP * 2 * MAX_NUM_DOF > localPerfJacobian( 2 * numComps, 2 * resNumDofs );
+      stackArray1d< real64, 2 * MAX_NUM_COMP > localPerf( 2 * numComps );
+      stackArray2d< real64, 2 * MAX_NUM_COMP * 2 * MAX_NUM_DOF > localPerfJacobian( 2 * numComps, 2 * resNumDofs );
 
-        // get the reservoir (sub)region and element indices
-        localIndex const er  = resElementRegion[iperf];
-        localIndex const esr = resElementSubRegion[iperf];
-        localIndex const ei  = resElementIndex[iperf];
+      // get the reservoir (sub)region and element indices
+      localIndex const er  = resElementRegionView[iwell][iperf];
+      localIndex const esr = resElementSubRegionView[iwell][iperf];
+      localIndex const ei  = resElementIndexView[iwell][iperf];
 
-        // get the well element index for this perforation
-        localIndex const iwelem = perfWellElemIndex[iperf];
-        globalIndex const resOffset = resDofNumber[er][esr][ei];
-        globalIndex const wellElemOffset = wellElemDofNumber[iwelem];
+      // get the well element index for this perforation
+      localIndex const iwelem = perfWellElemIndexView[iwell][iperf];
+      globalIndex const resOffset = resDofNumber[er][esr][ei];
+      globalIndex const wellElemOffset = wellElemDofNumberView[iwell][iwelem];
 
-        for( integer ic = 0; ic < numComps; ++ic )
-        {
-          eqnRowIndices[TAG::RES * numComps + ic] = LvArray::integerConversion< localIndex >( resOffset - rankOffset ) + ic;
-          eqnRowIndices[TAG::WELL * numComps + ic] = LvArray::integerConversion< localIndex >( wellElemOffset - rankOffset ) + ROFFSET::MASSBAL + ic;
-        }
-        for( integer jdof = 0; jdof < resNumDofs; ++jdof )
-        {
-          dofColIndices[TAG::RES * resNumDofs + jdof] = resOffset + jdof;
-          dofColIndices[TAG::WELL * resNumDofs + jdof] = wellElemOffset + COFFSET::DPRES + jdof;
-        }
+      for( integer ic = 0; ic < numComps; ++ic )
+      {
+        eqnRowIndices[TAG::RES * numComps + ic] = LvArray::integerConversion< localIndex >( resOffset - rankOffset ) + ic;
+        eqnRowIndices[TAG::WELL * numComps + ic] = LvArray::integerConversion< localIndex >( wellElemOffset - rankOffset ) + ROFFSET::MASSBAL + ic;
+      }
+      for( integer jdof = 0; jdof < resNumDofs; ++jdof )
+      {
+        dofColIndices[TAG::RES * resNumDofs + jdof] = resOffset + jdof;
+        dofColIndices[TAG::WELL * resNumDofs + jdof] = wellElemOffset + COFFSET::DPRES + jdof;
+      }
 
-        // populate local flux vector and derivatives
-        for( integer ic = 0; ic < numComps; ++ic )
-        {
-          localPerf[TAG::RES * numComps + ic] = dt * compPerfRate[iperf][ic];
-          localPerf[TAG::WELL * numComps + ic] = -dt * compPerfRate[iperf][ic];
+      // populate local flux vector and derivatives
+      for( integer ic = 0; ic < numComps; ++ic )
+      {
+        localPerf[TAG::RES * numComps + ic] = dt * compPerfRateView[iwell][iperf][ic];
+        localPerf[TAG::WELL * numComps + ic] = -dt * compPerfRateView[iwell][iperf][ic];
 
-          if( detectCrossflow )
+        if( detectCrossflowView[iwell] )
+        {
+          if( compPerfRateView[iwell][iperf][ic] > LvArray::NumericLimits< real64 >::epsilon )
           {
-            if( compPerfRate[iperf][ic] > LvArray::NumericLimits< real64 >::epsilon )
-            {
-              numCrossflowPerforations += 1;
-            }
+            RAJA::atomicAdd( parallelDeviceAtomic{}, &numCrossflowPerforationsView[iwell], 1 );
           }
+        }
 
-          for( integer ke = 0; ke < 2; ++ke )
-          {
-            localIndex const localDofIndexPres = ke * resNumDofs;
-            localPerfJacobian[TAG::RES * numComps + ic][localDofIndexPres] = dt * dCompPerfRate_dPres[iperf][ke][ic];
-            localPerfJacobian[TAG::WELL * numComps + ic][localDofIndexPres] = -dt * dCompPerfRate_dPres[iperf][ke][ic];
+        for( integer ke = 0; ke < 2; ++ke )
+        {
+          localIndex const localDofIndexPres = ke * resNumDofs;
+          localPerfJacobian[TAG::RES * numComps + ic][localDofIndexPres] = dt * dCompPerfRate_dPresView[iwell][iperf][ke][ic];
+          localPerfJacobian[TAG::WELL * numComps + ic][localDofIndexPres] = -dt * dCompPerfRate_dPresView[iwell][iperf][ke][ic];
 
-            for( integer jc = 0; jc < numComps; ++jc )
-            {
-              localIndex const localDofIndexComp = localDofIndexPres + jc + 1;
-              localPerfJacobian[TAG::RES * numComps + ic][localDofIndexComp] = dt * dCompPerfRate_dComp[iperf][ke][ic][jc];
-              localPerfJacobian[TAG::WELL * numComps + ic][localDofIndexComp] = -dt * dCompPerfRate_dComp[iperf][ke][ic][jc];
-            }
+          for( integer jc = 0; jc < numComps; ++jc )
+          {
+            localIndex const localDofIndexComp = localDofIndexPres + jc + 1;
+            localPerfJacobian[TAG::RES * numComps + ic][localDofIndexComp] = dt * dCompPerfRate_dCompView[iwell][iperf][ke][ic][jc];
+            localPerfJacobian[TAG::WELL * numComps + ic][localDofIndexComp] = -dt * dCompPerfRate_dCompView[iwell][iperf][ke][ic][jc];
           }
         }
+      }
 
-        // Apply equation/variable change transformation(s)
-        stackArray1d< real64, 2 * MAX_NUM_DOF > work( 2 * resNumDofs );
-        shiftBlockRowsAheadByOneAndReplaceFirstRowWithColumnSum( numComps, numComps, resNumDofs*2, 2, localPerfJacobian, work );
-        shiftBlockElementsAheadByOneAndReplaceFirstElementWithSum( numComps, numComps, 2, localPerf );
+      // Apply equation/variable change transformation(s)
+      stackArray1d< real64, 2 * MAX_NUM_DOF > work( 2 * resNumDofs );
+      shiftBlockRowsAheadByOneAndReplaceFirstRowWithColumnSum( numComps, numComps, resNumDofs*2, 2, localPerfJacobian, work );
+      shiftBlockElementsAheadByOneAndReplaceFirstElementWithSum( numComps, numComps, 2, localPerf );
 
-        for( localIndex i = 0; i < localPerf.size(); ++i )
+      for( localIndex i = 0; i < localPerf.size(); ++i )
+      {
+        if( eqnRowIndices[i] >= 0 && eqnRowIndices[i] < localMatrix.numRows() )
         {
-          if( eqnRowIndices[i] >= 0 && eqnRowIndices[i] < localMatrix.numRows() )
-          {
-            localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( eqnRowIndices[i],
-                                                                              dofColIndices.data(),
-                                                                              localPerfJacobian[i].dataIfContiguous(),
-                                                                              2 * resNumDofs );
-            RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[eqnRowIndices[i]], localPerf[i] );
-          }
+          localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( eqnRowIndices[i],
+                                                                            dofColIndices.data(),
+                                                                            localPerfJacobian[i].dataIfContiguous(),
+                                                                            2 * resNumDofs );
+          RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[eqnRowIndices[i]], localPerf[i] );
         }
-      } );
-
+      }
+    } );
 
-      if( detectCrossflow ) // check to avoid communications if not needed
+    // the crossflow detection is done well by well, in the same order on all ranks
+    numCrossflowPerforations.move( hostMemorySpace, false );
+    for( localIndex iwell = 0; iwell < numOpenWells; ++iwell )
+    {
+      if( detectCrossflow[iwell] ) // check to avoid communications if not needed
       {
-        globalIndex const totalNumCrossflowPerforations = MpiWrapper::sum( numCrossflowPerforations.get() );
+        globalIndex const totalNumCrossflowPerforations = MpiWrapper::sum( numCrossflowPerforations[iwell] );
         if( totalNumCrossflowPerforations > 0 )
         {
+          WellControls const & wellControls = Base::wellSolver()->getWellControls( *openWells[iwell] );
           GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "CompositionalMultiphaseReservoir '{}': Warning! Crossflow detected at {} perforations in well {}"
                                               "To disable crossflow for injectors, you can use the field '{}' in the WellControls '{}' section",
-                                              this->getName(), totalNumCrossflowPerforations, subRegion.getName(),
+                                              this->getName(), totalNumCrossflowPerforations, openWells[iwell]->getName(),
                                               WellControls::viewKeyStruct::enableCrossflowString(), wellControls.getName() ) );
         }
       }
-    } );
+    }
 
     // update dynamically the MGR recipe to optimize the linear solve if all wells are shut
     areWellsShut = MpiWrapper::min( areWellsShut );
@@ -20,6 +20,7 @@
 #ifndef GEOS_PHYSICSSOLVERS_MULTIPHYSICS_COUPLEDSOLVER_HPP_
 #define GEOS_PHYSICSSOLVERS_MULTIPHYSICS_COUPLEDSOLVER_HPP_
 
+#include "mesh/mpiCommunications/CommunicationTools.hpp"
 #include "physicsSolvers/SolverBase.hpp"
 
 #include <tuple>
@@ -192,10 +193,23 @@ public:
                        real64 const dt,
                        DomainPartition & domain ) override
   {
+    // the synchronizations of the sub-solvers are merged into a single exchange per mesh
+    DeferredSynchronization deferredSync;
     forEachArgInTuple( m_solvers, [&]( auto & solver, auto )
     {
       solver->applySystemSolution( dofManager, localSolution, scalingFactor, dt, domain );
     } );
+    deferredSync.flush();
+  }
+
+  virtual void
+  addSolutionCorrections( arrayView1d< real64 > const & localIncrement ) override
+  {
+    SolverBase::addSolutionCorrections( localIncrement );
+    forEachArgInTuple( m_solvers, [&]( auto & solver, auto )
+    {
+      solver->addSolutionCorrections( localIncrement );
+    } );
   }
 
   virtual void
@@ -317,6 +331,19 @@ public:
     return nextDt;
   }
 
+  virtual real64
+  computeNormalizedStateChange( DomainPartition & domain ) override
+  {
+    real64 normalizedChange = -1.0;
+    forEachArgInTuple( m_solvers, [&]( auto & solver, auto )
+    {
+      real64 const singlePhysicsNormalizedChange =
+        solver->computeNormalizedStateChange( domain );
+      normalizedChange = LvArray::math::max( singlePhysicsNormalizedChange, normalizedChange );
+    } );
+    return normalizedChange;
+  }
+
   virtual void cleanup( real64 const time_n,
                         integer const cycleNumber,
                         integer const eventCounter,
@@ -348,12 +348,23 @@ void SinglePhasePoromechanics::createPreconditioner()
                                                                            SchurComplementOption::RowsumDiagonalProbing,
                                                                            BlockScalingOption::FrobeniusNorm );
 
-    auto mechPrecond = LAInterface::createPreconditioner( solidMechanicsSolver()->getLinearSolverParameters() );
+    // the mixed precision option of the coupled solver applies to the preconditioners of both blocks
+    integer const mixedPrecision = m_linearSolverParameters.get().mixedPrecision;
+    LinearSolverParameters mechParams = solidMechanicsSolver()->getLinearSolverParameters();
+    LinearSolverParameters flowParams = flowSolver()->getLinearSolverParameters();
+    mechParams.mixedPrecision = mixedPrecision;
+    flowParams.mixedPrecision = mixedPrecision;
+    GEOS_WARNING_IF( mixedPrecision &&
+                     ( mechParams.preconditionerType != LinearSolverParameters::PreconditionerType::jacobi ||
+                       flowParams.preconditionerType != LinearSolverParameters::PreconditionerType::jacobi ),
+                     getDataContext() << ": mixed precision is only applied to the blocks using a jacobi preconditioner" );
+
+    auto mechPrecond = LAInterface::createPreconditioner( mechParams );
     precond->setupBlock( 0,
                          { { solidMechanics::totalDisplacement::key(), { 3, true } } },
                          std::make_unique< SeparateComponentPreconditioner< LAInterface > >( 3, std::move( mechPrecond ) ) );
 
-    auto flowPrecond = LAInterface::createPreconditioner( flowSolver()->getLinearSolverParameters() );
+    auto flowPrecond = LAInterface::createPreconditioner( flowParams );
     precond->setupBlock( 1,
                          { { flow::pressure::key(), { 1, true } } },
                          std::move( flowPrecond ) );
@@ -616,7 +616,7 @@ real64 SolidMechanicsLagrangianFEM::explicitStep( real64 const & time_n,
     fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time_n, mesh, solidMechanics::velocity::key() );
 
     parallelDeviceEvents packEvents;
-    CommunicationTools::getInstance().asyncPack( fieldsToBeSync, mesh, domain.getNeighbors(), m_iComm, true, packEvents );
+    CommunicationTools::getInstance().asyncPack( domain.getNeighbors(), m_iComm, true, packEvents );
 
     waitAllDeviceEvents( packEvents );
 
@@ -636,7 +636,7 @@ real64 SolidMechanicsLagrangianFEM::explicitStep( real64 const & time_n,
 
     // this includes  a device sync after launching all the unpacking kernels
     parallelDeviceEvents unpackEvents;
-    CommunicationTools::getInstance().finalizeUnpack( mesh, domain.getNeighbors(), m_iComm, true, unpackEvents );
+    CommunicationTools::getInstance().finalizeUnpack( domain.getNeighbors(), m_iComm, true, unpackEvents );
 
   } );
 
@@ -1203,12 +1203,12 @@ void SolidMechanicsMPM::syncGridFields( std::vector< std::string > const & field
   // (3) Additive sync
   CommunicationTools::getInstance().synchronizePackSendRecvSizes( fieldsToBeSynced, mesh, neighbors, m_iComm, true );
   parallelDeviceEvents packEvents;
-  CommunicationTools::getInstance().asyncPack( fieldsToBeSynced, mesh, neighbors, m_iComm, true, packEvents );
+  CommunicationTools::getInstance().asyncPack( neighbors, m_iComm, true, packEvents );
   waitAllDeviceEvents( packEvents );
   CommunicationTools::getInstance().asyncSendRecv( neighbors, m_iComm, true, packEvents );
   parallelDeviceEvents unpackEvents;
-  CommunicationTools::getInstance().finalizeUnpack( mesh, neighbors, m_iComm, true, unpackEvents, op ); // needs an extra argument to
-                                                                                                        // indicate unpack operation
+  CommunicationTools::getInstance().finalizeUnpack( neighbors, m_iComm, true, unpackEvents, op ); // needs an extra argument to
+                                                                                                  // indicate unpack operation
 
   // (4) Swap send and receive indices back so we can sync from master to ghost
   for( size_t n=0; n<neighbors.size(); n++ )
@@ -1224,11 +1224,11 @@ void SolidMechanicsMPM::syncGridFields( std::vector< std::string > const & field
   // (5) Perform sync
   CommunicationTools::getInstance().synchronizePackSendRecvSizes( fieldsToBeSynced, mesh, neighbors, m_iComm, true );
   parallelDeviceEvents packEvents2;
-  CommunicationTools::getInstance().asyncPack( fieldsToBeSynced, mesh, neighbors, m_iComm, true, packEvents2 );
+  CommunicationTools::getInstance().asyncPack( neighbors, m_iComm, true, packEvents2 );
   waitAllDeviceEvents( packEvents2 );
   CommunicationTools::getInstance().asyncSendRecv( neighbors, m_iComm, true, packEvents2 );
   parallelDeviceEvents unpackEvents2;
-  CommunicationTools::getInstance().finalizeUnpack( mesh, neighbors, m_iComm, true, unpackEvents2 );
+  CommunicationTools::getInstance().finalizeUnpack( neighbors, m_iComm, true, unpackEvents2 );
 }
 
 void SolidMechanicsMPM::singleFaceVectorFieldSymmetryBC( const int face,
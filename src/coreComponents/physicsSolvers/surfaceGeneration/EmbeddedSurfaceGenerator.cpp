@@ -136,7 +136,8 @@ void EmbeddedSurfaceGenerator::initializePostSubGroups()
                                                                                              PlanarGeometricObject & fracture )
   {
     /* 1. Find out if an element is cut by the fracture or not.
-     * Loop over all the elements and for each one of them loop over the nodes and compute the
+     * The spatial index of the mesh level provides the elements whose bounding box is cut by the
+     * fracture plane. For each one of them loop over the nodes and compute the
      * dot product between the distance between the plane center and the node and the normal
      * vector defining the plane. If two scalar products have different signs the plane cuts the
      * cell. If a nodes gives a 0 dot product it has to be neglected or the method won't work.
@@ -148,63 +149,63 @@ void EmbeddedSurfaceGenerator::initializePostSubGroups()
     integer isPositive, isNegative;
     real64 distVec[ 3 ];
 
-    elemManager.forElementSubRegionsComplete< CellElementSubRegion >(
-      [&]( localIndex const er, localIndex const esr, ElementRegionBase &, CellElementSubRegion & subRegion )
+    meshLevel.getElementSpatialIndex().forElementsIntersectingPlane( planeCenter,
+                                                                     normalVector,
+                                                                     [&]( localIndex const er,
+                                                                          localIndex const esr,
+                                                                          localIndex const cellIndex )
     {
+      CellElementSubRegion & subRegion = elemManager.getRegion( er ).getSubRegion< CellElementSubRegion >( esr );
+
       arrayView2d< localIndex const, cells::NODE_MAP_USD > const cellToNodes = subRegion.nodeList();
       FixedOneToManyRelation const & cellToEdges = subRegion.edgeList();
 
       arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
 
-      forAll< serialPolicy >( subRegion.size(), [ &, ghostRank,
-                                                  cellToNodes,
-                                                  nodesCoord ] ( localIndex const cellIndex )
+      if( ghostRank[cellIndex] < 0 )
       {
-        if( ghostRank[cellIndex] < 0 )
+        isPositive = 0;
+        isNegative = 0;
+        for( localIndex kn = 0; kn < subRegion.numNodesPerElement(); kn++ )
         {
-          isPositive = 0;
-          isNegative = 0;
-          for( localIndex kn = 0; kn < subRegion.numNodesPerElement(); kn++ )
+          nodeIndex = cellToNodes[cellIndex][kn];
+          LvArray::tensorOps::copy< 3 >( distVec, nodesCoord[nodeIndex] );
+          LvArray::tensorOps::subtract< 3 >( distVec, planeCenter );
+          // check if the dot product is zero
+          if( LvArray::tensorOps::AiBi< 3 >( distVec, normalVector ) > 0 )
           {
-            nodeIndex = cellToNodes[cellIndex][kn];
-            LvArray::tensorOps::copy< 3 >( distVec, nodesCoord[nodeIndex] );
-            LvArray::tensorOps::subtract< 3 >( distVec, planeCenter );
-            // check if the dot product is zero
-            if( LvArray::tensorOps::AiBi< 3 >( distVec, normalVector ) > 0 )
-            {
-              isPositive = 1;
-            }
-            else if( LvArray::tensorOps::AiBi< 3 >( distVec, normalVector ) < 0 )
-            {
-              isNegative = 1;
-            }
-          } // end loop over nodes
-          if( isPositive * isNegative == 1 )
+            isPositive = 1;
+          }
+          else if( LvArray::tensorOps::AiBi< 3 >( distVec, normalVector ) < 0 )
           {
-            bool added = embeddedSurfaceSubRegion.addNewEmbeddedSurface( cellIndex,
-                                                                         er,
-                                                                         esr,
-                                                                         nodeManager,
-                                                                         embSurfNodeManager,
-                                                                         edgeManager,
-                                                                         cellToEdges,
-                                                                         &fracture );
-
-            if( added )
-            {
-              GEOS_LOG_LEVEL_RANK_0( 2, "Element " << cellIndex << " is fractured" );
-
-              // Add the information to the CellElementSubRegion
-              subRegion.addFracturedElement( cellIndex, localNumberOfSurfaceElems );
-
-              newObjects.newElements[ {embeddedSurfaceRegion.getIndexInParent(), embeddedSurfaceSubRegion.getIndexInParent()} ].insert( localNumberOfSurfaceElems );
-
-              localNumberOfSurfaceElems++;
-            }
+            isNegative = 1;
+          }
+        } // end loop over nodes
+        if( isPositive * isNegative == 1 )
+        {
+          bool added = embeddedSurfaceSubRegion.addNewEmbeddedSurface( cellIndex,
+                                                                       er,
+                                                                       esr,
+                                                                       nodeManager,
+                                                                       embSurfNodeManager,
+                                                                       edgeManager,
+                                                                       cellToEdges,
+                                                                       &fracture );
+
+          if( added )
+          {
+            GEOS_LOG_LEVEL_RANK_0( 2, "Element " << cellIndex << " is fractured" );
+
+            // Add the information to the CellElementSubRegion
+            subRegion.addFracturedElement( cellIndex, localNumberOfSurfaceElems );
+
+            newObjects.newElements[ {embeddedSurfaceRegion.getIndexInParent(), embeddedSurfaceSubRegion.getIndexInParent()} ].insert( localNumberOfSurfaceElems );
+
+            localNumberOfSurfaceElems++;
           }
         }
-      } );// end loop over cells
-    } );// end loop over subregions
+      }
+    } );// end loop over candidate cells
   } );// end loop over planes
 
   // Launch kernel to compute connectivity index of each fractured element.
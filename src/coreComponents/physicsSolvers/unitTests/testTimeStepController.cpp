@@ -0,0 +1,132 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "physicsSolvers/TimeStepController.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace geos;
+
+namespace
+{
+constexpr real64 dt = 10.0;
+constexpr real64 maxIncreaseFactor = 2.0;
+constexpr real64 minDecreaseFactor = 0.1;
+constexpr integer growthDelay = 2;
+constexpr real64 tol = 1e-12;
+}
+
+TEST( TimeStepController, noErrorKeepsTimeStep )
+{
+  TimeStepController controller;
+  EXPECT_FALSE( controller.hasError() );
+  EXPECT_DOUBLE_EQ( controller.errorEstimateDt( dt ), dt );
+  EXPECT_DOUBLE_EQ( controller.targetChangeDt( dt ), dt );
+
+  // a negative error means that no measure is available for the step, and breaks the history
+  controller.recordStep( 0, 0.5 );
+  EXPECT_TRUE( controller.hasError() );
+  controller.recordStep( 0, -1.0 );
+  EXPECT_FALSE( controller.hasError() );
+  EXPECT_DOUBLE_EQ( controller.errorEstimateDt( dt ), dt );
+}
+
+TEST( TimeStepController, errorEstimateAcceptAndReject )
+{
+  TimeStepController controller;
+
+  // error below the target: the step is accepted and the time step increases
+  controller.recordStep( 0, 0.25 );
+  real64 const grownDt = controller.errorEstimateDt( dt );
+  EXPECT_GT( grownDt, dt );
+  // the error scales with dt^2
+  EXPECT_NEAR( grownDt, dt * 0.9 / 0.5, tol * dt );
+
+  // error above the target: the time step decreases
+  controller.recordStep( 0, 4.0 );
+  real64 const shrunkDt = controller.errorEstimateDt( dt );
+  EXPECT_LT( shrunkDt, dt );
+  EXPECT_NEAR( shrunkDt, dt * 0.9 / 2.0, tol * dt );
+}
+
+TEST( TimeStepController, targetChange )
+{
+  TimeStepController controller;
+
+  // until the history is full, the time step is scaled to hit the target
+  controller.recordStep( 0, 0.5 );
+  EXPECT_NEAR( controller.targetChangeDt( dt ), 2.0 * dt, tol * dt );
+  controller.recordStep( 0, 2.0 );
+  EXPECT_NEAR( controller.targetChangeDt( dt ), 0.5 * dt, tol * dt );
+
+  // PID control: the time step does not change when the target is hit exactly
+  controller.recordStep( 0, 1.0 );
+  controller.recordStep( 0, 1.0 );
+  controller.recordStep( 0, 1.0 );
+  EXPECT_NEAR( controller.targetChangeDt( dt ), dt, tol * dt );
+
+  // and it increases (resp. decreases) when the change is below (resp. above) the target
+  controller.recordStep( 0, 0.5 );
+  EXPECT_GT( controller.targetChangeDt( dt ), dt );
+  controller.recordStep( 0, 2.0 );
+  controller.recordStep( 0, 2.0 );
+  EXPECT_LT( controller.targetChangeDt( dt ), dt );
+}
+
+TEST( TimeStepController, growthAndShrinkClamps )
+{
+  TimeStepController controller;
+
+  // growth is capped by the increase factor
+  EXPECT_DOUBLE_EQ( controller.limitChange( dt, 10.0 * dt, maxIncreaseFactor, minDecreaseFactor, growthDelay ), maxIncreaseFactor * dt );
+  EXPECT_DOUBLE_EQ( controller.limitChange( dt, 1.5 * dt, maxIncreaseFactor, minDecreaseFactor, growthDelay ), 1.5 * dt );
+
+  // decrease is capped by the minimum decrease factor
+  EXPECT_DOUBLE_EQ( controller.limitChange( dt, 1e-6 * dt, maxIncreaseFactor, minDecreaseFactor, growthDelay ),
+                    minDecreaseFactor * dt );
+  EXPECT_DOUBLE_EQ( controller.limitChange( dt, 0.5 * dt, maxIncreaseFactor, minDecreaseFactor, growthDelay ), 0.5 * dt );
+  EXPECT_DOUBLE_EQ( controller.limitChange( dt, 0.5 * dt, maxIncreaseFactor, 0.8, growthDelay ), 0.8 * dt );
+
+  // a huge error estimate does not collapse the time step
+  controller.recordStep( 0, 1e8 );
+  EXPECT_DOUBLE_EQ( controller.limitChange( dt, controller.errorEstimateDt( dt ), maxIncreaseFactor, minDecreaseFactor, growthDelay ),
+                    minDecreaseFactor * dt );
+}
+
+TEST( TimeStepController, growthDelayedAfterCut )
+{
+  TimeStepController controller;
+  EXPECT_FALSE( controller.isGrowthDelayed( growthDelay ) );
+
+  // a step that needed a cut blocks the growth for the next growthDelay steps
+  controller.recordStep( 1, 0.1 );
+  EXPECT_TRUE( controller.isGrowthDelayed( growthDelay ) );
+  EXPECT_DOUBLE_EQ( controller.limitChange( dt, 5.0 * dt, maxIncreaseFactor, minDecreaseFactor, growthDelay ), dt );
+  // but the time step can still decrease
+  EXPECT_DOUBLE_EQ( controller.limitChange( dt, 0.5 * dt, maxIncreaseFactor, minDecreaseFactor, growthDelay ), 0.5 * dt );
+
+  controller.recordStep( 0, 0.1 );
+  EXPECT_TRUE( controller.isGrowthDelayed( growthDelay ) );
+
+  controller.recordStep( 0, 0.1 );
+  EXPECT_FALSE( controller.isGrowthDelayed( growthDelay ) );
+  EXPECT_DOUBLE_EQ( controller.limitChange( dt, 5.0 * dt, maxIncreaseFactor, minDecreaseFactor, growthDelay ), maxIncreaseFactor * dt );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  int const result = RUN_ALL_TESTS();
+  return result;
+}
@@ -203,8 +203,11 @@ void AcousticFirstOrderWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLev
     }
   }
 
-  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const regionIndex,
-                                                                                        CellElementSubRegion & elementSubRegion )
+  mesh.getElemManager().forElementSubRegionsComplete< CellElementSubRegion >( regionNames, [&]( localIndex const regionIndex,
+                                                                                                localIndex const er,
+                                                                                                localIndex const esr,
+                                                                                                ElementRegionBase &,
+                                                                                                CellElementSubRegion & elementSubRegion )
   {
     GEOS_THROW_IF( elementSubRegion.getElementType() != ElementType::Hexahedron,
                    getDataContext() << ": Invalid type of element, the acoustic solver is designed for hexahedral meshes only (C3D8) ",
@@ -215,6 +218,8 @@ void AcousticFirstOrderWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLev
     arrayView2d< real64 const > const elemCenter = elementSubRegion.getElementCenter();
     arrayView1d< integer const > const elemGhostRank = elementSubRegion.ghostRank();
 
+    SortedArray< localIndex > const elementList = findSourceAndReceiverElements( mesh, er, esr );
+
     finiteElement::FiniteElementBase const &
     fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( getDiscretizationName() );
     finiteElement::FiniteElementDispatchHandler< SEM_FE_TYPES >::dispatch3D( fe, [&] ( auto const finiteElement )
@@ -227,7 +232,7 @@ void AcousticFirstOrderWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLev
       acousticFirstOrderWaveEquationSEMKernels::
         PrecomputeSourceAndReceiverKernel::
         launch< EXEC_POLICY, FE_TYPE >
-        ( elementSubRegion.size(),
+        ( elementList.toViewConst(),
         regionIndex,
         numNodesPerElem,
         numFacesPerElem,
@@ -592,6 +597,11 @@ void AcousticFirstOrderWaveEquationSEM::cleanup( real64 const time_n, integer co
   {
     m_indexSeismoTrace++;
   }
+
+  writeSeismoTraces( viewKeyStruct::pressureNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_pressureNp1AtReceivers.toViewConst() );
+  writeSeismoTraces( viewKeyStruct::uxNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_uxNp1AtReceivers.toViewConst() );
+  writeSeismoTraces( viewKeyStruct::uyNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_uyNp1AtReceivers.toViewConst() );
+  writeSeismoTraces( viewKeyStruct::uzNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_uzNp1AtReceivers.toViewConst() );
 }
 
 void AcousticFirstOrderWaveEquationSEM::computeAllSeismoTraces( real64 const time_n,
@@ -38,7 +38,7 @@ struct PrecomputeSourceAndReceiverKernel
    * @brief Launches the precomputation of the source and receiver terms
    * @tparam EXEC_POLICY execution policy
    * @tparam FE_TYPE finite element type
-   * @param[in] size the number of cells in the subRegion
+   * @param[in] elementList the cells of the subRegion whose bounding box contains a source or a receiver
    * @param[in] numNodesPerElem number of nodes per element
    * @param[in] numFacesPerElem number of faces per element
    * @param[in] nodeCoords coordinates of the nodes
@@ -66,7 +66,7 @@ struct PrecomputeSourceAndReceiverKernel
    */
   template< typename EXEC_POLICY, typename FE_TYPE >
   static void
-  launch( localIndex const size,
+  launch( SortedArrayView< localIndex const > const elementList,
           localIndex const regionIndex,
           localIndex const numNodesPerElem,
           localIndex const numFacesPerElem,
@@ -96,8 +96,9 @@ struct PrecomputeSourceAndReceiverKernel
           localIndex const rickerOrder )
   {
 
-    forAll< EXEC_POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const k )
+    forAll< EXEC_POLICY >( elementList.size(), [=] GEOS_HOST_DEVICE ( localIndex const ie )
     {
+      localIndex const k = elementList[ie];
       real64 const center[3] = { elemCenter[k][0],
                                  elemCenter[k][1],
                                  elemCenter[k][2] };
@@ -234,7 +235,7 @@ struct MassMatrixKernel
       constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
 
       real32 const invC2 = 1.0 / ( density[k] * velocity[k] * velocity[k] );
-      real64 xLocal[ numNodesPerElem ][ 3 ];
+      WaveSolverBase::wsGeometryType xLocal[ numNodesPerElem ][ 3 ];
       for( localIndex a = 0; a < numNodesPerElem; ++a )
       {
         for( localIndex i = 0; i < 3; ++i )
@@ -297,7 +298,7 @@ struct DampingMatrixKernel
         if( facesDomainBoundaryIndicator[f] == 1 && freeSurfaceFaceIndicator[f] != 1 )
         {
           constexpr localIndex numNodesPerFace = FE_TYPE::numNodesPerFace;
-          real64 xLocal[ numNodesPerFace ][ 3 ];
+          WaveSolverBase::wsGeometryType xLocal[ numNodesPerFace ][ 3 ];
           for( localIndex a = 0; a < numNodesPerFace; ++a )
           {
             for( localIndex d = 0; d < 3; ++d )
@@ -362,7 +363,7 @@ struct VelocityComputation
       constexpr localIndex numNodesPerElem = FE_TYPE::numNodes;
       constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
 
-      real64 xLocal[numNodesPerElem][3];
+      WaveSolverBase::wsGeometryType xLocal[numNodesPerElem][3];
       for( localIndex a=0; a< numNodesPerElem; ++a )
       {
         for( localIndex i=0; i<3; ++i )
@@ -497,7 +498,7 @@ struct PressureComputation
       constexpr localIndex numNodesPerElem = FE_TYPE::numNodes;
       constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
 
-      real64 xLocal[numNodesPerElem][3];
+      WaveSolverBase::wsGeometryType xLocal[numNodesPerElem][3];
       for( localIndex a=0; a< numNodesPerElem; ++a )
       {
         for( localIndex i=0; i<3; ++i )
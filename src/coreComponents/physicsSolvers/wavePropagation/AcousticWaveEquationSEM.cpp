@@ -36,7 +36,9 @@ using namespace dataRepository;
 AcousticWaveEquationSEM::AcousticWaveEquationSEM( const std::string & name,
                                                   Group * const parent ):
   WaveSolverBase( name,
-                  parent )
+                  parent ),
+  m_savedFieldsCycle( std::numeric_limits< integer >::max() ),
+  m_upperSavedFieldsCycle( std::numeric_limits< integer >::max() )
 {
 
   registerWrapper( viewKeyStruct::pressureNp1AtReceiversString(), &m_pressureNp1AtReceivers ).
@@ -44,6 +46,13 @@ AcousticWaveEquationSEM::AcousticWaveEquationSEM( const std::string & name,
     setSizedFromParent( 0 ).
     setDescription( "Pressure value at each receiver for each timestep" );
 
+  registerWrapper( viewKeyStruct::saveFieldsDecimationString(), &m_saveFieldsDecimation ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 1 ).
+    setDescription( "Number of cycles between two fields saved during forward, the last cycle being always saved. During backward, "
+                    "the saved fields are linearly interpolated in time between the saved cycles, so that the storage of the saved "
+                    "fields is divided by this number" );
+
 }
 
 AcousticWaveEquationSEM::~AcousticWaveEquationSEM()
@@ -76,6 +85,12 @@ void AcousticWaveEquationSEM::registerDataOnMesh( Group & meshBodies )
                                fields::StiffnessVector,
                                fields::FreeSurfaceNodeIndicator >( getName() );
 
+    /// register the second saved fields only when they are interpolated in time
+    if( m_saveFieldsDecimation > 1 )
+    {
+      nodeManager.registerField< fields::PressureDoubleDerivativeUpper >( getName() );
+    }
+
     /// register  PML auxiliary variables only when a PML is specified in the xml
     if( m_usePML )
     {
@@ -100,6 +115,11 @@ void AcousticWaveEquationSEM::registerDataOnMesh( Group & meshBodies )
       subRegion.registerField< fields::PartialGradient >( getName() );
     } );
 
+    if( m_maxLocalTimeSteppingLevel > 0 )
+    {
+      registerLocalTimeSteppingData( mesh, 1 );
+    }
+
   } );
 }
 
@@ -109,6 +129,11 @@ void AcousticWaveEquationSEM::postProcessInput()
 
   WaveSolverBase::postProcessInput();
 
+  GEOS_THROW_IF( m_saveFieldsDecimation < 1,
+                 getWrapperDataContext( viewKeyStruct::saveFieldsDecimationString() ) <<
+                 ": The number of cycles between two saved fields must be positive",
+                 InputError );
+
   localIndex const numReceiversGlobal = m_receiverCoordinates.size( 0 );
 
   m_pressureNp1AtReceivers.resize( m_nsamplesSeismoTrace, numReceiversGlobal );
@@ -157,8 +182,11 @@ void AcousticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & mesh,
     }
   }
 
-  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
-                                                                                        CellElementSubRegion & elementSubRegion )
+  mesh.getElemManager().forElementSubRegionsComplete< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                                localIndex const er,
+                                                                                                localIndex const esr,
+                                                                                                ElementRegionBase &,
+                                                                                                CellElementSubRegion & elementSubRegion )
   {
     GEOS_THROW_IF( elementSubRegion.getElementType() != ElementType::Hexahedron,
                    getDataContext() << ": Invalid type of element, the acoustic solver is designed for hexahedral meshes only (C3D8), using the SEM formulation",
@@ -169,6 +197,8 @@ void AcousticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & mesh,
     arrayView2d< real64 const > const elemCenter = elementSubRegion.getElementCenter();
     arrayView1d< integer const > const elemGhostRank = elementSubRegion.ghostRank();
 
+    SortedArray< localIndex > const elementList = findSourceAndReceiverElements( mesh, er, esr );
+
     finiteElement::FiniteElementBase const &
     fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( getDiscretizationName() );
     finiteElement::FiniteElementDispatchHandler< SEM_FE_TYPES >::dispatch3D( fe, [&] ( auto const finiteElement )
@@ -183,7 +213,7 @@ void AcousticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & mesh,
         acousticWaveEquationSEMKernels::
           PrecomputeSourceAndReceiverKernel::
           launch< EXEC_POLICY, FE_TYPE >
-          ( elementSubRegion.size(),
+          ( elementList.toViewConst(),
           numNodesPerElem,
           numFacesPerElem,
           X32,
@@ -325,10 +355,55 @@ void AcousticWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
         }
       } );
     } );
+
+    if( m_maxLocalTimeSteppingLevel > 0 )
+    {
+      initializeLocalTimeStepping( mesh, regionNames, fields::MediumVelocity::key(), domain );
+    }
   } );
 
 }
 
+void AcousticWaveEquationSEM::computeLocalTimeSteppingStiffness( MeshLevel & mesh,
+                                                                 arrayView1d< string const > const & regionNames,
+                                                                 integer const level,
+                                                                 arrayView3d< real32 const > const input,
+                                                                 integer const inputLevel,
+                                                                 arrayView2d< real32 > const stiffness )
+{
+  NodeManager & nodeManager = mesh.getNodeManager();
+  arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = nodeManager.getField< fields::referencePosition32 >().toViewConst();
+  arrayView1d< integer const > const nodeLevel = nodeManager.getField< fields::localTimeSteppingNodeLevel >().toViewConst();
+
+  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                        CellElementSubRegion & elementSubRegion )
+  {
+    finiteElement::FiniteElementBase const &
+    fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( getDiscretizationName() );
+
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = elementSubRegion.nodeList();
+    arrayView1d< real32 const > const density = elementSubRegion.getField< fields::MediumDensity >();
+    ArrayOfArraysView< localIndex const > const elementLists =
+      elementSubRegion.getReference< ArrayOfArrays< localIndex > >( viewKeyStruct::localTimeSteppingElementsString() ).toViewConst();
+
+    finiteElement::FiniteElementDispatchHandler< SEM_FE_TYPES >::dispatch3D( fe, [&] ( auto const finiteElement )
+    {
+      using FE_TYPE = TYPEOFREF( finiteElement );
+
+      acousticWaveEquationSEMKernels::LocalTimeSteppingStiffnessKernel< FE_TYPE > kernel( finiteElement );
+      kernel.template launch< EXEC_POLICY, ATOMIC_POLICY >( elementLists,
+                                                            level,
+                                                            nodeCoords,
+                                                            elemsToNodes,
+                                                            nodeLevel,
+                                                            density,
+                                                            input,
+                                                            inputLevel,
+                                                            stiffness );
+    } );
+  } );
+}
+
 
 void AcousticWaveEquationSEM::applyFreeSurfaceBC( real64 time, DomainPartition & domain )
 {
@@ -766,8 +841,17 @@ real64 AcousticWaveEquationSEM::explicitStepForward( real64 const & time_n,
     arrayView1d< real32 > const p_n = nodeManager.getField< fields::Pressure_n >();
     arrayView1d< real32 > const p_np1 = nodeManager.getField< fields::Pressure_np1 >();
 
-    if( computeGradient && cycleNumber >= 0 )
+    EventManager const & event = getGroupByPath< EventManager >( "/Problem/Events" );
+    real64 const & maxTime = event.getReference< real64 >( EventManager::viewKeyStruct::maxTimeString() );
+    int const maxCycle = int(round( maxTime/dt ));
+
+    // the last cycle is always saved, so that the backward pass can interpolate the fields after the last multiple
+    // of m_saveFieldsDecimation
+    if( computeGradient && cycleNumber >= 0 && ( cycleNumber % m_saveFieldsDecimation == 0 || cycleNumber == maxCycle - 1 ) )
     {
+      // the next backward pass starts by loading the last saved fields
+      m_savedFieldsCycle = std::numeric_limits< integer >::max();
+      m_upperSavedFieldsCycle = std::numeric_limits< integer >::max();
 
       arrayView1d< real32 > const p_dt2 = nodeManager.getField< fields::PressureDoubleDerivative >();
 
@@ -864,31 +948,49 @@ real64 AcousticWaveEquationSEM::explicitStepBackward( real64 const & time_n,
 
       arrayView1d< real32 > const p_dt2 = nodeManager.getField< fields::PressureDoubleDerivative >();
 
-      if( m_enableLifo )
+      // the fields are saved every m_saveFieldsDecimation cycles and at the last cycle: the saved fields preceding
+      // the current cycle are loaded once the backward pass goes below the cycle of the loaded ones, which are kept
+      // to interpolate the fields in time between the two saved cycles bracketing the current cycle
+      integer const savedCycle = ( cycleNumber == maxCycle - 1 ) ? cycleNumber : cycleNumber - cycleNumber % m_saveFieldsDecimation;
+      if( cycleNumber < m_savedFieldsCycle )
       {
-        m_lifo->pop( p_dt2 );
-        if( m_lifo->empty() )
-          delete m_lifo.release();
-      }
-      else
-      {
-        GEOS_MARK_SCOPE ( DirectRead );
+        if( m_saveFieldsDecimation > 1 )
+        {
+          arrayView1d< real32 > const p_dt2_upper = nodeManager.getField< fields::PressureDoubleDerivativeUpper >();
+          forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+          {
+            p_dt2_upper[a] = p_dt2[a];
+          } );
+          m_upperSavedFieldsCycle = m_savedFieldsCycle;
+        }
+        m_savedFieldsCycle = savedCycle;
 
-        int const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
-        std::string fileName = GEOS_FMT( "lifo/rank_{:05}/pressuredt2_{:06}_{:08}.dat", rank, m_shotIndex, cycleNumber );
-        std::ifstream wf( fileName, std::ios::in | std::ios::binary );
-        GEOS_THROW_IF( !wf,
-                       getDataContext() << ": Could not open file "<< fileName << " for reading",
-                       InputError );
-        //std::string fileName = GEOS_FMT( "pressuredt2_{:06}_{:08}_{:04}.dat", m_shotIndex, cycleNumber, rank );
-        //const int fileDesc = open( fileName.c_str(), O_RDONLY | O_DIRECT );
-        //GEOS_ERROR_IF( fileDesc == -1,
-        //                "Could not open file "<< fileName << " for reading: " << strerror( errno ) );
-        // maybe better with registerTouch()
-        p_dt2.move( MemorySpace::host, true );
-        wf.read( (char *)&p_dt2[0], p_dt2.size()*sizeof( real32 ) );
-        wf.close( );
-        remove( fileName.c_str() );
+        if( m_enableLifo )
+        {
+          m_lifo->pop( p_dt2 );
+          if( m_lifo->empty() )
+            delete m_lifo.release();
+        }
+        else
+        {
+          GEOS_MARK_SCOPE ( DirectRead );
+
+          int const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+          std::string fileName = GEOS_FMT( "lifo/rank_{:05}/pressuredt2_{:06}_{:08}.dat", rank, m_shotIndex, savedCycle );
+          std::ifstream wf( fileName, std::ios::in | std::ios::binary );
+          GEOS_THROW_IF( !wf,
+                         getDataContext() << ": Could not open file "<< fileName << " for reading",
+                         InputError );
+          //std::string fileName = GEOS_FMT( "pressuredt2_{:06}_{:08}_{:04}.dat", m_shotIndex, cycleNumber, rank );
+          //const int fileDesc = open( fileName.c_str(), O_RDONLY | O_DIRECT );
+          //GEOS_ERROR_IF( fileDesc == -1,
+          //                "Could not open file "<< fileName << " for reading: " << strerror( errno ) );
+          // maybe better with registerTouch()
+          p_dt2.move( MemorySpace::host, true );
+          wf.read( (char *)&p_dt2[0], p_dt2.size()*sizeof( real32 ) );
+          wf.close( );
+          remove( fileName.c_str() );
+        }
       }
       elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
                                                                                   CellElementSubRegion & elementSubRegion )
@@ -899,17 +1001,38 @@ real64 AcousticWaveEquationSEM::explicitStepBackward( real64 const & time_n,
         constexpr localIndex numNodesPerElem = 8;
         arrayView1d< integer const > const elemGhostRank = elementSubRegion.ghostRank();
         GEOS_MARK_SCOPE ( updatePartialGradient );
-        forAll< EXEC_POLICY >( elementSubRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const eltIdx )
+        if( cycleNumber > m_savedFieldsCycle && m_upperSavedFieldsCycle < std::numeric_limits< integer >::max() )
         {
-          if( elemGhostRank[eltIdx]<0 )
+          // linear interpolation between the saved fields bracketing the current cycle
+          arrayView1d< real32 const > const p_dt2_upper = nodeManager.getField< fields::PressureDoubleDerivativeUpper >();
+          real32 const weightUpper = real32( cycleNumber - m_savedFieldsCycle ) / ( m_upperSavedFieldsCycle - m_savedFieldsCycle );
+          forAll< EXEC_POLICY >( elementSubRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const eltIdx )
           {
-            for( localIndex i = 0; i < numNodesPerElem; ++i )
+            if( elemGhostRank[eltIdx]<0 )
             {
-              localIndex nodeIdx = elemsToNodes[eltIdx][i];
-              grad[eltIdx] += (-2/velocity[eltIdx]) * mass[nodeIdx]/8.0 * (p_dt2[nodeIdx] * p_n[nodeIdx]);
+              for( localIndex i = 0; i < numNodesPerElem; ++i )
+              {
+                localIndex nodeIdx = elemsToNodes[eltIdx][i];
+                real32 const pdt2 = (1 - weightUpper) * p_dt2[nodeIdx] + weightUpper * p_dt2_upper[nodeIdx];
+                grad[eltIdx] += (-2/velocity[eltIdx]) * mass[nodeIdx]/8.0 * (pdt2 * p_n[nodeIdx]);
+              }
             }
-          }
-        } );
+          } );
+        }
+        else
+        {
+          forAll< EXEC_POLICY >( elementSubRegion.size(), [=] GEOS_HOST_DEVICE ( localIndex const eltIdx )
+          {
+            if( elemGhostRank[eltIdx]<0 )
+            {
+              for( localIndex i = 0; i < numNodesPerElem; ++i )
+              {
+                localIndex nodeIdx = elemsToNodes[eltIdx][i];
+                grad[eltIdx] += (-2/velocity[eltIdx]) * mass[nodeIdx]/8.0 * (p_dt2[nodeIdx] * p_n[nodeIdx]);
+              }
+            }
+          } );
+        }
       } );
     }
 
@@ -951,17 +1074,21 @@ real64 AcousticWaveEquationSEM::explicitStepInternal( real64 const & time_n,
     arrayView1d< real32 > const rhs = nodeManager.getField< fields::ForcingRHS >();
 
     bool const usePML = m_usePML;
+    bool const useLocalTimeStepping = m_maxLocalTimeSteppingLevel > 0;
 
-    auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticSEMFactory( dt );
-
-    finiteElement::
-      regionBasedKernelApplication< EXEC_POLICY,
-                                    constitutive::NullModel,
-                                    CellElementSubRegion >( mesh,
-                                                            regionNames,
-                                                            getDiscretizationName(),
-                                                            "",
-                                                            kernelFactory );
+    if( !useLocalTimeStepping )
+    {
+      auto kernelFactory = acousticWaveEquationSEMKernels::ExplicitAcousticSEMFactory( dt );
+
+      finiteElement::
+        regionBasedKernelApplication< EXEC_POLICY,
+                                      constitutive::NullModel,
+                                      CellElementSubRegion >( mesh,
+                                                              regionNames,
+                                                              getDiscretizationName(),
+                                                              "",
+                                                              kernelFactory );
+    }
 
     EventManager const & event = getGroupByPath< EventManager >( "/Problem/Events" );
     real64 const & minTime = event.getReference< real64 >( EventManager::viewKeyStruct::minTimeString() );
@@ -972,7 +1099,32 @@ real64 AcousticWaveEquationSEM::explicitStepInternal( real64 const & time_n,
     /// calculate your time integrators
     real64 const dt2 = dt*dt;
 
-    if( !usePML )
+    if( useLocalTimeStepping )
+    {
+      GEOS_MARK_SCOPE ( updatePWithLocalTimeStepping );
+      arrayView3d< real32 > const forcing = nodeManager.getField< fields::localTimeSteppingForcing >();
+      arrayView3d< real32 > const p_lts = nodeManager.getField< fields::localTimeSteppingSubstep1 >();
+      forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+      {
+        p_lts[a][0][0] = p_n[a];
+        forcing[a][0][0] = rhs[a] / mass[a];
+      } );
+
+      localTimeSteppingStep( mesh, regionNames, domain, dt, mass, freeSurfaceNodeIndicator );
+
+      // same update as below, where p_n + dt2*(rhs-stiffnessVector)/(2*mass) is replaced by its multirate counterpart
+      arrayView3d< real32 const > const q = nodeManager.getField< fields::localTimeSteppingSubstep2 >().toViewConst();
+      forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+      {
+        if( freeSurfaceNodeIndicator[a] != 1 )
+        {
+          p_np1[a] = 2.0*mass[a]*q[a][0][0];
+          p_np1[a] -= (mass[a]-0.5*dt*damping[a])*p_nm1[a];
+          p_np1[a] /= mass[a]+0.5*dt*damping[a];
+        }
+      } );
+    }
+    else if( !usePML )
     {
       GEOS_MARK_SCOPE ( updateP );
       forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
@@ -1112,6 +1264,8 @@ void AcousticWaveEquationSEM::cleanup( real64 const time_n,
     arrayView2d< real32 > const pReceivers   = m_pressureNp1AtReceivers.toView();
     computeAllSeismoTraces( time_n, 0, p_np1, p_n, pReceivers );
   } );
+
+  writeSeismoTraces( viewKeyStruct::pressureNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_pressureNp1AtReceivers.toViewConst() );
 }
 
 void AcousticWaveEquationSEM::computeAllSeismoTraces( real64 const time_n,
@@ -120,6 +120,8 @@ public:
 
     static constexpr char const * pressureNp1AtReceiversString() { return "pressureNp1AtReceivers"; }
 
+    static constexpr char const * saveFieldsDecimationString() { return "saveFieldsDecimation"; }
+
   } waveEquationViewKeys;
 
 
@@ -165,9 +167,27 @@ private:
    */
   virtual void applyPML( real64 const time, DomainPartition & domain ) override;
 
+  virtual bool supportsLocalTimeStepping() const override { return true; }
+
+  virtual void computeLocalTimeSteppingStiffness( MeshLevel & mesh,
+                                                  arrayView1d< string const > const & regionNames,
+                                                  integer const level,
+                                                  arrayView3d< real32 const > const input,
+                                                  integer const inputLevel,
+                                                  arrayView2d< real32 > const stiffness ) override;
+
   /// Pressure_np1 at the receiver location for each time step for each receiver
   array2d< real32 > m_pressureNp1AtReceivers;
 
+  /// Number of cycles between two saved fields (the fields are interpolated in time between them during backward)
+  integer m_saveFieldsDecimation;
+
+  /// Cycle of the saved fields currently loaded in PressureDoubleDerivative during backward
+  integer m_savedFieldsCycle;
+
+  /// Cycle of the saved fields currently loaded in PressureDoubleDerivativeUpper during backward
+  integer m_upperSavedFieldsCycle;
+
 };
 
 
@@ -270,6 +290,14 @@ DECLARE_FIELD( PressureDoubleDerivative,
                WRITE_AND_READ,
                "Double derivative of the pressure for each node to compute the gradient" );
 
+DECLARE_FIELD( PressureDoubleDerivativeUpper,
+               "pressureDoubleDerivativeUpper",
+               array1d< real32 >,
+               0,
+               NOPLOT,
+               WRITE_AND_READ,
+               "Double derivative of the pressure at the saved cycle following the loaded one, to interpolate it in time during backward" );
+
 DECLARE_FIELD( PartialGradient,
                "partialGradient",
                array1d< real32 >,
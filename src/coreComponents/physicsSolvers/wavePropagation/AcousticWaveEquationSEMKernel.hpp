@@ -39,7 +39,7 @@ struct PrecomputeSourceAndReceiverKernel
    * @brief Launches the precomputation of the source and receiver terms
    * @tparam EXEC_POLICY execution policy
    * @tparam FE_TYPE finite element type
-   * @param[in] size the number of cells in the subRegion
+   * @param[in] elementList the cells of the subRegion whose bounding box contains a source or a receiver
    * @param[in] numNodesPerElem number of nodes per element
    * @param[in] nodeCoords coordinates of the nodes
    * @param[in] elemsToNodes map from element to nodes
@@ -57,7 +57,7 @@ struct PrecomputeSourceAndReceiverKernel
    */
   template< typename EXEC_POLICY, typename FE_TYPE >
   static void
-  launch( localIndex const size,
+  launch( SortedArrayView< localIndex const > const elementList,
           localIndex const numNodesPerElem,
           localIndex const numFacesPerElem,
           arrayView2d< WaveSolverBase::wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords,
@@ -82,8 +82,9 @@ struct PrecomputeSourceAndReceiverKernel
           localIndex const rickerOrder )
   {
 
-    forAll< EXEC_POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const k )
+    forAll< EXEC_POLICY >( elementList.size(), [=] GEOS_HOST_DEVICE ( localIndex const ie )
     {
+      localIndex const k = elementList[ie];
       real64 const center[3] = { elemCenter[k][0],
                                  elemCenter[k][1],
                                  elemCenter[k][2] };
@@ -217,7 +218,7 @@ struct MassMatrixKernel
       constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
 
       real32 const invC2 = 1.0 / ( density[e] * velocity[e] * velocity[e] );
-      real64 xLocal[ numNodesPerElem ][ 3 ];
+      WaveSolverBase::wsGeometryType xLocal[ numNodesPerElem ][ 3 ];
       for( localIndex a = 0; a < numNodesPerElem; ++a )
       {
         for( localIndex i = 0; i < 3; ++i )
@@ -282,7 +283,7 @@ struct DampingMatrixKernel
         if( facesDomainBoundaryIndicator[f] == 1 && freeSurfaceFaceIndicator[f] != 1 )
         {
           constexpr localIndex numNodesPerFace = FE_TYPE::numNodesPerFace;
-          real64 xLocal[ numNodesPerFace ][ 3 ];
+          WaveSolverBase::wsGeometryType xLocal[ numNodesPerFace ][ 3 ];
           for( localIndex a = 0; a < numNodesPerFace; ++a )
           {
             for( localIndex d = 0; d < 3; ++d )
@@ -307,6 +308,77 @@ struct DampingMatrixKernel
 
 };
 
+template< typename FE_TYPE >
+struct LocalTimeSteppingStiffnessKernel
+{
+
+  LocalTimeSteppingStiffnessKernel( FE_TYPE const & finiteElement )
+    : m_finiteElement( finiteElement )
+  {}
+
+  /**
+   * @brief Launches the computation of the stiffness term of the pressure of the nodes of a local time stepping level,
+   *   the pressure of the other nodes being taken as zero
+   * @tparam EXEC_POLICY the execution policy
+   * @tparam ATOMIC_POLICY the atomic policy
+   * @param[in] elementLists the cells adjacent to the nodes of each level
+   * @param[in] level the local time stepping level
+   * @param[in] nodeCoords coordinates of the nodes
+   * @param[in] elemsToNodes map from element to nodes
+   * @param[in] nodeLevel local time stepping level of the nodes
+   * @param[in] density cell-wise density
+   * @param[in] pressure the nodal pressure, for each local time stepping level
+   * @param[in] pressureLevel the level of @p pressure to use
+   * @param[out] stiffness the product of the stiffness matrix and the pressure of the nodes of the level
+   */
+  template< typename EXEC_POLICY, typename ATOMIC_POLICY >
+  void
+  launch( ArrayOfArraysView< localIndex const > const elementLists,
+          integer const level,
+          arrayView2d< WaveSolverBase::wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords,
+          arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes,
+          arrayView1d< integer const > const nodeLevel,
+          arrayView1d< real32 const > const density,
+          arrayView3d< real32 const > const pressure,
+          integer const pressureLevel,
+          arrayView2d< real32 > const stiffness )
+  {
+    forAll< EXEC_POLICY >( elementLists.sizeOfArray( level ), [=] GEOS_HOST_DEVICE ( localIndex const ie )
+    {
+      constexpr localIndex numNodesPerElem = FE_TYPE::numNodes;
+      constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
+
+      localIndex const e = elementLists( level, ie );
+
+      WaveSolverBase::wsGeometryType xLocal[ numNodesPerElem ][ 3 ];
+      real32 pLocal[ numNodesPerElem ];
+      for( localIndex a = 0; a < numNodesPerElem; ++a )
+      {
+        localIndex const nodeIndex = elemsToNodes( e, a );
+        for( localIndex i = 0; i < 3; ++i )
+        {
+          xLocal[a][i] = nodeCoords( nodeIndex, i );
+        }
+        pLocal[a] = ( nodeLevel[nodeIndex] == level ) ? pressure( nodeIndex, pressureLevel, 0 ) : 0.0;
+      }
+
+      real32 const invDensity = 1.0 / density[e];
+      for( localIndex q = 0; q < numQuadraturePointsPerElem; ++q )
+      {
+        m_finiteElement.computeStiffnessTerm( q, xLocal, [&] ( int const i, int const j, WaveSolverBase::wsGeometryType const val )
+        {
+          real32 const localIncrement = invDensity * val * pLocal[j];
+          RAJA::atomicAdd< ATOMIC_POLICY >( &stiffness( elemsToNodes( e, i ), 0 ), localIncrement );
+        } );
+      }
+    } );
+  }
+
+  /// The finite element space/discretization object for the element type in the subRegion
+  FE_TYPE const & m_finiteElement;
+
+};
+
 struct PMLKernelHelper
 {
   /**
@@ -762,7 +834,7 @@ public:
     {}
 
     /// C-array stack storage for element local the nodal positions.
-    real64 xLocal[ numNodesPerElem ][ 3 ];
+    WaveSolverBase::wsGeometryType xLocal[ numNodesPerElem ][ 3 ];
   };
   //***************************************************************************
 
@@ -801,7 +873,7 @@ public:
                               localIndex const q,
                               StackVariables & stack ) const
   {
-    m_finiteElementSpace.template computeStiffnessTerm( q, stack.xLocal, [&] ( int i, int j, real64 val )
+    m_finiteElementSpace.template computeStiffnessTerm( q, stack.xLocal, [&] ( int i, int j, WaveSolverBase::wsGeometryType val )
     {
       real32 invDensity = 1./m_density[k];
       real32 const localIncrement = invDensity*val*m_p_n[m_elemsToNodes[k][j]];
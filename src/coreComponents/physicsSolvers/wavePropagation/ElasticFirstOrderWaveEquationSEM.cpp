@@ -254,8 +254,11 @@ void ElasticFirstOrderWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLeve
     }
   }
 
-  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const regionIndex,
-                                                                                        CellElementSubRegion & elementSubRegion )
+  mesh.getElemManager().forElementSubRegionsComplete< CellElementSubRegion >( regionNames, [&]( localIndex const regionIndex,
+                                                                                                localIndex const er,
+                                                                                                localIndex const esr,
+                                                                                                ElementRegionBase &,
+                                                                                                CellElementSubRegion & elementSubRegion )
   {
 
     GEOS_THROW_IF( elementSubRegion.getElementType() != ElementType::Hexahedron,
@@ -267,6 +270,8 @@ void ElasticFirstOrderWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLeve
     arrayView2d< real64 const > const elemCenter = elementSubRegion.getElementCenter();
     arrayView1d< integer const > const elemGhostRank = elementSubRegion.ghostRank();
 
+    SortedArray< localIndex > const elementList = findSourceAndReceiverElements( mesh, er, esr );
+
     finiteElement::FiniteElementBase const &
     fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( getDiscretizationName() );
     finiteElement::FiniteElementDispatchHandler< SEM_FE_TYPES >::dispatch3D( fe, [&] ( auto const finiteElement )
@@ -279,7 +284,7 @@ void ElasticFirstOrderWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLeve
       elasticFirstOrderWaveEquationSEMKernels::
         PrecomputeSourceAndReceiverKernel::
         launch< EXEC_POLICY, FE_TYPE >
-        ( elementSubRegion.size(),
+        ( elementList.toViewConst(),
         regionIndex,
         numNodesPerElem,
         numFacesPerElem,
@@ -740,6 +745,15 @@ void ElasticFirstOrderWaveEquationSEM::cleanup( real64 const time_n,
     m_indexSeismoTrace++;
   }
 
+  writeSeismoTraces( viewKeyStruct::displacementxNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_displacementxNp1AtReceivers.toViewConst() );
+  writeSeismoTraces( viewKeyStruct::displacementyNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_displacementyNp1AtReceivers.toViewConst() );
+  writeSeismoTraces( viewKeyStruct::displacementzNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_displacementzNp1AtReceivers.toViewConst() );
+  writeSeismoTraces( viewKeyStruct::sigmaxxNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_sigmaxxNp1AtReceivers.toViewConst() );
+  writeSeismoTraces( viewKeyStruct::sigmayyNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_sigmayyNp1AtReceivers.toViewConst() );
+  writeSeismoTraces( viewKeyStruct::sigmazzNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_sigmazzNp1AtReceivers.toViewConst() );
+  writeSeismoTraces( viewKeyStruct::sigmaxyNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_sigmaxyNp1AtReceivers.toViewConst() );
+  writeSeismoTraces( viewKeyStruct::sigmaxzNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_sigmaxzNp1AtReceivers.toViewConst() );
+  writeSeismoTraces( viewKeyStruct::sigmayzNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_sigmayzNp1AtReceivers.toViewConst() );
 }
 
 void ElasticFirstOrderWaveEquationSEM::computeAllSeismoTraces( real64 const time_n,
@@ -220,6 +220,11 @@ void ElasticWaveEquationSEM::registerDataOnMesh( Group & meshBodies )
       subRegion.registerField< fields::MediumDensity >( getName() );
     } );
 
+    if( m_maxLocalTimeSteppingLevel > 0 )
+    {
+      registerLocalTimeSteppingData( mesh, 3 );
+    }
+
   } );
 }
 
@@ -325,8 +330,11 @@ void ElasticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & mesh,
     }
   }
 
-  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
-                                                                                        CellElementSubRegion & elementSubRegion )
+  mesh.getElemManager().forElementSubRegionsComplete< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                                localIndex const er,
+                                                                                                localIndex const esr,
+                                                                                                ElementRegionBase &,
+                                                                                                CellElementSubRegion & elementSubRegion )
   {
 
     GEOS_THROW_IF( elementSubRegion.getElementType() != ElementType::Hexahedron,
@@ -338,6 +346,8 @@ void ElasticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & mesh,
     arrayView2d< real64 const > const elemCenter = elementSubRegion.getElementCenter();
     arrayView1d< integer const > const elemGhostRank = elementSubRegion.ghostRank();
 
+    SortedArray< localIndex > const elementList = findSourceAndReceiverElements( mesh, er, esr );
+
     finiteElement::FiniteElementBase const &
     fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( getDiscretizationName() );
     finiteElement::FiniteElementDispatchHandler< SEM_FE_TYPES >::dispatch3D( fe, [&] ( auto const finiteElement )
@@ -349,7 +359,7 @@ void ElasticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & mesh,
       elasticWaveEquationSEMKernels::
         PrecomputeSourceAndReceiverKernel::
         launch< EXEC_POLICY, FE_TYPE >
-        ( elementSubRegion.size(),
+        ( elementList.toViewConst(),
         numFacesPerElem,
         X,
         elemGhostRank,
@@ -585,10 +595,59 @@ void ElasticWaveEquationSEM::initializePostInitialConditionsPreSubGroups()
                                                                dampingz );
       } );
     } );
+
+    if( m_maxLocalTimeSteppingLevel > 0 )
+    {
+      initializeLocalTimeStepping( mesh, regionNames, fields::MediumVelocityVp::key(), domain );
+    }
   } );
 
 }
 
+void ElasticWaveEquationSEM::computeLocalTimeSteppingStiffness( MeshLevel & mesh,
+                                                                arrayView1d< string const > const & regionNames,
+                                                                integer const level,
+                                                                arrayView3d< real32 const > const input,
+                                                                integer const inputLevel,
+                                                                arrayView2d< real32 > const stiffness )
+{
+  NodeManager & nodeManager = mesh.getNodeManager();
+  arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = nodeManager.getField< fields::referencePosition32 >().toViewConst();
+  arrayView1d< integer const > const nodeLevel = nodeManager.getField< fields::localTimeSteppingNodeLevel >().toViewConst();
+
+  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                                        CellElementSubRegion & elementSubRegion )
+  {
+    finiteElement::FiniteElementBase const &
+    fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( getDiscretizationName() );
+
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = elementSubRegion.nodeList();
+    arrayView1d< real32 const > const density = elementSubRegion.getField< fields::MediumDensity >();
+    arrayView1d< real32 const > const velocityVp = elementSubRegion.getField< fields::MediumVelocityVp >();
+    arrayView1d< real32 const > const velocityVs = elementSubRegion.getField< fields::MediumVelocityVs >();
+    ArrayOfArraysView< localIndex const > const elementLists =
+      elementSubRegion.getReference< ArrayOfArrays< localIndex > >( viewKeyStruct::localTimeSteppingElementsString() ).toViewConst();
+
+    finiteElement::FiniteElementDispatchHandler< SEM_FE_TYPES >::dispatch3D( fe, [&] ( auto const finiteElement )
+    {
+      using FE_TYPE = TYPEOFREF( finiteElement );
+
+      elasticWaveEquationSEMKernels::LocalTimeSteppingStiffnessKernel< FE_TYPE > kernel( finiteElement );
+      kernel.template launch< EXEC_POLICY, ATOMIC_POLICY >( elementLists,
+                                                            level,
+                                                            nodeCoords,
+                                                            elemsToNodes,
+                                                            nodeLevel,
+                                                            density,
+                                                            velocityVp,
+                                                            velocityVs,
+                                                            input,
+                                                            inputLevel,
+                                                            stiffness );
+    } );
+  } );
+}
+
 
 void ElasticWaveEquationSEM::applyFreeSurfaceBC( real64 const time, DomainPartition & domain )
 {
@@ -730,16 +789,21 @@ real64 ElasticWaveEquationSEM::explicitStepInternal( real64 const & time_n,
     arrayView1d< real32 > const rhsy = nodeManager.getField< fields::ForcingRHSy >();
     arrayView1d< real32 > const rhsz = nodeManager.getField< fields::ForcingRHSz >();
 
-    auto kernelFactory = elasticWaveEquationSEMKernels::ExplicitElasticSEMFactory( dt );
+    bool const useLocalTimeStepping = m_maxLocalTimeSteppingLevel > 0;
 
-    finiteElement::
-      regionBasedKernelApplication< EXEC_POLICY,
-                                    constitutive::NullModel,
-                                    CellElementSubRegion >( mesh,
-                                                            regionNames,
-                                                            getDiscretizationName(),
-                                                            "",
-                                                            kernelFactory );
+    if( !useLocalTimeStepping )
+    {
+      auto kernelFactory = elasticWaveEquationSEMKernels::ExplicitElasticSEMFactory( dt );
+
+      finiteElement::
+        regionBasedKernelApplication< EXEC_POLICY,
+                                      constitutive::NullModel,
+                                      CellElementSubRegion >( mesh,
+                                                              regionNames,
+                                                              getDiscretizationName(),
+                                                              "",
+                                                              kernelFactory );
+    }
 
 
     addSourceToRightHandSide( cycleNumber, rhsx, rhsy, rhsz );
@@ -747,27 +811,65 @@ real64 ElasticWaveEquationSEM::explicitStepInternal( real64 const & time_n,
 
 
     real64 const dt2 = dt*dt;
-    forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+    if( useLocalTimeStepping )
     {
-      if( freeSurfaceNodeIndicator[a] != 1 )
+      GEOS_MARK_SCOPE ( updateUWithLocalTimeStepping );
+      arrayView3d< real32 > const forcing = nodeManager.getField< fields::localTimeSteppingForcing >();
+      arrayView3d< real32 > const u_lts = nodeManager.getField< fields::localTimeSteppingSubstep1 >();
+      forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
       {
-        ux_np1[a] = ux_n[a];
-        ux_np1[a] *= 2.0*mass[a];
-        ux_np1[a] -= (mass[a]-0.5*dt*dampingx[a])*ux_nm1[a];
-        ux_np1[a] += dt2*(rhsx[a]-stiffnessVectorx[a]);
-        ux_np1[a] /= mass[a]+0.5*dt*dampingx[a];
-        uy_np1[a] = uy_n[a];
-        uy_np1[a] *= 2.0*mass[a];
-        uy_np1[a] -= (mass[a]-0.5*dt*dampingy[a])*uy_nm1[a];
-        uy_np1[a] += dt2*(rhsy[a]-stiffnessVectory[a]);
-        uy_np1[a] /= mass[a]+0.5*dt*dampingy[a];
-        uz_np1[a] = uz_n[a];
-        uz_np1[a] *= 2.0*mass[a];
-        uz_np1[a] -= (mass[a]-0.5*dt*dampingz[a])*uz_nm1[a];
-        uz_np1[a] += dt2*(rhsz[a]-stiffnessVectorz[a]);
-        uz_np1[a] /= mass[a]+0.5*dt*dampingz[a];
-      }
-    } );
+        u_lts[a][0][0] = ux_n[a];
+        u_lts[a][0][1] = uy_n[a];
+        u_lts[a][0][2] = uz_n[a];
+        forcing[a][0][0] = rhsx[a] / mass[a];
+        forcing[a][0][1] = rhsy[a] / mass[a];
+        forcing[a][0][2] = rhsz[a] / mass[a];
+      } );
+
+      localTimeSteppingStep( mesh, regionNames, domain, dt, mass, freeSurfaceNodeIndicator );
+
+      // same update as below, where u_n + dt2*(rhs-stiffnessVector)/(2*mass) is replaced by its multirate counterpart
+      arrayView3d< real32 const > const q = nodeManager.getField< fields::localTimeSteppingSubstep2 >().toViewConst();
+      forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+      {
+        if( freeSurfaceNodeIndicator[a] != 1 )
+        {
+          ux_np1[a] = 2.0*mass[a]*q[a][0][0];
+          ux_np1[a] -= (mass[a]-0.5*dt*dampingx[a])*ux_nm1[a];
+          ux_np1[a] /= mass[a]+0.5*dt*dampingx[a];
+          uy_np1[a] = 2.0*mass[a]*q[a][0][1];
+          uy_np1[a] -= (mass[a]-0.5*dt*dampingy[a])*uy_nm1[a];
+          uy_np1[a] /= mass[a]+0.5*dt*dampingy[a];
+          uz_np1[a] = 2.0*mass[a]*q[a][0][2];
+          uz_np1[a] -= (mass[a]-0.5*dt*dampingz[a])*uz_nm1[a];
+          uz_np1[a] /= mass[a]+0.5*dt*dampingz[a];
+        }
+      } );
+    }
+    else
+    {
+      forAll< EXEC_POLICY >( nodeManager.size(), [=] GEOS_HOST_DEVICE ( localIndex const a )
+      {
+        if( freeSurfaceNodeIndicator[a] != 1 )
+        {
+          ux_np1[a] = ux_n[a];
+          ux_np1[a] *= 2.0*mass[a];
+          ux_np1[a] -= (mass[a]-0.5*dt*dampingx[a])*ux_nm1[a];
+          ux_np1[a] += dt2*(rhsx[a]-stiffnessVectorx[a]);
+          ux_np1[a] /= mass[a]+0.5*dt*dampingx[a];
+          uy_np1[a] = uy_n[a];
+          uy_np1[a] *= 2.0*mass[a];
+          uy_np1[a] -= (mass[a]-0.5*dt*dampingy[a])*uy_nm1[a];
+          uy_np1[a] += dt2*(rhsy[a]-stiffnessVectory[a]);
+          uy_np1[a] /= mass[a]+0.5*dt*dampingy[a];
+          uz_np1[a] = uz_n[a];
+          uz_np1[a] *= 2.0*mass[a];
+          uz_np1[a] -= (mass[a]-0.5*dt*dampingz[a])*uz_nm1[a];
+          uz_np1[a] += dt2*(rhsz[a]-stiffnessVectorz[a]);
+          uz_np1[a] /= mass[a]+0.5*dt*dampingz[a];
+        }
+      } );
+    }
 
     /// synchronize pressure fields
     FieldIdentifiers fieldsToBeSync;
@@ -858,6 +960,18 @@ void ElasticWaveEquationSEM::cleanup( real64 const time_n,
   {
     m_indexSeismoTrace++;
   }
+
+  if( m_useDAS )
+  {
+    // the x-component holds the strain of each DAS channel (see computeDAS), the other ones the receiver pairs
+    writeSeismoTraces( viewKeyStruct::dasStrainAtReceiversString(), m_receiverIsLocal.toViewConst(), m_displacementXNp1AtReceivers.toViewConst() );
+  }
+  else
+  {
+    writeSeismoTraces( viewKeyStruct::displacementXNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_displacementXNp1AtReceivers.toViewConst() );
+    writeSeismoTraces( viewKeyStruct::displacementYNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_displacementYNp1AtReceivers.toViewConst() );
+    writeSeismoTraces( viewKeyStruct::displacementZNp1AtReceiversString(), m_receiverIsLocal.toViewConst(), m_displacementZNp1AtReceivers.toViewConst() );
+  }
 }
 
 void ElasticWaveEquationSEM::computeAllSeismoTraces( real64 const time_n,
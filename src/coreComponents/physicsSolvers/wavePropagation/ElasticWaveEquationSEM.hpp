@@ -136,6 +136,8 @@ public:
     static constexpr char const * displacementXNp1AtReceiversString() { return "displacementXNp1AtReceivers"; }
     static constexpr char const * displacementYNp1AtReceiversString() { return "displacementYNp1AtReceivers"; }
     static constexpr char const * displacementZNp1AtReceiversString() { return "displacementZNp1AtReceivers"; }
+    /// name of the DAS strain traces in the seismo trace file
+    static constexpr char const * dasStrainAtReceiversString() { return "dasStrainAtReceivers"; }
 
     static constexpr char const * sourceForceString() { return "sourceForce"; }
     static constexpr char const * sourceMomentString() { return "sourceMoment"; }
@@ -190,6 +192,15 @@ private:
    */
   virtual void applyPML( real64 const time, DomainPartition & domain ) override;
 
+  virtual bool supportsLocalTimeStepping() const override { return true; }
+
+  virtual void computeLocalTimeSteppingStiffness( MeshLevel & mesh,
+                                                  arrayView1d< string const > const & regionNames,
+                                                  integer const level,
+                                                  arrayView3d< real32 const > const input,
+                                                  integer const inputLevel,
+                                                  arrayView2d< real32 > const stiffness ) override;
+
   localIndex getNumNodesPerElem();
 
   /// Indices of the nodes (in the right order) for each source point
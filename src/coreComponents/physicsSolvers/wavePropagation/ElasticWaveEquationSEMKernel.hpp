@@ -37,7 +37,7 @@ struct PrecomputeSourceAndReceiverKernel
    * @brief Launches the precomputation of the source and receiver terms
    * @tparam EXEC_POLICY execution policy
    * @tparam FE_TYPE finite element type
-   * @param[in] size the number of cells in the subRegion
+   * @param[in] elementList the cells of the subRegion whose bounding box contains a source or a receiver
    * @param[in] numFacesPerElem number of face on an element
    * @param[in] nodeCoords coordinates of the nodes
    * @param[in] elemGhostRank array containing the ghost rank
@@ -63,7 +63,7 @@ struct PrecomputeSourceAndReceiverKernel
    */
   template< typename EXEC_POLICY, typename FE_TYPE >
   static void
-  launch( localIndex const size,
+  launch( SortedArrayView< localIndex const > const elementList,
           localIndex const numFacesPerElem,
           arrayView2d< WaveSolverBase::wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords,
           arrayView1d< integer const > const elemGhostRank,
@@ -91,8 +91,9 @@ struct PrecomputeSourceAndReceiverKernel
           R2SymTensor const sourceMoment )
   {
 
-    forAll< EXEC_POLICY >( size, [=] GEOS_HOST_DEVICE ( localIndex const k )
+    forAll< EXEC_POLICY >( elementList.size(), [=] GEOS_HOST_DEVICE ( localIndex const ie )
     {
+      localIndex const k = elementList[ie];
 
       constexpr localIndex numNodesPerElem = FE_TYPE::numNodes;
 
@@ -251,7 +252,7 @@ struct MassMatrixKernel
       constexpr localIndex numNodesPerElem = FE_TYPE::numNodes;
       constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
 
-      real64 xLocal[ numNodesPerElem ][ 3 ];
+      WaveSolverBase::wsGeometryType xLocal[ numNodesPerElem ][ 3 ];
       for( localIndex a = 0; a < numNodesPerElem; ++a )
       {
         for( localIndex i = 0; i < 3; ++i )
@@ -320,7 +321,7 @@ struct DampingMatrixKernel
         if( facesDomainBoundaryIndicator[f] == 1 && freeSurfaceFaceIndicator[f] != 1 )
         {
           constexpr localIndex numNodesPerFace = FE_TYPE::numNodesPerFace;
-          real64 xLocal[ numNodesPerFace ][ 3 ];
+          WaveSolverBase::wsGeometryType xLocal[ numNodesPerFace ][ 3 ];
           for( localIndex a = 0; a < numNodesPerFace; ++a )
           {
             for( localIndex d = 0; d < 3; ++d )
@@ -351,6 +352,100 @@ struct DampingMatrixKernel
 
 };
 
+template< typename FE_TYPE >
+struct LocalTimeSteppingStiffnessKernel
+{
+
+  LocalTimeSteppingStiffnessKernel( FE_TYPE const & finiteElement )
+    : m_finiteElement( finiteElement )
+  {}
+
+  /**
+   * @brief Launches the computation of the stiffness term of the displacement of the nodes of a local time stepping level,
+   *   the displacement of the other nodes being taken as zero
+   * @tparam EXEC_POLICY the execution policy
+   * @tparam ATOMIC_POLICY the atomic policy
+   * @param[in] elementLists the cells adjacent to the nodes of each level
+   * @param[in] level the local time stepping level
+   * @param[in] nodeCoords coordinates of the nodes
+   * @param[in] elemsToNodes map from element to nodes
+   * @param[in] nodeLevel local time stepping level of the nodes
+   * @param[in] density cell-wise density
+   * @param[in] velocityVp cell-wise P-wavespeed
+   * @param[in] velocityVs cell-wise S-wavespeed
+   * @param[in] displacement the nodal displacement, for each local time stepping level and each component
+   * @param[in] displacementLevel the level of @p displacement to use
+   * @param[out] stiffness the product of the stiffness matrix and the displacement of the nodes of the level
+   */
+  template< typename EXEC_POLICY, typename ATOMIC_POLICY >
+  void
+  launch( ArrayOfArraysView< localIndex const > const elementLists,
+          integer const level,
+          arrayView2d< WaveSolverBase::wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords,
+          arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes,
+          arrayView1d< integer const > const nodeLevel,
+          arrayView1d< real32 const > const density,
+          arrayView1d< real32 const > const velocityVp,
+          arrayView1d< real32 const > const velocityVs,
+          arrayView3d< real32 const > const displacement,
+          integer const displacementLevel,
+          arrayView2d< real32 > const stiffness )
+  {
+    forAll< EXEC_POLICY >( elementLists.sizeOfArray( level ), [=] GEOS_HOST_DEVICE ( localIndex const ie )
+    {
+      constexpr localIndex numNodesPerElem = FE_TYPE::numNodes;
+      constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
+
+      localIndex const e = elementLists( level, ie );
+
+      WaveSolverBase::wsGeometryType xLocal[ numNodesPerElem ][ 3 ];
+      real32 uLocal[ numNodesPerElem ][ 3 ];
+      for( localIndex a = 0; a < numNodesPerElem; ++a )
+      {
+        localIndex const nodeIndex = elemsToNodes( e, a );
+        bool const isActive = ( nodeLevel[nodeIndex] == level );
+        for( localIndex i = 0; i < 3; ++i )
+        {
+          xLocal[a][i] = nodeCoords( nodeIndex, i );
+          uLocal[a][i] = isActive ? displacement( nodeIndex, displacementLevel, i ) : 0.0;
+        }
+      }
+
+      real32 const mu = density[e] * velocityVs[e] * velocityVs[e];
+      real32 const lambda = density[e] * velocityVp[e] * velocityVp[e] - 2.0*mu;
+      for( localIndex q = 0; q < numQuadraturePointsPerElem; ++q )
+      {
+        m_finiteElement.computeFirstOrderStiffnessTerm( q, xLocal, [&] ( int i, int j, WaveSolverBase::wsGeometryType val,
+                                                                         WaveSolverBase::wsGeometryType J[3][3], int p, int r )
+        {
+          real32 const Rxx_ij = val*((lambda+2.0*mu)*J[p][0]*J[r][0]+mu*(J[p][1]*J[r][1]+J[p][2]*J[r][2]));
+          real32 const Ryy_ij = val*((lambda+2.0*mu)*J[p][1]*J[r][1]+mu*(J[p][0]*J[r][0]+J[p][2]*J[r][2]));
+          real32 const Rzz_ij = val*((lambda+2.0*mu)*J[p][2]*J[r][2]+mu*(J[p][0]*J[r][0]+J[p][1]*J[r][1]));
+          real32 const Rxy_ij = val*(lambda*J[p][0]*J[r][1]+mu*J[p][1]*J[r][0]);
+          real32 const Ryx_ij = val*(mu*J[p][0]*J[r][1]+lambda*J[p][1]*J[r][0]);
+          real32 const Rxz_ij = val*(lambda*J[p][0]*J[r][2]+mu*J[p][2]*J[r][0]);
+          real32 const Rzx_ij = val*(mu*J[p][0]*J[r][2]+lambda*J[p][2]*J[r][0]);
+          real32 const Ryz_ij = val*(lambda*J[p][1]*J[r][2]+mu*J[p][2]*J[r][1]);
+          real32 const Rzy_ij = val*(mu*J[p][1]*J[r][2]+lambda*J[p][2]*J[r][1]);
+
+          real32 const localIncrementx = Rxx_ij*uLocal[j][0] + Rxy_ij*uLocal[j][1] + Rxz_ij*uLocal[j][2];
+          real32 const localIncrementy = Ryx_ij*uLocal[j][0] + Ryy_ij*uLocal[j][1] + Ryz_ij*uLocal[j][2];
+          real32 const localIncrementz = Rzx_ij*uLocal[j][0] + Rzy_ij*uLocal[j][1] + Rzz_ij*uLocal[j][2];
+
+          localIndex const nodeIndex = elemsToNodes( e, i );
+          RAJA::atomicAdd< ATOMIC_POLICY >( &stiffness( nodeIndex, 0 ), localIncrementx );
+          RAJA::atomicAdd< ATOMIC_POLICY >( &stiffness( nodeIndex, 1 ), localIncrementy );
+          RAJA::atomicAdd< ATOMIC_POLICY >( &stiffness( nodeIndex, 2 ), localIncrementz );
+        } );
+      }
+    } );
+  }
+
+  /// The finite element space/discretization object for the element type in the subRegion
+  FE_TYPE const & m_finiteElement;
+
+};
+
 /**
  * @brief Implements kernels for solving the elastic wave equations
  *   explicit central FD method and SEM
@@ -452,7 +547,7 @@ public:
       xLocal()
     {}
     /// C-array stack storage for element local the nodal positions.
-    real64 xLocal[ numNodesPerElem ][ 3 ]{};
+    WaveSolverBase::wsGeometryType xLocal[ numNodesPerElem ][ 3 ]{};
     real32 mu=0;
     real32 lambda=0;
   };
@@ -496,7 +591,8 @@ public:
                               StackVariables & stack ) const
   {
 
-    m_finiteElementSpace.template computeFirstOrderStiffnessTerm( q, stack.xLocal, [&] ( int i, int j, real64 val, real64 J[3][3], int p, int r )
+    m_finiteElementSpace.template computeFirstOrderStiffnessTerm( q, stack.xLocal, [&] ( int i, int j, WaveSolverBase::wsGeometryType val,
+                                                                                         WaveSolverBase::wsGeometryType J[3][3], int p, int r )
     {
       real32 const Rxx_ij = val*((stack.lambda+2.0*stack.mu)*J[p][0]*J[r][0]+stack.mu*(J[p][1]*J[r][1]+J[p][2]*J[r][2]));
       real32 const Ryy_ij = val*((stack.lambda+2.0*stack.mu)*J[p][1]*J[r][1]+stack.mu*(J[p][0]*J[r][0]+J[p][2]*J[r][2]));
@@ -24,6 +24,9 @@
 
 #include "fieldSpecification/FieldSpecificationManager.hpp"
 #include "fieldSpecification/PerfectlyMatchedLayer.hpp"
+#include "fileIO/Outputs/OutputBase.hpp"
+#include "fileIO/timeHistory/HDFFile.hpp"
+#include "fileIO/timeHistory/HDFHistoryIO.hpp"
 #include "mainInterface/ProblemManager.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 
@@ -37,7 +40,8 @@ using namespace dataRepository;
 WaveSolverBase::WaveSolverBase( const std::string & name,
                                 Group * const parent ):
   SolverBase( name,
-              parent )
+              parent ),
+  m_numLocalTimeSteppingLevels( 1 )
 {
 
   registerWrapper( viewKeyStruct::sourceCoordinatesString(), &m_sourceCoordinates ).
@@ -73,7 +77,13 @@ WaveSolverBase::WaveSolverBase( const std::string & name,
   registerWrapper( viewKeyStruct::outputSeismoTraceString(), &m_outputSeismoTrace ).
     setInputFlag( InputFlags::OPTIONAL ).
     setApplyDefaultValue( 0 ).
-    setDescription( "Flag that indicates if we write the seismo trace in a file .txt, 0 no output, 1 otherwise" );
+    setDescription( "Flag that indicates if we write the seismo traces: 0 no output, 1 in a .txt file per receiver, "
+                    "2 in a single hdf5 file where each row of a dataset holds the trace of one receiver" );
+
+  registerWrapper( viewKeyStruct::seismoTraceCompressionLevelString(), &m_seismoTraceCompressionLevel ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Level of the deflate compression (1 to 9) applied to the seismo traces written in the hdf5 file, 0 to disable compression" );
 
   registerWrapper( viewKeyStruct::dtSeismoTraceString(), &m_dtSeismoTrace ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -121,6 +131,13 @@ WaveSolverBase::WaveSolverBase( const std::string & name,
     setDescription( "Set the capacity of the lifo host storage (if negative, opposite of percentage of remaining memory)" );
 
 
+  registerWrapper( viewKeyStruct::maxLocalTimeSteppingLevelString(), &m_maxLocalTimeSteppingLevel ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setApplyDefaultValue( 0 ).
+    setDescription( "Maximum level of the multirate local time stepping. The cells are binned by their stable time step, "
+                    "and the cells of level l are advanced with dt / 2^l: the time step of the solver event must then be "
+                    "stable for the coarsest cells. Set to 0 to advance all the cells with the time step of the solver event" );
+
   registerWrapper( viewKeyStruct::usePMLString(), &m_usePML ).
     setInputFlag( InputFlags::FALSE ).
     setApplyDefaultValue( 0 ).
@@ -220,6 +237,16 @@ void WaveSolverBase::initializePreSubGroups()
   m_receiverConstants.resize( numReceiversGlobal, numNodesPerElem );
   m_receiverIsLocal.resize( numReceiversGlobal );
 
+  if( m_outputSeismoTrace == 2 )
+  {
+    // truncate the file of a previous run up front, the datasets of the shots are then added or overwritten
+    if( MpiWrapper::commRank( MPI_COMM_GEOSX ) == 0 )
+    {
+      makeDirsForPath( OutputBase::getOutputDirectory() );
+    }
+    MpiWrapper::barrier( MPI_COMM_GEOSX );
+    HDFFile( getSeismoTraceFileName(), true, true, MPI_COMM_GEOSX );
+  }
 }
 
 void WaveSolverBase::postProcessInput()
@@ -240,6 +267,31 @@ void WaveSolverBase::postProcessInput()
 
   m_usePML = counter;
 
+  GEOS_THROW_IF( m_maxLocalTimeSteppingLevel < 0,
+                 getWrapperDataContext( viewKeyStruct::maxLocalTimeSteppingLevelString() ) <<
+                 ": The maximum local time stepping level must be non-negative",
+                 InputError );
+
+  GEOS_THROW_IF( m_maxLocalTimeSteppingLevel > 0 && !supportsLocalTimeStepping(),
+                 getWrapperDataContext( viewKeyStruct::maxLocalTimeSteppingLevelString() ) <<
+                 ": Local time stepping is not supported by this solver",
+                 InputError );
+
+  GEOS_THROW_IF( m_maxLocalTimeSteppingLevel > 0 && m_usePML,
+                 getWrapperDataContext( viewKeyStruct::maxLocalTimeSteppingLevelString() ) <<
+                 ": Local time stepping cannot be combined with a perfectly matched layer",
+                 InputError );
+
+  GEOS_THROW_IF( m_outputSeismoTrace < 0 || m_outputSeismoTrace > 2,
+                 getWrapperDataContext( viewKeyStruct::outputSeismoTraceString() ) <<
+                 ": The seismo trace output flag must be 0, 1 or 2",
+                 InputError );
+
+  GEOS_THROW_IF( m_seismoTraceCompressionLevel < 0 || m_seismoTraceCompressionLevel > 9,
+                 getWrapperDataContext( viewKeyStruct::seismoTraceCompressionLevelString() ) <<
+                 ": The compression level of the seismo traces must be between 0 and 9",
+                 InputError );
+
   if( m_linearDASGeometry.size( 1 ) > 0 )
   {
     m_useDAS = 1;
@@ -332,6 +384,65 @@ void WaveSolverBase::initializeDAS()
   }
 }
 
+string WaveSolverBase::getSeismoTraceFileName() const
+{
+  return joinPath( OutputBase::getOutputDirectory(), GEOS_FMT( "{}_seismoTraces", getName() ) );
+}
+
+void WaveSolverBase::writeSeismoTraces( string const & traceName,
+                                        arrayView1d< localIndex const > const receiverIsLocal,
+                                        arrayView2d< real32 const > const varAtReceivers ) const
+{
+  if( m_outputSeismoTrace != 2 )
+  {
+    return;
+  }
+
+  GEOS_MARK_FUNCTION;
+
+  receiverIsLocal.move( hostMemorySpace, false );
+  varAtReceivers.move( hostMemorySpace, false );
+
+  localIndex const numSamples = varAtReceivers.size( 0 );
+  std::vector< localIndex > localReceivers;
+  for( localIndex ircv = 0; ircv < varAtReceivers.size( 1 ); ++ircv )
+  {
+    if( receiverIsLocal[ircv] == 1 )
+    {
+      localReceivers.emplace_back( ircv );
+    }
+  }
+  localIndex const numLocalReceivers = LvArray::integerConversion< localIndex >( localReceivers.size() );
+
+  string const fileName = getSeismoTraceFileName();
+  string const datasetName = GEOS_FMT( "{}_shot{:06}", traceName, m_shotIndex );
+
+  // the traces are already buffered for all the time samples, so they are written in a single collective write,
+  // with the receivers as rows and the time samples contiguous in each row
+  HDFHistoryIO traceIO( fileName, 2, { numLocalReceivers, numSamples }, datasetName,
+                        std::type_index( typeid( real32 ) ), 0, 1, 2, MPI_COMM_GEOSX, m_seismoTraceCompressionLevel );
+  traceIO.init( true );
+  real32 * const traceBuffer = reinterpret_cast< real32 * >( traceIO.getBufferHead() );
+  for( localIndex i = 0; i < numLocalReceivers; ++i )
+  {
+    for( localIndex iSample = 0; iSample < numSamples; ++iSample )
+    {
+      traceBuffer[i * numSamples + iSample] = varAtReceivers[iSample][localReceivers[i]];
+    }
+  }
+  traceIO.write();
+  traceIO.compressInFile();
+
+  // the rows are ordered by rank, so the index of the receiver of each row is written alongside the traces
+  HDFHistoryIO receiverIO( fileName, 1, { numLocalReceivers }, datasetName + "_receiverIndex",
+                           std::type_index( typeid( localIndex ) ), 0, 1, 2, MPI_COMM_GEOSX, m_seismoTraceCompressionLevel );
+  receiverIO.init( true );
+  localIndex * const receiverBuffer = reinterpret_cast< localIndex * >( receiverIO.getBufferHead() );
+  std::copy( localReceivers.begin(), localReceivers.end(), receiverBuffer );
+  receiverIO.write();
+  receiverIO.compressInFile();
+}
+
 real64 WaveSolverBase::solverStep( real64 const & time_n,
                                    real64 const & dt,
                                    integer const cycleNumber,
@@ -399,6 +510,425 @@ localIndex WaveSolverBase::getNumNodesPerElem()
 
 }
 
+SortedArray< localIndex > WaveSolverBase::findSourceAndReceiverElements( MeshLevel const & mesh,
+                                                                        localIndex const er,
+                                                                        localIndex const esr ) const
+{
+  ElementSpatialIndex const & spatialIndex = mesh.getElementSpatialIndex();
+
+  SortedArray< localIndex > elements;
+  spatialIndex.findElementsContainingPoints( er, esr, m_sourceCoordinates.toViewConst(), elements );
+  spatialIndex.findElementsContainingPoints( er, esr, m_receiverCoordinates.toViewConst(), elements );
+  return elements;
+}
+
+namespace
+{
+
+/**
+ * @brief Estimate the stable time step of a hexahedral cell, up to a constant factor,
+ * as the ratio between its smallest edge and its wave speed.
+ * @param k the index of the cell
+ * @param elemsToNodes map from cells to support points, ordered lexicographically
+ * @param nodeCoords coordinates of the nodes
+ * @param waveSpeed the wave speed of the cell
+ * @return the characteristic time of the cell
+ */
+real64 characteristicTime( localIndex const k,
+                           arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes,
+                           arrayView2d< WaveSolverBase::wsCoordType const, nodes::REFERENCE_POSITION_USD > const & nodeCoords,
+                           real32 const waveSpeed )
+{
+  // the corners are the first and last support points in each direction
+  localIndex const numNodes1d = LvArray::integerConversion< localIndex >( std::lround( std::cbrt( elemsToNodes.size( 1 ) ) ) );
+  localIndex const stride[3] = { 1, numNodes1d, numNodes1d * numNodes1d };
+  localIndex const last = numNodes1d - 1;
+
+  real64 minEdgeLength = LvArray::NumericLimits< real64 >::max;
+  for( integer c = 0; c < 8; ++c )
+  {
+    integer const ijk[3] = { c % 2, ( c / 2 ) % 2, c / 4 };
+    localIndex const corner = last * ( ijk[0] * stride[0] + ijk[1] * stride[1] + ijk[2] * stride[2] );
+    for( integer d = 0; d < 3; ++d )
+    {
+      // each edge is visited once, from its corner of lowest index
+      if( ijk[d] == 0 )
+      {
+        localIndex const a = elemsToNodes( k, corner );
+        localIndex const b = elemsToNodes( k, corner + last * stride[d] );
+        real64 edgeLength2 = 0.0;
+        for( integer i = 0; i < 3; ++i )
+        {
+          real64 const dx = nodeCoords( b, i ) - nodeCoords( a, i );
+          edgeLength2 += dx * dx;
+        }
+        minEdgeLength = LvArray::math::min( minEdgeLength, LvArray::math::sqrt( edgeLength2 ) );
+      }
+    }
+  }
+  return minEdgeLength / waveSpeed;
+}
+
+}
+
+void WaveSolverBase::registerLocalTimeSteppingData( MeshLevel & mesh, integer const numComponents )
+{
+  integer const numLevels = m_maxLocalTimeSteppingLevel + 1;
+
+  NodeManager & nodeManager = mesh.getNodeManager();
+  nodeManager.registerField< fields::localTimeSteppingNodeLevel,
+                             fields::localTimeSteppingNodeNeighborLevel,
+                             fields::localTimeSteppingForcing,
+                             fields::localTimeSteppingSubstep1,
+                             fields::localTimeSteppingSubstep2,
+                             fields::localTimeSteppingStiffness,
+                             fields::localTimeSteppingExchange >( getName() );
+
+  nodeManager.getField< fields::localTimeSteppingForcing >().resizeDimension< 1, 2 >( numLevels, numComponents );
+  nodeManager.getField< fields::localTimeSteppingSubstep1 >().resizeDimension< 1, 2 >( numLevels, numComponents );
+  nodeManager.getField< fields::localTimeSteppingSubstep2 >().resizeDimension< 1, 2 >( numLevels, numComponents );
+  nodeManager.getField< fields::localTimeSteppingStiffness >().resizeDimension< 1 >( numComponents );
+  nodeManager.getField< fields::localTimeSteppingExchange >().resizeDimension< 1 >( numComponents );
+  nodeManager.registerWrapper< ArrayOfArrays< localIndex > >( viewKeyStruct::localTimeSteppingNodesString() ).
+    setSizedFromParent( 0 ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Nodes updated at each local time stepping level" );
+
+  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+  {
+    subRegion.registerField< fields::localTimeSteppingLevel >( getName() );
+    subRegion.registerWrapper< ArrayOfArrays< localIndex > >( viewKeyStruct::localTimeSteppingElementsString() ).
+      setSizedFromParent( 0 ).
+      setRestartFlags( RestartFlags::NO_WRITE ).
+      setDescription( "Cells adjacent to the nodes of each local time stepping level" );
+  } );
+}
+
+void WaveSolverBase::initializeLocalTimeStepping( MeshLevel & mesh,
+                                                  arrayView1d< string const > const & regionNames,
+                                                  string const & waveSpeedKey,
+                                                  DomainPartition & domain )
+{
+  GEOS_MARK_FUNCTION;
+
+  NodeManager & nodeManager = mesh.getNodeManager();
+  ElementRegionManager & elemManager = mesh.getElemManager();
+
+  arrayView2d< wsCoordType const, nodes::REFERENCE_POSITION_USD > const nodeCoords = nodeManager.getField< fields::referencePosition32 >().toViewConst();
+
+  // the coarsest cells, with the largest stable time step, are at level 0
+  RAJA::ReduceMax< serialReduce, real64 > localMaxCharacteristicTime( 0.0 );
+  elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                              CellElementSubRegion const & subRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = subRegion.nodeList();
+    arrayView1d< real32 const > const waveSpeed = subRegion.getReference< array1d< real32 > >( waveSpeedKey );
+    forAll< serialPolicy >( subRegion.size(), [=] ( localIndex const k )
+    {
+      localMaxCharacteristicTime.max( characteristicTime( k, elemsToNodes, nodeCoords, waveSpeed[k] ) );
+    } );
+  } );
+  real64 const maxCharacteristicTime = MpiWrapper::max( localMaxCharacteristicTime.get() );
+
+  // the level of a node is the finest level of its adjacent cells
+  arrayView1d< integer > const nodeLevel = nodeManager.getField< fields::localTimeSteppingNodeLevel >();
+  nodeLevel.setValues< serialPolicy >( 0 );
+  integer const maxLevel = m_maxLocalTimeSteppingLevel;
+  RAJA::ReduceSum< serialReduce, globalIndex > localNumClampedCells( 0 );
+  elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                              CellElementSubRegion & subRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = subRegion.nodeList();
+    arrayView1d< real32 const > const waveSpeed = subRegion.getReference< array1d< real32 > >( waveSpeedKey );
+    arrayView1d< integer const > const elemGhostRank = subRegion.ghostRank();
+    arrayView1d< integer > const elemLevel = subRegion.getField< fields::localTimeSteppingLevel >();
+    forAll< serialPolicy >( subRegion.size(), [=] ( localIndex const k )
+    {
+      // the tolerance avoids splitting cells of the same size because of round-off errors
+      real64 const ratio = maxCharacteristicTime / characteristicTime( k, elemsToNodes, nodeCoords, waveSpeed[k] );
+      integer const level = static_cast< integer >( std::ceil( std::log2( ratio ) - 1e-6 ) );
+      if( level > maxLevel && elemGhostRank[k] < 0 )
+      {
+        localNumClampedCells += 1;
+      }
+      elemLevel[k] = LvArray::math::min( maxLevel, level );
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        localIndex const node = elemsToNodes( k, a );
+        nodeLevel[node] = LvArray::math::max( nodeLevel[node], elemLevel[k] );
+      }
+    } );
+  } );
+
+  // the cells finer than the finest level are advanced with a time step larger than their own stable time step
+  globalIndex const numClampedCells = MpiWrapper::sum( localNumClampedCells.get() );
+  GEOS_WARNING_IF( numClampedCells > 0 && MpiWrapper::commRank() == 0,
+                   GEOS_FMT( "{}: {} cell(s) would need a local time stepping level above {} = {}. "
+                             "They are advanced with dt / {}, which must be stable for them",
+                             getDataContext(), numClampedCells,
+                             viewKeyStruct::maxLocalTimeSteppingLevelString(), maxLevel, 1 << maxLevel ) );
+
+  // the ghost nodes take the level of their owner, whose finest adjacent cell may be on another rank
+  FieldIdentifiers fieldsToBeSync;
+  fieldsToBeSync.addFields( FieldLocation::Node, { fields::localTimeSteppingNodeLevel::key() } );
+  CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync,
+                                                       mesh,
+                                                       domain.getNeighbors(),
+                                                       false );
+
+  RAJA::ReduceMax< serialReduce, integer > localMaxNodeLevel( 0 );
+  forAll< serialPolicy >( nodeManager.size(), [=] ( localIndex const a )
+  {
+    localMaxNodeLevel.max( nodeLevel[a] );
+  } );
+  m_numLocalTimeSteppingLevels = MpiWrapper::max( localMaxNodeLevel.get() ) + 1;
+  integer const numLevels = m_numLocalTimeSteppingLevels;
+
+  // the stiffness term of a level reaches the nodes of this level and the nodes sharing a cell with them
+  arrayView1d< integer > const nodeNeighborLevel = nodeManager.getField< fields::localTimeSteppingNodeNeighborLevel >();
+  nodeNeighborLevel.setValues< serialPolicy >( 0 );
+  elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                              CellElementSubRegion const & subRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = subRegion.nodeList();
+    forAll< serialPolicy >( subRegion.size(), [=] ( localIndex const k )
+    {
+      integer cellNodeLevel = 0;
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        cellNodeLevel = LvArray::math::max( cellNodeLevel, nodeLevel[elemsToNodes( k, a )] );
+      }
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        localIndex const node = elemsToNodes( k, a );
+        nodeNeighborLevel[node] = LvArray::math::max( nodeNeighborLevel[node], cellNodeLevel );
+      }
+    } );
+  } );
+  FieldIdentifiers neighborLevelFields;
+  neighborLevelFields.addFields( FieldLocation::Node, { fields::localTimeSteppingNodeNeighborLevel::key() } );
+  CommunicationTools::getInstance().synchronizeFields( neighborLevelFields,
+                                                       mesh,
+                                                       domain.getNeighbors(),
+                                                       false );
+
+  // the nodes updated at a given level are the nodes reached by the stiffness term of this level or of a finer one,
+  // the finer substeps of the other nodes reducing to a constant acceleration
+  arrayView1d< integer const > const nodeGhostRank = nodeManager.ghostRank();
+  nodeGhostRank.move( hostMemorySpace, false );
+  nodeNeighborLevel.move( hostMemorySpace, false );
+  array1d< globalIndex > numNodeUpdates( numLevels );
+  std::vector< std::vector< localIndex > > nodesOfLevel( numLevels );
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    for( integer level = 0; level <= nodeNeighborLevel[a]; ++level )
+    {
+      nodesOfLevel[level].emplace_back( a );
+      numNodeUpdates[level] += ( nodeGhostRank[a] < 0 ) ? 1 : 0;
+    }
+  }
+  ArrayOfArrays< localIndex > & nodes = nodeManager.getReference< ArrayOfArrays< localIndex > >( viewKeyStruct::localTimeSteppingNodesString() );
+  nodes.resize( 0 );
+  for( integer level = 0; level < numLevels; ++level )
+  {
+    nodes.appendArray( nodesOfLevel[level].begin(), nodesOfLevel[level].end() );
+  }
+
+  // the cells updated at a given level are the cells adjacent to at least one node of this level
+  globalIndex numCells = 0;
+  array1d< globalIndex > numCellUpdates( numLevels );
+  elemManager.forElementSubRegions< CellElementSubRegion >( regionNames, [&]( localIndex const,
+                                                                              CellElementSubRegion & subRegion )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = subRegion.nodeList();
+    arrayView1d< integer const > const elemGhostRank = subRegion.ghostRank();
+    elemsToNodes.move( hostMemorySpace, false );
+    elemGhostRank.move( hostMemorySpace, false );
+
+    std::vector< std::vector< localIndex > > elementsOfLevel( numLevels );
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      for( integer level = 0; level < numLevels; ++level )
+      {
+        bool isAdjacent = false;
+        for( localIndex a = 0; a < elemsToNodes.size( 1 ) && !isAdjacent; ++a )
+        {
+          isAdjacent = ( nodeLevel[elemsToNodes( k, a )] == level );
+        }
+        if( isAdjacent )
+        {
+          elementsOfLevel[level].emplace_back( k );
+          numCellUpdates[level] += ( elemGhostRank[k] < 0 ) ? 1 : 0;
+        }
+      }
+      numCells += ( elemGhostRank[k] < 0 ) ? 1 : 0;
+    }
+
+    ArrayOfArrays< localIndex > & elements =
+      subRegion.getReference< ArrayOfArrays< localIndex > >( viewKeyStruct::localTimeSteppingElementsString() );
+    elements.resize( 0 );
+    for( integer level = 0; level < numLevels; ++level )
+    {
+      elements.appendArray( elementsOfLevel[level].begin(), elementsOfLevel[level].end() );
+    }
+  } );
+
+  // estimated speedup compared to advancing all the cells with the time step of the finest level
+  real64 const globalCost = static_cast< real64 >( MpiWrapper::sum( numCells ) ) * ( 1 << ( numLevels - 1 ) );
+  real64 localTimeSteppingCost = 0.0;
+  for( integer level = 0; level < numLevels; ++level )
+  {
+    globalIndex const numUpdates = MpiWrapper::sum( numCellUpdates[level] );
+    localTimeSteppingCost += static_cast< real64 >( numUpdates ) * ( 1 << level );
+    GEOS_LOG_LEVEL_RANK_0( 1, GEOS_FMT( "{}: local time stepping level {} (dt / {}) updates {} cells and {} nodes",
+                                        getDataContext(), level, 1 << level, numUpdates, MpiWrapper::sum( numNodeUpdates[level] ) ) );
+  }
+  GEOS_LOG_RANK_0( GEOS_FMT( "{}: local time stepping with {} level(s), estimated speedup of {:.2f} "
+                             "compared to a global time step of dt / {}",
+                             getDataContext(), numLevels,
+                             localTimeSteppingCost > 0.0 ? globalCost / localTimeSteppingCost : 1.0,
+                             1 << ( numLevels - 1 ) ) );
+}
+
+void WaveSolverBase::localTimeSteppingStep( MeshLevel & mesh,
+                                            arrayView1d< string const > const & regionNames,
+                                            DomainPartition & domain,
+                                            real64 const dt,
+                                            arrayView1d< real32 const > const mass,
+                                            arrayView1d< localIndex const > const freeSurfaceNodeIndicator )
+{
+  GEOS_MARK_FUNCTION;
+
+  arrayView3d< real32 const > const u_n = mesh.getNodeManager().getField< fields::localTimeSteppingSubstep1 >().toViewConst();
+  advanceLocalTimeSteppingLevel( mesh, regionNames, domain, 0, dt, u_n, 0,
+                                 fields::localTimeSteppingSubstep2::key(), mass, freeSurfaceNodeIndicator );
+}
+
+void WaveSolverBase::advanceLocalTimeSteppingLevel( MeshLevel & mesh,
+                                                    arrayView1d< string const > const & regionNames,
+                                                    DomainPartition & domain,
+                                                    integer const level,
+                                                    real64 const tau,
+                                                    arrayView3d< real32 const > const input,
+                                                    integer const inputLevel,
+                                                    string const & outputKey,
+                                                    arrayView1d< real32 const > const mass,
+                                                    arrayView1d< localIndex const > const freeSurfaceNodeIndicator )
+{
+  NodeManager & nodeManager = mesh.getNodeManager();
+
+  arrayView3d< real32 > const forcing = nodeManager.getField< fields::localTimeSteppingForcing >();
+  arrayView2d< real32 > const stiffness = nodeManager.getField< fields::localTimeSteppingStiffness >();
+  arrayView3d< real32 > const output = nodeManager.getReference< array3d< real32 > >( outputKey );
+  arrayView1d< integer const > const nodeNeighborLevel = nodeManager.getField< fields::localTimeSteppingNodeNeighborLevel >().toViewConst();
+  integer const numComponents = LvArray::integerConversion< integer >( forcing.size( 2 ) );
+
+  // only the nodes reached by the stiffness term of this level or of a finer one are updated
+  ArrayOfArraysView< localIndex const > const nodeLists =
+    nodeManager.getReference< ArrayOfArrays< localIndex > >( viewKeyStruct::localTimeSteppingNodesString() ).toViewConst();
+  localIndex const numNodes = nodeLists.sizeOfArray( level );
+
+  // stiffness term of the nodes of this level, frozen while the finer levels are advanced
+  forAll< EXEC_POLICY >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    localIndex const a = nodeLists( level, i );
+    for( integer ic = 0; ic < numComponents; ++ic )
+    {
+      stiffness[a][ic] = 0.0;
+    }
+  } );
+  computeLocalTimeSteppingStiffness( mesh, regionNames, level, input, inputLevel, stiffness );
+
+  // the nodes that no finer stiffness term reaches have a constant acceleration over the finer substeps,
+  // for which the recursive leapfrog reduces to a single step from a symmetric start, i.e. u(-tau) = u(tau)
+  // (at the finest level, this is the case of all the updated nodes)
+  real64 const halfTau2 = 0.5 * tau * tau;
+  forAll< EXEC_POLICY >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    localIndex const a = nodeLists( level, i );
+    for( integer ic = 0; ic < numComponents; ++ic )
+    {
+      real32 const acceleration = forcing[a][level][ic] - stiffness[a][ic] / mass[a];
+      if( nodeNeighborLevel[a] > level )
+      {
+        forcing[a][level+1][ic] = acceleration;
+      }
+      else
+      {
+        output[a][level][ic] = input[a][inputLevel][ic];
+        if( freeSurfaceNodeIndicator[a] != 1 )
+        {
+          output[a][level][ic] += halfTau2 * acceleration;
+        }
+      }
+    }
+  } );
+
+  if( level < m_numLocalTimeSteppingLevels - 1 )
+  {
+    // advance the finer levels with two half steps
+    advanceLocalTimeSteppingLevel( mesh, regionNames, domain, level + 1, 0.5 * tau, input, inputLevel,
+                                   fields::localTimeSteppingSubstep1::key(), mass, freeSurfaceNodeIndicator );
+
+    arrayView3d< real32 const > const substep1 = nodeManager.getField< fields::localTimeSteppingSubstep1 >().toViewConst();
+    advanceLocalTimeSteppingLevel( mesh, regionNames, domain, level + 1, 0.5 * tau, substep1, level + 1,
+                                   fields::localTimeSteppingSubstep2::key(), mass, freeSurfaceNodeIndicator );
+
+    arrayView3d< real32 const > const substep2 = nodeManager.getField< fields::localTimeSteppingSubstep2 >().toViewConst();
+    localIndex const numFinerNodes = nodeLists.sizeOfArray( level + 1 );
+    forAll< EXEC_POLICY >( numFinerNodes, [=] GEOS_HOST_DEVICE ( localIndex const i )
+    {
+      localIndex const a = nodeLists( level + 1, i );
+      for( integer ic = 0; ic < numComponents; ++ic )
+      {
+        output[a][level][ic] = 2.0 * substep2[a][level+1][ic] - input[a][inputLevel][ic];
+      }
+    } );
+  }
+
+  // the stiffness term is incomplete on the ghost nodes: only the level just computed is exchanged,
+  // through a scratch field holding one level, instead of all the levels of the output field
+  arrayView2d< real32 > const exchange = nodeManager.getField< fields::localTimeSteppingExchange >();
+  forAll< EXEC_POLICY >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    localIndex const a = nodeLists( level, i );
+    for( integer ic = 0; ic < numComponents; ++ic )
+    {
+      exchange[a][ic] = output[a][level][ic];
+    }
+  } );
+
+  FieldIdentifiers fieldsToBeSync;
+  fieldsToBeSync.addFields( FieldLocation::Node, { fields::localTimeSteppingExchange::key() } );
+  CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync,
+                                                       mesh,
+                                                       domain.getNeighbors(),
+                                                       true );
+
+  arrayView1d< integer const > const nodeGhostRank = nodeManager.ghostRank();
+  forAll< EXEC_POLICY >( numNodes, [=] GEOS_HOST_DEVICE ( localIndex const i )
+  {
+    localIndex const a = nodeLists( level, i );
+    if( nodeGhostRank[a] >= 0 )
+    {
+      for( integer ic = 0; ic < numComponents; ++ic )
+      {
+        output[a][level][ic] = exchange[a][ic];
+      }
+    }
+  } );
+}
+
+void WaveSolverBase::computeLocalTimeSteppingStiffness( MeshLevel & GEOS_UNUSED_PARAM( mesh ),
+                                                        arrayView1d< string const > const & GEOS_UNUSED_PARAM( regionNames ),
+                                                        integer const GEOS_UNUSED_PARAM( level ),
+                                                        arrayView3d< real32 const > const GEOS_UNUSED_PARAM( input ),
+                                                        integer const GEOS_UNUSED_PARAM( inputLevel ),
+                                                        arrayView2d< real32 > const GEOS_UNUSED_PARAM( stiffness ) )
+{
+  GEOS_ERROR( getDataContext() << ": Local time stepping is not supported by this solver" );
+}
+
 bool WaveSolverBase::directoryExists( std::string const & directoryName )
 {
   struct stat buffer;
@@ -51,6 +51,13 @@ public:
 
   using EXEC_POLICY = parallelDevicePolicy< >;
   using wsCoordType = real32;
+  /// Floating point type of the local coordinates used to evaluate the Jacobian, mass, damping and stiffness terms
+  /// (real64 unless the build disables ENABLE_WAVE_SOLVER_DOUBLE_PRECISION_GEOMETRY)
+#if defined( GEOSX_USE_WAVE_SOLVER_DOUBLE_PRECISION_GEOMETRY )
+  using wsGeometryType = real64;
+#else
+  using wsGeometryType = real32;
+#endif
 
   WaveSolverBase( const std::string & name,
                   Group * const parent );
@@ -97,6 +104,7 @@ public:
     static constexpr char const * receiverIsLocalString() { return "receiverIsLocal"; }
 
     static constexpr char const * outputSeismoTraceString() { return "outputSeismoTrace"; }
+    static constexpr char const * seismoTraceCompressionLevelString() { return "seismoTraceCompressionLevel"; }
     static constexpr char const * dtSeismoTraceString() { return "dtSeismoTrace"; }
     static constexpr char const * indexSeismoTraceString() { return "indexSeismoTrace"; }
     static constexpr char const * forwardString() { return "forward"; }
@@ -114,6 +122,10 @@ public:
     static constexpr char const * parametersPMLString() { return "parametersPML"; }
 
     static constexpr char const * freeSurfaceString() { return "FreeSurface"; }
+
+    static constexpr char const * maxLocalTimeSteppingLevelString() { return "maxLocalTimeSteppingLevel"; }
+    static constexpr char const * localTimeSteppingElementsString() { return "localTimeSteppingElements"; }
+    static constexpr char const * localTimeSteppingNodesString() { return "localTimeSteppingNodes"; }
   };
 
   /**
@@ -144,6 +156,25 @@ protected:
    */
   virtual void applyFreeSurfaceBC( real64 const time, DomainPartition & domain ) = 0;
 
+  /**
+   * @brief Get the name of the hdf5 file holding the seismo traces of the solver
+   * @return the path of the file in the output directory, without the extension
+   */
+  string getSeismoTraceFileName() const;
+
+  /**
+   * @brief Write the seismo traces of all the receivers in the hdf5 output file of the solver, if requested.
+   * The local receivers of every rank are aggregated in a single collective write, in a dataset where each row
+   * holds all the time samples of one receiver, along with a dataset holding the index of the receiver of each row.
+   * @param traceName the name of the recorded variable, used to name the datasets
+   * @param receiverIsLocal flag indicating if a receiver is owned by this rank
+   * @param varAtReceivers the array holding the trace values (time samples x receivers)
+   * @note This is collective over MPI_COMM_GEOSX
+   */
+  void writeSeismoTraces( string const & traceName,
+                          arrayView1d< localIndex const > const receiverIsLocal,
+                          arrayView2d< real32 const > const varAtReceivers ) const;
+
   /**
    * @brief Initialize DAS fiber geometry. This will duplicate the number of point receivers to be modeled
    */
@@ -170,6 +201,18 @@ protected:
    */
   virtual void precomputeSourceAndReceiverTerm( MeshLevel & mesh, arrayView1d< string const > const & regionNames ) = 0;
 
+  /**
+   * @brief Find the elements of a subregion whose bounding box contains a source or a receiver,
+   * using the spatial index of the mesh level.
+   * @param mesh mesh of the computational domain
+   * @param er index of the region
+   * @param esr index of the subregion
+   * @return the candidate elements to be checked by the source and receiver location kernels
+   */
+  SortedArray< localIndex > findSourceAndReceiverElements( MeshLevel const & mesh,
+                                                           localIndex const er,
+                                                           localIndex const esr ) const;
+
   /**
    * @brief Perform forward explicit step
    * @param time_n time at the beginning of the step
@@ -205,6 +248,82 @@ protected:
 
   localIndex getNumNodesPerElem();
 
+  /**
+   * @name Multirate local time stepping
+   *
+   * With local time stepping, the elements are binned into levels according to their stable time step,
+   * estimated by the ratio between their smallest edge and their wave speed: the coarsest elements are
+   * at level 0 and advance with the time step of the solver event, and the elements of level l advance
+   * with dt / 2^l. The nodes are advanced with the time step of their finest adjacent element.
+   * The scheme is the multi-level local time stepping leapfrog of Diaz and Grote: the stiffness terms of the
+   * coarser levels are frozen while the finer levels are advanced recursively with two half steps, which keeps
+   * the scheme explicit, second-order accurate and time-reversible.
+   */
+  ///@{
+
+  /**
+   * @brief @return true if the solver implements the local time stepping hooks
+   */
+  virtual bool supportsLocalTimeStepping() const { return false; }
+
+  /**
+   * @brief Register the fields used by the local time stepping
+   * @param mesh the mesh level
+   * @param numComponents the number of components of the nodal unknowns
+   */
+  void registerLocalTimeSteppingData( MeshLevel & mesh, integer const numComponents );
+
+  /**
+   * @brief Compute the level of the elements and of the nodes, and the elements and nodes updated at each level
+   * @param mesh the mesh level
+   * @param regionNames the names of the target regions
+   * @param waveSpeedKey the key of the cell-wise (fastest) wave speed field
+   * @param domain the domain partition, used to synchronize the node levels
+   */
+  void initializeLocalTimeStepping( MeshLevel & mesh,
+                                    arrayView1d< string const > const & regionNames,
+                                    string const & waveSpeedKey,
+                                    DomainPartition & domain );
+
+  /**
+   * @brief Advance the nodal unknowns over one step of the solver with local time stepping.
+   *
+   * On input, the level 0 of the localTimeSteppingSubstep1 field holds the unknowns at time_n, and the level 0 of
+   * the localTimeSteppingForcing field holds the right-hand side divided by the mass. On output, the level 0 of the
+   * localTimeSteppingSubstep2 field holds q, such that u_np1 + u_nm1 = 2 q without damping.
+   * @param mesh the mesh level
+   * @param regionNames the names of the target regions
+   * @param domain the domain partition
+   * @param dt the time step of the solver
+   * @param mass the diagonal of the mass matrix
+   * @param freeSurfaceNodeIndicator flag equal to 1 for the nodes on the free surface, which are not updated
+   */
+  void localTimeSteppingStep( MeshLevel & mesh,
+                              arrayView1d< string const > const & regionNames,
+                              DomainPartition & domain,
+                              real64 const dt,
+                              arrayView1d< real32 const > const mass,
+                              arrayView1d< localIndex const > const freeSurfaceNodeIndicator );
+
+  /**
+   * @brief Compute the product of the stiffness matrix and the unknowns of the nodes of a given level
+   * (the unknowns of the other nodes being taken as zero), looping only over the elements adjacent to these nodes.
+   * @param mesh the mesh level
+   * @param regionNames the names of the target regions
+   * @param level the level of the nodes
+   * @param input the unknowns, as stored in the local time stepping fields
+   * @param inputLevel the level of @p input holding the unknowns
+   * @param stiffness the product of the stiffness matrix and the unknowns, to be incremented
+   */
+  virtual void computeLocalTimeSteppingStiffness( MeshLevel & mesh,
+                                                  arrayView1d< string const > const & regionNames,
+                                                  integer const level,
+                                                  arrayView3d< real32 const > const input,
+                                                  integer const inputLevel,
+                                                  arrayView2d< real32 > const stiffness );
+
+  ///@}
+
   /// Coordinates of the sources in the mesh
   array2d< real64 > m_sourceCoordinates;
 
@@ -223,9 +342,12 @@ protected:
   /// Flag that indicates the order of the Ricker to be used, order 2 by default
   localIndex m_rickerOrder;
 
-  /// Flag that indicates if we write the seismo trace in a file .txt, 0 no output, 1 otherwise
+  /// Flag that indicates if we write the seismo trace: 0 no output, 1 in .txt files, 2 in a single hdf5 file
   localIndex m_outputSeismoTrace;
 
+  /// Deflate compression level (0 if not compressed) of the seismo traces written in the hdf5 file
+  integer m_seismoTraceCompressionLevel;
+
   /// Time step for seismoTrace output
   real64 m_dtSeismoTrace;
 
@@ -286,6 +408,12 @@ protected:
   /// LIFO to store p_dt2
   std::unique_ptr< LifoStorage< real32, localIndex > > m_lifo;
 
+  /// Maximum level of the local time stepping (0 for a single global time step)
+  integer m_maxLocalTimeSteppingLevel;
+
+  /// Number of local time stepping levels actually used on the mesh
+  integer m_numLocalTimeSteppingLevels;
+
   struct parametersPML
   {
     /// Mininum (x,y,z) coordinates of inner PML boundaries
@@ -306,6 +434,34 @@ protected:
     R1Tensor32 waveSpeedMaxXYZPML;
   };
 
+private:
+
+  /**
+   * @brief Advance the nodal unknowns of a local time stepping level (and of the finer levels) over a step tau,
+   * the forcing of this level being frozen. Only the nodes reached by the stiffness term of this level or of a
+   * finer one are updated.
+   * @param mesh the mesh level
+   * @param regionNames the names of the target regions
+   * @param domain the domain partition
+   * @param level the level to advance
+   * @param tau the time step of the level
+   * @param input the unknowns at the beginning of the step
+   * @param inputLevel the level of @p input holding the unknowns
+   * @param outputKey the key of the field (localTimeSteppingSubstep1 or 2) whose level @p level receives the result
+   * @param mass the diagonal of the mass matrix
+   * @param freeSurfaceNodeIndicator flag equal to 1 for the nodes on the free surface, which are not updated
+   */
+  void advanceLocalTimeSteppingLevel( MeshLevel & mesh,
+                                      arrayView1d< string const > const & regionNames,
+                                      DomainPartition & domain,
+                                      integer const level,
+                                      real64 const tau,
+                                      arrayView3d< real32 const > const input,
+                                      integer const inputLevel,
+                                      string const & outputKey,
+                                      arrayView1d< real32 const > const mass,
+                                      arrayView1d< localIndex const > const freeSurfaceNodeIndicator );
+
 };
 
 namespace fields
@@ -318,6 +474,70 @@ DECLARE_FIELD( referencePosition32,
                NOPLOT,
                WRITE_AND_READ,
                "Copy of the referencePosition from NodeManager in 32 bits integer" );
+
+DECLARE_FIELD( localTimeSteppingLevel,
+               "localTimeSteppingLevel",
+               array1d< integer >,
+               0,
+               LEVEL_1,
+               NO_WRITE,
+               "Local time stepping level of the cell (the cell is advanced with dt / 2^level)" );
+
+DECLARE_FIELD( localTimeSteppingNodeLevel,
+               "localTimeSteppingNodeLevel",
+               array1d< integer >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Local time stepping level of the node, i.e. the finest level of its adjacent cells" );
+
+DECLARE_FIELD( localTimeSteppingNodeNeighborLevel,
+               "localTimeSteppingNodeNeighborLevel",
+               array1d< integer >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Finest level of the nodes sharing a cell with the node, i.e. the finest level whose stiffness term reaches the node" );
+
+DECLARE_FIELD( localTimeSteppingForcing,
+               "localTimeSteppingForcing",
+               array3d< real32 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Frozen forcing (divided by the mass) of each local time stepping level" );
+
+DECLARE_FIELD( localTimeSteppingSubstep1,
+               "localTimeSteppingSubstep1",
+               array3d< real32 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Unknowns after the first half step of each local time stepping level" );
+
+DECLARE_FIELD( localTimeSteppingSubstep2,
+               "localTimeSteppingSubstep2",
+               array3d< real32 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Unknowns after the second half step of each local time stepping level" );
+
+DECLARE_FIELD( localTimeSteppingStiffness,
+               "localTimeSteppingStiffness",
+               array2d< real32 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Product of the stiffness matrix and the unknowns of a local time stepping level" );
+
+DECLARE_FIELD( localTimeSteppingExchange,
+               "localTimeSteppingExchange",
+               array2d< real32 >,
+               0,
+               NOPLOT,
+               NO_WRITE,
+               "Copy of the unknowns of one local time stepping level, exchanged with the neighbors" );
 }
 } /* namespace geos */
 
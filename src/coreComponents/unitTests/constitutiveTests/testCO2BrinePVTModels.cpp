@@ -364,7 +364,8 @@ std::unique_ptr< MODEL > makePVTFunction( string const & filename,
       pvtFunction = std::make_unique< MODEL >( strs[1],
                                                strs,
                                                componentNames,
-                                               componentMolarWeight );
+                                               componentMolarWeight,
+                                               "" );
     }
   }
   GEOS_ERROR_IF( pvtFunction == nullptr,
@@ -405,7 +406,8 @@ std::unique_ptr< MODEL > makeFlashModel( string const & filename,
                                               strs,
                                               phaseNames,
                                               componentNames,
-                                              componentMolarWeight );
+                                              componentMolarWeight,
+                                              "" );
     }
   }
   GEOS_ERROR_IF( flashModel == nullptr,
@@ -429,6 +429,30 @@ MultiFluidBase & makeCompositionalFluid( string const & name, Group & parent )
   return fluid;
 }
 
+void testDerivativeStorage( MultiFluidBase & fluid )
+{
+  integer const NC = fluid.numFluidComponents();
+  integer const NP = fluid.numFluidPhases();
+  integer const NDOF = NC+2;
+
+  fluid.allocateConstitutiveData( fluid.getParent(), 1 );
+
+  // the derivatives of the phase properties used by the flow kernels are always stored
+  EXPECT_EQ( fluid.dPhaseDensity().size( 3 ), NDOF );
+  EXPECT_EQ( fluid.dPhaseViscosity().size( 3 ), NDOF );
+  EXPECT_EQ( fluid.dPhaseCompFraction().size( 4 ), NDOF );
+
+  // the derivatives of the energy properties are only stored for thermal models
+  integer const numEnergyDof = fluid.isThermal() ? NDOF : 0;
+  EXPECT_EQ( fluid.dPhaseEnthalpy().size( 3 ), numEnergyDof );
+  EXPECT_EQ( fluid.dPhaseInternalEnergy().size( 3 ), numEnergyDof );
+  EXPECT_EQ( fluid.dPhaseEnthalpy().size(), fluid.numQuadraturePoints() * fluid.size() * NP * numEnergyDof );
+
+  // the values of the energy properties, and their old-time copies, are always stored
+  EXPECT_EQ( fluid.phaseEnthalpy().size( 2 ), NP );
+  EXPECT_EQ( fluid.phaseEnthalpy_n().size( 2 ), NP );
+}
+
 class CompositionalFluidTestBase : public ::testing::Test
 {
 public:
@@ -456,6 +480,11 @@ public:
   }
 };
 
+TEST_F( CompositionalFluidTest, derivativeStorage )
+{
+  testDerivativeStorage( *fluid );
+}
+
 TEST_F( CompositionalFluidTest, numericalDerivativesMolar )
 {
   fluid->setMassFlag( false );
@@ -703,6 +732,11 @@ public:
   }
 };
 
+TEST_F( LiveOilFluidTest, derivativeStorage )
+{
+  testDerivativeStorage( *fluid );
+}
+
 TEST_F( LiveOilFluidTest, numericalDerivativesMolar )
 {
   fluid->setMassFlag( false );
@@ -764,6 +798,11 @@ public:
   }
 };
 
+TEST_F( DeadOilFluidTest, derivativeStorage )
+{
+  testDerivativeStorage( *fluid );
+}
+
 TEST_F( DeadOilFluidTest, numericalDerivativesMolar )
 {
   fluid->setMassFlag( false );
@@ -1018,6 +1057,11 @@ TEST_F( CO2BrinePhillipsFluidTest, checkAgainstPreviousImplementationMass )
   }
 }
 
+TEST_F( CO2BrinePhillipsFluidTest, derivativeStorage )
+{
+  testDerivativeStorage( *fluid );
+}
+
 TEST_F( CO2BrinePhillipsFluidTest, numericalDerivativesMolar )
 {
   fluid->setMassFlag( false );
@@ -0,0 +1,223 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "codingUtilities/StringUtilities.hpp"
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+#include "common/Path.hpp"
+#include "constitutive/fluid/multifluid/CO2Brine/functions/PVTFunctionHelpers.hpp"
+#include "constitutive/fluid/multifluid/CO2Brine/functions/SpanWagnerCO2Density.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/initialization.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <filesystem>
+#include <unistd.h>
+
+using namespace geos;
+using namespace geos::constitutive::PVTProps;
+
+namespace
+{
+
+/// Value of the test property at a pair of pressure and temperature indices
+real64 propertyValue( localIndex const i, localIndex const j, real64 const parameter )
+{
+  return parameter * ( i + 1 ) + 1000.0 * j;
+}
+
+PTTableCoordinates makeTableCoordinates( localIndex const nPressures, localIndex const nTemperatures )
+{
+  PTTableCoordinates tableCoords;
+  for( localIndex i = 0; i < nPressures; ++i )
+  {
+    tableCoords.appendPressure( 1e5 * ( i + 1 ) );
+  }
+  for( localIndex j = 0; j < nTemperatures; ++j )
+  {
+    tableCoords.appendTemperature( 20.0 + j );
+  }
+  return tableCoords;
+}
+
+localIndex numPoints( PTTableCoordinates const & tableCoords )
+{
+  return tableCoords.nPressures() * tableCoords.nTemperatures();
+}
+
+/**
+ * @brief Compute the test property table.
+ * @return the number of points evaluated on all the ranks (zero if the table has been read from the cache)
+ */
+localIndex computeTable( string const & cacheDirectory,
+                         real64 const parameter,
+                         PTTableCoordinates const & tableCoords,
+                         array1d< real64 > & values )
+{
+  values.resize( numPoints( tableCoords ) );
+  values.zero();
+  localIndex numEvaluations = 0;
+  PVTFunctionHelpers::computePropertyTable( "TestProperty",
+                                            { parameter },
+                                            tableCoords,
+                                            cacheDirectory,
+                                            values.toView(),
+                                            [&]( localIndex const i, localIndex const j )
+  {
+    ++numEvaluations;
+    return propertyValue( i, j, parameter );
+  } );
+  return MpiWrapper::sum( numEvaluations );
+}
+
+void checkValues( PTTableCoordinates const & tableCoords,
+                  real64 const parameter,
+                  arrayView1d< real64 const > const & values )
+{
+  localIndex const nPressures = tableCoords.nPressures();
+  for( localIndex k = 0; k < values.size(); ++k )
+  {
+    EXPECT_DOUBLE_EQ( values[k], propertyValue( k % nPressures, k / nPressures, parameter ) );
+  }
+}
+
+class PVTTableCacheTest : public ::testing::Test
+{
+protected:
+
+  void SetUp() override
+  {
+    // a directory unique to the run, named after the process of rank 0
+    int pid = MpiWrapper::commRank() == 0 ? static_cast< int >( getpid() ) : 0;
+    MpiWrapper::broadcast( pid, 0 );
+    string const testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    m_cacheDirectory = ( std::filesystem::temp_directory_path() / GEOS_FMT( "pvtTableCache_{}_{}", pid, testName ) ).string();
+  }
+
+  void TearDown() override
+  {
+    MpiWrapper::barrier();
+    if( MpiWrapper::commRank() == 0 )
+    {
+      std::filesystem::remove_all( m_cacheDirectory );
+    }
+  }
+
+  string m_cacheDirectory;
+};
+
+}
+
+TEST_F( PVTTableCacheTest, distributedTableGather )
+{
+  // the number of points is not a multiple of the number of ranks, so the last chunk is incomplete
+  PTTableCoordinates const tableCoords = makeTableCoordinates( 7, 5 );
+  array1d< real64 > values;
+
+  // without cache directory, each point is evaluated on exactly one rank and the table is known on all ranks
+  EXPECT_EQ( computeTable( "", 2.0, tableCoords, values ), numPoints( tableCoords ) );
+  checkValues( tableCoords, 2.0, values.toViewConst() );
+  EXPECT_FALSE( std::filesystem::exists( m_cacheDirectory ) );
+}
+
+TEST_F( PVTTableCacheTest, writeAndReadCachedTable )
+{
+  PTTableCoordinates const tableCoords = makeTableCoordinates( 7, 5 );
+  string const cacheFile = PVTFunctionHelpers::getTableCacheFile( m_cacheDirectory, "TestProperty", { 2.0 }, tableCoords );
+  ASSERT_FALSE( cacheFile.empty() );
+
+  array1d< real64 > values;
+  EXPECT_EQ( computeTable( m_cacheDirectory, 2.0, tableCoords, values ), numPoints( tableCoords ) );
+  checkValues( tableCoords, 2.0, values.toViewConst() );
+  MpiWrapper::barrier();
+  EXPECT_TRUE( std::filesystem::exists( cacheFile ) );
+
+  // the second computation reads the table from the cache file, without evaluating the property
+  array1d< real64 > cachedValues;
+  EXPECT_EQ( computeTable( m_cacheDirectory, 2.0, tableCoords, cachedValues ), 0 );
+  checkValues( tableCoords, 2.0, cachedValues.toViewConst() );
+
+  // a cache file of the wrong size is ignored
+  array1d< real64 > wrongSizeValues( numPoints( tableCoords ) + 1 );
+  EXPECT_FALSE( PVTFunctionHelpers::readCachedTable( cacheFile, wrongSizeValues.toView() ) );
+}
+
+TEST_F( PVTTableCacheTest, cacheInvalidatedByInputs )
+{
+  PTTableCoordinates const tableCoords = makeTableCoordinates( 7, 5 );
+  PTTableCoordinates const finerTableCoords = makeTableCoordinates( 8, 5 );
+  string const cacheFile = PVTFunctionHelpers::getTableCacheFile( m_cacheDirectory, "TestProperty", { 2.0 }, tableCoords );
+
+  // the name of the file depends on all the inputs of the table, and the cache can be disabled
+  EXPECT_NE( cacheFile, PVTFunctionHelpers::getTableCacheFile( m_cacheDirectory, "TestProperty", { 3.0 }, tableCoords ) );
+  EXPECT_NE( cacheFile, PVTFunctionHelpers::getTableCacheFile( m_cacheDirectory, "OtherProperty", { 2.0 }, tableCoords ) );
+  EXPECT_NE( cacheFile, PVTFunctionHelpers::getTableCacheFile( m_cacheDirectory, "TestProperty", { 2.0 }, finerTableCoords ) );
+  EXPECT_EQ( cacheFile, PVTFunctionHelpers::getTableCacheFile( m_cacheDirectory, "TestProperty", { 2.0 }, tableCoords ) );
+  EXPECT_TRUE( PVTFunctionHelpers::getTableCacheFile( "", "TestProperty", { 2.0 }, tableCoords ).empty() );
+
+  array1d< real64 > values;
+  EXPECT_EQ( computeTable( m_cacheDirectory, 2.0, tableCoords, values ), numPoints( tableCoords ) );
+
+  // a change of the parameters or of the coordinates triggers a new computation
+  EXPECT_EQ( computeTable( m_cacheDirectory, 3.0, tableCoords, values ), numPoints( tableCoords ) );
+  checkValues( tableCoords, 3.0, values.toViewConst() );
+  EXPECT_EQ( computeTable( m_cacheDirectory, 2.0, finerTableCoords, values ), numPoints( finerTableCoords ) );
+  checkValues( finerTableCoords, 2.0, values.toViewConst() );
+
+  // all the tables are now cached side by side
+  EXPECT_EQ( computeTable( m_cacheDirectory, 2.0, tableCoords, values ), 0 );
+  checkValues( tableCoords, 2.0, values.toViewConst() );
+  EXPECT_EQ( computeTable( m_cacheDirectory, 3.0, tableCoords, values ), 0 );
+  checkValues( tableCoords, 3.0, values.toViewConst() );
+}
+
+TEST_F( PVTTableCacheTest, cacheDirectoryOfEachModel )
+{
+  string_array const inputParams = stringutilities::tokenizeBySpaces< array1d >( "DensityFun SpanWagnerCO2Density 1e6 2e6 5e5 300 320 10" );
+  string_array componentNames;
+  componentNames.emplace_back( "co2" );
+  componentNames.emplace_back( "water" );
+  array1d< real64 > componentMolarWeight;
+  componentMolarWeight.emplace_back( 44e-3 );
+  componentMolarWeight.emplace_back( 18e-3 );
+
+  // two models built with different cache directories write to their own directory
+  string const firstDirectory = joinPath( m_cacheDirectory, "first" );
+  string const secondDirectory = joinPath( m_cacheDirectory, "second" );
+  SpanWagnerCO2Density const firstDensity( "firstDensity", inputParams, componentNames, componentMolarWeight, firstDirectory );
+  SpanWagnerCO2Density const secondDensity( "secondDensity", inputParams, componentNames, componentMolarWeight, secondDirectory );
+  SpanWagnerCO2Density const uncachedDensity( "uncachedDensity", inputParams, componentNames, componentMolarWeight, "" );
+
+  MpiWrapper::barrier();
+  EXPECT_FALSE( std::filesystem::is_empty( firstDirectory ) );
+  EXPECT_FALSE( std::filesystem::is_empty( secondDirectory ) );
+  EXPECT_EQ( std::distance( std::filesystem::directory_iterator( m_cacheDirectory ), std::filesystem::directory_iterator() ), 2 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+
+  geos::GeosxState state( geos::basicSetup( argc, argv ) );
+
+  int const result = RUN_ALL_TESTS();
+
+  geos::basicCleanup();
+
+  return result;
+}
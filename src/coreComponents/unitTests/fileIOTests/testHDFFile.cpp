@@ -114,6 +114,93 @@ TEST( testHDFIO, IdxArrayHistory )
   }
 }
 
+void testMultiRowHistory( string const & filename, integer const compressionLevel )
+{
+  Array< real64, 1 > arr( 64 );
+  HistoryMetadata spec = getHistoryMetadata( "Multi Row History", arr.toViewConst( ), 1 );
+  HDFHistoryIO io( filename, spec, 0, 1, 2, MPI_COMM_GEOSX, compressionLevel );
+  io.init( true );
+
+  auto collect = [&]( real64 const rowValue )
+  {
+    forValuesInSlice( arr.toSlice(), [rowValue]( real64 & value )
+    {
+      value = rowValue;
+    } );
+    buffer_unit_type * buffer = io.getBufferHead( );
+    parallelDeviceEvents packEvents;
+    bufferOps::PackDataDevice< true >( buffer, arr.toViewConst( ), packEvents );
+    waitAllDeviceEvents( packEvents );
+  };
+
+  // the first write follows the partition setup, the second one writes all the buffered rows at once
+  collect( 0.0 );
+  collect( 1.0 );
+  io.write( );
+  collect( 2.0 );
+  collect( 3.0 );
+  collect( 4.0 );
+  io.write( );
+
+  hid_t file = H5Fopen( ( filename + ".hdf5" ).c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+  hid_t dataset = H5Dopen( file, "Multi Row History", H5P_DEFAULT );
+
+  // the deflate filter is only set on the dataset if requested (and available)
+  hid_t dcpl = H5Dget_create_plist( dataset );
+  bool const expectCompressed = compressionLevel > 0 && H5Zfilter_avail( H5Z_FILTER_DEFLATE ) > 0;
+  EXPECT_EQ( H5Pget_nfilters( dcpl ) > 0, expectCompressed );
+  H5Pclose( dcpl );
+
+  hid_t filespace = H5Dget_space( dataset );
+  hsize_t const offset[2] = { 0, 0 };
+  hsize_t const count[2] = { 5, 64 };
+  H5Sselect_hyperslab( filespace, H5S_SELECT_SET, offset, nullptr, count, nullptr );
+  hid_t memspace = H5Screate_simple( 2, count, nullptr );
+  std::vector< real64 > values( 5 * 64 );
+  H5Dread( dataset, H5T_NATIVE_DOUBLE, memspace, filespace, H5P_DEFAULT, values.data() );
+  H5Sclose( memspace );
+  H5Sclose( filespace );
+  H5Dclose( dataset );
+  H5Fclose( file );
+
+  for( std::size_t ii = 0; ii < values.size(); ++ii )
+  {
+    EXPECT_EQ( values[ii], static_cast< real64 >( ii / 64 ) );
+  }
+}
+
+TEST( testHDFIO, MultiRowHistory )
+{
+  testMultiRowHistory( "multi_row_history", 0 );
+}
+
+TEST( testHDFIO, MultiRowCompressedHistory )
+{
+  testMultiRowHistory( "multi_row_compressed_history", 6 );
+}
+
+TEST( testHDFIO, ChunkSizeIsCapped )
+{
+  // each index holds more values than a chunk can, so the chunk is cut along the innermost dimension
+  string filename( "capped_chunk_history" );
+  localIndex const numValuesPerChunk = LvArray::integerConversion< localIndex >( HDFHistoryIO::maxChunkBytes / sizeof( real32 ) );
+  HDFHistoryIO io( filename, 2, { 3, numValuesPerChunk + 5 }, "Capped Chunk History", std::type_index( typeid( real32 ) ) );
+  io.init( true );
+
+  hid_t file = H5Fopen( ( filename + ".hdf5" ).c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+  hid_t dataset = H5Dopen( file, "Capped Chunk History", H5P_DEFAULT );
+  hid_t dcpl = H5Dget_create_plist( dataset );
+  hsize_t chunkDims[3] = { 0, 0, 0 };
+  EXPECT_EQ( H5Pget_chunk( dcpl, 3, chunkDims ), 3 );
+  H5Pclose( dcpl );
+  H5Dclose( dataset );
+  H5Fclose( file );
+
+  EXPECT_EQ( chunkDims[0], hsize_t( 1 ) );
+  EXPECT_EQ( chunkDims[1], hsize_t( 1 ) );
+  EXPECT_EQ( chunkDims[2], LvArray::integerConversion< hsize_t >( numValuesPerChunk ) );
+}
+
 int main( int ac, char * av[] )
 {
   ::testing::InitGoogleTest( &ac, av );
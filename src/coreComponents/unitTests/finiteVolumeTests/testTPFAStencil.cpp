@@ -0,0 +1,185 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "finiteVolume/CellElementStencilTPFA.hpp"
+#include "finiteVolume/FiniteVolumeManager.hpp"
+#include "finiteVolume/FluxApproximationBase.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+
+#include <gtest/gtest.h>
+
+#if defined( GEOSX_USE_OPENMP )
+#include <omp.h>
+#endif
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// The mesh is stretched and split in two regions, so that the weights and the region indices vary between the connections.
+// The flow solver is only there to trigger the construction of the stencils.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <SinglePhaseFVM name="singleflow"
+                      discretization="fluidTPFA"
+                      targetRegions="{ region1, region2 }">
+        <NonlinearSolverParameters newtonTol="1.0e-8"
+                                   newtonMaxIter="8" />
+        <LinearSolverParameters solverType="direct" />
+      </SinglePhaseFVM>
+    </Solvers>
+    <Mesh>
+      <InternalMesh name="mesh"
+                    elementTypes="{ C3D8 }"
+                    xCoords="{ 0, 2, 10 }"
+                    yCoords="{ 0, 1, 5 }"
+                    zCoords="{ 0, 3 }"
+                    nx="{ 4, 5 }"
+                    ny="{ 2, 3 }"
+                    nz="{ 4 }"
+                    xBias="{ 0, -0.4 }"
+                    cellBlockNames="{ cb1, cb2, cb3, cb4 }" />
+    </Mesh>
+    <Events maxTime="1">
+      <PeriodicEvent name="solverApplications"
+                     target="/Solvers/singleflow" />
+    </Events>
+    <NumericalMethods>
+      <FiniteVolume>
+        <TwoPointFluxApproximation name="fluidTPFA" />
+      </FiniteVolume>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion name="region1"
+                         cellBlocks="{ cb1, cb3 }"
+                         materialList="{ water, rock }" />
+      <CellElementRegion name="region2"
+                         cellBlocks="{ cb2, cb4 }"
+                         materialList="{ water, rock }" />
+    </ElementRegions>
+    <Constitutive>
+      <CompressibleSolidConstantPermeability name="rock"
+                                             solidModelName="nullSolid"
+                                             porosityModelName="rockPorosity"
+                                             permeabilityModelName="rockPerm" />
+      <NullModel name="nullSolid" />
+      <PressurePorosity name="rockPorosity"
+                        defaultReferencePorosity="0.05"
+                        referencePressure="0.0"
+                        compressibility="1.0e-9" />
+      <ConstantPermeability name="rockPerm"
+                            permeabilityComponents="{ 1.0e-13, 1.0e-13, 1.0e-13 }" />
+      <CompressibleSinglePhaseFluid name="water"
+                                    defaultDensity="1000"
+                                    defaultViscosity="0.001"
+                                    referencePressure="0.0"
+                                    compressibility="5e-10"
+                                    viscosibility="0.0" />
+    </Constitutive>
+  </Problem>
+  )xml";
+
+/// Host copy of the entries of a cell stencil
+struct StencilEntries
+{
+  std::vector< localIndex > regionIndices;
+  std::vector< localIndex > subRegionIndices;
+  std::vector< localIndex > elementIndices;
+  std::vector< real64 > weights;
+
+  /// Whether each face of the mesh is the connector of a stencil entry
+  std::vector< bool > isConnector;
+};
+
+/**
+ * @brief Build the cell stencil of the problem with a given number of threads.
+ * @param numThreads the number of threads used to build the stencil (ignored without OpenMP)
+ * @return the entries of the stencil
+ */
+StencilEntries buildCellStencil( int const numThreads )
+{
+#if defined( GEOSX_USE_OPENMP )
+  int const maxThreads = omp_get_max_threads();
+  omp_set_num_threads( numThreads );
+#else
+  GEOS_UNUSED_VAR( numThreads );
+#endif
+
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), xmlInput );
+
+#if defined( GEOSX_USE_OPENMP )
+  omp_set_num_threads( maxThreads );
+#endif
+
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  MeshLevel & mesh = domain.getMeshBody( 0 ).getBaseDiscretization();
+  FluxApproximationBase const & fluxApprox =
+    domain.getNumericalMethodManager().getFiniteVolumeManager().getFluxApproximation( "fluidTPFA" );
+  CellElementStencilTPFA & stencil =
+    fluxApprox.getStencil< CellElementStencilTPFA >( mesh, FluxApproximationBase::viewKeyStruct::cellStencilString() );
+
+  StencilEntries entries;
+  for( localIndex iconn = 0; iconn < stencil.size(); ++iconn )
+  {
+    for( localIndex ke = 0; ke < CellElementStencilTPFA::maxNumPointsInFlux; ++ke )
+    {
+      entries.regionIndices.emplace_back( stencil.getElementRegionIndices()[iconn][ke] );
+      entries.subRegionIndices.emplace_back( stencil.getElementSubRegionIndices()[iconn][ke] );
+      entries.elementIndices.emplace_back( stencil.getElementIndices()[iconn][ke] );
+      entries.weights.emplace_back( stencil.getWeights()[iconn][ke] );
+    }
+  }
+
+  // the connectors are only reachable through zero(), which is called last since it modifies the weights
+  for( localIndex kf = 0; kf < mesh.getFaceManager().size(); ++kf )
+  {
+    entries.isConnector.emplace_back( stencil.zero( kf ) );
+  }
+  return entries;
+}
+
+TEST( TPFAStencil, parallelBuildMatchesSerialBuild )
+{
+  StencilEntries const serial = buildCellStencil( 1 );
+  StencilEntries const parallel = buildCellStencil( 4 );
+
+  ASSERT_FALSE( serial.weights.empty() );
+
+  // the entries are written at the same position, with the same geometry computation
+  EXPECT_EQ( parallel.regionIndices, serial.regionIndices );
+  EXPECT_EQ( parallel.subRegionIndices, serial.subRegionIndices );
+  EXPECT_EQ( parallel.elementIndices, serial.elementIndices );
+  EXPECT_EQ( parallel.weights, serial.weights );
+  EXPECT_EQ( parallel.isConnector, serial.isConnector );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
@@ -0,0 +1,365 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "constitutive/fluid/multifluid/MultiFluidBase.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseFields.hpp"
+#include "physicsSolvers/fluidFlow/CompositionalMultiphaseFVM.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
+#include "physicsSolvers/fluidFlow/IsothermalCompositionalMultiphaseBaseKernels.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::constitutive;
+using namespace geos::testing;
+using namespace geos::isothermalCompositionalMultiphaseBaseKernels;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers gravityVector="{ 0.0, 0.0, -9.81 }">
+      <CompositionalMultiphaseFVM name="compflow"
+                                   logLevel="0"
+                                   discretization="fluidTPFA"
+                                   targetRegions="{region}"
+                                   temperature="297.15"
+                                   useMass="1"
+                                   constitutiveUpdateTolerance="CONSTITUTIVE_UPDATE_TOLERANCE">
+
+        <NonlinearSolverParameters newtonTol="1.0e-6"
+                                   newtonMaxIter="10"/>
+        <LinearSolverParameters solverType="direct"/>
+      </CompositionalMultiphaseFVM>
+    </Solvers>
+    <Mesh>
+      <InternalMesh name="mesh"
+                    elementTypes="{C3D8}"
+                    xCoords="{0, 3}"
+                    yCoords="{0, 1}"
+                    zCoords="{0, 1}"
+                    nx="{3}"
+                    ny="{1}"
+                    nz="{1}"
+                    cellBlockNames="{cb1}"/>
+    </Mesh>
+    <NumericalMethods>
+      <FiniteVolume>
+        <TwoPointFluxApproximation name="fluidTPFA"/>
+      </FiniteVolume>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion name="region" cellBlocks="{cb1}" materialList="{fluid, rock, relperm, cappressure}" />
+    </ElementRegions>
+    <Constitutive>
+      <CompositionalMultiphaseFluid name="fluid"
+                                    phaseNames="{oil, gas}"
+                                    equationsOfState="{PR, PR}"
+                                    componentNames="{N2, C10, C20, H2O}"
+                                    componentCriticalPressure="{34e5, 25.3e5, 14.6e5, 220.5e5}"
+                                    componentCriticalTemperature="{126.2, 622.0, 782.0, 647.0}"
+                                    componentAcentricFactor="{0.04, 0.443, 0.816, 0.344}"
+                                    componentMolarWeight="{28e-3, 134e-3, 275e-3, 18e-3}"
+                                    componentVolumeShift="{0, 0, 0, 0}"
+                                    componentBinaryCoeff="{ {0, 0, 0, 0},
+                                                            {0, 0, 0, 0},
+                                                            {0, 0, 0, 0},
+                                                            {0, 0, 0, 0} }"/>
+      <CompressibleSolidConstantPermeability name="rock"
+          solidModelName="nullSolid"
+          porosityModelName="rockPorosity"
+          permeabilityModelName="rockPerm"/>
+     <NullModel name="nullSolid"/>
+     <PressurePorosity name="rockPorosity"
+                       defaultReferencePorosity="0.05"
+                       referencePressure = "0.0"
+                       compressibility="1.0e-9"/>
+      <BrooksCoreyRelativePermeability name="relperm"
+                                       phaseNames="{oil, gas}"
+                                       phaseMinVolumeFraction="{0.1, 0.15}"
+                                       phaseRelPermExponent="{2.0, 2.0}"
+                                       phaseRelPermMaxValue="{0.8, 0.9}"/>
+      <BrooksCoreyCapillaryPressure name="cappressure"
+                                    phaseNames="{oil, gas}"
+                                    phaseMinVolumeFraction="{0.2, 0.05}"
+                                    phaseCapPressureExponentInv="{4.25, 3.5}"
+                                    phaseEntryPressure="{0., 1e8}"
+                                    capPressureEpsilon="0.0"/>
+    <ConstantPermeability name="rockPerm"
+                          permeabilityComponents="{2.0e-16, 2.0e-16, 2.0e-16}"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification name="initialPressure"
+                 initialCondition="1"
+                 setNames="{all}"
+                 objectPath="ElementRegions/region/cb1"
+                 fieldName="pressure"
+                 functionName="initialPressureFunc"
+                 scale="5e6"/>
+      <FieldSpecification name="initialComposition_N2"
+                 initialCondition="1"
+                 setNames="{all}"
+                 objectPath="ElementRegions/region/cb1"
+                 fieldName="globalCompFraction"
+                 component="0"
+                 scale="0.099"/>
+      <FieldSpecification name="initialComposition_C10"
+                 initialCondition="1"
+                 setNames="{all}"
+                 objectPath="ElementRegions/region/cb1"
+                 fieldName="globalCompFraction"
+                 component="1"
+                 scale="0.3"/>
+      <FieldSpecification name="initialComposition_C20"
+                 initialCondition="1"
+                 setNames="{all}"
+                 objectPath="ElementRegions/region/cb1"
+                 fieldName="globalCompFraction"
+                 component="2"
+                 scale="0.6"/>
+      <FieldSpecification name="initialComposition_H20"
+                 initialCondition="1"
+                 setNames="{all}"
+                 objectPath="ElementRegions/region/cb1"
+                 fieldName="globalCompFraction"
+                 component="3"
+                 scale="0.001"/>
+    </FieldSpecifications>
+    <Functions>
+      <TableFunction name="initialPressureFunc"
+                     inputVarNames="{elementCenter}"
+                     coordinates="{0.0, 3.0}"
+                     values="{1.0, 0.5}"/>
+    </Functions>
+  </Problem>
+  )xml";
+
+string inputWithTolerance( string const & tolerance )
+{
+  string input = xmlInput;
+  string const marker = "CONSTITUTIVE_UPDATE_TOLERANCE";
+  input.replace( input.find( marker ), marker.size(), tolerance );
+  return input;
+}
+
+TEST( ConstitutiveUpdateActiveSet, fluidActiveSet )
+{
+  real64 const tol = 1e-6;
+  localIndex const numCells = 5;
+  integer const numComp = 2;
+
+  array1d< real64 > pres( numCells );
+  array1d< real64 > temp( numCells );
+  array2d< real64, compflow::LAYOUT_COMP > compFrac( numCells, numComp );
+  array1d< real64 > presRef( numCells );
+  array1d< real64 > tempRef( numCells );
+  array2d< real64, compflow::LAYOUT_COMP > compFracRef( numCells, numComp );
+  for( localIndex k = 0; k < numCells; ++k )
+  {
+    pres[k] = 1e7;
+    temp[k] = 300.0;
+    compFrac[k][0] = 0.3;
+    compFrac[k][1] = 0.7;
+    presRef[k] = -1.0;
+    tempRef[k] = -1.0;
+    compFracRef[k][0] = -1.0;
+    compFracRef[k][1] = -1.0;
+  }
+
+  // the first time, all the cells are collected
+  array1d< localIndex > activeSet;
+  ConstitutiveUpdateActiveSetKernel::buildFluidActiveSet( tol, pres, temp, compFrac, presRef, tempRef, compFracRef, activeSet );
+  activeSet.move( hostMemorySpace, false );
+  ASSERT_EQ( activeSet.size(), numCells );
+  for( localIndex k = 0; k < numCells; ++k )
+  {
+    EXPECT_EQ( activeSet[k], k );
+  }
+
+  // changes below the tolerance are skipped, changes above the tolerance are collected, in increasing order
+  pres.move( hostMemorySpace );
+  temp.move( hostMemorySpace );
+  compFrac.move( hostMemorySpace );
+  pres[0] *= 1.0 + 0.1 * tol;
+  pres[1] *= 1.0 + 10.0 * tol;
+  temp[2] += 0.1 * tol;
+  compFrac[3][0] += 10.0 * tol;
+  compFrac[4][1] += 0.1 * tol;
+  ConstitutiveUpdateActiveSetKernel::buildFluidActiveSet( tol, pres, temp, compFrac, presRef, tempRef, compFracRef, activeSet );
+  activeSet.move( hostMemorySpace, false );
+  ASSERT_EQ( activeSet.size(), 2 );
+  EXPECT_EQ( activeSet[0], 1 );
+  EXPECT_EQ( activeSet[1], 3 );
+
+  // only the reference values of the collected cells are refreshed
+  presRef.move( hostMemorySpace, false );
+  compFracRef.move( hostMemorySpace, false );
+  EXPECT_EQ( presRef[0], 1e7 );
+  EXPECT_EQ( presRef[1], pres[1] );
+  EXPECT_EQ( compFracRef[3][0], compFrac[3][0] );
+  EXPECT_EQ( compFracRef[4][1], 0.7 );
+
+  // nothing changed since the last call
+  ConstitutiveUpdateActiveSetKernel::buildFluidActiveSet( tol, pres, temp, compFrac, presRef, tempRef, compFracRef, activeSet );
+  EXPECT_EQ( activeSet.size(), 0 );
+}
+
+TEST( ConstitutiveUpdateActiveSet, relPermActiveSet )
+{
+  real64 const tol = 1e-6;
+  localIndex const numCells = 4;
+  integer const numPhase = 2;
+
+  array2d< real64, compflow::LAYOUT_PHASE > phaseVolFrac( numCells, numPhase );
+  array2d< real64, compflow::LAYOUT_PHASE > phaseVolFracRef( numCells, numPhase );
+  for( localIndex k = 0; k < numCells; ++k )
+  {
+    phaseVolFrac[k][0] = 0.4;
+    phaseVolFrac[k][1] = 0.6;
+    phaseVolFracRef[k][0] = 0.4;
+    phaseVolFracRef[k][1] = 0.6;
+  }
+  phaseVolFrac[0][1] += 0.1 * tol;
+  phaseVolFrac[2][0] -= 10.0 * tol;
+
+  array1d< localIndex > activeSet;
+  ConstitutiveUpdateActiveSetKernel::buildRelPermActiveSet( tol, phaseVolFrac, phaseVolFracRef, activeSet );
+  activeSet.move( hostMemorySpace, false );
+  ASSERT_EQ( activeSet.size(), 1 );
+  EXPECT_EQ( activeSet[0], 2 );
+
+  phaseVolFracRef.move( hostMemorySpace, false );
+  EXPECT_EQ( phaseVolFracRef[0][1], 0.6 );
+  EXPECT_EQ( phaseVolFracRef[2][0], phaseVolFrac[2][0] );
+}
+
+class ConstitutiveUpdateToleranceTest : public ::testing::Test
+{
+public:
+
+  ConstitutiveUpdateToleranceTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void setup( string const & tolerance )
+  {
+    setupProblemFromXML( state.getProblemManager(), inputWithTolerance( tolerance ).c_str() );
+    solver = &state.getProblemManager().getPhysicsSolverManager().getGroup< CompositionalMultiphaseFVM >( "compflow" );
+  }
+
+  ElementSubRegionBase & getSubRegion()
+  {
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    return domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager().getRegion( "region" ).getSubRegion( "cb1" );
+  }
+
+  GeosxState state;
+  CompositionalMultiphaseFVM * solver;
+};
+
+TEST_F( ConstitutiveUpdateToleranceTest, skipsUnchangedCells )
+{
+  real64 const tol = 1e-6;
+  setup( "1e-6" );
+
+  ElementSubRegionBase & subRegion = getSubRegion();
+  string const & fluidName = subRegion.getReference< string >( CompositionalMultiphaseFVM::viewKeyStruct::fluidNamesString() );
+  MultiFluidBase const & fluid = subRegion.getConstitutiveModel< MultiFluidBase >( fluidName );
+
+  // all the cells are updated the first time
+  solver->updateFluidState( subRegion );
+  arrayView3d< real64 const, multifluid::USD_PHASE > const phaseDens = fluid.phaseDensity();
+  phaseDens.move( hostMemorySpace, false );
+  array3d< real64, multifluid::LAYOUT_PHASE > phaseDensBefore( phaseDens.size( 0 ), phaseDens.size( 1 ), phaseDens.size( 2 ) );
+  phaseDensBefore.setValues< serialPolicy >( phaseDens );
+
+  // perturb the pressure of the first cell below the tolerance, and the one of the last cell above
+  arrayView1d< real64 > const pres = subRegion.getField< fields::flow::pressure >();
+  pres.move( hostMemorySpace, true );
+  localIndex const last = subRegion.size() - 1;
+  pres[0] *= 1.0 + 0.1 * tol;
+  pres[last] *= 1.0 + 1e-2;
+
+  solver->updateFluidState( subRegion );
+  phaseDens.move( hostMemorySpace, false );
+  for( integer ip = 0; ip < phaseDens.size( 2 ); ++ip )
+  {
+    EXPECT_EQ( phaseDens[0][0][ip], phaseDensBefore[0][0][ip] );
+  }
+  bool hasChanged = false;
+  for( integer ip = 0; ip < phaseDens.size( 2 ); ++ip )
+  {
+    hasChanged = hasChanged || phaseDens[last][0][ip] != phaseDensBefore[last][0][ip];
+  }
+  EXPECT_TRUE( hasChanged );
+}
+
+/// Run one time step and return the cell pressures and component fractions
+array1d< real64 > runOneStep( string const & tolerance )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), inputWithTolerance( tolerance ).c_str() );
+  CompositionalMultiphaseFVM & solver =
+    state.getProblemManager().getPhysicsSolverManager().getGroup< CompositionalMultiphaseFVM >( "compflow" );
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+  real64 const dt = 1e4;
+  real64 const dtAchieved = solver.solverStep( 0.0, dt, 0, domain );
+  EXPECT_EQ( dtAchieved, dt );
+
+  ElementSubRegionBase & subRegion =
+    domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager().getRegion( "region" ).getSubRegion( "cb1" );
+  arrayView1d< real64 const > const pres = subRegion.getField< fields::flow::pressure >();
+  arrayView2d< real64 const, compflow::USD_COMP > const compFrac = subRegion.getField< fields::flow::globalCompFraction >();
+  pres.move( hostMemorySpace, false );
+  compFrac.move( hostMemorySpace, false );
+
+  array1d< real64 > result;
+  for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+  {
+    result.emplace_back( pres[ei] );
+    for( localIndex ic = 0; ic < compFrac.size( 1 ); ++ic )
+    {
+      result.emplace_back( compFrac[ei][ic] );
+    }
+  }
+  return result;
+}
+
+TEST( ConstitutiveUpdateTolerance, resultsUnchanged )
+{
+  array1d< real64 > const reference = runOneStep( "0" );
+  array1d< real64 > const withTolerance = runOneStep( "1e-10" );
+
+  ASSERT_EQ( reference.size(), withTolerance.size() );
+  for( localIndex i = 0; i < reference.size(); ++i )
+  {
+    EXPECT_NEAR( withTolerance[i], reference[i], 1e-8 * LvArray::math::abs( reference[i] ) + 1e-10 );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
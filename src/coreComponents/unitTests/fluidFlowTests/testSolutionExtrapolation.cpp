@@ -0,0 +1,225 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/SinglePhaseFVM.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
+#include "unitTests/fluidFlowTests/testSingleFlowUtils.hpp"
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <SinglePhaseFVM name="singleflow"
+                      discretization="fluidTPFA"
+                      targetRegions="{ region }">
+        <NonlinearSolverParameters newtonTol="1.0e-8"
+                                   newtonMaxIter="20"
+                                   solutionExtrapolation="Linear" />
+        <LinearSolverParameters solverType="direct" />
+      </SinglePhaseFVM>
+    </Solvers>
+    <Mesh>
+      <InternalMesh name="mesh"
+                    elementTypes="{ C3D8 }"
+                    xCoords="{ 0, 20 }"
+                    yCoords="{ 0, 1 }"
+                    zCoords="{ 0, 1 }"
+                    nx="{ 10 }"
+                    ny="{ 1 }"
+                    nz="{ 1 }"
+                    cellBlockNames="{ cb }" />
+    </Mesh>
+    <Geometry>
+      <Box name="source"
+           xMin="{ -0.01, -0.01, -0.01 }"
+           xMax="{ 2.01, 1.01, 1.01 }" />
+      <Box name="sink"
+           xMin="{ 17.99, -0.01, -0.01 }"
+           xMax="{ 20.01, 1.01, 1.01 }" />
+    </Geometry>
+    <Events maxTime="1000">
+      <PeriodicEvent name="solverApplications"
+                     maxEventDt="1000"
+                     target="/Solvers/singleflow" />
+    </Events>
+    <NumericalMethods>
+      <FiniteVolume>
+        <TwoPointFluxApproximation name="fluidTPFA" />
+      </FiniteVolume>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion name="region"
+                         cellBlocks="{ cb }"
+                         materialList="{ water, rock }" />
+    </ElementRegions>
+    <Constitutive>
+      <CompressibleSolidConstantPermeability name="rock"
+                                             solidModelName="nullSolid"
+                                             porosityModelName="rockPorosity"
+                                             permeabilityModelName="rockPerm" />
+      <NullModel name="nullSolid" />
+      <PressurePorosity name="rockPorosity"
+                        defaultReferencePorosity="0.05"
+                        referencePressure="0.0"
+                        compressibility="1.0e-9" />
+      <ConstantPermeability name="rockPerm"
+                            permeabilityComponents="{ 1.0e-13, 1.0e-13, 1.0e-13 }" />
+      <CompressibleSinglePhaseFluid name="water"
+                                    defaultDensity="1000"
+                                    defaultViscosity="0.001"
+                                    referencePressure="0.0"
+                                    compressibility="5e-10"
+                                    viscosibility="0.0" />
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification name="initialPressure"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="9e6" />
+      <FieldSpecification name="sourcePressure"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="1.45e7" />
+      <FieldSpecification name="sinkPressure"
+                          setNames="{ sink }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="7e6" />
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+class SolutionExtrapolationTest : public ::testing::Test
+{
+public:
+
+  SolutionExtrapolationTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+    solver = &state.getProblemManager().getPhysicsSolverManager().getGroup< SinglePhaseFVM< SinglePhaseBase > >( "singleflow" );
+
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+    solver->setupSystem( domain,
+                         solver->getDofManager(),
+                         solver->getLocalMatrix(),
+                         solver->getSystemRhs(),
+                         solver->getSystemSolution() );
+  }
+
+  /// Advance one step the way the solvers overriding solverStep do, i.e. calling directly the nonlinear loop
+  void advance( real64 const time_n, real64 const dt )
+  {
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    solver->implicitStepSetup( time_n, dt, domain );
+    real64 const dtAchieved = solver->nonlinearImplicitStep( time_n, dt, 0, domain );
+    solver->implicitStepComplete( time_n, dtAchieved, domain );
+    ASSERT_EQ( dtAchieved, dt );
+  }
+
+  /// Copy the current cell pressures
+  array1d< real64 > getPressure()
+  {
+    array1d< real64 > pressureCopy;
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    solver->forDiscretizationOnMeshTargets( domain.getMeshBodies(),
+                                            [&]( string const,
+                                                 MeshLevel & mesh,
+                                                 arrayView1d< string const > const & regionNames )
+    {
+      mesh.getElemManager().forElementSubRegions( regionNames,
+                                                  [&]( localIndex const,
+                                                       ElementSubRegionBase & subRegion )
+      {
+        arrayView1d< real64 const > const pres = subRegion.getField< fields::flow::pressure >();
+        pres.move( hostMemorySpace, false );
+        for( localIndex ei = 0; ei < pres.size(); ++ei )
+        {
+          pressureCopy.emplace_back( pres[ei] );
+        }
+      } );
+    } );
+    return pressureCopy;
+  }
+
+  static real64 constexpr dt = 1e3;
+
+  GeosxState state;
+  SinglePhaseFVM< SinglePhaseBase > * solver;
+};
+
+real64 constexpr SolutionExtrapolationTest::dt;
+
+TEST_F( SolutionExtrapolationTest, initialGuessIsExtrapolated )
+{
+  advance( 0.0, dt );
+  array1d< real64 > const pres1 = getPressure();
+  advance( dt, dt );
+  array1d< real64 > const pres2 = getPressure();
+
+  // capture the state at the first assembly of the next step, i.e. the initial Newton guess
+  array1d< real64 > initialGuess;
+  std::function< void( CRSMatrix< real64, globalIndex >, array1d< real64 > ) > callback =
+    [&]( CRSMatrix< real64, globalIndex >, array1d< real64 > )
+  {
+    if( initialGuess.empty() )
+    {
+      initialGuess = getPressure();
+    }
+  };
+  ASSERT_TRUE( solver->registerCallback( &callback, typeid( callback ) ) );
+
+  real64 const dt3 = 2.0 * dt;
+  advance( 2.0 * dt, dt3 );
+
+  ASSERT_EQ( initialGuess.size(), pres2.size() );
+
+  // linear extrapolation of the increment of the last converged step
+  bool hasChanged = false;
+  for( localIndex ei = 0; ei < pres2.size(); ++ei )
+  {
+    real64 const expected = pres2[ei] + dt3 / dt * ( pres2[ei] - pres1[ei] );
+    EXPECT_NEAR( initialGuess[ei], expected, 1e-8 * LvArray::math::abs( expected ) );
+    hasChanged = hasChanged || LvArray::math::abs( pres2[ei] - pres1[ei] ) > 1e-6 * LvArray::math::abs( pres2[ei] );
+  }
+  // make sure the test is meaningful, i.e. the initial guess is not just the previous state
+  EXPECT_TRUE( hasChanged );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
@@ -0,0 +1,239 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "codingUtilities/UnitTestUtilities.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/MeshManager.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/SinglePhaseFVM.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseFields.hpp"
+
+using namespace geos;
+using namespace geos::dataRepository;
+
+CommandLineOptions g_commandLineOptions;
+
+// The mesh is a 4x4 slab split in 2x2 partitions, so that each rank has a diagonal neighbor
+// touching its cells only along an edge.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <SinglePhaseFVM name="singleflow"
+                      discretization="fluidTPFA"
+                      targetRegions="{ region }">
+        <NonlinearSolverParameters newtonTol="1.0e-8"
+                                   newtonMaxIter="20" />
+        <LinearSolverParameters solverType="direct" />
+      </SinglePhaseFVM>
+      <!-- EXTRA_SOLVER -->
+    </Solvers>
+    <Mesh>
+      <InternalMesh name="mesh"
+                    elementTypes="{ C3D8 }"
+                    xCoords="{ 0, 4 }"
+                    yCoords="{ 0, 4 }"
+                    zCoords="{ 0, 1 }"
+                    nx="{ 4 }"
+                    ny="{ 4 }"
+                    nz="{ 1 }"
+                    cellBlockNames="{ cb }" />
+    </Mesh>
+    <Geometry>
+      <Box name="source"
+           xMin="{ -0.01, -0.01, -0.01 }"
+           xMax="{ 1.01, 1.01, 1.01 }" />
+      <Box name="sink"
+           xMin="{ 2.99, 2.99, -0.01 }"
+           xMax="{ 4.01, 4.01, 1.01 }" />
+    </Geometry>
+    <Events maxTime="1000">
+      <PeriodicEvent name="solverApplications"
+                     maxEventDt="1000"
+                     target="/Solvers/singleflow" />
+    </Events>
+    <NumericalMethods>
+      <FiniteVolume>
+        <TwoPointFluxApproximation name="fluidTPFA" />
+      </FiniteVolume>
+      <!-- EXTRA_DISCRETIZATION -->
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion name="region"
+                         cellBlocks="{ cb }"
+                         materialList="{ water, rock }" />
+    </ElementRegions>
+    <Constitutive>
+      <CompressibleSolidConstantPermeability name="rock"
+                                             solidModelName="nullSolid"
+                                             porosityModelName="rockPorosity"
+                                             permeabilityModelName="rockPerm" />
+      <NullModel name="nullSolid" />
+      <PressurePorosity name="rockPorosity"
+                        defaultReferencePorosity="0.05"
+                        referencePressure="0.0"
+                        compressibility="1.0e-9" />
+      <ConstantPermeability name="rockPerm"
+                            permeabilityComponents="{ 1.0e-13, 1.0e-13, 1.0e-13 }" />
+      <CompressibleSinglePhaseFluid name="water"
+                                    defaultDensity="1000"
+                                    defaultViscosity="0.001"
+                                    referencePressure="0.0"
+                                    compressibility="5e-10"
+                                    viscosibility="0.0" />
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification name="initialPressure"
+                          initialCondition="1"
+                          setNames="{ all }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="9e6" />
+      <FieldSpecification name="sourcePressure"
+                          setNames="{ source }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="1.45e7" />
+      <FieldSpecification name="sinkPressure"
+                          setNames="{ sink }"
+                          objectPath="ElementRegions/region/cb"
+                          fieldName="pressure"
+                          scale="7e6" />
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+// A finite element solver on the same mesh body, which requires node-neighbor ghosts
+char const * laplaceSolver =
+  R"xml(
+      <LaplaceFEM name="laplace"
+                  discretization="FE1"
+                  timeIntegrationOption="SteadyState"
+                  fieldName="Temperature"
+                  targetRegions="{ region }" />
+  )xml";
+
+char const * feDiscretization =
+  R"xml(
+      <FiniteElements>
+        <FiniteElementSpace name="FE1" order="1" />
+      </FiniteElements>
+  )xml";
+
+void setupProblem( ProblemManager & problemManager, string const & input )
+{
+  // The partitioning is given on the command line (-x 2 -y 2)
+  xmlWrapper::xmlDocument xmlDocument;
+  xmlWrapper::xmlResult xmlResult = xmlDocument.loadString( input );
+  GEOS_ERROR_IF( !xmlResult, "XML parsed with errors: " << xmlResult.description() );
+
+  xmlWrapper::xmlNode xmlProblemNode = xmlDocument.getChild( dataRepository::keys::ProblemManager );
+  problemManager.processInputFileRecursive( xmlDocument, xmlProblemNode );
+
+  DomainPartition & domain = problemManager.getDomainPartition();
+
+  constitutive::ConstitutiveManager & constitutiveManager = domain.getConstitutiveManager();
+  xmlWrapper::xmlNode topLevelNode = xmlProblemNode.child( constitutiveManager.getName().c_str() );
+  constitutiveManager.processInputFileRecursive( xmlDocument, topLevelNode );
+
+  MeshManager & meshManager = problemManager.getGroup< MeshManager >( problemManager.groupKeys.meshManager );
+  meshManager.generateMeshLevels( domain );
+
+  ElementRegionManager & elementManager = domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager();
+  topLevelNode = xmlProblemNode.child( elementManager.getName().c_str() );
+  elementManager.processInputFileRecursive( xmlDocument, topLevelNode );
+
+  problemManager.problemSetup();
+  problemManager.applyInitialConditions();
+}
+
+/// Number of ghost cells of this rank, and pressure of the owned cells after one step, indexed by global id
+struct GhostingResult
+{
+  localIndex numGhostCells = 0;
+  std::map< globalIndex, real64 > ownedPressure;
+};
+
+GhostingResult runOneStep( bool const withNodeGhostingSolver )
+{
+  string input = xmlInput;
+  if( withNodeGhostingSolver )
+  {
+    string const solverMarker = "<!-- EXTRA_SOLVER -->";
+    string const discretizationMarker = "<!-- EXTRA_DISCRETIZATION -->";
+    input.replace( input.find( solverMarker ), solverMarker.size(), laplaceSolver );
+    input.replace( input.find( discretizationMarker ), discretizationMarker.size(), feDiscretization );
+  }
+
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  ProblemManager & problemManager = state.getProblemManager();
+  setupProblem( problemManager, input );
+
+  SinglePhaseFVM< SinglePhaseBase > & solver =
+    problemManager.getPhysicsSolverManager().getGroup< SinglePhaseFVM< SinglePhaseBase > >( "singleflow" );
+  DomainPartition & domain = problemManager.getDomainPartition();
+  solver.solverStep( 0.0, 1e3, 0, domain );
+
+  GhostingResult result;
+  ElementSubRegionBase & subRegion =
+    domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager().getRegion( "region" ).getSubRegion( "cb" );
+  arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+  arrayView1d< globalIndex const > const localToGlobal = subRegion.localToGlobalMap();
+  arrayView1d< real64 const > const pressure = subRegion.getField< fields::flow::pressure >();
+  pressure.move( hostMemorySpace, false );
+  for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+  {
+    if( ghostRank[ei] >= 0 )
+    {
+      ++result.numGhostCells;
+    }
+    else
+    {
+      result.ownedPressure[localToGlobal[ei]] = pressure[ei];
+    }
+  }
+  return result;
+}
+
+TEST( TPFAGhosting, faceNeighborsOnly )
+{
+  SKIP_TEST_IF( MpiWrapper::commSize() != 4, "Requires 4 ranks (2x2 partitions)" );
+
+  // Each rank owns 2x2 cells. With TPFA only, it ghosts the 2 + 2 cells of the ranks sharing a face with it.
+  GhostingResult const tpfaOnly = runOneStep( false );
+  EXPECT_EQ( tpfaOnly.numGhostCells, 4 );
+
+  // With a finite element solver on the mesh body, the cell of the diagonal rank touching the corner is ghosted too.
+  GhostingResult const withNodeGhosting = runOneStep( true );
+  EXPECT_EQ( withNodeGhosting.numGhostCells, 5 );
+
+  // The TPFA solution does not depend on the ghosting of the cells that are not in the stencils
+  ASSERT_EQ( tpfaOnly.ownedPressure.size(), withNodeGhosting.ownedPressure.size() );
+  for( auto const & [cellGlobalIndex, pressure] : tpfaOnly.ownedPressure )
+  {
+    ASSERT_EQ( withNodeGhosting.ownedPressure.count( cellGlobalIndex ), 1 );
+    EXPECT_NEAR( withNodeGhosting.ownedPressure.at( cellGlobalIndex ), pressure, 1e-8 * pressure );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
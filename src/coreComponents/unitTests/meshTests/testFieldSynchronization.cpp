@@ -0,0 +1,405 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "gtest/gtest.h"
+
+#include "codingUtilities/UnitTestUtilities.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/MeshManager.hpp"
+#include "mesh/mpiCommunications/CommunicationTools.hpp"
+#include "mesh/mpiCommunications/MPI_iCommData.hpp"
+
+using namespace geos;
+
+namespace
+{
+constexpr char const * nodeIntegerField = "testNodeInteger";
+constexpr char const * faceGlobalIndexField = "testFaceGlobalIndex";
+constexpr char const * elemScalarField = "testElemScalar";
+constexpr char const * elemVectorField = "testElemVector";
+constexpr localIndex numComponents = 3;
+constexpr real64 poisonValue = -1.0;
+
+/// Value stored in a field for the object of global index @p gi
+real64 expectedValue( globalIndex const gi, localIndex const component = 0 )
+{
+  return 0.5 * gi + component;
+}
+}
+
+class FieldSynchronizationTest : public ::testing::Test
+{
+protected:
+
+  static void SetUpTestCase()
+  {
+    string const inputStream =
+      "<Problem>"
+      "  <Mesh>"
+      "    <InternalMesh"
+      "      name=\"mesh1\""
+      "      elementTypes=\"{C3D8}\""
+      "      xCoords=\"{0,4}\""
+      "      yCoords=\"{0,2}\""
+      "      zCoords=\"{0,1}\""
+      "      nx=\"{4}\""
+      "      ny=\"{2}\""
+      "      nz=\"{1}\""
+      "      cellBlockNames=\"{cb1}\"/>"
+      "  </Mesh>"
+      "  <ElementRegions>"
+      "    <CellElementRegion name=\"region1\" cellBlocks=\"{cb1}\" materialList=\"{}\"/>"
+      "  </ElementRegions>"
+      "</Problem>";
+
+    xmlWrapper::xmlDocument xmlDocument;
+    xmlWrapper::xmlResult xmlResult = xmlDocument.loadString( inputStream );
+    ASSERT_TRUE( xmlResult );
+
+    xmlWrapper::xmlNode xmlProblemNode = xmlDocument.getChild( dataRepository::keys::ProblemManager );
+    ProblemManager & problemManager = getGlobalState().getProblemManager();
+    problemManager.processInputFileRecursive( xmlDocument, xmlProblemNode );
+
+    DomainPartition & domain = problemManager.getDomainPartition();
+    MeshManager & meshManager = problemManager.getGroup< MeshManager >( problemManager.groupKeys.meshManager );
+    meshManager.generateMeshLevels( domain );
+
+    ElementRegionManager & elementManager = domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager();
+    xmlWrapper::xmlNode topLevelNode = xmlProblemNode.child( elementManager.getName().c_str() );
+    elementManager.processInputFileRecursive( xmlDocument, topLevelNode );
+    elementManager.postProcessInputRecursive();
+
+    problemManager.problemSetup();
+    problemManager.applyInitialConditions();
+  }
+};
+
+TEST_F( FieldSynchronizationTest, heterogeneousFields )
+{
+  SKIP_TEST_IN_SERIAL( "Parallel test" );
+
+  DomainPartition & domain = getGlobalState().getProblemManager().getDomainPartition();
+  MeshLevel & mesh = domain.getMeshBody( 0 ).getBaseDiscretization();
+  NodeManager & nodeManager = mesh.getNodeManager();
+  FaceManager & faceManager = mesh.getFaceManager();
+  CellElementSubRegion & subRegion = mesh.getElemManager().getRegion( 0 ).getSubRegion< CellElementSubRegion >( 0 );
+
+  // fields of different types and shapes, on different object managers, synchronized in a single exchange.
+  // Owned objects hold their expected value, ghosts are poisoned.
+  array1d< integer > & nodeInteger = nodeManager.registerWrapper< array1d< integer > >( nodeIntegerField ).reference();
+  array1d< globalIndex > & faceGlobalIndex = faceManager.registerWrapper< array1d< globalIndex > >( faceGlobalIndexField ).reference();
+  array1d< real64 > & elemScalar = subRegion.registerWrapper< array1d< real64 > >( elemScalarField ).reference();
+  array2d< real64 > & elemVector = subRegion.registerWrapper< array2d< real64 > >( elemVectorField ).reference();
+  elemVector.resizeDimension< 1 >( numComponents );
+
+  arrayView1d< globalIndex const > const nodeLocalToGlobal = nodeManager.localToGlobalMap();
+  arrayView1d< integer const > const nodeGhostRank = nodeManager.ghostRank();
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    nodeInteger[a] = nodeGhostRank[a] < 0 ? LvArray::integerConversion< integer >( nodeLocalToGlobal[a] ) : -1;
+  }
+
+  arrayView1d< globalIndex const > const faceLocalToGlobal = faceManager.localToGlobalMap();
+  arrayView1d< integer const > const faceGhostRank = faceManager.ghostRank();
+  for( localIndex f = 0; f < faceManager.size(); ++f )
+  {
+    faceGlobalIndex[f] = faceGhostRank[f] < 0 ? faceLocalToGlobal[f] : -1;
+  }
+
+  arrayView1d< globalIndex const > const elemLocalToGlobal = subRegion.localToGlobalMap();
+  arrayView1d< integer const > const elemGhostRank = subRegion.ghostRank();
+  localIndex numGhostElems = 0;
+  for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+  {
+    bool const isGhost = elemGhostRank[ei] >= 0;
+    numGhostElems += isGhost ? 1 : 0;
+    elemScalar[ei] = isGhost ? poisonValue : expectedValue( elemLocalToGlobal[ei] );
+    for( localIndex c = 0; c < numComponents; ++c )
+    {
+      elemVector( ei, c ) = isGhost ? poisonValue : expectedValue( elemLocalToGlobal[ei], c );
+    }
+  }
+  // make sure that the test is meaningful
+  ASSERT_GT( numGhostElems, 0 );
+
+  FieldIdentifiers fieldsToBeSync;
+  fieldsToBeSync.addFields( FieldLocation::Node, { nodeIntegerField } );
+  fieldsToBeSync.addFields( FieldLocation::Face, { faceGlobalIndexField } );
+  fieldsToBeSync.addElementFields( { elemScalarField, elemVectorField }, std::vector< string >{ "region1" } );
+  CommunicationTools::getInstance().synchronizeFields( fieldsToBeSync, mesh, domain.getNeighbors(), false );
+
+  nodeInteger.move( hostMemorySpace, false );
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    EXPECT_EQ( nodeInteger[a], nodeLocalToGlobal[a] );
+  }
+
+  faceGlobalIndex.move( hostMemorySpace, false );
+  for( localIndex f = 0; f < faceManager.size(); ++f )
+  {
+    EXPECT_EQ( faceGlobalIndex[f], faceLocalToGlobal[f] );
+  }
+
+  elemScalar.move( hostMemorySpace, false );
+  elemVector.move( hostMemorySpace, false );
+  for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+  {
+    EXPECT_EQ( elemScalar[ei], expectedValue( elemLocalToGlobal[ei] ) );
+    for( localIndex c = 0; c < numComponents; ++c )
+    {
+      EXPECT_EQ( elemVector( ei, c ), expectedValue( elemLocalToGlobal[ei], c ) );
+    }
+  }
+}
+
+TEST_F( FieldSynchronizationTest, onDeviceWithCachedPlan )
+{
+  SKIP_TEST_IN_SERIAL( "Parallel test" );
+
+  DomainPartition & domain = getGlobalState().getProblemManager().getDomainPartition();
+  MeshLevel & mesh = domain.getMeshBody( 0 ).getBaseDiscretization();
+  NodeManager & nodeManager = mesh.getNodeManager();
+  CellElementSubRegion & subRegion = mesh.getElemManager().getRegion( 0 ).getSubRegion< CellElementSubRegion >( 0 );
+
+  // real64 arrays of all the fused layouts, along with a field packed wrapper by wrapper
+  array1d< real64 > & nodeScalar = nodeManager.registerWrapper< array1d< real64 > >( "testDeviceNodeScalar" ).reference();
+  array2d< real64, RAJA::PERM_JI > & nodeVector =
+    nodeManager.registerWrapper< array2d< real64, RAJA::PERM_JI > >( "testDeviceNodeVector" ).reference();
+  array3d< real64 > & elemTensor = subRegion.registerWrapper< array3d< real64 > >( "testDeviceElemTensor" ).reference();
+  array1d< integer > & elemInteger = subRegion.registerWrapper< array1d< integer > >( "testDeviceElemInteger" ).reference();
+  nodeVector.resizeDimension< 1 >( numComponents );
+  elemTensor.resizeDimension< 1, 2 >( numComponents, 2 );
+
+  arrayView1d< globalIndex const > const nodeLocalToGlobal = nodeManager.localToGlobalMap();
+  arrayView1d< integer const > const nodeGhostRank = nodeManager.ghostRank();
+  arrayView1d< globalIndex const > const elemLocalToGlobal = subRegion.localToGlobalMap();
+  arrayView1d< integer const > const elemGhostRank = subRegion.ghostRank();
+
+  // owned objects hold their expected value (shifted by @p shift), ghosts are poisoned
+  auto initialize = [&]( real64 const shift )
+  {
+    nodeScalar.move( hostMemorySpace, true );
+    nodeVector.move( hostMemorySpace, true );
+    elemTensor.move( hostMemorySpace, true );
+    elemInteger.move( hostMemorySpace, true );
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      bool const isGhost = nodeGhostRank[a] >= 0;
+      nodeScalar[a] = isGhost ? poisonValue : expectedValue( nodeLocalToGlobal[a] ) + shift;
+      for( localIndex c = 0; c < nodeVector.size( 1 ); ++c )
+      {
+        nodeVector( a, c ) = isGhost ? poisonValue : expectedValue( nodeLocalToGlobal[a], c ) + shift;
+      }
+    }
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      bool const isGhost = elemGhostRank[ei] >= 0;
+      elemInteger[ei] = isGhost ? -1 : LvArray::integerConversion< integer >( elemLocalToGlobal[ei] );
+      for( localIndex c = 0; c < numComponents; ++c )
+      {
+        for( localIndex d = 0; d < 2; ++d )
+        {
+          elemTensor( ei, c, d ) = isGhost ? poisonValue : expectedValue( elemLocalToGlobal[ei], c + numComponents * d ) + shift;
+        }
+      }
+    }
+  };
+
+  auto check = [&]( real64 const shift )
+  {
+    nodeScalar.move( hostMemorySpace, false );
+    nodeVector.move( hostMemorySpace, false );
+    elemTensor.move( hostMemorySpace, false );
+    elemInteger.move( hostMemorySpace, false );
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      EXPECT_EQ( nodeScalar[a], expectedValue( nodeLocalToGlobal[a] ) + shift );
+      for( localIndex c = 0; c < nodeVector.size( 1 ); ++c )
+      {
+        EXPECT_EQ( nodeVector( a, c ), expectedValue( nodeLocalToGlobal[a], c ) + shift );
+      }
+    }
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      EXPECT_EQ( elemInteger[ei], elemLocalToGlobal[ei] );
+      for( localIndex c = 0; c < numComponents; ++c )
+      {
+        for( localIndex d = 0; d < 2; ++d )
+        {
+          EXPECT_EQ( elemTensor( ei, c, d ), expectedValue( elemLocalToGlobal[ei], c + numComponents * d ) + shift );
+        }
+      }
+    }
+  };
+
+  FieldIdentifiers fieldsToBeSync;
+  fieldsToBeSync.addFields( FieldLocation::Node, { "testDeviceNodeScalar", "testDeviceNodeVector" } );
+  fieldsToBeSync.addElementFields( { "testDeviceElemTensor", "testDeviceElemInteger" }, std::vector< string >{ "region1" } );
+
+  CommunicationTools & commTools = CommunicationTools::getInstance();
+  std::vector< NeighborCommunicator > & neighbors = domain.getNeighbors();
+  std::map< string, std::shared_ptr< SyncPlan const > > const & planCache = mesh.getSyncPlanCache();
+  std::size_t const numCachedPlans = planCache.size();
+
+  auto findPlan = [&]() -> SyncPlan const *
+  {
+    dataRepository::WrapperBase const * const nodeScalarWrapper = &nodeManager.getWrapperBase( "testDeviceNodeScalar" );
+    for( auto const & plan : planCache )
+    {
+      for( SyncFieldEntry const & entry : plan.second->entries )
+      {
+        if( entry.wrapper == nodeScalarWrapper )
+        {
+          return plan.second.get();
+        }
+      }
+    }
+    return nullptr;
+  };
+
+  initialize( 0.0 );
+  commTools.synchronizeFields( fieldsToBeSync, mesh, neighbors, true );
+  check( 0.0 );
+
+  // the plan of the fields is cached, and the real64 arrays are fused
+  EXPECT_EQ( planCache.size(), numCachedPlans + 1 );
+  SyncPlan const * const plan = findPlan();
+  ASSERT_NE( plan, nullptr );
+  for( SyncFieldEntry const & entry : plan->entries )
+  {
+    EXPECT_EQ( entry.fused, entry.wrapper != &subRegion.getWrapperBase( "testDeviceElemInteger" ) );
+  }
+
+  // the second synchronization of the same fields reuses the plan
+  initialize( 1.0 );
+  commTools.synchronizeFields( fieldsToBeSync, mesh, neighbors, true );
+  check( 1.0 );
+  EXPECT_EQ( planCache.size(), numCachedPlans + 1 );
+  EXPECT_EQ( findPlan(), plan );
+
+  // a change of the number of components changes the buffer layout, and the plan is rebuilt
+  nodeVector.resizeDimension< 1 >( numComponents + 1 );
+  initialize( 2.0 );
+  commTools.synchronizeFields( fieldsToBeSync, mesh, neighbors, true );
+  check( 2.0 );
+  EXPECT_EQ( planCache.size(), numCachedPlans + 1 );
+
+  // the host path gives the same result with the cached plan
+  initialize( 3.0 );
+  commTools.synchronizeFields( fieldsToBeSync, mesh, neighbors, false );
+  check( 3.0 );
+}
+
+TEST_F( FieldSynchronizationTest, deferredSynchronizationOfShallowLevels )
+{
+  SKIP_TEST_IN_SERIAL( "Parallel test" );
+
+  DomainPartition & domain = getGlobalState().getProblemManager().getDomainPartition();
+  MeshBody & meshBody = domain.getMeshBody( 0 );
+  MeshLevel & baseMesh = meshBody.getBaseDiscretization();
+
+  // two solvers using different discretizations of the same mesh body, e.g. a finite element and a finite volume solver
+  MeshLevel & feMesh = meshBody.createShallowMeshLevel( baseMesh.getName(), "shallowLevelFE" );
+  MeshLevel & fvMesh = meshBody.createShallowMeshLevel( baseMesh.getName(), "shallowLevelFV" );
+
+  NodeManager & nodeManager = feMesh.getNodeManager();
+  CellElementSubRegion & subRegion = fvMesh.getElemManager().getRegion( 0 ).getSubRegion< CellElementSubRegion >( 0 );
+
+  array1d< real64 > & nodeField = nodeManager.registerWrapper< array1d< real64 > >( "testDeferredNode" ).reference();
+  array1d< real64 > & elemField = subRegion.registerWrapper< array1d< real64 > >( "testDeferredElem" ).reference();
+
+  arrayView1d< globalIndex const > const nodeLocalToGlobal = nodeManager.localToGlobalMap();
+  arrayView1d< integer const > const nodeGhostRank = nodeManager.ghostRank();
+  arrayView1d< globalIndex const > const elemLocalToGlobal = subRegion.localToGlobalMap();
+  arrayView1d< integer const > const elemGhostRank = subRegion.ghostRank();
+
+  auto initialize = [&]()
+  {
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      nodeField[a] = nodeGhostRank[a] < 0 ? expectedValue( nodeLocalToGlobal[a] ) : poisonValue;
+    }
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      elemField[ei] = elemGhostRank[ei] < 0 ? expectedValue( elemLocalToGlobal[ei] ) : poisonValue;
+    }
+  };
+
+  auto checkGhosts = [&]( bool const synchronized )
+  {
+    nodeField.move( hostMemorySpace, false );
+    elemField.move( hostMemorySpace, false );
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      real64 const expected = ( synchronized || nodeGhostRank[a] < 0 ) ? expectedValue( nodeLocalToGlobal[a] ) : poisonValue;
+      EXPECT_EQ( nodeField[a], expected );
+    }
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      real64 const expected = ( synchronized || elemGhostRank[ei] < 0 ) ? expectedValue( elemLocalToGlobal[ei] ) : poisonValue;
+      EXPECT_EQ( elemField[ei], expected );
+    }
+  };
+
+  FieldIdentifiers nodeFields;
+  nodeFields.addFields( FieldLocation::Node, { "testDeferredNode" } );
+  FieldIdentifiers elemFields;
+  elemFields.addElementFields( { "testDeferredElem" }, std::vector< string >{ "region1" } );
+
+  CommunicationTools & commTools = CommunicationTools::getInstance();
+  std::vector< NeighborCommunicator > & neighbors = domain.getNeighbors();
+
+  // the synchronizations requested on the two levels are merged in a single exchange
+  initialize();
+  {
+    DeferredSynchronization deferredSync;
+    commTools.synchronizeFields( nodeFields, feMesh, neighbors, false );
+    commTools.synchronizeFields( elemFields, fvMesh, neighbors, false );
+    EXPECT_EQ( commTools.numPendingSynchronizations(), 1 );
+    checkGhosts( false );
+    deferredSync.flush();
+  }
+  EXPECT_EQ( commTools.numPendingSynchronizations(), 0 );
+  checkGhosts( true );
+
+  // a deferral unwound by an exception drops the pending fields without communicating
+  initialize();
+  try
+  {
+    DeferredSynchronization deferredSync;
+    commTools.synchronizeFields( nodeFields, feMesh, neighbors, false );
+    commTools.synchronizeFields( elemFields, fvMesh, neighbors, false );
+    throw std::runtime_error( "unwinding" );
+  }
+  catch( std::runtime_error const & )
+  {}
+  EXPECT_EQ( commTools.numPendingSynchronizations(), 0 );
+  checkGhosts( false );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+
+  GeosxState state( geos::basicSetup( argc, argv ) );
+
+  int const result = RUN_ALL_TESTS();
+
+  geos::basicCleanup();
+
+  return result;
+}
@@ -21,6 +21,7 @@
 #include "mesh/MeshManager.hpp"
 #include "mesh/generators/CellBlockManagerABC.hpp"
 #include "mesh/generators/CellBlockABC.hpp"
+#include "mesh/generators/VTKParallelReader.hpp"
 
 // special CMake-generated include
 #include "tests/meshDirName.hpp"
@@ -33,11 +34,14 @@
 #include <vtkPoints.h>
 #include <vtkUnstructuredGrid.h>
 #include <vtkXMLMultiBlockDataWriter.h>
+#include <vtkXMLUnstructuredGridReader.h>
+#include <vtkXMLUnstructuredGridWriter.h>
 
 #include <gtest/gtest.h>
 #include <conduit.hpp>
 
 #include <filesystem>
+#include <stdlib.h>
 
 
 using namespace geos;
@@ -46,7 +50,7 @@ using namespace geos::dataRepository;
 
 
 template< class V >
-void TestMeshImport( string const & meshFilePath, V const & validate, string const fractureName="" )
+void TestMeshImport( string const & meshFilePath, V const & validate, string const fractureName="", string const & extraAttributes="" )
 {
   string const pattern = R"xml(
     <Mesh>
@@ -55,10 +59,10 @@ void TestMeshImport( string const & meshFilePath, V const & validate, string con
         file="{}"
         partitionRefinement="0"
         useGlobalIds="0"
-        {} />
+        {} {} />
     </Mesh>
   )xml";
-  string const meshNode = GEOS_FMT( pattern, meshFilePath, fractureName.empty() ? "" : "faceBlocks=\"{" + fractureName + "}\"" );
+  string const meshNode = GEOS_FMT( pattern, meshFilePath, fractureName.empty() ? "" : "faceBlocks=\"{" + fractureName + "}\"", extraAttributes );
   xmlWrapper::xmlDocument xmlDocument;
   xmlDocument.loadString( meshNode );
   xmlWrapper::xmlNode xmlMeshNode = xmlDocument.getChild( "Mesh" );
@@ -77,6 +81,37 @@ void TestMeshImport( string const & meshFilePath, V const & validate, string con
   validate( domain.getMeshBody( "mesh" ).getGroup< CellBlockManagerABC >( keys::cellManager ) );
 }
 
+/**
+ * @brief Creates an empty directory, unique to this run of the test, shared by all the ranks.
+ * @param prefix prefix of the name of the directory
+ * @return the path of the directory
+ */
+std::filesystem::path makeTemporaryDirectory( string const & prefix )
+{
+  // The name is chosen by the first rank, so that concurrent runs of the test do not share their files
+  string path;
+  if( MpiWrapper::commRank() == 0 )
+  {
+    path = ( std::filesystem::temp_directory_path() / ( prefix + "_XXXXXX" ) ).string();
+    GEOS_ERROR_IF( mkdtemp( path.data() ) == nullptr, "Could not create a temporary directory from " << path );
+  }
+  MpiWrapper::broadcast( path );
+  return path;
+}
+
+/**
+ * @brief Removes a directory created by makeTemporaryDirectory, once all the ranks are done with it.
+ * @param path the path of the directory
+ */
+void removeTemporaryDirectory( std::filesystem::path const & path )
+{
+  MpiWrapper::barrier();
+  if( MpiWrapper::commRank() == 0 )
+  {
+    std::filesystem::remove_all( path );
+  }
+}
+
 
 class TestFractureImport : public ::testing::Test
 {
@@ -302,106 +337,107 @@ TEST_F( TestFractureImport, fracture )
 }
 
 
-TEST( VTKImport, cube )
+/// Validates the import of `cube.*`, whatever the format of the file
+void validateCube( CellBlockManagerABC const & cellBlockManager )
 {
-  auto validate = []( CellBlockManagerABC const & cellBlockManager ) -> void
+  // `cube.vtk` is a cube made by 3 x 3 x 3 = 27 Hexahedron 3d-elements.
+  // It contains 4 x 4 x 4 = 64 nodes.
+  // On each face of the cube, you have 3 x 3 quad faces. Hence 9 x 6 = 54 quad 2d-elements.
+  // On each edge of the cube, you have 3 Line elements. Hence 3 x 12 = 36 line 1d-elements.
+  // On each vertex of the cube you have on Vertex element. Hence 8 Vertex 0d-cells.
+
+  // The `cube.vtk` mesh contains an "attribute" field that is used to group cells together.
+  // A region with id `-1` is considered as a non region.
+  // For testing purpose, the "attribute" field was designed such that
+  // - All 36 `Line` elements are in "region" 1 except the last two in regions -1 and 9.
+  // - All 36 `Quad` elements are in "region" 2 except 4.
+  //   Counting backwards from the end, quads number 0, 1, 3 and 4 with respectively regions 9 and -1, -1, -1.
+  //   Those quads were selected such that they form a larger square, excluding the central node (number 55) from the region 2.
+  //   This should appear in the test.
+  // - All 36 `Hexahedron` elements are in "region" 3 except the last two in regions -1 and 9.
+  // - All 36 `Vertex` elements are in "region" 4 except the last two in regions -1 and 9.
+
+  // When run in parallel with two MPI ranks, the central hexahedra are on the splitting boundary.
+  // The VTK default pattern is to assign the cell to one unique rank.
+  // For example, if it happens to be the first one:
+  // - rank 0 (lower `x`) gets 18 hexaedra and 48 nodes,
+  // - rank 1 (greater `x`) gets 9 hexahedra and 32 nodes.
+
+  // This pattern could be influenced by settings the parameters of
+  // vtkRedistributeDataSetFilter::SetBoundaryMode(...) to
+  // ASSIGN_TO_ALL_INTERSECTING_REGIONS, ASSIGN_TO_ONE_REGION or SPLIT_BOUNDARY_CELLS.
+  localIndex const expectedNumNodesRank1 = expected( 64, { 48, 32 } );
+  localIndex const expectedNumNodesRank2 = expected( 64, { 32, 48 } );
+  bool rankswap = cellBlockManager.numNodes() == expectedNumNodesRank2;
+  localIndex const expectedNumNodes = rankswap ? expectedNumNodesRank2 : expectedNumNodesRank1;
+  auto expectedSwap = [=] ( int seq, std::initializer_list< int > par )
   {
-    // `cube.vtk` is a cube made by 3 x 3 x 3 = 27 Hexahedron 3d-elements.
-    // It contains 4 x 4 x 4 = 64 nodes.
-    // On each face of the cube, you have 3 x 3 quad faces. Hence 9 x 6 = 54 quad 2d-elements.
-    // On each edge of the cube, you have 3 Line elements. Hence 3 x 12 = 36 line 1d-elements.
-    // On each vertex of the cube you have on Vertex element. Hence 8 Vertex 0d-cells.
-
-    // The `cube.vtk` mesh contains an "attribute" field that is used to group cells together.
-    // A region with id `-1` is considered as a non region.
-    // For testing purpose, the "attribute" field was designed such that
-    // - All 36 `Line` elements are in "region" 1 except the last two in regions -1 and 9.
-    // - All 36 `Quad` elements are in "region" 2 except 4.
-    //   Counting backwards from the end, quads number 0, 1, 3 and 4 with respectively regions 9 and -1, -1, -1.
-    //   Those quads were selected such that they form a larger square, excluding the central node (number 55) from the region 2.
-    //   This should appear in the test.
-    // - All 36 `Hexahedron` elements are in "region" 3 except the last two in regions -1 and 9.
-    // - All 36 `Vertex` elements are in "region" 4 except the last two in regions -1 and 9.
-
-    // When run in parallel with two MPI ranks, the central hexahedra are on the splitting boundary.
-    // The VTK default pattern is to assign the cell to one unique rank.
-    // For example, if it happens to be the first one:
-    // - rank 0 (lower `x`) gets 18 hexaedra and 48 nodes,
-    // - rank 1 (greater `x`) gets 9 hexahedra and 32 nodes.
-
-    // This pattern could be influenced by settings the parameters of
-    // vtkRedistributeDataSetFilter::SetBoundaryMode(...) to
-    // ASSIGN_TO_ALL_INTERSECTING_REGIONS, ASSIGN_TO_ONE_REGION or SPLIT_BOUNDARY_CELLS.
-    localIndex const expectedNumNodesRank1 = expected( 64, { 48, 32 } );
-    localIndex const expectedNumNodesRank2 = expected( 64, { 32, 48 } );
-    bool rankswap = cellBlockManager.numNodes() == expectedNumNodesRank2;
-    localIndex const expectedNumNodes = rankswap ? expectedNumNodesRank2 : expectedNumNodesRank1;
-    auto expectedSwap = [=] ( int seq, std::initializer_list< int > par )
-    {
-      std::vector< int > tmp( par );
-      if( rankswap )
-        return expected( seq, { tmp[1], tmp[0] } );
-      else
-        return expected( seq, par );
-    };
+    std::vector< int > tmp( par );
+    if( rankswap )
+      return expected( seq, { tmp[1], tmp[0] } );
+    else
+      return expected( seq, par );
+  };
 
-    ASSERT_EQ( cellBlockManager.numNodes(), expectedNumNodes );
-    ASSERT_EQ( cellBlockManager.numEdges(), expectedSwap( 144, { 104, 64 } ) );
-    ASSERT_EQ( cellBlockManager.numFaces(), expectedSwap( 108, { 75, 42 } ) );
+  ASSERT_EQ( cellBlockManager.numNodes(), expectedNumNodes );
+  ASSERT_EQ( cellBlockManager.numEdges(), expectedSwap( 144, { 104, 64 } ) );
+  ASSERT_EQ( cellBlockManager.numFaces(), expectedSwap( 108, { 75, 42 } ) );
 
-    // The information in the tables is not filled yet. We can check the consistency of the sizes.
-    ASSERT_EQ( cellBlockManager.getNodeToFaces().size(), expectedNumNodes );
-    ASSERT_EQ( cellBlockManager.getNodeToElements().toCellIndex.size(), expectedNumNodes );
+  // The information in the tables is not filled yet. We can check the consistency of the sizes.
+  ASSERT_EQ( cellBlockManager.getNodeToFaces().size(), expectedNumNodes );
+  ASSERT_EQ( cellBlockManager.getNodeToElements().toCellIndex.size(), expectedNumNodes );
 
-    // We have all the 4 x 4  x 4 = 64 nodes in the "all" set.
-    SortedArray< localIndex > const & allNodes = cellBlockManager.getNodeSets().at( "all" );
-    ASSERT_EQ( allNodes.size(), expectedNumNodes );
+  // We have all the 4 x 4  x 4 = 64 nodes in the "all" set.
+  SortedArray< localIndex > const & allNodes = cellBlockManager.getNodeSets().at( "all" );
+  ASSERT_EQ( allNodes.size(), expectedNumNodes );
+
+  if( cellBlockManager.getNodeSets().size()>1 )
+  {
+    // The "2" set are all the boundary nodes (64 - 8 inside nodes = 56),
+    // minus an extra node that belongs to regions -1 and 9 only.
+    SortedArray< localIndex > const & nodesRegion2 = cellBlockManager.getNodeSets().at( "2" );
+    ASSERT_EQ( nodesRegion2.size(), expectedSwap( 55, { 39, 27 } ) );
 
-    if( cellBlockManager.getNodeSets().size()>1 )
+    // Region "9" has only one quad, on the greater `x` direction.
+    // This hex will belong to MPI rank 1.
+    SortedArray< localIndex > const & nodesRegion9 = cellBlockManager.getNodeSets().at( "9" );
+    ASSERT_EQ( nodesRegion9.size(), expectedSwap( 4, { 0, 4 } ) );
+
+    // FIXME How to get the CellBlock as a function of the region, without knowing the naming pattern.
+    // 1 elements type on 3 regions ("-1", "3", "9") = 3 sub-groups
+    std::array< std::pair< string, int >, 3 > const expectedCellBlocks =
     {
-      // The "2" set are all the boundary nodes (64 - 8 inside nodes = 56),
-      // minus an extra node that belongs to regions -1 and 9 only.
-      SortedArray< localIndex > const & nodesRegion2 = cellBlockManager.getNodeSets().at( "2" );
-      ASSERT_EQ( nodesRegion2.size(), expectedSwap( 55, { 39, 27 } ) );
-
-      // Region "9" has only one quad, on the greater `x` direction.
-      // This hex will belong to MPI rank 1.
-      SortedArray< localIndex > const & nodesRegion9 = cellBlockManager.getNodeSets().at( "9" );
-      ASSERT_EQ( nodesRegion9.size(), expectedSwap( 4, { 0, 4 } ) );
-
-      // FIXME How to get the CellBlock as a function of the region, without knowing the naming pattern.
-      // 1 elements type on 3 regions ("-1", "3", "9") = 3 sub-groups
-      std::array< std::pair< string, int >, 3 > const expectedCellBlocks =
       {
-        {
-          { "hexahedra", expectedSwap( 1, {  1, 0 } ) },
-          { "3_hexahedra", expectedSwap( 25, { 17, 8 } ) },
-          { "9_hexahedra", expectedSwap( 1, {  0, 1 } ) }
-        }
-      };
-      ASSERT_EQ( cellBlockManager.getCellBlocks().numSubGroups(), expectedCellBlocks.size() );
+        { "hexahedra", expectedSwap( 1, {  1, 0 } ) },
+        { "3_hexahedra", expectedSwap( 25, { 17, 8 } ) },
+        { "9_hexahedra", expectedSwap( 1, {  0, 1 } ) }
+      }
+    };
+    ASSERT_EQ( cellBlockManager.getCellBlocks().numSubGroups(), expectedCellBlocks.size() );
 
-      for( const auto & nameAndSize : expectedCellBlocks )
-      {
-        ASSERT_TRUE( cellBlockManager.getCellBlocks().hasGroup< CellBlockABC >( nameAndSize.first ) );
+    for( const auto & nameAndSize : expectedCellBlocks )
+    {
+      ASSERT_TRUE( cellBlockManager.getCellBlocks().hasGroup< CellBlockABC >( nameAndSize.first ) );
 
-        // here pb
-        CellBlockABC const * h = &cellBlockManager.getCellBlocks().getGroup< CellBlockABC >( nameAndSize.first );
-        localIndex const expectedSize = nameAndSize.second;
+      // here pb
+      CellBlockABC const * h = &cellBlockManager.getCellBlocks().getGroup< CellBlockABC >( nameAndSize.first );
+      localIndex const expectedSize = nameAndSize.second;
 
-        // 8 nodes, 12 edges and 6 faces per hex.
-        ASSERT_EQ( h->getElemToNodes().size( 1 ), 8 );
-        ASSERT_EQ( h->getElemToEdges().size( 1 ), 12 );
-        ASSERT_EQ( h->getElemToFaces().size( 1 ), 6 );
+      // 8 nodes, 12 edges and 6 faces per hex.
+      ASSERT_EQ( h->getElemToNodes().size( 1 ), 8 );
+      ASSERT_EQ( h->getElemToEdges().size( 1 ), 12 );
+      ASSERT_EQ( h->getElemToFaces().size( 1 ), 6 );
 
-        ASSERT_EQ( h->size(), expectedSize );
-        ASSERT_EQ( h->getElemToNodes().size( 0 ), expectedSize );
-        ASSERT_EQ( h->getElemToEdges().size( 0 ), expectedSize );
-        ASSERT_EQ( h->getElemToFaces().size( 0 ), expectedSize );
-      }
+      ASSERT_EQ( h->size(), expectedSize );
+      ASSERT_EQ( h->getElemToNodes().size( 0 ), expectedSize );
+      ASSERT_EQ( h->getElemToEdges().size( 0 ), expectedSize );
+      ASSERT_EQ( h->getElemToFaces().size( 0 ), expectedSize );
     }
-  };
+  }
+}
 
+TEST( VTKImport, cube )
+{
   std::set< string > const meshFiles{ "cube.vtk",
                                       "cube_STRUCTURED_POINTS.vtk",
                                       "cube_RECTILINEAR_GRID.vtk",
@@ -417,9 +453,128 @@ TEST( VTKImport, cube )
                                       "cube.pvti" };
   for( string const & meshFile: meshFiles )
   {
-    TestMeshImport( testMeshDir + "/" + meshFile, validate );
+    TestMeshImport( testMeshDir + "/" + meshFile, validateCube );
+  }
+}
+
+TEST( VTKImport, storedPartition )
+{
+  // The partitioned mesh is stored by the first import, and loaded by the second one
+  std::filesystem::path const partitionDir = makeTemporaryDirectory( "cubePartition" );
+  string const partitionAttribute = GEOS_FMT( "partitionedMeshDirectory=\"{}\" logLevel=\"2\"", partitionDir.string() );
+
+  // The node positions of each rank are recorded to check that the cell ownership is reused.
+  auto validateAndRecordNodes = [&]( std::vector< real64 > & recordedNodes )
+  {
+    return [&recordedNodes]( CellBlockManagerABC const & cellBlockManager ) -> void
+    {
+      validateCube( cellBlockManager );
+      array2d< real64, nodes::REFERENCE_POSITION_PERM > const nodePositions = cellBlockManager.getNodePositions();
+      recordedNodes.assign( nodePositions.data(), nodePositions.data() + nodePositions.size() );
+    };
+  };
+
+  std::vector< real64 > storedNodes;
+  testing::internal::CaptureStdout();
+  TestMeshImport( testMeshDir + "/cube.vtu", validateAndRecordNodes( storedNodes ), "", partitionAttribute );
+  string const storeLog = testing::internal::GetCapturedStdout();
+  EXPECT_TRUE( std::filesystem::exists( partitionDir / "partition.txt" ) );
+
+  std::vector< real64 > loadedNodes;
+  testing::internal::CaptureStdout();
+  TestMeshImport( testMeshDir + "/cube.vtu", validateAndRecordNodes( loadedNodes ), "", partitionAttribute );
+  string const loadLog = testing::internal::GetCapturedStdout();
+
+  // The second import loads the stored partition, and neither reads the dataset nor redistributes it.
+  if( MpiWrapper::commRank() == 0 )
+  {
+    EXPECT_NE( storeLog.find( "writing partitioned mesh" ), string::npos );
+    EXPECT_NE( loadLog.find( "loaded partitioned mesh from" ), string::npos );
+    EXPECT_EQ( loadLog.find( "reading the dataset" ), string::npos );
+    EXPECT_EQ( loadLog.find( "redistributing mesh" ), string::npos );
+  }
+  EXPECT_EQ( storedNodes, loadedNodes );
+
+  removeTemporaryDirectory( partitionDir );
+}
+
+TEST( VTKImport, parallelRead )
+{
+  // The parallel read needs raw appended data, so `cube.vtu` (ascii) is converted first.
+  std::filesystem::path const rawCubeDir = makeTemporaryDirectory( "cubeRawAppended" );
+  std::filesystem::path const rawCubeFile = rawCubeDir / "cube_rawAppended.vtu";
+  if( MpiWrapper::commRank() == 0 )
+  {
+    vtkNew< vtkXMLUnstructuredGridReader > reader;
+    reader->SetFileName( ( testMeshDir + "/cube.vtu" ).c_str() );
+    reader->Update();
+
+    vtkNew< vtkXMLUnstructuredGridWriter > writer;
+    writer->SetFileName( rawCubeFile.c_str() );
+    writer->SetInputData( reader->GetOutput() );
+    writer->SetDataModeToAppended();
+    writer->EncodeAppendedDataOff();
+    writer->SetCompressorTypeToNone();
+    writer->Write();
   }
+  MpiWrapper::barrier();
+
+  // Make sure the file is actually read by cell ranges, and not by the single-rank fallback.
+  vtkSmartPointer< vtkUnstructuredGrid > const localCells = vtk::readUnstructuredGridInParallel( rawCubeFile.string(), MPI_COMM_GEOSX );
+  ASSERT_NE( localCells, nullptr );
+  EXPECT_GT( localCells->GetNumberOfCells(), 0 );
+  EXPECT_EQ( MpiWrapper::sum( localCells->GetNumberOfCells() ), 27 );
+
+  // Global summary of the imported mesh, independent of the partitioning:
+  // the number of cells of each cell block, and the nodes of each node set.
+  using Summary = std::map< string, std::vector< int > >;
+  auto summarize = []( Summary & summary )
+  {
+    return [&summary]( CellBlockManagerABC const & cellBlockManager ) -> void
+    {
+      // Fixed lists of names are used, since the reductions must be called by all the ranks.
+      for( string const & cellBlockName : { "hexahedra", "3_hexahedra", "9_hexahedra" } )
+      {
+        Group const & cellBlocks = cellBlockManager.getCellBlocks();
+        localIndex const numCells = cellBlocks.hasGroup( cellBlockName ) ? cellBlocks.getGroup< CellBlockABC >( cellBlockName ).size() : 0;
+        summary[cellBlockName] = { static_cast< int >( MpiWrapper::sum( numCells ) ) };
+      }
+
+      // The global ids are generated differently by the two reads, but the nodes of the cube have integer coordinates.
+      array2d< real64, nodes::REFERENCE_POSITION_PERM > const nodePositions = cellBlockManager.getNodePositions();
+      for( string const & setName : { "all", "2", "9" } )
+      {
+        std::vector< int > isInSet( 64, 0 );
+        auto const nameAndSet = cellBlockManager.getNodeSets().find( setName );
+        if( nameAndSet != cellBlockManager.getNodeSets().end() )
+        {
+          for( localIndex const node : nameAndSet->second )
+          {
+            int const i = std::lround( nodePositions( node, 0 ) );
+            int const j = std::lround( nodePositions( node, 1 ) );
+            int const k = std::lround( nodePositions( node, 2 ) );
+            isInSet[ i + 4 * j + 16 * k ] = 1;
+          }
+        }
+        std::vector< int > & globalIsInSet = summary["nodes_" + setName];
+        globalIsInSet.resize( isInSet.size() );
+        MpiWrapper::allReduce( isInSet.data(), globalIsInSet.data(), LvArray::integerConversion< int >( isInSet.size() ), MPI_MAX, MPI_COMM_GEOSX );
+      }
+    };
+  };
+
+  Summary serialSummary;
+  TestMeshImport( rawCubeFile.string(), summarize( serialSummary ) );
+  Summary parallelSummary;
+  TestMeshImport( rawCubeFile.string(), summarize( parallelSummary ), "", "parallelRead=\"1\"" );
+
+  EXPECT_EQ( serialSummary, parallelSummary );
+  ASSERT_EQ( parallelSummary.count( "nodes_all" ), 1 );
+  EXPECT_EQ( std::count( parallelSummary["nodes_all"].begin(), parallelSummary["nodes_all"].end(), 1 ), 64 );
+  ASSERT_EQ( parallelSummary.count( "3_hexahedra" ), 1 );
+  EXPECT_EQ( parallelSummary["3_hexahedra"][0], 25 );
 
+  removeTemporaryDirectory( rawCubeDir );
 }
 
 TEST( VTKImport, supportedElements )
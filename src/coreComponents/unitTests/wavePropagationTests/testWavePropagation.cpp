@@ -250,6 +250,222 @@ TEST_F( AcousticWaveEquationSEMTest, SeismoTrace )
   }
 }
 
+// This unit test checks the time decimation of the fields saved during forward to compute the gradient during backward.
+// The marker is replaced by the number of cycles between two saved fields.
+char const * gradientXmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <AcousticSEM
+        name="acousticSolver"
+        cflFactor="0.25"
+        discretization="FE1"
+        targetRegions="{ Region }"
+        sourceCoordinates="{ { 25, 50, 50 } }"
+        timeSourceFrequency="15"
+        receiverCoordinates="{ { 75, 50, 50 } }"
+        outputSeismoTrace="0"
+        dtSeismoTrace="0.01"
+        saveFieldsDecimation="DECIMATION"/>
+    </Solvers>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ 0, 100 }"
+        yCoords="{ 0, 100 }"
+        zCoords="{ 0, 100 }"
+        nx="{ 10 }"
+        ny="{ 10 }"
+        nz="{ 10 }"
+        cellBlockNames="{ cb }"/>
+    </Mesh>
+    <Events
+      maxTime="0.2">
+      <PeriodicEvent
+        name="solverApplications"
+        forceDt="0.002"
+        target="/Solvers/acousticSolver"/>
+    </Events>
+    <NumericalMethods>
+      <FiniteElements>
+        <FiniteElementSpace
+          name="FE1"
+          order="1"
+          formulation="SEM"/>
+      </FiniteElements>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Region"
+        cellBlocks="{ cb }"
+        materialList="{ nullModel }"/>
+    </ElementRegions>
+    <Constitutive>
+      <NullModel
+        name="nullModel"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="initialPressureN"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="pressure_n"
+        scale="0.0"/>
+      <FieldSpecification
+        name="initialPressureNm1"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="pressure_nm1"
+        scale="0.0"/>
+      <FieldSpecification
+        name="cellVelocity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="mediumVelocity"
+        scale="1500"
+        setNames="{ all }"/>
+      <FieldSpecification
+        name="cellDensity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="mediumDensity"
+        scale="1"
+        setNames="{ all }"/>
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+// The last forward cycle (99) is not a multiple of the decimation of the test, so that it is saved on its own
+real64 constexpr gradientDt = 0.002;
+integer constexpr gradientNumCycles = 100;
+
+struct GradientResult
+{
+  /// Partial gradient computed by the solver
+  array1d< real32 > gradient;
+
+  /// Partial gradient accumulated in the test with the fields of every forward cycle
+  array1d< real32 > reference;
+};
+
+GradientResult computeGradient( integer const decimation )
+{
+  string input = gradientXmlInput;
+  string const marker = "DECIMATION";
+  input.replace( input.find( marker ), marker.size(), std::to_string( decimation ) );
+
+  GeosxState state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), input.c_str() );
+
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  AcousticWaveEquationSEM & propagator =
+    state.getProblemManager().getPhysicsSolverManager().getGroup< AcousticWaveEquationSEM >( "acousticSolver" );
+
+  MeshLevel & mesh = domain.getMeshBody( 0 ).getBaseDiscretization();
+  NodeManager & nodeManager = mesh.getNodeManager();
+  CellElementSubRegion & subRegion = mesh.getElemManager().getRegion( "Region" ).getSubRegion< CellElementSubRegion >( "cb" );
+  localIndex const numNodes = nodeManager.size();
+
+  arrayView1d< real32 const > const p_nm1 = nodeManager.getField< fields::Pressure_nm1 >();
+  arrayView1d< real32 const > const p_n = nodeManager.getField< fields::Pressure_n >();
+
+  // forward: the second time derivative of the pressure is computed by the test at every cycle, as done by the solver
+  std::vector< array1d< real32 > > pressureDt2( gradientNumCycles );
+  array1d< real32 > pressureN( numNodes );
+  array1d< real32 > pressureNm1( numNodes );
+  for( integer cycle = 0; cycle < gradientNumCycles; ++cycle )
+  {
+    p_n.move( hostMemorySpace, false );
+    p_nm1.move( hostMemorySpace, false );
+    for( localIndex a = 0; a < numNodes; ++a )
+    {
+      pressureN[a] = p_n[a];
+      pressureNm1[a] = p_nm1[a];
+    }
+
+    propagator.explicitStepForward( cycle * gradientDt, gradientDt, cycle, domain, true );
+
+    // after the step, p_n holds the pressure at the end of the cycle
+    p_n.move( hostMemorySpace, false );
+    pressureDt2[cycle].resize( numNodes );
+    for( localIndex a = 0; a < numNodes; ++a )
+    {
+      pressureDt2[cycle][a] = (p_n[a] - 2*pressureN[a] + pressureNm1[a])/(gradientDt*gradientDt);
+    }
+  }
+
+  // backward: the reference gradient is accumulated with the same expression as the solver, before each step
+  arrayView1d< real32 const > const mass = nodeManager.getField< fields::MassVector >();
+  arrayView1d< real32 const > const velocity = subRegion.getField< fields::MediumVelocity >();
+  arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = subRegion.nodeList().toViewConst();
+  GradientResult result;
+  result.reference.resize( subRegion.size() );
+  for( integer cycle = gradientNumCycles - 1; cycle >= 0; --cycle )
+  {
+    p_n.move( hostMemorySpace, false );
+    mass.move( hostMemorySpace, false );
+    velocity.move( hostMemorySpace, false );
+    for( localIndex eltIdx = 0; eltIdx < subRegion.size(); ++eltIdx )
+    {
+      for( localIndex i = 0; i < 8; ++i )
+      {
+        localIndex const nodeIdx = elemsToNodes[eltIdx][i];
+        result.reference[eltIdx] += (-2/velocity[eltIdx]) * mass[nodeIdx]/8.0 * (pressureDt2[cycle][nodeIdx] * p_n[nodeIdx]);
+      }
+    }
+
+    propagator.explicitStepBackward( cycle * gradientDt, gradientDt, cycle, domain, true );
+  }
+
+  arrayView1d< real32 const > const grad = subRegion.getField< fields::PartialGradient >();
+  grad.move( hostMemorySpace, false );
+  result.gradient.resize( subRegion.size() );
+  for( localIndex eltIdx = 0; eltIdx < subRegion.size(); ++eltIdx )
+  {
+    result.gradient[eltIdx] = grad[eltIdx];
+  }
+  return result;
+}
+
+TEST( AcousticWaveEquationSEMGradient, saveFieldsDecimationOne )
+{
+  GradientResult const result = computeGradient( 1 );
+
+  // all the fields are saved, so that the gradient is the same as the one accumulated at every cycle
+  real64 maxGradient = 0.0;
+  for( localIndex eltIdx = 0; eltIdx < result.reference.size(); ++eltIdx )
+  {
+    maxGradient = LvArray::math::max( maxGradient, LvArray::math::abs( static_cast< real64 >( result.reference[eltIdx] ) ) );
+#if defined( GEOS_USE_DEVICE )
+    // the device kernel may contract the multiply-adds differently
+    EXPECT_FLOAT_EQ( result.gradient[eltIdx], result.reference[eltIdx] ) << "cell " << eltIdx;
+#else
+    EXPECT_EQ( result.gradient[eltIdx], result.reference[eltIdx] ) << "cell " << eltIdx;
+#endif
+  }
+  ASSERT_GT( maxGradient, 0.0 );
+}
+
+TEST( AcousticWaveEquationSEMGradient, saveFieldsDecimationTwo )
+{
+  GradientResult const result = computeGradient( 2 );
+
+  // the saved fields are interpolated in time between every other cycle (and the last cycle), with an error in dt^2
+  real64 maxGradient = 0.0;
+  for( localIndex eltIdx = 0; eltIdx < result.reference.size(); ++eltIdx )
+  {
+    maxGradient = LvArray::math::max( maxGradient, LvArray::math::abs( static_cast< real64 >( result.reference[eltIdx] ) ) );
+  }
+  ASSERT_GT( maxGradient, 0.0 );
+  for( localIndex eltIdx = 0; eltIdx < result.reference.size(); ++eltIdx )
+  {
+    EXPECT_NEAR( result.gradient[eltIdx], result.reference[eltIdx], 5e-2 * maxGradient ) << "cell " << eltIdx;
+  }
+}
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
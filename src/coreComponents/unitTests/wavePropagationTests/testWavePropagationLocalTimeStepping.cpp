@@ -0,0 +1,358 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "unitTests/wavePropagationTests/testWavePropagationUtils.hpp"
+
+#include "mainInterface/initialization.hpp"
+#include "physicsSolvers/wavePropagation/WaveSolverBase.hpp"
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// This unit test compares the traces computed with the multirate local time stepping to the ones of a global time step.
+// The markers are replaced by the mesh coordinates and the maximum local time stepping level of each case.
+char const * acousticXmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <AcousticSEM
+        name="acousticSolver"
+        cflFactor="0.25"
+        discretization="FE1"
+        targetRegions="{ Region }"
+        sourceCoordinates="{ { 25, 50, 50 } }"
+        timeSourceFrequency="15"
+        receiverCoordinates="{ { 15, 50, 50 }, { 45, 50, 50 }, { 80, 50, 50 } }"
+        outputSeismoTrace="0"
+        dtSeismoTrace="0.01"
+        maxLocalTimeSteppingLevel="MAX_LEVEL"/>
+    </Solvers>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ X_COORDS }"
+        yCoords="{ 0, 100 }"
+        zCoords="{ 0, 100 }"
+        nx="{ NX }"
+        ny="{ 10 }"
+        nz="{ 10 }"
+        cellBlockNames="{ cb }"/>
+    </Mesh>
+    <Events
+      maxTime="0.2">
+      <PeriodicEvent
+        name="solverApplications"
+        forceDt="0.002"
+        target="/Solvers/acousticSolver"/>
+    </Events>
+    <NumericalMethods>
+      <FiniteElements>
+        <FiniteElementSpace
+          name="FE1"
+          order="1"
+          formulation="SEM"/>
+      </FiniteElements>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Region"
+        cellBlocks="{ cb }"
+        materialList="{ nullModel }"/>
+    </ElementRegions>
+    <Constitutive>
+      <NullModel
+        name="nullModel"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="initialPressureN"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="pressure_n"
+        scale="0.0"/>
+      <FieldSpecification
+        name="initialPressureNm1"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="pressure_nm1"
+        scale="0.0"/>
+      <FieldSpecification
+        name="cellVelocity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="mediumVelocity"
+        scale="1500"
+        setNames="{ all }"/>
+      <FieldSpecification
+        name="cellDensity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="mediumDensity"
+        scale="1"
+        setNames="{ all }"/>
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+char const * elasticXmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <ElasticSEM
+        name="elasticSolver"
+        cflFactor="0.25"
+        discretization="FE1"
+        targetRegions="{ Region }"
+        sourceCoordinates="{ { 25, 50, 50 } }"
+        timeSourceFrequency="15"
+        receiverCoordinates="{ { 15, 45, 55 }, { 45, 55, 45 }, { 80, 30, 70 } }"
+        outputSeismoTrace="0"
+        dtSeismoTrace="0.01"
+        maxLocalTimeSteppingLevel="MAX_LEVEL"/>
+    </Solvers>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ X_COORDS }"
+        yCoords="{ 0, 100 }"
+        zCoords="{ 0, 100 }"
+        nx="{ NX }"
+        ny="{ 10 }"
+        nz="{ 10 }"
+        cellBlockNames="{ cb }"/>
+    </Mesh>
+    <Events
+      maxTime="0.2">
+      <PeriodicEvent
+        name="solverApplications"
+        forceDt="0.002"
+        target="/Solvers/elasticSolver"/>
+    </Events>
+    <NumericalMethods>
+      <FiniteElements>
+        <FiniteElementSpace
+          name="FE1"
+          order="1"
+          formulation="SEM"/>
+      </FiniteElements>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Region"
+        cellBlocks="{ cb }"
+        materialList="{ nullModel }"/>
+    </ElementRegions>
+    <Constitutive>
+      <NullModel
+        name="nullModel"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="initialDisplacementxN"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="displacementx_n"
+        scale="0.0"/>
+      <FieldSpecification
+        name="initialDisplacementyN"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="displacementy_n"
+        scale="0.0"/>
+      <FieldSpecification
+        name="initialDisplacementzN"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="displacementz_n"
+        scale="0.0"/>
+      <FieldSpecification
+        name="initialDisplacementxNm1"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="displacementx_nm1"
+        scale="0.0"/>
+      <FieldSpecification
+        name="initialDisplacementyNm1"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="displacementy_nm1"
+        scale="0.0"/>
+      <FieldSpecification
+        name="initialDisplacementzNm1"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="displacementz_nm1"
+        scale="0.0"/>
+      <FieldSpecification
+        name="cellVelocityVp"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="mediumVelocityVp"
+        scale="1500"
+        setNames="{ all }"/>
+      <FieldSpecification
+        name="cellVelocityVs"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="mediumVelocityVs"
+        scale="1060"
+        setNames="{ all }"/>
+      <FieldSpecification
+        name="cellDensity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="mediumDensity"
+        scale="1"
+        setNames="{ all }"/>
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+// Uniform mesh of 10 m cells
+char const * uniformXCoords = "0, 100";
+char const * uniformNx = "10";
+
+// Same mesh with a layer of 2.5 m cells between x = 40 and x = 50, which is at level 2
+char const * refinedXCoords = "0, 40, 50, 100";
+char const * refinedNx = "4, 4, 5";
+
+// Stable time step of the 10 m cells
+real64 constexpr coarseDt = 0.002;
+real64 constexpr maxTime = 0.2;
+
+enum class WaveEquation
+{
+  Acoustic,
+  Elastic
+};
+
+struct Traces
+{
+  /// Traces at the receivers of all the ranks, indexed by [time sample][receiver]
+  array2d< real32 > receivers;
+
+  /// Local time stepping level of the cells owned by the rank
+  std::vector< integer > cellLevels;
+};
+
+Traces runLocalTimeStepping( WaveEquation const equation,
+                             char const * const xCoords,
+                             char const * const nx,
+                             integer const maxLevel,
+                             real64 const dt )
+{
+  string input = equation == WaveEquation::Acoustic ? acousticXmlInput : elasticXmlInput;
+  replaceMarker( input, "X_COORDS", xCoords );
+  replaceMarker( input, "NX", nx );
+  replaceMarker( input, "MAX_LEVEL", std::to_string( maxLevel ) );
+
+  Traces traces;
+  auto readCellLevels = [&]( DomainPartition & domain )
+  {
+    if( maxLevel > 0 )
+    {
+      CellElementSubRegion const & subRegion =
+        domain.getMeshBody( 0 ).getBaseDiscretization().getElemManager().getRegion( "Region" ).getSubRegion< CellElementSubRegion >( "cb" );
+      arrayView1d< integer const > const elemLevel = subRegion.getField< fields::localTimeSteppingLevel >();
+      arrayView1d< integer const > const elemGhostRank = subRegion.ghostRank();
+      elemLevel.move( hostMemorySpace, false );
+      for( localIndex k = 0; k < elemLevel.size(); ++k )
+      {
+        if( elemGhostRank[k] < 0 )
+        {
+          traces.cellLevels.emplace_back( elemLevel[k] );
+        }
+      }
+    }
+  };
+  traces.receivers = equation == WaveEquation::Acoustic
+                   ? runAcoustic( g_commandLineOptions, input, maxTime, dt, readCellLevels )
+                   : runElastic( g_commandLineOptions, input, maxTime, dt, readCellLevels );
+  return traces;
+}
+
+void checkUniformMesh( WaveEquation const equation )
+{
+  Traces const global = runLocalTimeStepping( equation, uniformXCoords, uniformNx, 0, coarseDt );
+  Traces const lts = runLocalTimeStepping( equation, uniformXCoords, uniformNx, 2, coarseDt );
+
+  // all the cells have the same size, so there is a single level and the scheme reduces to the global leapfrog
+  for( integer const level : lts.cellLevels )
+  {
+    EXPECT_EQ( level, 0 );
+  }
+  // the results only differ by the round-off of the single precision updates
+  compareTraces( lts.receivers.toViewConst(), global.receivers.toViewConst(), 1e-5 );
+}
+
+void checkRefinedLayer( WaveEquation const equation )
+{
+  // the reference advances all the cells with the stable time step of the refined layer
+  Traces const global = runLocalTimeStepping( equation, refinedXCoords, refinedNx, 0, 0.25 * coarseDt );
+  Traces const lts = runLocalTimeStepping( equation, refinedXCoords, refinedNx, 2, coarseDt );
+
+  // the cells of the layer are at level 2, the other ones at level 0
+  integer numFineCells = 0;
+  for( integer const level : lts.cellLevels )
+  {
+    EXPECT_TRUE( level == 0 || level == 2 );
+    numFineCells += ( level == 2 ) ? 1 : 0;
+  }
+  EXPECT_EQ( MpiWrapper::sum( numFineCells ), 4 * 10 * 10 );
+
+  // the schemes are both second-order accurate, and only differ by the time step in the coarse cells
+  compareTraces( lts.receivers.toViewConst(), global.receivers.toViewConst(), 5e-2 );
+}
+
+TEST( WavePropagationLocalTimeStepping, uniformMeshMatchesGlobalTimeStep )
+{
+  checkUniformMesh( WaveEquation::Acoustic );
+}
+
+TEST( WavePropagationLocalTimeStepping, refinedLayerMatchesGlobalFineTimeStep )
+{
+  checkRefinedLayer( WaveEquation::Acoustic );
+}
+
+TEST( WavePropagationLocalTimeStepping, elasticUniformMeshMatchesGlobalTimeStep )
+{
+  checkUniformMesh( WaveEquation::Elastic );
+}
+
+TEST( WavePropagationLocalTimeStepping, elasticRefinedLayerMatchesGlobalFineTimeStep )
+{
+  checkRefinedLayer( WaveEquation::Elastic );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
@@ -0,0 +1,173 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "unitTests/wavePropagationTests/testWavePropagationUtils.hpp"
+
+#include "mainInterface/initialization.hpp"
+#include "physicsSolvers/wavePropagation/WaveSolverBase.hpp"
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// This unit test checks the accuracy of the geometric factors evaluated in WaveSolverBase::wsGeometryType by
+// comparing the traces computed on a mesh close to the origin with the ones computed on the same mesh translated
+// far away from it, where the single precision coordinates are large compared to the size of the cells.
+// The markers are replaced by the position of the mesh, of the source and of the receivers, and by the order of the elements.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <AcousticSEM
+        name="acousticSolver"
+        cflFactor="0.25"
+        discretization="FE1"
+        targetRegions="{ Region }"
+        sourceCoordinates="{ { SOURCE } }"
+        timeSourceFrequency="15"
+        receiverCoordinates="{ RECEIVERS }"
+        outputSeismoTrace="0"
+        dtSeismoTrace="0.01"/>
+    </Solvers>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ X_COORDS }"
+        yCoords="{ Y_COORDS }"
+        zCoords="{ Z_COORDS }"
+        nx="{ NX }"
+        ny="{ NY }"
+        nz="{ NZ }"
+        cellBlockNames="{ cb }"/>
+    </Mesh>
+    <Events
+      maxTime="0.2">
+      <PeriodicEvent
+        name="solverApplications"
+        forceDt="0.002"
+        target="/Solvers/acousticSolver"/>
+    </Events>
+    <NumericalMethods>
+      <FiniteElements>
+        <FiniteElementSpace
+          name="FE1"
+          order="ORDER"
+          formulation="SEM"/>
+      </FiniteElements>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Region"
+        cellBlocks="{ cb }"
+        materialList="{ nullModel }"/>
+    </ElementRegions>
+    <Constitutive>
+      <NullModel
+        name="nullModel"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="initialPressureN"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="pressure_n"
+        scale="0.0"/>
+      <FieldSpecification
+        name="initialPressureNm1"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="pressure_nm1"
+        scale="0.0"/>
+      <FieldSpecification
+        name="cellVelocity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="mediumVelocity"
+        scale="1500"
+        setNames="{ all }"/>
+      <FieldSpecification
+        name="cellDensity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="mediumDensity"
+        scale="1"
+        setNames="{ all }"/>
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+// Position of the translated mesh, for which the spacing of the single precision numbers is about 1e-3 m
+real64 constexpr farOffset = 1.0e4;
+real64 constexpr maxTime = 0.2;
+
+/// Pressure at the receivers, indexed by [time sample][receiver]
+array2d< real32 > runTranslated( real64 const offset,
+                                 integer const order,
+                                 integer const nx,
+                                 real64 const dt )
+{
+  auto const point = [offset]( real64 const x, real64 const y, real64 const z )
+  {
+    return GEOS_FMT( "{}, {}, {}", offset + x, offset + y, offset + z );
+  };
+  string const interval = GEOS_FMT( "{}, {}", offset, offset + 100.0 );
+
+  string input = xmlInput;
+  replaceMarker( input, "SOURCE", point( 25.0, 50.0, 50.0 ) );
+  replaceMarker( input, "RECEIVERS", GEOS_FMT( "{{ {} }}, {{ {} }}, {{ {} }}",
+                                               point( 15.0, 50.0, 50.0 ), point( 60.0, 45.0, 55.0 ), point( 80.0, 30.0, 70.0 ) ) );
+  replaceMarker( input, "X_COORDS", interval );
+  replaceMarker( input, "Y_COORDS", interval );
+  replaceMarker( input, "Z_COORDS", interval );
+  replaceMarker( input, "NX", std::to_string( nx ) );
+  replaceMarker( input, "NY", std::to_string( nx ) );
+  replaceMarker( input, "NZ", std::to_string( nx ) );
+  replaceMarker( input, "ORDER", std::to_string( order ) );
+
+  return runAcoustic( g_commandLineOptions, input, maxTime, dt );
+}
+
+TEST( WavePropagationMixedPrecision, translatedMeshQ1 )
+{
+  array2d< real32 > const reference = runTranslated( 0.0, 1, 10, 0.002 );
+  array2d< real32 > const translated = runTranslated( farOffset, 1, 10, 0.002 );
+
+  // the Jacobians are evaluated from the coordinates relative to the cell, so that only the
+  // rounding of the stored node coordinates (1e-4 of the cell size) affects the traces
+  compareTraces( translated.toViewConst(), reference.toViewConst(), 1e-3 );
+}
+
+TEST( WavePropagationMixedPrecision, translatedMeshQ3 )
+{
+  // the Gauss-Lobatto support points of the Q3 cells do not have round coordinates, and
+  // the stiffness term is more sensitive to the rounding of their relative positions
+  array2d< real32 > const reference = runTranslated( 0.0, 3, 5, 0.0005 );
+  array2d< real32 > const translated = runTranslated( farOffset, 3, 5, 0.0005 );
+
+  compareTraces( translated.toViewConst(), reference.toViewConst(), 1e-3 );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
@@ -0,0 +1,197 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "unitTests/wavePropagationTests/testWavePropagationUtils.hpp"
+
+#include "fileIO/Outputs/OutputBase.hpp"
+#include "mainInterface/initialization.hpp"
+
+#include <gtest/gtest.h>
+#include <hdf5.h>
+
+using namespace geos;
+using namespace geos::dataRepository;
+using namespace geos::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+// This unit test reads back the seismo traces written in the hdf5 file of the solver (outputSeismoTrace="2").
+// The marker is replaced by the coordinates of the receivers of each case.
+char const * xmlInput =
+  R"xml(
+  <Problem>
+    <Solvers>
+      <AcousticSEM
+        name="acousticSolver"
+        cflFactor="0.25"
+        discretization="FE1"
+        targetRegions="{ Region }"
+        sourceCoordinates="{ { 25, 50, 50 } }"
+        timeSourceFrequency="15"
+        receiverCoordinates="{ RECEIVERS }"
+        outputSeismoTrace="2"
+        seismoTraceCompressionLevel="4"
+        dtSeismoTrace="0.01"/>
+    </Solvers>
+    <Mesh>
+      <InternalMesh
+        name="mesh"
+        elementTypes="{ C3D8 }"
+        xCoords="{ 0, 100 }"
+        yCoords="{ 0, 100 }"
+        zCoords="{ 0, 100 }"
+        nx="{ 10 }"
+        ny="{ 10 }"
+        nz="{ 10 }"
+        cellBlockNames="{ cb }"/>
+    </Mesh>
+    <Events
+      maxTime="0.1">
+      <PeriodicEvent
+        name="solverApplications"
+        forceDt="0.002"
+        target="/Solvers/acousticSolver"/>
+    </Events>
+    <NumericalMethods>
+      <FiniteElements>
+        <FiniteElementSpace
+          name="FE1"
+          order="1"
+          formulation="SEM"/>
+      </FiniteElements>
+    </NumericalMethods>
+    <ElementRegions>
+      <CellElementRegion
+        name="Region"
+        cellBlocks="{ cb }"
+        materialList="{ nullModel }"/>
+    </ElementRegions>
+    <Constitutive>
+      <NullModel
+        name="nullModel"/>
+    </Constitutive>
+    <FieldSpecifications>
+      <FieldSpecification
+        name="initialPressureN"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="pressure_n"
+        scale="0.0"/>
+      <FieldSpecification
+        name="initialPressureNm1"
+        initialCondition="1"
+        setNames="{ all }"
+        objectPath="nodeManager"
+        fieldName="pressure_nm1"
+        scale="0.0"/>
+      <FieldSpecification
+        name="cellVelocity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="mediumVelocity"
+        scale="1500"
+        setNames="{ all }"/>
+      <FieldSpecification
+        name="cellDensity"
+        initialCondition="1"
+        objectPath="ElementRegions/Region/cb"
+        fieldName="mediumDensity"
+        scale="1"
+        setNames="{ all }"/>
+    </FieldSpecifications>
+  </Problem>
+  )xml";
+
+real64 constexpr dt = 0.002;
+real64 constexpr maxTime = 0.1;
+
+/// Run the solver and return the pressure at the receivers, indexed by [time sample][receiver]
+array2d< real32 > runWithReceivers( string const & receivers )
+{
+  string input = xmlInput;
+  replaceMarker( input, "RECEIVERS", receivers );
+  return runAcoustic( g_commandLineOptions, input, maxTime, dt );
+}
+
+/// Read back the traces of the shot and check each row against the trace of the receiver given by the receiver index dataset
+void checkTraceFile( arrayView2d< real32 const > const & pressure )
+{
+  localIndex const numSamples = pressure.size( 0 );
+  localIndex const numReceivers = pressure.size( 1 );
+  string const datasetName = GEOS_FMT( "{}_shot{:06}", AcousticWaveEquationSEM::viewKeyStruct::pressureNp1AtReceiversString(), 0 );
+  string const fileName = joinPath( OutputBase::getOutputDirectory(), "acousticSolver_seismoTraces.hdf5" );
+
+  hid_t file = H5Fopen( fileName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+  ASSERT_GE( file, 0 );
+
+  // the traces are stored as [write][receiver][time sample], with a single write
+  hid_t traceDataset = H5Dopen( file, datasetName.c_str(), H5P_DEFAULT );
+  hid_t traceSpace = H5Dget_space( traceDataset );
+  ASSERT_EQ( H5Sget_simple_extent_ndims( traceSpace ), 3 );
+  hsize_t traceDims[3] = { 0, 0, 0 };
+  H5Sget_simple_extent_dims( traceSpace, traceDims, nullptr );
+  EXPECT_EQ( traceDims[0], hsize_t( 1 ) );
+  // a previous run with more receivers must not leave rows behind
+  ASSERT_EQ( traceDims[1], LvArray::integerConversion< hsize_t >( numReceivers ) );
+  ASSERT_EQ( traceDims[2], LvArray::integerConversion< hsize_t >( numSamples ) );
+  std::vector< real32 > traces( numReceivers * numSamples );
+  H5Dread( traceDataset, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, traces.data() );
+  H5Sclose( traceSpace );
+  H5Dclose( traceDataset );
+
+  hid_t indexDataset = H5Dopen( file, ( datasetName + "_receiverIndex" ).c_str(), H5P_DEFAULT );
+  std::vector< long long > receiverIndex( numReceivers );
+  H5Dread( indexDataset, H5T_NATIVE_LLONG, H5S_ALL, H5S_ALL, H5P_DEFAULT, receiverIndex.data() );
+  H5Dclose( indexDataset );
+  H5Fclose( file );
+
+  std::vector< integer > rowsPerReceiver( numReceivers, 0 );
+  for( localIndex row = 0; row < numReceivers; ++row )
+  {
+    localIndex const ircv = LvArray::integerConversion< localIndex >( receiverIndex[row] );
+    ASSERT_GE( ircv, 0 );
+    ASSERT_LT( ircv, numReceivers );
+    ++rowsPerReceiver[ircv];
+    for( localIndex iSample = 0; iSample < numSamples; ++iSample )
+    {
+      EXPECT_EQ( traces[row * numSamples + iSample], pressure[iSample][ircv] ) << "row " << row << ", sample " << iSample;
+    }
+  }
+  // each receiver is written exactly once
+  for( integer const count : rowsPerReceiver )
+  {
+    EXPECT_EQ( count, 1 );
+  }
+}
+
+TEST( WavePropagationSeismoTraceOutput, rowsMatchReceiverIndex )
+{
+  array2d< real32 > const pressure =
+    runWithReceivers( "{ 15, 50, 50 }, { 45, 50, 50 }, { 80, 50, 50 }, { 60, 30, 70 }" );
+  checkTraceFile( pressure.toViewConst() );
+
+  // the file is truncated at setup: rerunning with fewer receivers does not keep the rows of the first run
+  array2d< real32 > const fewerReceiversPressure = runWithReceivers( "{ 45, 50, 50 }, { 15, 50, 50 }" );
+  checkTraceFile( fewerReceiversPressure.toViewConst() );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geos::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geos::basicCleanup();
+  return result;
+}
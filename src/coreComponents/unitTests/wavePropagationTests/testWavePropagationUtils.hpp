@@ -0,0 +1,206 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 TotalEnergies
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#ifndef GEOS_TESTWAVEPROPAGATIONUTILS_HPP
+#define GEOS_TESTWAVEPROPAGATIONUTILS_HPP
+
+// using some utility classes from the following unit test
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+#include "common/DataTypes.hpp"
+#include "common/MpiWrapper.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/wavePropagation/AcousticWaveEquationSEM.hpp"
+#include "physicsSolvers/wavePropagation/ElasticWaveEquationSEM.hpp"
+
+#include <gtest/gtest.h>
+
+namespace geos
+{
+
+namespace testing
+{
+
+/**
+ * @brief Replace the first occurrence of a marker of an xml input.
+ * @param[inout] input the xml input
+ * @param[in] marker the marker to replace
+ * @param[in] value the replacement value
+ */
+void replaceMarker( string & input, string const & marker, string const & value )
+{
+  input.replace( input.find( marker ), marker.size(), value );
+}
+
+/**
+ * @brief Run a wave propagation solver of an xml input with a fixed time step.
+ * @tparam SOLVER the type of the solver
+ * @tparam LAMBDA the type of the function called on the domain at the end of the run
+ * @param[in] commandLineOptions the command line options of the test
+ * @param[in] xmlInput the xml input of the problem
+ * @param[in] solverName the name of the solver
+ * @param[in] receiverKeys the keys of the receiver arrays of the solver
+ * @param[in] maxTime the end time of the run
+ * @param[in] dt the time step
+ * @param[in] inspectDomain function called on the domain after the cleanup of the solver
+ * @return the traces of all the ranks, indexed by [time sample][receiver], with the receiver arrays side by side
+ */
+template< typename SOLVER, typename LAMBDA >
+array2d< real32 > runSolver( CommandLineOptions const & commandLineOptions,
+                             string const & xmlInput,
+                             string const & solverName,
+                             std::vector< string > const & receiverKeys,
+                             real64 const maxTime,
+                             real64 const dt,
+                             LAMBDA && inspectDomain )
+{
+  GeosxState state( std::make_unique< CommandLineOptions >( commandLineOptions ) );
+  setupProblemFromXML( state.getProblemManager(), xmlInput.c_str() );
+
+  DomainPartition & domain = state.getProblemManager().getDomainPartition();
+  SOLVER & propagator = state.getProblemManager().getPhysicsSolverManager().getGroup< SOLVER >( solverName );
+
+  integer const numSteps = static_cast< integer >( std::round( maxTime / dt ) );
+  real64 time_n = 0.0;
+  for( integer i = 0; i < numSteps; ++i )
+  {
+    propagator.explicitStepForward( time_n, dt, i, domain, false );
+    time_n += dt;
+  }
+  // cleanup (triggers calculation of the remaining seismograms data points, and writes the trace files)
+  propagator.cleanup( maxTime, numSteps, 0, 0, domain );
+
+  array2d< real32 > localTraces;
+  for( std::size_t k = 0; k < receiverKeys.size(); ++k )
+  {
+    arrayView2d< real32 const > const receivers = propagator.template getReference< array2d< real32 > >( receiverKeys[k] ).toViewConst();
+    receivers.move( hostMemorySpace, false );
+    localIndex const numReceivers = receivers.size( 1 );
+    localTraces.resize( receivers.size( 0 ), numReceivers * receiverKeys.size() );
+    for( localIndex i = 0; i < receivers.size( 0 ); ++i )
+    {
+      for( localIndex r = 0; r < numReceivers; ++r )
+      {
+        localTraces[i][k * numReceivers + r] = receivers[i][r];
+      }
+    }
+  }
+
+  // each receiver is only recorded by the rank owning it, the other ranks hold zeros
+  array2d< real32 > traces( localTraces.size( 0 ), localTraces.size( 1 ) );
+  MpiWrapper::sum( Span< real32 const >( localTraces.data(), localTraces.size() ),
+                   Span< real32 >( traces.data(), traces.size() ) );
+
+  inspectDomain( domain );
+  return traces;
+}
+
+/**
+ * @brief Run the solver named "acousticSolver" of an xml input with a fixed time step.
+ * @tparam LAMBDA the type of the function called on the domain at the end of the run
+ * @param[in] commandLineOptions the command line options of the test
+ * @param[in] xmlInput the xml input of the problem
+ * @param[in] maxTime the end time of the run
+ * @param[in] dt the time step
+ * @param[in] inspectDomain function called on the domain after the cleanup of the solver
+ * @return the pressure at the receivers, indexed by [time sample][receiver]
+ */
+template< typename LAMBDA >
+array2d< real32 > runAcoustic( CommandLineOptions const & commandLineOptions,
+                               string const & xmlInput,
+                               real64 const maxTime,
+                               real64 const dt,
+                               LAMBDA && inspectDomain )
+{
+  return runSolver< AcousticWaveEquationSEM >( commandLineOptions, xmlInput, "acousticSolver",
+                                               { AcousticWaveEquationSEM::viewKeyStruct::pressureNp1AtReceiversString() },
+                                               maxTime, dt, std::forward< LAMBDA >( inspectDomain ) );
+}
+
+/**
+ * @brief Run the solver named "acousticSolver" of an xml input with a fixed time step.
+ * @param[in] commandLineOptions the command line options of the test
+ * @param[in] xmlInput the xml input of the problem
+ * @param[in] maxTime the end time of the run
+ * @param[in] dt the time step
+ * @return the pressure at the receivers, indexed by [time sample][receiver]
+ */
+array2d< real32 > runAcoustic( CommandLineOptions const & commandLineOptions,
+                               string const & xmlInput,
+                               real64 const maxTime,
+                               real64 const dt )
+{
+  return runAcoustic( commandLineOptions, xmlInput, maxTime, dt, []( DomainPartition & ){} );
+}
+
+/**
+ * @brief Run the solver named "elasticSolver" of an xml input with a fixed time step.
+ * @tparam LAMBDA the type of the function called on the domain at the end of the run
+ * @param[in] commandLineOptions the command line options of the test
+ * @param[in] xmlInput the xml input of the problem
+ * @param[in] maxTime the end time of the run
+ * @param[in] dt the time step
+ * @param[in] inspectDomain function called on the domain after the cleanup of the solver
+ * @return the x, y and z displacements at the receivers side by side, indexed by [time sample][component * numReceivers + receiver]
+ */
+template< typename LAMBDA >
+array2d< real32 > runElastic( CommandLineOptions const & commandLineOptions,
+                              string const & xmlInput,
+                              real64 const maxTime,
+                              real64 const dt,
+                              LAMBDA && inspectDomain )
+{
+  return runSolver< ElasticWaveEquationSEM >( commandLineOptions, xmlInput, "elasticSolver",
+                                              { ElasticWaveEquationSEM::viewKeyStruct::displacementXNp1AtReceiversString(),
+                                                ElasticWaveEquationSEM::viewKeyStruct::displacementYNp1AtReceiversString(),
+                                                ElasticWaveEquationSEM::viewKeyStruct::displacementZNp1AtReceiversString() },
+                                              maxTime, dt, std::forward< LAMBDA >( inspectDomain ) );
+}
+
+/**
+ * @brief Compare the traces receiver by receiver, relative to the largest amplitude of the reference trace of the receiver.
+ * @param[in] traces the traces to check, indexed by [time sample][receiver]
+ * @param[in] reference the reference traces
+ * @param[in] relTol the tolerance, relative to the largest amplitude of each reference trace
+ */
+void compareTraces( arrayView2d< real32 const > const & traces,
+                    arrayView2d< real32 const > const & reference,
+                    real64 const relTol )
+{
+  ASSERT_EQ( traces.size( 0 ), reference.size( 0 ) );
+  ASSERT_EQ( traces.size( 1 ), reference.size( 1 ) );
+  for( localIndex r = 0; r < reference.size( 1 ); ++r )
+  {
+    real64 maxAmplitude = 0.0;
+    for( localIndex i = 0; i < reference.size( 0 ); ++i )
+    {
+      maxAmplitude = LvArray::math::max( maxAmplitude, LvArray::math::abs( static_cast< real64 >( reference[i][r] ) ) );
+    }
+    // make sure the wave has reached the receiver, so that the comparison is meaningful
+    ASSERT_GT( maxAmplitude, 0.0 );
+    for( localIndex i = 0; i < reference.size( 0 ); ++i )
+    {
+      EXPECT_NEAR( traces[i][r], reference[i][r], relTol * maxAmplitude ) << "receiver " << r << ", sample " << i;
+    }
+  }
+}
+
+} // namespace testing
+
+} // namespace geos
+
+#endif //GEOS_TESTWAVEPROPAGATIONUTILS_HPP
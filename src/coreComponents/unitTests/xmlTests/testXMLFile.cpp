@@ -25,6 +25,7 @@
 #include <gtest/gtest.h>
 #include <conduit.hpp>
 #include <algorithm>
+#include <functional>
 
 using namespace geos;
 using namespace geos::dataRepository;
@@ -225,6 +226,40 @@ TEST( testXML, testXMLFileLines )
                                      << stringutilities::join( notExpected, "," ) << "}";
 }
 
+// Tests if the document read on the first rank and broadcast contains all the includes,
+// and if the node positions can still be retrieved from the original buffers on all ranks.
+TEST( testXML, testXMLFileBroadcast )
+{
+  ProblemManager & problemManager = getGlobalState().getProblemManager();
+  problemManager.parseCommandLineInput();
+  Group & commandLine = problemManager.getGroup( problemManager.groupKeys.commandLine );
+  string const & inputFileName = commandLine.getReference< string >( problemManager.viewKeys.inputFileName );
+
+  xmlDocument xmlDoc;
+  xmlResult const result = xmlDoc.loadFileAndBroadcast( inputFileName, true );
+  ASSERT_TRUE( result );
+
+  xmlDocument refDoc;
+  refDoc.loadFile( inputFileName, true );
+  EXPECT_EQ( xmlDoc.getFilePath(), refDoc.getFilePath() );
+  EXPECT_EQ( xmlDoc.getOriginalBuffer(), refDoc.getOriginalBuffer() );
+
+  // All includes must have been resolved, and their buffers loaded
+  std::function< void( xmlNode const & ) > checkNode = [&]( xmlNode const & node )
+  {
+    EXPECT_TRUE( node.child( includedListTag ).empty() );
+    EXPECT_TRUE( xmlDoc.getNodePosition( node ).isFound() ) << node.path();
+    for( xmlNode const & subNode : node.children() )
+    {
+      if( subNode.type() == xmlNodeType::node_element )
+      {
+        checkNode( subNode );
+      }
+    }
+  };
+  checkNode( xmlDoc.getFirstChild() );
+}
+
 
 int main( int argc, char * * argv )
 {
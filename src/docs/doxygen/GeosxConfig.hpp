@@ -110,6 +110,9 @@
 /// USE OF SEPARATION COEFFICIENT IN FRACTURE FLOW
 #define GEOSX_USE_SEPARATION_COEFFICIENT
 
+/// Evaluates the geometric factors of the wave solver kernels in double precision (CMake option ENABLE_WAVE_SOLVER_DOUBLE_PRECISION_GEOMETRY)
+#define GEOSX_USE_WAVE_SOLVER_DOUBLE_PRECISION_GEOMETRY
+
 /// CMake option CMAKE_BUILD_TYPE
 #define GEOSX_CMAKE_BUILD_TYPE "Release"
 